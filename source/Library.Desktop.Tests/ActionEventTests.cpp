@@ -16,6 +16,7 @@
 #include "Factory.h"
 #include "GameObject.h"
 #include "GameTime.h"
+#include "CountingResource.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace UnitTests;
@@ -325,6 +326,39 @@ public:
 		GameState::GetEventQueue().Clear();
 	}
 
+	TEST_METHOD(PayloadCopyAllocations)
+	{
+		CountingResource counting;
+		size_t copyAllocations = 0;
+		size_t datumAllocations = 0;
+
+		MemoryResource* previous = SetDefaultResource(&counting);
+		{
+			EventMessageAttributed payload("Test"s);
+			payload.Append("target"s) = "A"s;
+			payload.Append("incrementAmount"s) = 2;
+			payload.Append("scale"s) = 1.5f;
+			payload.Append("direction"s) = vec4(1, 0, 0, 0);
+
+			size_t before = counting.Allocations;
+			EventMessageAttributed copy(payload);
+			copyAllocations = counting.Allocations - before;
+			Assert::IsTrue(copy == payload);
+
+			before = counting.Allocations;
+			for (const auto& key : { "incrementAmount"s, "scale"s, "direction"s }) {
+				Datum datumCopy(payload.At(key));
+				UNREFERENCED_LOCAL(datumCopy);
+			}
+			datumAllocations = counting.Allocations - before;
+		}
+		SetDefaultResource(previous);
+
+		Assert::IsTrue(copyAllocations > 0);
+		Assert::AreEqual(size_t(0), datumAllocations);
+		Assert::AreEqual(size_t(0), counting.Outstanding);
+	}
+
 	TEST_METHOD(GetSetSubtype)
 	{
 		{
@@ -0,0 +1,615 @@
+/// <summary>
+/// Benchmarks comparing container configurations. Each benchmark reports its measurements through the test Logger and asserts only on the relationships between them, never on absolute timings.
+/// </summary>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "HashMap.h"
+#include "ConcurrentHashMap.h"
+#include "DefaultHash.h"
+#include "Scope.h"
+#include "Vector.h"
+#include "MpscQueue.h"
+#include "DatumMath.h"
+#include "GameObject.h"
+#include "Factory.h"
+#include "CountingResource.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+using namespace FIEAGameEngine;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(BenchmarkTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(ScopeStoredHashComparisons)
+		{
+			const size_t attributeCount = 2000;
+			Vector<std::string> keys(attributeCount);
+			Vector<std::string> missingKeys(attributeCount);
+			for (size_t i = 0; i < attributeCount; ++i) {
+				keys.PushBack("attribute"s + std::to_string(i));
+				missingKeys.PushBack("missing"s + std::to_string(i));
+			}
+
+			for (double maxLoadFactor : { 0.0, 1.0 }) {
+				const size_t plainComparisons = CountComparisons<DefaultHash<std::string>>(keys, missingKeys, maxLoadFactor);
+				const size_t storedComparisons = CountComparisons<StoredHash<DefaultHash<std::string>>>(keys, missingKeys, maxLoadFactor);
+
+				std::stringstream report;
+				report << "HashMap<std::string, Datum> with " << attributeCount << " attributes, max load factor " << maxLoadFactor
+					<< ": " << plainComparisons << " key comparisons plain, " << storedComparisons << " with stored hashes\n";
+				Logger::WriteMessage(report.str().c_str());
+
+				Assert::IsTrue(storedComparisons <= plainComparisons);
+				Assert::IsTrue(storedComparisons >= attributeCount);
+			}
+
+			Scope scope;
+			auto start = std::chrono::steady_clock::now();
+			for (const std::string& key : keys) {
+				scope.Append(key) = static_cast<int>(scope.Size());
+			}
+			for (size_t i = 0; i < attributeCount; ++i) {
+				Assert::IsNotNull(scope.Find(keys[i]));
+				Assert::IsNull(scope.Find(missingKeys[i]));
+			}
+			auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+			std::stringstream report;
+			report << "Scope with " << attributeCount << " attributes: appends and lookups took " << elapsed.count() << "us\n";
+			Logger::WriteMessage(report.str().c_str());
+		}
+
+		TEST_METHOD(ConcurrentLookupScaling)
+		{
+			const size_t keyCount = 4096;
+			Vector<std::string> keys(keyCount);
+			ConcurrentHashMap<std::string, int> shardedMap;
+			HashMap<std::string, int> lockedMap;
+			std::mutex mapMutex;
+			for (size_t i = 0; i < keyCount; ++i) {
+				keys.PushBack("type"s + std::to_string(i));
+				shardedMap.TryEmplace(keys[i], static_cast<int>(i));
+				lockedMap.TryEmplace(keys[i], static_cast<int>(i));
+			}
+
+			const size_t maxThreads = std::max(size_t(1), static_cast<size_t>(std::thread::hardware_concurrency()));
+			for (size_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+				const double shardedRate = MeasureLookups(keys, threadCount, [&shardedMap](const std::string& key) { return shardedMap.Find(key) != nullptr; });
+				const double lockedRate = MeasureLookups(keys, threadCount, [&lockedMap, &mapMutex](const std::string& key) { std::lock_guard<std::mutex> lock(mapMutex); return lockedMap.ContainsKey(key); });
+
+				std::stringstream report;
+				report << threadCount << " threads looking up " << keyCount << " keys: " << shardedRate << " lookups/ms in a " << shardedMap.Shards()
+					<< " shard ConcurrentHashMap, " << lockedRate << " lookups/ms in a HashMap behind one mutex\n";
+				Logger::WriteMessage(report.str().c_str());
+			}
+		}
+
+		TEST_METHOD(VectorAlgorithms)
+		{
+			const size_t valueCount = size_t(1) << 16;
+			Vector<int> values(valueCount);
+			std::uint32_t state = 12345u;
+			for (size_t i = 0; i < valueCount; ++i) {
+				state = state * 1664525u + 1013904223u;
+				values.PushBack(static_cast<int>(state >> 8));
+			}
+
+			Vector<int> iteratorValues(values);
+			Vector<int> pointerValues(values);
+			const int missing = -1;
+			const auto isEven = [](int value) { return (value % 2) == 0; };
+
+			auto [iteratorFind, iteratorFound] = TimeAlgorithm([&iteratorValues, missing]() { return std::find(iteratorValues.begin(), iteratorValues.end(), missing) - iteratorValues.begin(); });
+			auto [pointerFind, pointerFound] = TimeAlgorithm([&pointerValues, missing]() { return std::find(pointerValues.Data(), pointerValues.Data() + pointerValues.Size(), missing) - pointerValues.Data(); });
+			Assert::AreEqual(iteratorFound, pointerFound);
+			Assert::AreEqual(static_cast<std::ptrdiff_t>(valueCount), iteratorFound);
+
+			auto [iteratorPartition, iteratorEvens] = TimeAlgorithm([&iteratorValues, &isEven]() { return std::partition(iteratorValues.begin(), iteratorValues.end(), isEven) - iteratorValues.begin(); });
+			auto [pointerPartition, pointerEvens] = TimeAlgorithm([&pointerValues, &isEven]() { return std::partition(pointerValues.Data(), pointerValues.Data() + pointerValues.Size(), isEven) - pointerValues.Data(); });
+			Assert::AreEqual(iteratorEvens, pointerEvens);
+
+			auto [iteratorSort, iteratorSorted] = TimeAlgorithm([&iteratorValues]() { std::sort(iteratorValues.begin(), iteratorValues.end()); return std::is_sorted(iteratorValues.begin(), iteratorValues.end()); });
+			auto [pointerSort, pointerSorted] = TimeAlgorithm([&pointerValues]() { std::sort(pointerValues.AsSpan().begin(), pointerValues.AsSpan().end()); return std::is_sorted(pointerValues.Data(), pointerValues.Data() + pointerValues.Size()); });
+			Assert::IsTrue(iteratorSorted && pointerSorted);
+			Assert::IsTrue(std::equal(iteratorValues.cbegin(), iteratorValues.cend(), pointerValues.cbegin()));
+
+			std::stringstream report;
+#ifdef USE_CHECKED_ITERATORS
+			report << "Checked";
+#else
+			report << "Unchecked";
+#endif // USE_CHECKED_ITERATORS
+			report << " Vector<int>::Iterator vs raw pointers over " << valueCount << " ints: find " << iteratorFind << "us vs " << pointerFind
+				<< "us, partition " << iteratorPartition << "us vs " << pointerPartition << "us, sort " << iteratorSort << "us vs " << pointerSort << "us\n";
+			Logger::WriteMessage(report.str().c_str());
+		}
+
+		TEST_METHOD(MpscQueueThroughput)
+		{
+			const size_t valuesPerProducer = 100000;
+			const size_t maxProducers = std::max(size_t(2), static_cast<size_t>(std::thread::hardware_concurrency())) - 1;
+
+			std::stringstream report;
+			report << "Handing " << valuesPerProducer << " ints per producer to one consumer:\n";
+			for (size_t producerCount = 1; producerCount <= maxProducers; producerCount *= 2) {
+				MpscQueue<size_t> queue;
+				const double queueRate = MeasureHandoff(producerCount, valuesPerProducer,
+					[&queue](size_t value) { queue.Push(value); },
+					[&queue](size_t& sum) { return queue.Drain([&sum](size_t&& value) { sum += value; }); });
+
+				Vector<size_t> lockedValues;
+				Vector<size_t> drainedValues;
+				std::mutex valuesMutex;
+				const double lockedRate = MeasureHandoff(producerCount, valuesPerProducer,
+					[&lockedValues, &valuesMutex](size_t value) { std::lock_guard<std::mutex> lock(valuesMutex); lockedValues.PushBack(value); },
+					[&lockedValues, &drainedValues, &valuesMutex](size_t& sum) {
+						{
+							std::lock_guard<std::mutex> lock(valuesMutex);
+							std::swap(lockedValues, drainedValues);
+						}
+						for (size_t value : drainedValues) sum += value;
+						const size_t drained = drainedValues.Size();
+						drainedValues.Clear();
+						return drained;
+					});
+
+				report << "  " << producerCount << " producers: " << queueRate << " values/ms through an MpscQueue vs " << lockedRate << " values/ms through a mutex guarded Vector\n";
+			}
+			Logger::WriteMessage(report.str().c_str());
+		}
+
+		TEST_METHOD(VectorGrowthPolicies)
+		{
+			const size_t valueCount = size_t(1) << 18;
+
+			std::stringstream report;
+			report << "Pushing back " << valueCount << " ints (Vector<int> is " << sizeof(Vector<int>) << " bytes, Vector<int, RuntimeGrowth> is " << sizeof(Vector<int, RuntimeGrowth>) << " bytes):\n";
+			MeasureGrowth<DefaultGrowth>("DefaultGrowth", valueCount, report);
+			MeasureGrowth<RuntimeGrowth>("RuntimeGrowth", valueCount, report);
+			MeasureGrowth<DoublingGrowth>("DoublingGrowth", valueCount, report);
+			MeasureGrowth<FixedGrowth<4096>>("FixedGrowth<4096>", valueCount, report);
+			MeasureGrowth<PageRoundedGrowth<>>("PageRoundedGrowth", valueCount, report);
+			Logger::WriteMessage(report.str().c_str());
+
+			Assert::AreEqual(sizeof(Vector<int>), sizeof(Vector<int, DoublingGrowth>));
+			Assert::IsTrue(sizeof(Vector<int>) < sizeof(Vector<int, RuntimeGrowth>));
+		}
+
+		TEST_METHOD(DatumMathKernels)
+		{
+			const size_t vectorCount = size_t(1) << 17;
+			const size_t matrixCount = size_t(1) << 14;
+			const glm::mat4 transform = glm::mat4(0.0f, 1.0f, 0.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 3.0f, -2.0f, 1.0f, 1.0f);
+
+			Datum sourceVectors(Datum::DatumTypes::Vector);
+			sourceVectors.Reserve(vectorCount);
+			Datum lhsMatrices(Datum::DatumTypes::Matrix);
+			Datum rhsMatrices(Datum::DatumTypes::Matrix);
+			lhsMatrices.Reserve(matrixCount);
+			rhsMatrices.Reserve(matrixCount);
+			for (size_t i = 0; i < vectorCount; ++i) {
+				const float value = static_cast<float>(i % 1024);
+				sourceVectors.PushBack(glm::vec4(value, value * 0.5f, -value, 1.0f));
+			}
+			for (size_t i = 0; i < matrixCount; ++i) {
+				const float value = static_cast<float>(i % 64) * 0.125f;
+				lhsMatrices.PushBack(glm::mat4(value) + transform);
+				rhsMatrices.PushBack(transform * value);
+			}
+
+			Datum expectedVectors = sourceVectors;
+			const long long glmTransform = MeasureKernel([&expectedVectors, &sourceVectors]() { expectedVectors = sourceVectors; },
+				[&expectedVectors, &transform]() { for (glm::vec4& vector : expectedVectors.AsSpan<glm::vec4>()) vector = transform * vector; });
+			Datum expectedMatrices(Datum::DatumTypes::Matrix);
+			expectedMatrices.Resize(matrixCount);
+			const long long glmMultiply = MeasureKernel([]() {},
+				[&expectedMatrices, &lhsMatrices, &rhsMatrices]() {
+					auto products = expectedMatrices.AsSpan<glm::mat4>();
+					auto lhs = lhsMatrices.AsSpan<glm::mat4>();
+					auto rhs = rhsMatrices.AsSpan<glm::mat4>();
+					for (size_t i = 0; i < products.size(); ++i) products[i] = lhs[i] * rhs[i];
+				});
+
+			std::stringstream report;
+			report << "Transforming " << vectorCount << " vectors and multiplying " << matrixCount << " matrix pairs: glm loops take " << glmTransform << "us and " << glmMultiply << "us\n";
+			const DatumMath::InstructionSet original = DatumMath::ActiveInstructionSet();
+			for (auto [instructionSet, name] : { std::pair{ DatumMath::InstructionSet::Scalar, "Scalar" }, std::pair{ DatumMath::InstructionSet::SSE2, "SSE2" }, std::pair{ DatumMath::InstructionSet::AVX2, "AVX2" } }) {
+				if (!DatumMath::IsSupported(instructionSet)) continue;
+				DatumMath::SetInstructionSet(instructionSet);
+
+				Datum vectors;
+				const long long transformTime = MeasureKernel([&vectors, &sourceVectors]() { vectors = sourceVectors; },
+					[&vectors, &transform]() { DatumMath::Transform(vectors, transform); });
+				Datum matrices;
+				const long long multiplyTime = MeasureKernel([]() {},
+					[&matrices, &lhsMatrices, &rhsMatrices]() { DatumMath::Multiply(lhsMatrices, rhsMatrices, matrices); });
+
+				Assert::IsTrue(expectedVectors == vectors);
+				AssertMatricesNear(expectedMatrices, matrices);
+				report << "  " << name << " kernels: " << transformTime << "us and " << multiplyTime << "us\n";
+			}
+			DatumMath::SetInstructionSet(original);
+			Logger::WriteMessage(report.str().c_str());
+		}
+
+		TEST_METHOD(DatumStringConversions)
+		{
+			const size_t valueCount = size_t(1) << 15;
+			Datum floats(Datum::DatumTypes::Float);
+			Datum vectors(Datum::DatumTypes::Vector);
+			floats.Reserve(valueCount);
+			vectors.Reserve(valueCount);
+			for (size_t i = 0; i < valueCount; ++i) {
+				const float value = static_cast<float>(i) * 0.37f - 1000.0f;
+				floats.PushBack(value);
+				vectors.PushBack(glm::vec4(value, -value, value * 0.5f, 1.0f));
+			}
+
+			size_t characters = 0;
+			const long long floatToString = MeasureKernel([&characters]() { characters = 0; }, [&floats, &characters]() {
+				for (size_t i = 0; i < floats.Size(); ++i) characters += std::to_string(floats.GetAsFloat(i)).size();
+			});
+			const size_t toStringCharacters = characters;
+			std::string buffer;
+			const long long floatAppend = MeasureKernel([&characters]() { characters = 0; }, [&floats, &characters, &buffer]() {
+				for (size_t i = 0; i < floats.Size(); ++i) {
+					buffer.clear();
+					floats.AppendToString(buffer, i);
+					characters += buffer.size();
+				}
+			});
+			Assert::AreEqual(toStringCharacters, characters);
+
+			const long long vectorToString = MeasureKernel([&characters]() { characters = 0; }, [&vectors, &characters]() {
+				for (size_t i = 0; i < vectors.Size(); ++i) characters += glm::to_string(vectors.GetAsVector(i)).size();
+			});
+			const long long vectorAppend = MeasureKernel([&characters]() { characters = 0; }, [&vectors, &characters, &buffer]() {
+				for (size_t i = 0; i < vectors.Size(); ++i) {
+					buffer.clear();
+					vectors.AppendToString(buffer, i, Datum::StringFormat::Exact);
+					characters += buffer.size();
+				}
+			});
+
+			Vector<std::string> floatText(valueCount);
+			Vector<std::string> vectorText(valueCount);
+			for (size_t i = 0; i < valueCount; ++i) {
+				floatText.PushBack(floats.ToString(i, Datum::StringFormat::Exact));
+				vectorText.PushBack(vectors.ToString(i, Datum::StringFormat::Exact));
+			}
+			Datum parsedFloats(Datum::DatumTypes::Float);
+			Datum parsedVectors(Datum::DatumTypes::Vector);
+			parsedFloats.Resize(valueCount);
+			parsedVectors.Resize(valueCount);
+			const long long floatStof = MeasureKernel([]() {}, [&floatText, &parsedFloats]() {
+				for (size_t i = 0; i < floatText.Size(); ++i) parsedFloats.Set(std::stof(floatText[i]), i);
+			});
+			const long long floatParse = MeasureKernel([]() {}, [&floatText, &parsedFloats]() {
+				for (size_t i = 0; i < floatText.Size(); ++i) parsedFloats.SetFromString(floatText[i], i);
+			});
+			const long long vectorParse = MeasureKernel([]() {}, [&vectorText, &parsedVectors]() {
+				for (size_t i = 0; i < vectorText.Size(); ++i) parsedVectors.SetFromString(vectorText[i], i);
+			});
+			Assert::IsTrue(floats == parsedFloats);
+			Assert::IsTrue(vectors == parsedVectors);
+
+			std::stringstream report;
+			report << "Converting " << valueCount << " values: floats to text " << floatToString << "us through std::to_string vs " << floatAppend << "us through AppendToString, vectors "
+				<< vectorToString << "us through glm::to_string vs " << vectorAppend << "us exactly through AppendToString; reading floats back " << floatStof << "us through std::stof vs "
+				<< floatParse << "us through SetFromString, and vectors " << vectorParse << "us\n";
+			Logger::WriteMessage(report.str().c_str());
+		}
+
+		TEST_METHOD(DatumSearch)
+		{
+			const size_t elementsPerMeasurement = size_t(1) << 20;
+			const DatumMath::InstructionSet original = DatumMath::ActiveInstructionSet();
+
+			std::stringstream report;
+			report << "Searching Datums for their last element, in us per " << elementsPerMeasurement << " elements scanned (scalar loop, then each instruction set):\n";
+			for (size_t size = size_t(1) << 10; size <= elementsPerMeasurement; size <<= 5) {
+				const size_t repeats = elementsPerMeasurement / size;
+				Datum integers(Datum::DatumTypes::Integer);
+				Datum floats(Datum::DatumTypes::Float);
+				Datum vectors(Datum::DatumTypes::Vector);
+				Vector<const void*> addresses(size);
+				integers.Reserve(size);
+				floats.Reserve(size);
+				vectors.Reserve(size);
+				for (size_t i = 0; i < size; ++i) {
+					integers.PushBack(static_cast<std::int32_t>(i));
+					floats.PushBack(static_cast<float>(i));
+					vectors.PushBack(glm::vec4(static_cast<float>(i)));
+				}
+				for (const std::int32_t& integer : integers.AsSpan<std::int32_t>()) {
+					addresses.PushBack(&integer);
+				}
+				const std::int32_t lastInteger = integers.BackAsInt();
+				const float lastFloat = floats.BackAsFloat();
+				const glm::vec4 lastVector = vectors.BackAsVector();
+				const void* lastAddress = addresses.Back();
+				const gsl::span<const void* const> addressSpan(addresses.Data(), addresses.Size());
+
+				size_t found = 0;
+				const long long scalarIntegers = MeasureKernel([]() {}, [&integers, &found, lastInteger, repeats]() {
+					auto values = integers.AsSpan<std::int32_t>();
+					for (size_t r = 0; r < repeats; ++r) found += std::find(values.begin(), values.end(), lastInteger) - values.begin();
+				});
+				const long long scalarAddresses = MeasureKernel([]() {}, [&addresses, &found, lastAddress, repeats]() {
+					for (size_t r = 0; r < repeats; ++r) found += std::find(addresses.Data(), addresses.Data() + addresses.Size(), lastAddress) - addresses.Data();
+				});
+				report << "  " << size << " elements: int " << scalarIntegers << "us, Scope* " << scalarAddresses << "us";
+
+				for (auto [instructionSet, name] : { std::pair{ DatumMath::InstructionSet::Scalar, "Scalar" }, std::pair{ DatumMath::InstructionSet::SSE2, "SSE2" }, std::pair{ DatumMath::InstructionSet::AVX2, "AVX2" } }) {
+					if (!DatumMath::IsSupported(instructionSet)) continue;
+					DatumMath::SetInstructionSet(instructionSet);
+					const long long integerTime = MeasureKernel([]() {}, [&integers, &found, lastInteger, repeats]() { for (size_t r = 0; r < repeats; ++r) found += integers.FindIndex(lastInteger); });
+					const long long floatTime = MeasureKernel([]() {}, [&floats, &found, lastFloat, repeats]() { for (size_t r = 0; r < repeats; ++r) found += floats.FindIndex(lastFloat); });
+					const long long vectorTime = MeasureKernel([]() {}, [&vectors, &found, &lastVector, repeats]() { for (size_t r = 0; r < repeats; ++r) found += vectors.FindIndex(lastVector); });
+					const long long addressTime = MeasureKernel([]() {}, [&addressSpan, &found, lastAddress, repeats]() { for (size_t r = 0; r < repeats; ++r) found += DatumMath::FindAddress(addressSpan, lastAddress); });
+					report << "; " << name << " int " << integerTime << "us, float " << floatTime << "us, vec4 " << vectorTime << "us, Scope* " << addressTime << "us";
+
+					Assert::AreEqual(size - 1, integers.FindIndex(lastInteger));
+					Assert::AreEqual(size - 1, floats.FindIndex(lastFloat));
+					Assert::AreEqual(size - 1, vectors.FindIndex(lastVector));
+					Assert::AreEqual(size - 1, DatumMath::FindAddress(addressSpan, lastAddress));
+				}
+				report << "\n";
+				Assert::AreNotEqual(size_t(0), found);
+			}
+			DatumMath::SetInstructionSet(original);
+			Logger::WriteMessage(report.str().c_str());
+		}
+
+		TEST_METHOD(SceneMemoryReport)
+		{
+			const size_t gameObjectCount = 100000;
+			Factory<Scope>::Clear();
+			TypeManager::Clear();
+			RegisterType<GameObject>();
+			Factory<Scope>::Add(make_unique<GameObjectFactory>());
+
+			CountingResource counting;
+			size_t datumCount = 0;
+			size_t resourceBytes = 0;
+			size_t childCount = 0;
+
+			MemoryResource* previous = SetDefaultResource(&counting);
+			{
+				GameObject root;
+				size_t before = counting.OutstandingBytes;
+				for (size_t i = 0; i < gameObjectCount; ++i) {
+					root.CreateChild("GameObject"s, "child"s);
+				}
+				resourceBytes = counting.OutstandingBytes - before;
+
+				Datum& children = root.At("children"s);
+				childCount = children.Size();
+				for (size_t i = 0; i < childCount; ++i) {
+					datumCount += children.GetAsTable(i).Size();
+				}
+			}
+			SetDefaultResource(previous);
+
+			//the GameObjects themselves come from their factory's new, so only their attributes, chains, and node pools go through the resource
+			const size_t objectBytes = gameObjectCount * sizeof(GameObject);
+			std::stringstream report;
+			report << "A scene of " << gameObjectCount << " GameObjects holds " << datumCount << " Datums of " << sizeof(Datum) << " bytes each ("
+				<< (datumCount * sizeof(Datum)) / 1024 << " KiB of Datums); " << resourceBytes / 1024 << " KiB, node pools included, were obtained through the default resource and "
+				<< objectBytes / 1024 << " KiB of GameObjects from the heap, " << (resourceBytes + objectBytes) / gameObjectCount << " bytes per GameObject in all.\n";
+			Logger::WriteMessage(report.str().c_str());
+
+			Assert::AreEqual(gameObjectCount, childCount);
+			Assert::IsTrue(resourceBytes >= gameObjectCount * sizeof(NodePool));
+			Assert::AreEqual(size_t(0), counting.Outstanding);
+
+			Factory<Scope>::Clear();
+			TypeManager::Clear();
+		}
+
+	private:
+		/// <summary>
+		/// Runs a kernel several times, resetting its inputs before each run without timing the reset, and reports the fastest run in microseconds.
+		/// </summary>
+		template <typename TReset, typename TKernel>
+		static long long MeasureKernel(TReset reset, TKernel kernel) {
+			const size_t passes = 5;
+			long long fastest = std::numeric_limits<long long>::max();
+			for (size_t pass = 0; pass < passes; ++pass) {
+				reset();
+				auto start = std::chrono::steady_clock::now();
+				kernel();
+				auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+				fastest = std::min(fastest, static_cast<long long>(elapsed.count()));
+			}
+			return fastest;
+		}
+
+		/// <summary>
+		/// Asserts two Matrix Datums hold the same matrices, allowing for the rounding differences fused multiply-adds introduce.
+		/// </summary>
+		static void AssertMatricesNear(const Datum& expected, const Datum& actual) {
+			Assert::AreEqual(expected.Size(), actual.Size());
+			for (size_t i = 0; i < expected.Size(); ++i) {
+				for (glm::length_t column = 0; column < 4; ++column) {
+					for (glm::length_t row = 0; row < 4; ++row) {
+						const float value = expected.GetAsMatrix(i)[column][row];
+						Assert::AreEqual(value, actual.GetAsMatrix(i)[column][row], 1e-4f * std::max(1.0f, std::abs(value)));
+					}
+				}
+			}
+		}
+
+		/// <summary>
+		/// Runs an algorithm once and reports how long it took in microseconds, along with its result.
+		/// </summary>
+		template <typename TAlgorithm>
+		static std::pair<long long, std::invoke_result_t<TAlgorithm&>> TimeAlgorithm(TAlgorithm algorithm) {
+			auto start = std::chrono::steady_clock::now();
+			auto result = algorithm();
+			auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+			return { static_cast<long long>(elapsed.count()), result };
+		}
+
+		/// <summary>
+		/// Fills a Vector with the given growth policy one PushBack at a time, and reports how long it took, how many times it reallocated, and how much of its final capacity is unused.
+		/// </summary>
+		template <typename TGrowth>
+		static void MeasureGrowth(const char* name, size_t valueCount, std::stringstream& report) {
+			const size_t passes = 10;
+			size_t reallocations = 0;
+			size_t capacity = 0;
+			{
+				Vector<int, TGrowth> warmUp;
+				for (size_t i = 0; i < valueCount; ++i) {
+					warmUp.PushBack(static_cast<int>(i));
+				}
+			}
+
+			auto start = std::chrono::steady_clock::now();
+			for (size_t pass = 0; pass < passes; ++pass) {
+				Vector<int, TGrowth> values;
+				reallocations = 0;
+				for (size_t i = 0; i < valueCount; ++i) {
+					if (values.Size() == values.Capacity()) ++reallocations;
+					values.PushBack(static_cast<int>(i));
+				}
+				capacity = values.Capacity();
+				Assert::AreEqual(valueCount, values.Size());
+			}
+			auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+			const double slack = 100.0 * static_cast<double>(capacity - valueCount) / static_cast<double>(capacity);
+			report << "  " << name << ": " << (elapsed.count() / static_cast<long long>(passes)) << "us per fill, " << reallocations << " reallocations, capacity "
+				<< capacity << " (" << slack << "% slack)\n";
+		}
+
+		/// <summary>
+		/// Pushes valuesPerProducer values from each of the given number of producer threads while the calling thread drains them, and reports the combined throughput.
+		/// </summary>
+		template <typename TPush, typename TDrain>
+		static double MeasureHandoff(size_t producerCount, size_t valuesPerProducer, TPush push, TDrain drain) {
+			std::atomic<size_t> finishedProducers{ 0 };
+			size_t sum = 0;
+			size_t consumed = 0;
+
+			auto start = std::chrono::steady_clock::now();
+			{
+				Vector<std::thread> producers(producerCount);
+				for (size_t p = 0; p < producerCount; ++p) {
+					producers.PushBack(std::thread([&push, &finishedProducers, valuesPerProducer]() {
+						for (size_t i = 0; i < valuesPerProducer; ++i) {
+							push(i);
+						}
+						++finishedProducers;
+					}));
+				}
+				while (finishedProducers.load() < producerCount) {
+					consumed += drain(sum);
+				}
+				for (std::thread& producer : producers) {
+					producer.join();
+				}
+				consumed += drain(sum);
+			}
+			auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+
+			Assert::AreEqual(producerCount * valuesPerProducer, consumed);
+			Assert::AreEqual(producerCount * (valuesPerProducer * (valuesPerProducer - 1) / 2), sum);
+			return consumed / std::max(elapsed.count(), 0.001);
+		}
+
+		/// <summary>
+		/// Runs the given lookup over every key from each of the given number of threads at once, and reports the combined throughput.
+		/// </summary>
+		template <typename TLookup>
+		static double MeasureLookups(const Vector<std::string>& keys, size_t threadCount, TLookup lookup) {
+			const size_t passes = 25;
+			std::atomic<size_t> found{ 0 };
+
+			auto start = std::chrono::steady_clock::now();
+			{
+				Vector<std::thread> threads(threadCount);
+				for (size_t t = 0; t < threadCount; ++t) {
+					threads.PushBack(std::thread([&keys, &found, &lookup, t]() {
+						size_t localFound = 0;
+						for (size_t pass = 0; pass < passes; ++pass) {
+							for (size_t i = 0; i < keys.Size(); ++i) {
+								if (lookup(keys[(i + t * 97) % keys.Size()])) ++localFound;
+							}
+						}
+						found += localFound;
+					}));
+				}
+				for (std::thread& thread : threads) {
+					thread.join();
+				}
+			}
+			auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+
+			Assert::AreEqual(threadCount * passes * keys.Size(), found.load());
+			return (threadCount * passes * keys.Size()) / std::max(elapsed.count(), 0.001);
+		}
+
+		/// <summary>
+		/// Fills a HashMap with Datums at the given keys and counts the key comparisons made while looking each of them up, along with an equal number of missing keys.
+		/// </summary>
+		template <typename THashFunctor>
+		static size_t CountComparisons(const Vector<std::string>& keys, const Vector<std::string>& missingKeys, double maxLoadFactor) {
+			size_t comparisons = 0;
+			auto countingEquality = [&comparisons](const std::string& lhs, const std::string& rhs) { ++comparisons; return lhs == rhs; };
+
+			HashMap<std::string, Datum, THashFunctor, decltype(countingEquality)> attributes(size_t(13), countingEquality);
+			attributes.SetMaxLoadFactor(maxLoadFactor);
+			for (const std::string& key : keys) {
+				attributes.Insert({ key, Datum() });
+			}
+
+			comparisons = 0;
+			for (const std::string& key : keys) {
+				Assert::IsTrue(attributes.ContainsKey(key));
+			}
+			for (const std::string& key : missingKeys) {
+				Assert::IsFalse(attributes.ContainsKey(key));
+			}
+			return comparisons;
+		}
+
+		inline static _CrtMemState _startMemState;
+	};
+}
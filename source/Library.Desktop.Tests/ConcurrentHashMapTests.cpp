@@ -0,0 +1,347 @@
+/// <summary>
+/// Unit tests exercising the functionality of ConcurrentHashMap, both from a single thread and shared between several.
+/// </summary>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Foo.h"
+#include "ToStringSpecializations.h"
+#include "ConcurrentHashMap.h"
+#include <atomic>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+using namespace FIEAGameEngine;
+using namespace std;
+using namespace std::string_literals;
+
+namespace FIEAGameEngine {
+	template<>
+	struct DefaultEquality<const Foo> final {
+		bool operator()(const Foo& lhs, const Foo& rhs) const {
+			return lhs == rhs;
+		}
+	};
+
+	template<>
+	inline std::size_t DefaultHash<Foo>::operator()(const Foo& key) const {
+		const std::size_t hashPrime = 11;
+		return key.Data() * hashPrime;
+	}
+}
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(ConcurrentHashMapTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Constructors)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			{
+				ConcurrentHashMap<Foo, int> hashMap;
+				Assert::AreEqual(size_t(16), hashMap.Shards());
+				Assert::AreEqual(size_t(0), hashMap.Size());
+				Assert::IsTrue(hashMap.IsEmpty());
+			}
+			{
+				ConcurrentHashMap<Foo, int, DefaultHash<Foo>, DefaultEquality<const Foo>, 4> hashMap{ { a, a.Data() }, { b, b.Data() }, { a, 0 } };
+				Assert::AreEqual(size_t(4), hashMap.Shards());
+				Assert::AreEqual(size_t(2), hashMap.Size());
+				Assert::IsFalse(hashMap.IsEmpty());
+				Assert::AreEqual(a.Data(), hashMap.At(a));
+				Assert::AreEqual(b.Data(), hashMap.At(b));
+			}
+			{
+				ConcurrentHashMap<int, int, DefaultHash<int>, DefaultEquality<const int>, 1> hashMap{ { 1, 1 }, { 2, 2 } };
+				Assert::AreEqual(size_t(2), hashMap.Size());
+				Assert::AreEqual(2, hashMap.At(2));
+			}
+		}
+
+		TEST_METHOD(InsertAndFind)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			const Foo c{ 30 };
+			ConcurrentHashMap<Foo, int> hashMap;
+
+			auto [data, inserted] = hashMap.Insert({ a, a.Data() });
+			Assert::IsTrue(inserted);
+			Assert::AreEqual(a.Data(), *data);
+
+			std::pair<const Foo, int> bPair{ b, b.Data() };
+			std::tie(data, inserted) = hashMap.Insert(std::move(bPair));
+			Assert::IsTrue(inserted);
+			Assert::AreEqual(b.Data(), *data);
+
+			std::tie(data, inserted) = hashMap.Insert({ a, 0 });
+			Assert::IsFalse(inserted);
+			Assert::AreEqual(a.Data(), *data);
+			Assert::AreEqual(size_t(2), hashMap.Size());
+
+			Assert::IsTrue(hashMap.ContainsKey(a));
+			Assert::IsFalse(hashMap.ContainsKey(c));
+			Assert::IsNull(hashMap.Find(c));
+			Assert::AreEqual(static_cast<int*>(data), hashMap.Find(a));
+			*hashMap.Find(b) = 200;
+			Assert::AreEqual(200, hashMap.At(b));
+			hashMap.At(b) = b.Data();
+
+			const ConcurrentHashMap<Foo, int>& constHashMap = hashMap;
+			Assert::AreEqual(b.Data(), *constHashMap.Find(b));
+			Assert::IsNull(constHashMap.Find(c));
+			Assert::AreEqual(a.Data(), constHashMap.At(a));
+			Assert::ExpectException<std::runtime_error>([&hashMap, &c]() { auto& value = hashMap.At(c); UNREFERENCED_LOCAL(value); });
+			Assert::ExpectException<std::runtime_error>([&constHashMap, &c]() { auto& value = constHashMap.At(c); UNREFERENCED_LOCAL(value); });
+
+			for (int i = 0; i < 1000; ++i) {
+				hashMap.Insert({ Foo(i + 100), i });
+			}
+			Assert::AreEqual(data, hashMap.Find(a));
+			Assert::AreEqual(a.Data(), *data);
+			Assert::AreEqual(size_t(1002), hashMap.Size());
+		}
+
+		TEST_METHOD(TryEmplaceAndInsertOrAssign)
+		{
+			ConcurrentHashMap<std::string, std::string> hashMap;
+			std::string value = "Health";
+
+			auto [data, inserted] = hashMap.TryEmplace("hp"s, std::move(value));
+			Assert::IsTrue(inserted);
+			Assert::AreEqual("Health"s, *data);
+
+			value = "Armor";
+			std::tie(data, inserted) = hashMap.TryEmplace("hp"s, std::move(value));
+			Assert::IsFalse(inserted);
+			Assert::AreEqual("Health"s, *data);
+			Assert::AreEqual("Armor"s, value);
+
+			const std::string key = "ap";
+			std::tie(data, inserted) = hashMap.TryEmplace(key, size_t(3), 'x');
+			Assert::IsTrue(inserted);
+			Assert::AreEqual("xxx"s, *data);
+
+			std::tie(data, inserted) = hashMap.InsertOrAssign(key, "yyy"s);
+			Assert::IsFalse(inserted);
+			Assert::AreEqual("yyy"s, hashMap.At(key));
+
+			std::tie(data, inserted) = hashMap.InsertOrAssign("mp"s, "Mana"s);
+			Assert::IsTrue(inserted);
+			Assert::AreEqual("Mana"s, *data);
+			Assert::AreEqual(size_t(3), hashMap.Size());
+		}
+
+		TEST_METHOD(HeterogeneousLookup)
+		{
+			ConcurrentHashMap<std::string, int> hashMap;
+			for (int i = 0; i < 50; ++i) {
+				Assert::IsTrue(hashMap.TryEmplace("key"s + std::to_string(i), i).second);
+			}
+
+			const std::string_view key = "key17"sv;
+			Assert::IsTrue(hashMap.ContainsKey(key));
+			Assert::IsTrue(hashMap.ContainsKey("key42"));
+			Assert::IsFalse(hashMap.ContainsKey("key50"sv));
+			Assert::AreEqual(17, hashMap.At(key));
+			Assert::AreEqual(42, *hashMap.Find("key42"));
+			Assert::IsNull(hashMap.Find("missing"sv));
+			Assert::ExpectException<std::runtime_error>([&hashMap]() { auto& value = hashMap.At("missing"); UNREFERENCED_LOCAL(value); });
+
+			const ConcurrentHashMap<std::string, int>& constHashMap = hashMap;
+			Assert::AreEqual(17, constHashMap.At(key));
+			Assert::AreEqual(3, *constHashMap.Find("key3"sv));
+
+			Assert::IsFalse(hashMap.TryEmplace("key3"sv, 0).second);
+			Assert::IsTrue(hashMap.TryEmplace("key50"sv, 50).second);
+			Assert::IsFalse(hashMap.InsertOrAssign("key50", 500).second);
+			Assert::AreEqual(500, hashMap.At("key50"s));
+
+			Assert::IsTrue(hashMap.Remove("key17"sv));
+			Assert::IsFalse(hashMap.Remove("key17"));
+			Assert::IsFalse(hashMap.ContainsKey(key));
+			Assert::AreEqual(size_t(50), hashMap.Size());
+		}
+
+		TEST_METHOD(RemoveAndClear)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			ConcurrentHashMap<Foo, int> hashMap{ { a, a.Data() }, { b, b.Data() } };
+
+			Assert::IsTrue(hashMap.Remove(a));
+			Assert::IsFalse(hashMap.Remove(a));
+			Assert::IsFalse(hashMap.ContainsKey(a));
+			Assert::IsTrue(hashMap.ContainsKey(b));
+			Assert::AreEqual(size_t(1), hashMap.Size());
+
+			for (int i = 0; i < 100; ++i) {
+				hashMap.Insert({ Foo(i + 100), i });
+			}
+			Assert::AreEqual(size_t(101), hashMap.Size());
+			hashMap.Clear();
+			Assert::AreEqual(size_t(0), hashMap.Size());
+			Assert::IsTrue(hashMap.IsEmpty());
+			Assert::IsFalse(hashMap.ContainsKey(b));
+		}
+
+		TEST_METHOD(VisitAndForEach)
+		{
+			ConcurrentHashMap<int, int> hashMap;
+			for (int i = 0; i < 100; ++i) {
+				hashMap.Insert({ i, i });
+			}
+
+			Assert::IsTrue(hashMap.Visit(5, [](int& value) { value *= 10; }));
+			Assert::IsFalse(hashMap.Visit(100, [](int&) { Assert::Fail(); }));
+			Assert::AreEqual(50, hashMap.At(5));
+
+			const ConcurrentHashMap<int, int>& constHashMap = hashMap;
+			int visited = 0;
+			Assert::IsTrue(constHashMap.Visit(5, [&visited](const int& value) { visited = value; }));
+			Assert::IsFalse(constHashMap.Visit(-1, [](const int&) { Assert::Fail(); }));
+			Assert::AreEqual(50, visited);
+
+			int keySum = 0;
+			int valueSum = 0;
+			size_t count = 0;
+			hashMap.ForEach([&](const std::pair<const int, int>& entry) { keySum += entry.first; valueSum += entry.second; ++count; });
+			Assert::AreEqual(size_t(100), count);
+			Assert::AreEqual(4950, keySum);
+			Assert::AreEqual(4950 + 45, valueSum);
+		}
+
+#ifdef USE_HASHMAP_STATISTICS
+		TEST_METHOD(Statistics)
+		{
+			ConcurrentHashMap<int, int, DefaultHash<int>, DefaultEquality<const int>, 4> hashMap;
+			for (int i = 0; i < 100; ++i) {
+				hashMap.Insert({ i, i });
+			}
+			for (int i = 0; i < 200; ++i) {
+				UNREFERENCED_LOCAL(hashMap.ContainsKey(i));
+			}
+
+			HashMapStatistics statistics = hashMap.GetStatistics();
+			Assert::AreEqual(size_t(100), statistics.Population);
+			Assert::AreEqual(size_t(100), statistics.InsertCount);
+			Assert::AreEqual(size_t(300), statistics.FindCount);
+			Assert::IsTrue(statistics.BucketCount >= 4 * 13);
+			Assert::IsTrue(statistics.LongestChain >= 1);
+			Assert::IsTrue(statistics.MemoryFootprint >= sizeof(hashMap));
+
+			size_t chains = 0;
+			for (size_t count : statistics.ChainLengthHistogram) {
+				chains += count;
+			}
+			Assert::AreEqual(statistics.BucketCount, chains);
+
+			hashMap.ResetStatistics();
+			statistics = hashMap.GetStatistics();
+			Assert::AreEqual(size_t(0), statistics.FindCount);
+			Assert::AreEqual(size_t(100), statistics.Population);
+		}
+#endif // USE_HASHMAP_STATISTICS
+
+		TEST_METHOD(ConcurrentInsertAndFind)
+		{
+			const int threadCount = 8;
+			const int keysPerThread = 2000;
+			ConcurrentHashMap<std::string, int> hashMap;
+			std::atomic<int> missing{ 0 };
+
+			{
+				Vector<std::thread> threads(threadCount * 2);
+				for (int t = 0; t < threadCount; ++t) {
+					threads.PushBack(std::thread([&hashMap, t]() {
+						for (int i = 0; i < keysPerThread; ++i) {
+							int value = t * keysPerThread + i;
+							hashMap.TryEmplace("key"s + std::to_string(value), value);
+						}
+					}));
+					threads.PushBack(std::thread([&hashMap, &missing, t]() {
+						for (int i = 0; i < keysPerThread; ++i) {
+							int value = ((t + 1) % threadCount) * keysPerThread + i;
+							const int* found = hashMap.Find("key"s + std::to_string(value));
+							if (found != nullptr && *found != value) ++missing;
+						}
+					}));
+				}
+				for (std::thread& thread : threads) {
+					thread.join();
+				}
+			}
+
+			Assert::AreEqual(0, missing.load());
+			Assert::AreEqual(size_t(threadCount * keysPerThread), hashMap.Size());
+			for (int value = 0; value < threadCount * keysPerThread; ++value) {
+				Assert::AreEqual(value, hashMap.At("key"s + std::to_string(value)));
+			}
+		}
+
+		TEST_METHOD(ConcurrentVisitAndRemove)
+		{
+			const int threadCount = 8;
+			const int incrementsPerThread = 5000;
+			const int counterCount = 16;
+			ConcurrentHashMap<int, int> hashMap;
+			for (int i = 0; i < counterCount; ++i) {
+				hashMap.Insert({ i, 0 });
+			}
+
+			{
+				Vector<std::thread> threads(threadCount + 1);
+				for (int t = 0; t < threadCount; ++t) {
+					threads.PushBack(std::thread([&hashMap]() {
+						for (int i = 0; i < incrementsPerThread; ++i) {
+							hashMap.Visit(i % counterCount, [](int& value) { ++value; });
+						}
+					}));
+				}
+				threads.PushBack(std::thread([&hashMap]() {
+					for (int i = 0; i < incrementsPerThread; ++i) {
+						hashMap.InsertOrAssign(counterCount + i % 32, i);
+						hashMap.Remove(counterCount + (i + 16) % 32);
+					}
+				}));
+				for (std::thread& thread : threads) {
+					thread.join();
+				}
+			}
+
+			int total = 0;
+			for (int i = 0; i < counterCount; ++i) {
+				total += hashMap.At(i);
+			}
+			Assert::AreEqual(threadCount * incrementsPerThread, total);
+			Assert::IsTrue(hashMap.Size() >= size_t(counterCount));
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
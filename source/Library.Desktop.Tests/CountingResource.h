@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include "MemoryResource.h"
+
+namespace UnitTests
+{
+	/// <summary>
+	/// A resource that forwards to the heap resource and counts the blocks and bytes it hands out.
+	/// </summary>
+	class CountingResource final : public FIEAGameEngine::MemoryResource {
+	public:
+		std::size_t Allocations{ 0 };
+		std::size_t Deallocations{ 0 };
+		std::size_t Outstanding{ 0 };
+		std::size_t OutstandingBytes{ 0 };
+
+	private:
+		void* DoAllocate(std::size_t bytes, std::size_t alignment) override {
+			++Allocations;
+			++Outstanding;
+			OutstandingBytes += bytes;
+			return FIEAGameEngine::HeapResource()->Allocate(bytes, alignment);
+		}
+
+		void DoDeallocate(void* block, std::size_t bytes, std::size_t alignment) override {
+			++Deallocations;
+			--Outstanding;
+			OutstandingBytes -= bytes;
+			FIEAGameEngine::HeapResource()->Deallocate(block, bytes, alignment);
+		}
+	};
+}
@@ -0,0 +1,318 @@
+/// <summary>
+/// Unit tests exercising the DatumMath kernels, checking every supported instruction set against the same math done one element at a time with glm.
+/// </summary>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "ToStringSpecializations.h"
+#include "DatumMath.h"
+#include <cmath>
+#include <limits>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+using namespace FIEAGameEngine;
+using namespace std;
+using namespace glm;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(DatumMathTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(InstructionSets)
+		{
+			Assert::IsTrue(DatumMath::IsSupported(DatumMath::InstructionSet::Scalar));
+			Assert::IsTrue(DatumMath::IsSupported(DatumMath::ActiveInstructionSet()));
+
+			const DatumMath::InstructionSet original = DatumMath::SetInstructionSet(DatumMath::InstructionSet::Scalar);
+			Assert::IsTrue(DatumMath::ActiveInstructionSet() == DatumMath::InstructionSet::Scalar);
+			DatumMath::SetInstructionSet(DatumMath::InstructionSet::AVX2);
+			Assert::IsTrue(DatumMath::ActiveInstructionSet() == original);
+			if (!DatumMath::IsSupported(DatumMath::InstructionSet::AVX2)) {
+				Assert::IsTrue(DatumMath::ActiveInstructionSet() != DatumMath::InstructionSet::AVX2);
+			}
+		}
+
+		TEST_METHOD(Transform)
+		{
+			const mat4 matrix = TestMatrix(1.0f);
+			ForEachInstructionSet([&matrix](size_t count) {
+				Datum vectors = TestVectors(count, 1.0f);
+				Datum expected = TestVectors(count, 1.0f);
+				for (size_t i = 0; i < count; ++i) {
+					expected.Set(matrix * expected.GetAsVector(i), i);
+				}
+
+				DatumMath::Transform(vectors, matrix);
+				AssertNear(expected, vectors);
+			});
+
+			vec4 external[] = { vec4(1, 2, 3, 1) };
+			Datum externalDatum;
+			externalDatum.SetStorage(external, 1);
+			DatumMath::Transform(externalDatum, mat4(2.0f));
+			Assert::IsTrue(vec4(2, 4, 6, 2) == external[0]);
+
+			Datum empty(Datum::DatumTypes::Vector);
+			DatumMath::Transform(empty, matrix);
+			Assert::IsTrue(empty.IsEmpty());
+
+			Datum floats = { 1.0f };
+			Assert::ExpectException<runtime_error>([&floats, &matrix] { DatumMath::Transform(floats, matrix); });
+		}
+
+		TEST_METHOD(MultiplyByMatrix)
+		{
+			const mat4 lhs = TestMatrix(2.0f);
+			ForEachInstructionSet([&lhs](size_t count) {
+				Datum matrices = TestMatrices(count, 1.0f);
+				Datum expected = TestMatrices(count, 1.0f);
+				for (size_t i = 0; i < count; ++i) {
+					expected.Set(lhs * expected.GetAsMatrix(i), i);
+				}
+
+				DatumMath::Multiply(lhs, matrices);
+				AssertNear(expected, matrices);
+			});
+
+			Datum vectors = { vec4(1) };
+			Assert::ExpectException<runtime_error>([&vectors, &lhs] { DatumMath::Multiply(lhs, vectors); });
+		}
+
+		TEST_METHOD(MultiplyPairwise)
+		{
+			ForEachInstructionSet([](size_t count) {
+				const Datum lhs = TestMatrices(count, 1.0f);
+				const Datum rhs = TestMatrices(count, 3.0f);
+				Datum expected(Datum::DatumTypes::Matrix);
+				for (size_t i = 0; i < count; ++i) {
+					expected.PushBack(lhs.GetAsMatrix(i) * rhs.GetAsMatrix(i));
+				}
+
+				Datum result;
+				DatumMath::Multiply(lhs, rhs, result);
+				Assert::AreEqual(count, result.Size());
+				AssertNear(expected, result);
+
+				Datum inPlaceLeft = lhs;
+				DatumMath::Multiply(inPlaceLeft, rhs, inPlaceLeft);
+				AssertNear(expected, inPlaceLeft);
+
+				Datum inPlaceRight = rhs;
+				DatumMath::Multiply(lhs, inPlaceRight, inPlaceRight);
+				AssertNear(expected, inPlaceRight);
+			});
+
+			const Datum lhs = TestMatrices(2, 1.0f);
+			const Datum rhs = TestMatrices(3, 1.0f);
+			Datum result;
+			Assert::ExpectException<runtime_error>([&lhs, &rhs, &result] { DatumMath::Multiply(lhs, rhs, result); });
+
+			Datum shrinking = TestMatrices(5, 1.0f);
+			DatumMath::Multiply(lhs, lhs, shrinking);
+			Assert::AreEqual(size_t(2), shrinking.Size());
+
+			mat4 external[1];
+			Datum externalResult;
+			externalResult.SetStorage(external, 1);
+			Assert::ExpectException<runtime_error>([&lhs, &externalResult] { DatumMath::Multiply(lhs, lhs, externalResult); });
+
+			Datum wrongType = { vec4(1) };
+			Assert::ExpectException<runtime_error>([&lhs, &wrongType] { DatumMath::Multiply(lhs, lhs, wrongType); });
+		}
+
+		TEST_METHOD(AddScaleLerp)
+		{
+			ForEachInstructionSet([](size_t count) {
+				Datum vectors = TestVectors(count, 1.0f);
+				const Datum addends = TestVectors(count, 5.0f);
+				Datum expected = TestVectors(count, 1.0f);
+				for (size_t i = 0; i < count; ++i) {
+					expected.Set(((expected.GetAsVector(i) + addends.GetAsVector(i)) * 0.5f), i);
+					expected.Set(expected.GetAsVector(i) + (addends.GetAsVector(i) - expected.GetAsVector(i)) * 0.25f, i);
+				}
+
+				DatumMath::Add(vectors, addends);
+				DatumMath::Scale(vectors, 0.5f);
+				DatumMath::Lerp(vectors, addends, 0.25f);
+				AssertNear(expected, vectors);
+
+				Datum floats(Datum::DatumTypes::Float);
+				Datum floatTargets(Datum::DatumTypes::Float);
+				for (size_t i = 0; i < count * 3; ++i) {
+					floats.PushBack(static_cast<float>(i));
+					floatTargets.PushBack(static_cast<float>(i) * 2.0f + 1.0f);
+				}
+				DatumMath::Lerp(floats, floatTargets, 0.5f);
+				DatumMath::Scale(floats, 2.0f);
+				for (size_t i = 0; i < floats.Size(); ++i) {
+					Assert::AreEqual(static_cast<float>(i) * 3.0f + 1.0f, floats.GetAsFloat(i), 1e-4f);
+				}
+
+				Datum matrices = TestMatrices(count, 1.0f);
+				DatumMath::Add(matrices, TestMatrices(count, 1.0f));
+				Datum doubled = TestMatrices(count, 1.0f);
+				DatumMath::Scale(doubled, 2.0f);
+				AssertNear(doubled, matrices);
+			});
+
+			Datum vectors = TestVectors(3, 1.0f);
+			Datum shorter = TestVectors(2, 1.0f);
+			Datum floats = { 1.0f, 2.0f, 3.0f };
+			Datum strings = { "a"s };
+			Assert::ExpectException<runtime_error>([&vectors, &shorter] { DatumMath::Add(vectors, shorter); });
+			Assert::ExpectException<runtime_error>([&vectors, &floats] { DatumMath::Lerp(vectors, floats, 0.5f); });
+			Assert::ExpectException<runtime_error>([&strings] { DatumMath::Scale(strings, 2.0f); });
+			Assert::ExpectException<runtime_error>([&strings] { DatumMath::Add(strings, strings); });
+		}
+
+		TEST_METHOD(MinMax)
+		{
+			ForEachInstructionSet([](size_t count) {
+				if (count == 0) return;
+				const Datum vectors = TestVectors(count, 1.0f);
+				vec4 minimum = vectors.GetAsVector(0);
+				vec4 maximum = vectors.GetAsVector(0);
+				for (size_t i = 1; i < count; ++i) {
+					minimum = glm::min(minimum, vectors.GetAsVector(i));
+					maximum = glm::max(maximum, vectors.GetAsVector(i));
+				}
+
+				Assert::IsTrue(minimum == DatumMath::Min(vectors));
+				Assert::IsTrue(maximum == DatumMath::Max(vectors));
+			});
+
+			const Datum empty(Datum::DatumTypes::Vector);
+			const Datum floats = { 1.0f };
+			Assert::ExpectException<runtime_error>([&empty] { auto result = DatumMath::Min(empty); UNREFERENCED_LOCAL(result); });
+			Assert::ExpectException<runtime_error>([&empty] { auto result = DatumMath::Max(empty); UNREFERENCED_LOCAL(result); });
+			Assert::ExpectException<runtime_error>([&floats] { auto result = DatumMath::Min(floats); UNREFERENCED_LOCAL(result); });
+		}
+
+		TEST_METHOD(Find)
+		{
+			ForEachInstructionSet([](size_t count) {
+				int32_t integers[17];
+				float floats[17];
+				vec4 vectors[17];
+				int targets[17];
+				const void* addresses[17];
+				for (size_t i = 0; i < count; ++i) {
+					integers[i] = static_cast<int32_t>(i) * 7;
+					floats[i] = static_cast<float>(i) * 0.5f;
+					vectors[i] = vec4(1.0f, 2.0f, 3.0f, static_cast<float>(i));
+					addresses[i] = &targets[i];
+				}
+				const gsl::span<const int32_t> integerSpan(integers, count);
+				const gsl::span<const float> floatSpan(floats, count);
+				const gsl::span<const vec4> vectorSpan(vectors, count);
+				const gsl::span<const void* const> addressSpan(addresses, count);
+
+				for (size_t i = 0; i < count; ++i) {
+					Assert::AreEqual(i, DatumMath::Find(integerSpan, integers[i]));
+					Assert::AreEqual(i, DatumMath::Find(floatSpan, floats[i]));
+					Assert::AreEqual(i, DatumMath::Find(vectorSpan, vectors[i]));
+					Assert::AreEqual(i, DatumMath::FindAddress(addressSpan, addresses[i]));
+				}
+				Assert::AreEqual(count, DatumMath::Find(integerSpan, -1));
+				Assert::AreEqual(count, DatumMath::Find(floatSpan, -1.0f));
+				Assert::AreEqual(count, DatumMath::Find(vectorSpan, vec4(1.0f, 2.0f, 3.0f, -1.0f)));
+				Assert::AreEqual(count, DatumMath::Find(vectorSpan, vec4(1.0f, 2.0f, 0.0f, 0.0f)));
+				Assert::AreEqual(count, DatumMath::FindAddress(addressSpan, &count));
+				Assert::AreEqual(count, DatumMath::FindAddress(addressSpan, nullptr));
+
+				if (count >= 2) {
+					integers[count - 1] = integers[0];
+					vectors[count - 1] = vectors[0];
+					Assert::AreEqual(size_t(0), DatumMath::Find(integerSpan, integers[0]));
+					Assert::AreEqual(size_t(0), DatumMath::Find(vectorSpan, vectors[0]));
+
+					floats[count - 1] = std::numeric_limits<float>::quiet_NaN();
+					Assert::AreEqual(count, DatumMath::Find(floatSpan, std::numeric_limits<float>::quiet_NaN()));
+					Assert::AreEqual(size_t(0), DatumMath::Find(floatSpan, -0.0f));
+				}
+			});
+		}
+
+	private:
+		/// <summary>
+		/// Runs a check with every supported instruction set, at sizes that exercise both the wide loops and their leftover elements, then restores the active instruction set.
+		/// </summary>
+		template <typename TCheck>
+		static void ForEachInstructionSet(TCheck check) {
+			const DatumMath::InstructionSet original = DatumMath::ActiveInstructionSet();
+			for (auto instructionSet : { DatumMath::InstructionSet::Scalar, DatumMath::InstructionSet::SSE2, DatumMath::InstructionSet::AVX2 }) {
+				if (!DatumMath::IsSupported(instructionSet)) continue;
+				DatumMath::SetInstructionSet(instructionSet);
+				for (size_t count : { 0, 1, 2, 3, 5, 8, 17 }) {
+					check(count);
+				}
+			}
+			DatumMath::SetInstructionSet(original);
+		}
+
+		static mat4 TestMatrix(float seed) {
+			mat4 matrix;
+			for (int column = 0; column < 4; ++column) {
+				for (int row = 0; row < 4; ++row) {
+					matrix[column][row] = std::sin(seed * static_cast<float>(column * 4 + row + 1));
+				}
+			}
+			return matrix;
+		}
+
+		static Datum TestVectors(size_t count, float seed) {
+			Datum vectors(Datum::DatumTypes::Vector);
+			for (size_t i = 0; i < count; ++i) {
+				const float base = seed + static_cast<float>(i);
+				vectors.PushBack(vec4(std::sin(base), std::cos(base) * 3.0f, base, -base * 0.5f));
+			}
+			return vectors;
+		}
+
+		static Datum TestMatrices(size_t count, float seed) {
+			Datum matrices(Datum::DatumTypes::Matrix);
+			for (size_t i = 0; i < count; ++i) {
+				matrices.PushBack(TestMatrix(seed + static_cast<float>(i)));
+			}
+			return matrices;
+		}
+
+		static void AssertNear(const Datum& expected, const Datum& actual) {
+			Assert::AreEqual(expected.Size(), actual.Size());
+			const size_t components = (expected.Type() == Datum::DatumTypes::Matrix) ? 16 : 4;
+			for (size_t i = 0; i < expected.Size(); ++i) {
+				const float* expectedValues = (components == 16) ? &expected.GetAsMatrix(i)[0][0] : &expected.GetAsVector(i)[0];
+				const float* actualValues = (components == 16) ? &actual.GetAsMatrix(i)[0][0] : &actual.GetAsVector(i)[0];
+				for (size_t component = 0; component < components; ++component) {
+					Assert::AreEqual(expectedValues[component], actualValues[component], 1e-4f);
+				}
+			}
+		}
+
+		inline static _CrtMemState _startMemState;
+	};
+}
@@ -8,6 +8,10 @@
 #include "Datum.h"
 #include "Scope.h"
 #include "Foo.h"
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <vector>
 
 #pragma warning(push)
 #pragma warning(disable:4201)
@@ -1777,6 +1781,51 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(size_t(9), datum.Capacity());
 		}
 
+		TEST_METHOD(GrowthStrategies) {
+			{
+				Datum datum;
+				Assert::AreEqual(static_cast<int>(Datum::GrowthStrategies::HalfAgain), static_cast<int>(datum.GetGrowthStrategy()));
+
+				datum.SetGrowthStrategy(Datum::GrowthStrategies::Doubling);
+				Assert::AreEqual(size_t(10), datum.GetIncrementFunction()(size_t(10)));
+				for (int i = 0; i < 5; ++i) {
+					datum.PushBack(i);
+				}
+				Assert::AreEqual(size_t(8), datum.Capacity());
+
+				Datum copy(datum);
+				Assert::AreEqual(static_cast<int>(Datum::GrowthStrategies::Doubling), static_cast<int>(copy.GetGrowthStrategy()));
+			}
+			{
+				Datum datum(Datum::DatumTypes::Float, 0, Datum::GrowthStrategies::FixedChunk);
+				Assert::AreEqual(Datum::FixedGrowthChunk, datum.GetIncrementFunction()(size_t(100)));
+				datum.PushBack(1.0f);
+				Assert::AreEqual(Datum::FixedGrowthChunk, datum.Capacity());
+			}
+			{
+				Datum datum(glm::vec4(1.0f), Datum::GrowthStrategies::PageRounded);
+				Assert::AreEqual(size_t(4096) / sizeof(glm::vec4), datum.Capacity());
+				datum.Resize(datum.Capacity());
+				datum.PushBack(glm::vec4(2.0f));
+				Assert::AreEqual(size_t(2) * size_t(4096) / sizeof(glm::vec4), datum.Capacity());
+			}
+			{
+				Datum datum;
+				datum.SetIncrementFunction([](size_t capacity) { return capacity + 4; });
+				Assert::AreEqual(static_cast<int>(Datum::GrowthStrategies::Custom), static_cast<int>(datum.GetGrowthStrategy()));
+				datum.PushBack("a"s);
+				Assert::AreEqual(size_t(4), datum.Capacity());
+
+				Datum copy = datum;
+				Assert::AreEqual(size_t(14), copy.GetIncrementFunction()(size_t(10)));
+
+				datum.SetGrowthStrategy(Datum::GrowthStrategies::HalfAgain);
+				Assert::AreEqual(size_t(5), datum.GetIncrementFunction()(size_t(10)));
+				datum.SetGrowthStrategy(Datum::GrowthStrategies::Custom);
+				Assert::AreEqual(size_t(5), datum.GetIncrementFunction()(size_t(10)));
+			}
+		}
+
 		TEST_METHOD(Clear) {
 			{
 				int a = 10;
@@ -7325,6 +7374,402 @@ namespace LibraryDesktopTests
 			}
 		}
 
+		TEST_METHOD(AsSpan) {
+			{
+				Datum datum;
+				Assert::ExpectException<runtime_error>([&datum] { auto span = datum.AsSpan<int32_t>(); UNREFERENCED_LOCAL(span); });
+				Assert::ExpectException<runtime_error>([&datum] { auto span = std::as_const(datum).AsSpan<int32_t>(); UNREFERENCED_LOCAL(span); });
+				Assert::AreEqual(Datum::DatumTypes::Unknown, datum.Type());
+
+				datum.SetType(Datum::DatumTypes::Integer);
+				Assert::IsTrue(datum.AsSpan<int32_t>().empty());
+
+				datum = { 1, 2, 3 };
+				gsl::span<int32_t> values = datum.AsSpan<int32_t>();
+				Assert::AreEqual(size_t(3), size_t(values.size()));
+				for (auto& value : values) {
+					value *= 10;
+				}
+				Assert::AreEqual(20, datum.GetAsInt(1));
+
+				const Datum& constDatum = datum;
+				gsl::span<const int32_t> constValues = constDatum.AsSpan<int32_t>();
+				Assert::AreEqual(30, constValues[2]);
+
+				Assert::ExpectException<runtime_error>([&datum] { auto span = datum.AsSpan<float>(); UNREFERENCED_LOCAL(span); });
+				Assert::ExpectException<runtime_error>([&constDatum] { auto span = constDatum.AsSpan<std::string>(); UNREFERENCED_LOCAL(span); });
+			}
+			{
+				vec4 external[] = { vec4(1), vec4(2) };
+				Datum datum;
+				datum.SetStorage(external, 2);
+				gsl::span<vec4> values = datum.AsSpan<vec4>();
+				values[1] = vec4(5);
+				Assert::AreEqual(vec4(5), external[1]);
+			}
+			{
+				Datum datum = { "a"s, "b"s };
+				gsl::span<const std::string> values = std::as_const(datum).AsSpan<std::string>();
+				Assert::AreEqual("b"s, values[1]);
+			}
+		}
+
+		TEST_METHOD(PushBackRange) {
+			{
+				int32_t values[] = { 1, 2, 3, 4, 5, 6 };
+				Datum datum;
+				datum.PushBackRange(std::begin(values), std::end(values));
+				Assert::AreEqual(Datum::DatumTypes::Integer, datum.Type());
+				Assert::AreEqual(size_t(6), datum.Size());
+				datum.PushBackRange(values, values + 2);
+				Assert::AreEqual(size_t(8), datum.Size());
+				Assert::AreEqual(6, datum.GetAsInt(5));
+				Assert::AreEqual(2, datum.GetAsInt(7));
+
+				datum.PushBackRange(values, values);
+				Assert::AreEqual(size_t(8), datum.Size());
+
+				float floats[] = { 1.0f };
+				Assert::ExpectException<runtime_error>([&datum, &floats] { datum.PushBackRange(std::begin(floats), std::end(floats)); });
+			}
+			{
+				std::list<std::string> strings = { "a"s, "b"s, "c"s };
+				Datum datum;
+				datum.PushBackRange(strings.begin(), strings.end());
+				Assert::AreEqual(size_t(3), datum.Size());
+				Assert::AreEqual("c"s, datum.BackAsString());
+			}
+			{
+				std::istringstream stream("7 8 9");
+				Datum datum;
+				datum.PushBackRange(std::istream_iterator<int32_t>(stream), std::istream_iterator<int32_t>());
+				Assert::AreEqual(size_t(3), datum.Size());
+				Assert::AreEqual(9, datum.BackAsInt());
+			}
+			{
+				Foo a{ 1 };
+				Foo b{ 2 };
+				std::vector<RTTI*> pointers = { &a, &b };
+				Datum datum;
+				datum.PushBackRange(pointers.begin(), pointers.end());
+				Assert::IsTrue(datum.GetAsPointer(1) == &b);
+			}
+			{
+				int32_t external[] = { 1 };
+				Datum datum;
+				datum.SetStorage(external, 1);
+				Assert::ExpectException<runtime_error>([&datum, &external] { datum.PushBackRange(std::begin(external), std::end(external)); });
+			}
+			{
+				Datum datum = { 1, 2, 3, 4, 5 };
+				datum.ShrinkToFit();
+				gsl::span<int32_t> values = datum.AsSpan<int32_t>();
+				datum.PushBackRange(values.begin(), values.end());
+				Assert::AreEqual(size_t(10), datum.Size());
+				for (size_t i = 0; i < 10; ++i) {
+					Assert::AreEqual(static_cast<int32_t>(i % 5 + 1), datum.GetAsInt(i));
+				}
+			}
+			{
+				Datum datum = { "first"s, "second"s };
+				datum.ShrinkToFit();
+				gsl::span<std::string> values = datum.AsSpan<std::string>();
+				datum.PushBackRange(values.begin(), values.end());
+				Assert::AreEqual(size_t(4), datum.Size());
+				Assert::AreEqual("first"s, datum.GetAsString(2));
+				Assert::AreEqual("second"s, datum.BackAsString());
+			}
+		}
+
+		TEST_METHOD(Assign) {
+			{
+				Datum datum = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f };
+				const size_t capacity = datum.Capacity();
+				std::vector<float> values = { 7.0f, 8.0f };
+				datum.Assign(values);
+				Assert::AreEqual(size_t(2), datum.Size());
+				Assert::AreEqual(capacity, datum.Capacity());
+				Assert::AreEqual(8.0f, datum.BackAsFloat());
+
+				datum.Assign(std::vector<float>());
+				Assert::IsTrue(datum.IsEmpty());
+
+				std::vector<int32_t> integers = { 1 };
+				Assert::ExpectException<runtime_error>([&datum, &integers] { datum.Assign(integers); });
+				Assert::AreEqual(Datum::DatumTypes::Float, datum.Type());
+			}
+			{
+				mat4 matrices[] = { mat4(1), mat4(2) };
+				Datum datum;
+				datum.Assign(matrices);
+				Assert::AreEqual(Datum::DatumTypes::Matrix, datum.Type());
+				Assert::AreEqual(mat4(2), datum.BackAsMatrix());
+			}
+			{
+				Datum datum = { "old"s };
+				const std::string strings[] = { "new"s, "values"s };
+				datum.Assign(gsl::span<const std::string>(strings, 2));
+				Assert::AreEqual(size_t(2), datum.Size());
+				Assert::AreEqual("new"s, datum.FrontAsString());
+			}
+			{
+				float external[] = { 1.0f };
+				Datum datum;
+				datum.SetStorage(external, 1);
+				Assert::ExpectException<runtime_error>([&datum] { datum.Assign(std::vector<float>{ 2.0f }); });
+			}
+		}
+
+		TEST_METHOD(ResizeWithValue) {
+			{
+				Datum datum;
+				datum.Resize(3, 7);
+				Assert::AreEqual(Datum::DatumTypes::Integer, datum.Type());
+				Assert::AreEqual(size_t(3), datum.Size());
+				Assert::AreEqual(7, datum.GetAsInt(2));
+
+				datum.Resize(5, 9);
+				Assert::AreEqual(7, datum.GetAsInt(2));
+				Assert::AreEqual(9, datum.GetAsInt(4));
+
+				datum.Resize(1, 0);
+				Assert::AreEqual(size_t(1), datum.Size());
+				Assert::AreEqual(size_t(1), datum.Capacity());
+
+				Assert::ExpectException<runtime_error>([&datum] { datum.Resize(2, 1.0f); });
+			}
+			{
+				Datum datum;
+				datum.Resize(2, 1.5f);
+				Assert::AreEqual(1.5f, datum.BackAsFloat());
+			}
+			{
+				Datum datum;
+				datum.Resize(4, "fill"s);
+				Assert::AreEqual(size_t(4), datum.Size());
+				Assert::AreEqual("fill"s, datum.GetAsString(3));
+				datum.Resize(2, "unused"s);
+				Assert::AreEqual(size_t(2), datum.Size());
+			}
+			{
+				Datum datum = { 4, 5, 6, 7, 8 };
+				datum.ShrinkToFit();
+				datum.Resize(40, datum.FrontAsInt());
+				Assert::AreEqual(size_t(40), datum.Size());
+				Assert::AreEqual(5, datum.GetAsInt(1));
+				Assert::AreEqual(4, datum.BackAsInt());
+
+				Datum strings = { "shared"s };
+				strings.ShrinkToFit();
+				strings.Resize(3, strings.FrontAsString());
+				Assert::AreEqual("shared"s, strings.BackAsString());
+			}
+			{
+				Datum vectors;
+				vectors.Resize(2, vec4(3));
+				Assert::AreEqual(vec4(3), vectors.BackAsVector());
+
+				Datum matrices;
+				matrices.Resize(2, mat4(4));
+				Assert::AreEqual(mat4(4), matrices.BackAsMatrix());
+
+				Foo foo{ 5 };
+				Datum pointers;
+				pointers.Resize(3, &foo);
+				Assert::IsTrue(pointers.GetAsPointer(2) == &foo);
+			}
+			{
+				int32_t external[] = { 1 };
+				Datum datum;
+				datum.SetStorage(external, 1);
+				Assert::ExpectException<runtime_error>([&datum] { datum.Resize(2, 1); });
+			}
+		}
+
+		TEST_METHOD(FindAll) {
+			{
+				Datum datum(Datum::DatumTypes::Integer);
+				for (int32_t i = 0; i < 40; ++i) {
+					datum.PushBack(i % 3);
+				}
+				const Vector<size_t> indices = datum.FindAll(2);
+				Assert::AreEqual(size_t(13), indices.Size());
+				for (size_t i = 0; i < indices.Size(); ++i) {
+					Assert::AreEqual(i * 3 + 2, indices[i]);
+				}
+				Assert::IsTrue(datum.FindAll(3).IsEmpty());
+				Assert::ExpectException<runtime_error>([&datum] { auto indices = datum.FindAll(1.0f); UNREFERENCED_LOCAL(indices); });
+			}
+			{
+				Datum datum = { 1.0f, -0.0f, 2.0f, 0.0f, std::numeric_limits<float>::quiet_NaN() };
+				const Vector<size_t> zeros = datum.FindAll(0.0f);
+				Assert::AreEqual(size_t(2), zeros.Size());
+				Assert::AreEqual(size_t(1), zeros[0]);
+				Assert::AreEqual(size_t(3), zeros[1]);
+				Assert::IsTrue(datum.FindAll(std::numeric_limits<float>::quiet_NaN()).IsEmpty());
+			}
+			{
+				Datum datum = { "a"s, "b"s, "a"s };
+				const Vector<size_t> indices = datum.FindAll("a"s);
+				Assert::AreEqual(size_t(2), indices.Size());
+				Assert::AreEqual(size_t(2), indices[1]);
+			}
+			{
+				Datum vectors = { vec4(1), vec4(1, 1, 1, 2), vec4(1), vec4(2) };
+				const Vector<size_t> indices = vectors.FindAll(vec4(1));
+				Assert::AreEqual(size_t(2), indices.Size());
+				Assert::AreEqual(size_t(0), indices[0]);
+				Assert::AreEqual(size_t(2), indices[1]);
+
+				Datum matrices = { mat4(1), mat4(2), mat4(1) };
+				Assert::AreEqual(size_t(1), matrices.FindAll(mat4(2)).Size());
+			}
+			{
+				Foo a{ 1 };
+				Foo b{ 2 };
+				Foo alsoA{ 1 };
+				Datum pointers = { &a, &b, &alsoA };
+				const Vector<size_t> indices = pointers.FindAll(&a);
+				Assert::AreEqual(size_t(2), indices.Size());
+				Assert::AreEqual(size_t(2), indices[1]);
+			}
+			{
+				Scope parent;
+				Scope* children[9];
+				for (Scope*& child : children) {
+					child = &parent.AppendScope("children"s);
+				}
+				Datum& table = *parent.Find("children"s);
+				for (size_t i = 0; i < std::size(children); ++i) {
+					Assert::AreEqual(i, table.FindIndex(*children[i]));
+					const Vector<size_t> indices = table.FindAll(*children[i]);
+					Assert::AreEqual(size_t(1), indices.Size());
+					Assert::AreEqual(i, indices[0]);
+				}
+				Scope stranger;
+				Assert::AreEqual(table.Size(), table.FindIndex(stranger));
+				Assert::IsTrue(table.FindAll(stranger).IsEmpty());
+			}
+		}
+
+		TEST_METHOD(FindIndexLongDatums) {
+			Datum integers(Datum::DatumTypes::Integer);
+			Datum floats(Datum::DatumTypes::Float);
+			Datum vectors(Datum::DatumTypes::Vector);
+			for (int32_t i = 0; i < 37; ++i) {
+				for (int32_t j = 0; j < i; ++j) {
+					Assert::AreEqual(size_t(j), integers.FindIndex(j));
+					Assert::AreEqual(size_t(j), floats.FindIndex(static_cast<float>(j)));
+					Assert::AreEqual(size_t(j), vectors.FindIndex(vec4(static_cast<float>(j))));
+				}
+				Assert::AreEqual(integers.Size(), integers.FindIndex(i));
+				Assert::AreEqual(floats.Size(), floats.FindIndex(static_cast<float>(i)));
+				Assert::AreEqual(vectors.Size(), vectors.FindIndex(vec4(static_cast<float>(i))));
+				integers.PushBack(i);
+				floats.PushBack(static_cast<float>(i));
+				vectors.PushBack(vec4(static_cast<float>(i)));
+			}
+
+			Assert::IsTrue(integers.Remove(36));
+			Assert::IsTrue(integers.Remove(0));
+			Assert::AreEqual(size_t(34), integers.FindIndex(35));
+		}
+
+		TEST_METHOD(AppendToString) {
+			{
+				Datum datum = { 10, -20, std::numeric_limits<int32_t>::min() };
+				std::string out = "values: "s;
+				datum.AppendToString(out);
+				out += ' ';
+				datum.AppendToString(out, size_t(2));
+				Assert::AreEqual("values: 10 -2147483648"s, out);
+				Assert::ExpectException<runtime_error>([&datum, &out] { datum.AppendToString(out, size_t(3)); });
+			}
+			{
+				const float values[] = { 0.0078125f, 1e-7f, -3.4e38f, 0.1f, 123456.789f };
+				Datum datum;
+				for (float value : values) {
+					datum.PushBack(value);
+				}
+				for (size_t i = 0; i < std::size(values); ++i) {
+					Assert::AreEqual(std::to_string(values[i]), datum.ToString(i));
+					Datum readBack = { 0.0f };
+					readBack.SetFromString(datum.ToString(i, Datum::StringFormat::Exact));
+					Assert::AreEqual(values[i], readBack.FrontAsFloat());
+				}
+				Assert::AreEqual("0.1"s, datum.ToString(size_t(3), Datum::StringFormat::Exact));
+			}
+			{
+				const vec4 vector(0.1f, -1.0f, 2.5f, 1e20f);
+				const mat4 matrix(vec4(1.0f / 3.0f, 0, 0, 0), vec4(0, 2, 0, 0), vec4(0, 0, -0.0f, 0), vec4(7, 8, 9, 1));
+				Datum vectors = { vector };
+				Datum matrices = { matrix };
+				Assert::AreEqual(glm::to_string(vector), vectors.ToString());
+				Assert::AreEqual(glm::to_string(matrix), matrices.ToString());
+				Assert::AreEqual("vec4(0.1, -1, 2.5, 1e+20)"s, vectors.ToString(size_t(0), Datum::StringFormat::Exact));
+
+				std::string out;
+				matrices.AppendToString(out, size_t(0), Datum::StringFormat::Exact);
+				Datum readBack = { mat4(0) };
+				readBack.SetFromString(out);
+				Assert::AreEqual(matrix, readBack.FrontAsMatrix());
+				vectors.SetFromString(vectors.ToString(size_t(0), Datum::StringFormat::Exact));
+				Assert::AreEqual(vector, vectors.FrontAsVector());
+			}
+			{
+				Foo foo{ 3 };
+				Datum pointers = { &foo, nullptr };
+				std::string out;
+				pointers.AppendToString(out, size_t(1));
+				Assert::AreEqual("nullptr"s, out);
+				Assert::AreEqual(foo.ToString(), pointers.ToString());
+			}
+			{
+				Datum unknown;
+				std::string out;
+				Assert::ExpectException<runtime_error>([&unknown, &out] { unknown.AppendToString(out); });
+			}
+		}
+
+		TEST_METHOD(SetFromStringFormats) {
+			{
+				Datum datum = { 0 };
+				datum.SetFromString(" +12");
+				Assert::AreEqual(12, datum.FrontAsInt());
+				datum.SetFromString("-7 apples");
+				Assert::AreEqual(-7, datum.FrontAsInt());
+				datum.SetFromString(std::string_view("345", 2));
+				Assert::AreEqual(34, datum.FrontAsInt());
+				Assert::ExpectException<out_of_range>([&datum] { datum.SetFromString("99999999999"); });
+				Assert::ExpectException<invalid_argument>([&datum] { datum.SetFromString("+-1"); });
+				Assert::ExpectException<invalid_argument>([&datum] { datum.SetFromString(""); });
+			}
+			{
+				Datum datum = { 0.0f };
+				datum.SetFromString("\t1e3");
+				Assert::AreEqual(1000.0f, datum.FrontAsFloat());
+				datum.SetFromString("-0.5f");
+				Assert::AreEqual(-0.5f, datum.FrontAsFloat());
+				Assert::ExpectException<out_of_range>([&datum] { datum.SetFromString("1e50"); });
+				Assert::ExpectException<invalid_argument>([&datum] { datum.SetFromString("."); });
+			}
+			{
+				Datum datum = { vec4(0) };
+				datum.SetFromString("vec4(1,2 ,  3.5,-4)");
+				Assert::AreEqual(vec4(1, 2, 3.5f, -4), datum.FrontAsVector());
+				Assert::ExpectException<runtime_error>([&datum] { datum.SetFromString("vec4(1, 2, 3)"); });
+				Assert::ExpectException<runtime_error>([&datum] { datum.SetFromString("vec4(1, 2, 3, 4"); });
+				Assert::ExpectException<runtime_error>([&datum] { datum.SetFromString("vec3(1, 2, 3, 4)"); });
+			}
+			{
+				Datum datum = { mat4(0) };
+				datum.SetFromString("mat4x4((1,0,0,0),(0,1,0,0),(0,0,1,0),(0,0,0,1))");
+				Assert::AreEqual(mat4(1), datum.FrontAsMatrix());
+				Assert::ExpectException<runtime_error>([&datum] { datum.SetFromString("mat4x4((1,0,0,0),(0,1,0,0),(0,0,1,0))"); });
+				Assert::ExpectException<runtime_error>([&datum] { datum.SetFromString("mat4x4((1,0,0,0),(0,1,0,0),(0,0,1,0),(0,0,0,1)"); });
+			}
+		}
+
 	private:
 		inline static _CrtMemState _startMemState;
 	};
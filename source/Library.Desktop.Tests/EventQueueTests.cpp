@@ -11,6 +11,8 @@
 #include "JsonTableParseHelper.h"
 #include "Factory.h"
 #include "GameTime.h"
+#include <atomic>
+#include <thread>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace UnitTests;
@@ -121,6 +123,9 @@ namespace LibraryDesktopTests
 
 		TEST_METHOD(MoveSemantics)
 		{
+			Assert::IsTrue(std::is_nothrow_move_constructible_v<EventQueue>);
+			Assert::IsTrue(std::is_nothrow_move_assignable_v<EventQueue>);
+
 			GameTime gameTime;
 			EventQueue eventQueueTest{};
 			EventFooArgs eventFoo = 5;
@@ -394,6 +399,41 @@ namespace LibraryDesktopTests
 			Event<int>::RequestClearSubscribers();
 		}
 
+		TEST_METHOD(DequeueSeveralInterrupt)
+		{
+			GameTime gameTime;
+			EventQueue eventQueueTest{};
+
+			int deliveredSum = 0;
+			std::function<void(EventPublisher&)> sumFunction = [&deliveredSum](EventPublisher& eventPublisher) { deliveredSum += eventPublisher.As<Event<EventFooArgs>>()->Message().foo.Data(); };
+			Delegate sumDelegate = { sumFunction };
+			Event<EventFooArgs>::Subscribe(sumDelegate);
+
+			shared_ptr<Event<EventFooArgs>> events[] = { make_shared<Event<EventFooArgs>>(EventFooArgs(1)), make_shared<Event<EventFooArgs>>(EventFooArgs(2)),
+				make_shared<Event<EventFooArgs>>(EventFooArgs(4)), make_shared<Event<EventFooArgs>>(EventFooArgs(8)) };
+			for (auto& event : events) {
+				eventQueueTest.Enqueue(event, gameTime, 5ms);
+			}
+
+			std::function<void(EventPublisher&)> dequeueFunction = [&events, &eventQueueTest](EventPublisher& eventPublisher) { eventQueueTest.Dequeue(events[3]); eventQueueTest.Dequeue(events[1]); UNREFERENCED_LOCAL(eventPublisher); };
+			Delegate dequeueDelegate = { dequeueFunction };
+			Event<int>::Subscribe(dequeueDelegate);
+			eventQueueTest.Enqueue(make_shared<Event<int>>(0), gameTime);
+
+			eventQueueTest.Update(gameTime);
+			Assert::AreEqual(0, deliveredSum);
+			Assert::AreEqual(size_t(4), eventQueueTest.Size());
+
+			gameTime.SetCurrentTime(gameTime.CurrentTime() + 10ms);
+			eventQueueTest.Update(gameTime);
+			Assert::AreEqual(5, deliveredSum);
+			Assert::AreEqual(size_t(0), eventQueueTest.Size());
+
+			//prevent memory leaks
+			Event<EventFooArgs>::RequestClearSubscribers();
+			Event<int>::RequestClearSubscribers();
+		}
+
 		TEST_METHOD(ClearQueueBasic)
 		{
 			GameTime gameTime;
@@ -463,6 +503,103 @@ namespace LibraryDesktopTests
 			Event<int>::RequestClearSubscribers();
 		}
 
+		TEST_METHOD(EnqueueFromAnyThreadBasic)
+		{
+			GameTime gameTime;
+			EventQueue eventQueueTest{};
+
+			int testingInt = 0;
+			std::function<void(EventPublisher&)> dummySubscriberFunction = [&testingInt](EventPublisher& eventPublisher) {
+				Event<EventFooArgs>* event = eventPublisher.As<Event<EventFooArgs>>();
+				Assert::IsNotNull(event);
+				testingInt += event->Message().foo.Data();
+			};
+			Delegate del1 = { dummySubscriberFunction };
+			Event<EventFooArgs>::Subscribe(del1);
+
+			std::thread producer([&eventQueueTest]() {
+				eventQueueTest.EnqueueFromAnyThread(make_shared<Event<EventFooArgs>>(EventFooArgs(1)));
+				eventQueueTest.EnqueueFromAnyThread(make_shared<Event<EventFooArgs>>(EventFooArgs(10)), 5ms);
+			});
+			producer.join();
+			Assert::IsTrue(eventQueueTest.IsEmpty());
+
+			eventQueueTest.Update(gameTime);
+			Assert::AreEqual(1, testingInt);
+			Assert::AreEqual(size_t(1), eventQueueTest.Size());
+
+			gameTime.SetCurrentTime(gameTime.CurrentTime() + 5ms);
+			eventQueueTest.Update(gameTime);
+			Assert::AreEqual(11, testingInt);
+			Assert::IsTrue(eventQueueTest.IsEmpty());
+
+			eventQueueTest.EnqueueFromAnyThread(make_shared<Event<EventFooArgs>>(EventFooArgs(100)));
+			{
+				EventQueue moved = std::move(eventQueueTest);
+				moved.Update(gameTime);
+				Assert::AreEqual(111, testingInt);
+			}
+
+			eventQueueTest.EnqueueFromAnyThread(make_shared<Event<EventFooArgs>>(EventFooArgs(200)));
+			{
+				EventQueue copy = eventQueueTest;
+				copy.Update(gameTime);
+				Assert::AreEqual(111, testingInt);
+			}
+			eventQueueTest.Update(gameTime);
+			Assert::AreEqual(311, testingInt);
+
+			eventQueueTest.EnqueueFromAnyThread(make_shared<Event<EventFooArgs>>(EventFooArgs(1000)));
+			eventQueueTest.Clear();
+			eventQueueTest.Update(gameTime);
+			Assert::AreEqual(311, testingInt);
+
+			Event<EventFooArgs>::RequestClearSubscribers();
+		}
+
+		TEST_METHOD(EnqueueFromAnyThreadStress)
+		{
+			const int producerCount = 8;
+			const int eventsPerProducer = 2000;
+			GameTime gameTime;
+			EventQueue eventQueueTest{};
+
+			int delivered = 0;
+			int deliveredSum = 0;
+			std::function<void(EventPublisher&)> countSubscriberFunction = [&delivered, &deliveredSum](EventPublisher& eventPublisher) {
+				++delivered;
+				deliveredSum += eventPublisher.As<Event<EventFooArgs>>()->Message().foo.Data();
+			};
+			Delegate del1 = { countSubscriberFunction };
+			Event<EventFooArgs>::Subscribe(del1);
+
+			std::atomic<int> finishedProducers{ 0 };
+			Vector<std::thread> producers(producerCount);
+			for (int p = 0; p < producerCount; ++p) {
+				producers.PushBack(std::thread([&eventQueueTest, &finishedProducers]() {
+					for (int i = 0; i < eventsPerProducer; ++i) {
+						eventQueueTest.EnqueueFromAnyThread(make_shared<Event<EventFooArgs>>(EventFooArgs(1)));
+					}
+					++finishedProducers;
+				}));
+			}
+
+			//The game thread keeps updating while the producers submit, the way GameState::Update would
+			while (finishedProducers.load() < producerCount) {
+				eventQueueTest.Update(gameTime);
+			}
+			for (std::thread& producer : producers) {
+				producer.join();
+			}
+			eventQueueTest.Update(gameTime);
+
+			Assert::AreEqual(producerCount * eventsPerProducer, delivered);
+			Assert::AreEqual(producerCount * eventsPerProducer, deliveredSum);
+			Assert::IsTrue(eventQueueTest.IsEmpty());
+
+			Event<EventFooArgs>::RequestClearSubscribers();
+		}
+
 	private:
 		inline static _CrtMemState _startMemState;
 	};
@@ -488,6 +488,89 @@ namespace LibraryDesktopTests
 			Event<EventFooArgs>::RequestClearSubscribers();
 		}
 
+		TEST_METHOD(LinkUnlinkBasic)
+		{
+			Event<EventFooArgs> eventTest{ EventFooArgs(0) };
+
+			int testingInt = 0;
+			std::function<void(EventPublisher&)> dummySubscriberFunction = [&testingInt](EventPublisher& eventPublisher) { ++testingInt; UNREFERENCED_LOCAL(eventPublisher); };
+			Delegate del1 = { dummySubscriberFunction };
+			Delegate del2 = { dummySubscriberFunction };
+			Assert::IsFalse(del1.link.IsLinked());
+
+			Event<EventFooArgs>::Link(del1);
+			Event<EventFooArgs>::Link(del1);
+			Event<EventFooArgs>::Subscribe(del2);
+			Assert::IsTrue(del1.link.IsLinked());
+			Assert::AreEqual("Event with 2 subscribers."s, eventTest.ToString());
+			eventTest.Deliver();
+			Assert::AreEqual(2, testingInt);
+
+			Assert::ExpectException<std::runtime_error>([&del1] { Event<int>::Link(del1); });
+
+			Delegate copy = del1;
+			Assert::IsFalse(copy.link.IsLinked());
+
+			Event<EventFooArgs>::Unlink(del1);
+			Event<EventFooArgs>::Unlink(del1);
+			Assert::IsFalse(del1.link.IsLinked());
+			eventTest.Deliver();
+			Assert::AreEqual(3, testingInt);
+
+			Event<EventFooArgs>::Link(del1);
+			Event<EventFooArgs>::RequestClearSubscribers();
+			Assert::IsFalse(del1.link.IsLinked());
+			eventTest.Deliver();
+			Assert::AreEqual(3, testingInt);
+		}
+
+		TEST_METHOD(LinkUnlinkInterrupt)
+		{
+			Event<EventFooArgs> eventTest{ EventFooArgs(0) };
+
+			int testingInt = 0;
+			std::function<void(EventPublisher&)> dummySubscriberFunction = [&testingInt](EventPublisher& eventPublisher) { ++testingInt; UNREFERENCED_LOCAL(eventPublisher); };
+			Delegate del1 = { dummySubscriberFunction };
+			Delegate del2 = { dummySubscriberFunction };
+			Delegate del3 = { dummySubscriberFunction };
+
+			std::function<void(EventPublisher&)> linkSubscriberFunction = [&del3](EventPublisher& eventPublisher) { Event<EventFooArgs>::Link(del3); UNREFERENCED_LOCAL(eventPublisher); };
+			Delegate linker = { linkSubscriberFunction };
+			Event<EventFooArgs>::Link(linker);
+			Event<EventFooArgs>::Link(del1);
+			eventTest.Deliver();
+			Assert::AreEqual(1, testingInt);
+			Assert::IsTrue(del3.link.IsLinked());
+			eventTest.Deliver();
+			Assert::AreEqual(3, testingInt);
+			Event<EventFooArgs>::Unlink(linker);
+			Event<EventFooArgs>::Unlink(del3);
+
+			std::function<void(EventPublisher&)> unlinkSubscriberFunction = [&del1, &del2](EventPublisher& eventPublisher) { Event<EventFooArgs>::Unlink(del1); Event<EventFooArgs>::Unlink(del2); UNREFERENCED_LOCAL(eventPublisher); };
+			Delegate unlinker = { unlinkSubscriberFunction };
+			Event<EventFooArgs>::Unlink(del1);
+			Event<EventFooArgs>::Link(unlinker);
+			Event<EventFooArgs>::Link(del1);
+			Event<EventFooArgs>::Link(del2);
+			testingInt = 0;
+			eventTest.Deliver();
+			Assert::AreEqual(0, testingInt);
+			Assert::IsFalse(del1.link.IsLinked());
+			Assert::IsFalse(del2.link.IsLinked());
+
+			Delegate self;
+			self.subscriber = [&self, &testingInt](EventPublisher& eventPublisher) { ++testingInt; Event<EventFooArgs>::Unlink(self); UNREFERENCED_LOCAL(eventPublisher); };
+			Event<EventFooArgs>::Unlink(unlinker);
+			Event<EventFooArgs>::Link(self);
+			Event<EventFooArgs>::Link(del1);
+			eventTest.Deliver();
+			Assert::AreEqual(2, testingInt);
+			eventTest.Deliver();
+			Assert::AreEqual(3, testingInt);
+
+			Event<EventFooArgs>::RequestClearSubscribers();
+		}
+
 	private:
 		inline static _CrtMemState _startMemState;
 	};
@@ -7,6 +7,8 @@
 #include "ToStringSpecializations.h"
 #include "Factory.h"
 #include "AttributedFoo.h"
+#include <atomic>
+#include <thread>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace UnitTests;
@@ -129,6 +131,81 @@ namespace LibraryDesktopTests
 			TypeManager::Clear();
 		}
 
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		TEST_METHOD(ConcurrentCreate)
+		{
+			RegisterType<AttributedFoo>();
+			Factory<Scope>::Add(make_unique<AttributedFooFactory>());
+
+			const int threadCount = 8;
+			const int createsPerThread = 200;
+			std::atomic<int> created{ 0 };
+			{
+				Vector<std::thread> threads(threadCount + 1);
+				for (int t = 0; t < threadCount; ++t) {
+					threads.PushBack(std::thread([&created]() {
+						for (int i = 0; i < createsPerThread; ++i) {
+							gsl::owner<Scope*> createdScope = Factory<Scope>::Create("AttributedFoo");
+							if (createdScope != nullptr && createdScope->Is(AttributedFoo::TypeIdClass())) ++created;
+							delete createdScope;
+						}
+					}));
+				}
+				threads.PushBack(std::thread([]() {
+					for (int i = 0; i < createsPerThread; ++i) {
+						Factory<RTTI>::Add(make_unique<FooFactory>());
+						Factory<RTTI>::Remove("Foo");
+					}
+				}));
+				for (std::thread& thread : threads) {
+					thread.join();
+				}
+			}
+
+			Assert::AreEqual(threadCount * createsPerThread, created.load());
+			Assert::AreEqual(size_t(0), Factory<RTTI>::Size());
+
+			Factory<Scope>::Clear();
+			TypeManager::Clear();
+		}
+
+		TEST_METHOD(ConcurrentFreeze)
+		{
+			Factory<RTTI>::Add(make_unique<FooFactory>());
+
+			const int threadCount = 8;
+			const int findsPerThread = 2000;
+			const int freezeCount = 200;
+			std::atomic<int> missed{ 0 };
+			{
+				Vector<std::thread> threads(threadCount + 1);
+				for (int t = 0; t < threadCount; ++t) {
+					threads.PushBack(std::thread([&missed]() {
+						for (int i = 0; i < findsPerThread; ++i) {
+							if (Factory<RTTI>::Find("Foo"s) == nullptr) ++missed;
+						}
+					}));
+				}
+				threads.PushBack(std::thread([]() {
+					for (int i = 0; i < freezeCount; ++i) {
+						Factory<RTTI>::Freeze();
+						Factory<RTTI>::Add(make_unique<BarFactory>());
+						Factory<RTTI>::Freeze();
+						Factory<RTTI>::Remove("Bar"s);
+					}
+				}));
+				for (std::thread& thread : threads) {
+					thread.join();
+				}
+			}
+
+			Assert::AreEqual(0, missed.load());
+			Assert::IsFalse(Factory<RTTI>::IsFrozen());
+			Assert::AreEqual(size_t(1), Factory<RTTI>::Size());
+			Factory<RTTI>::Clear();
+		}
+
+#endif // USE_THREAD_SAFE_REGISTRIES
 		TEST_METHOD(AddAndRemove)
 		{
 			Assert::AreEqual(size_t(0), Factory<RTTI>::Size());
@@ -194,6 +271,44 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(size_t(0), Factory<RTTI>::Size());
 		}
 
+		TEST_METHOD(Freeze)
+		{
+			Factory<RTTI>::Add(make_unique<FooFactory>());
+			Factory<RTTI>::Add(make_unique<BarFactory>());
+			const Factory<RTTI>* fooFactory = Factory<RTTI>::Find("Foo"s);
+			Assert::IsFalse(Factory<RTTI>::IsFrozen());
+
+			Factory<RTTI>::Freeze();
+			Assert::IsTrue(Factory<RTTI>::IsFrozen());
+			Assert::AreEqual(fooFactory, Factory<RTTI>::Find("Foo"s));
+			Assert::AreEqual(fooFactory, Factory<RTTI>::Find("Foo"sv));
+			Assert::IsNotNull(Factory<RTTI>::Find("Bar"s));
+			Assert::IsNull(Factory<RTTI>::Find("Baz"s));
+
+			gsl::owner<RTTI*> createdFoo = Factory<RTTI>::Create("Foo"s);
+			Assert::IsNotNull(createdFoo);
+			Assert::IsTrue(createdFoo->Is(Foo::TypeIdClass()));
+			delete createdFoo;
+			Assert::IsNull(Factory<RTTI>::Create("Baz"s));
+
+			Factory<RTTI>::Remove("Bar"s);
+			Assert::IsFalse(Factory<RTTI>::IsFrozen());
+			Assert::IsNull(Factory<RTTI>::Find("Bar"s));
+			Assert::AreEqual(fooFactory, Factory<RTTI>::Find("Foo"s));
+
+			Factory<RTTI>::Freeze();
+			Assert::IsTrue(Factory<RTTI>::IsFrozen());
+			Factory<RTTI>::Add(make_unique<BarFactory>());
+			Assert::IsFalse(Factory<RTTI>::IsFrozen());
+			Assert::IsNotNull(Factory<RTTI>::Find("Bar"s));
+
+			Factory<RTTI>::Freeze();
+			Factory<RTTI>::Clear();
+			Assert::IsFalse(Factory<RTTI>::IsFrozen());
+			Assert::IsNull(Factory<RTTI>::Find("Foo"s));
+			Assert::AreEqual(size_t(0), Factory<RTTI>::Size());
+		}
+
 		TEST_METHOD(ClassName)
 		{
 			Factory<RTTI>::Add(make_unique<FooFactory>());
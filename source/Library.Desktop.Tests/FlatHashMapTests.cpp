@@ -0,0 +1,754 @@
+/// <summary>
+/// Unit tests exercising the functionality of FlatHashMap and its Iterator and ConstIterator types.
+/// </summary>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Foo.h"
+#include "ToStringSpecializations.h"
+#include "FlatHashMap.h"
+#include "DefaultHash.h"
+#include "DefaultEquality.h"
+#include <algorithm>
+#include <cctype>
+#include <functional>
+#include <tuple>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+using namespace FIEAGameEngine;
+using namespace std;
+using namespace std::string_literals;
+
+namespace FIEAGameEngine {
+	template<>
+	struct DefaultEquality<const Foo> final {
+		bool operator()(const Foo& lhs, const Foo& rhs) const {
+			return lhs == rhs;
+		}
+	};
+
+	template<>
+	inline std::size_t DefaultHash<Foo>::operator()(const Foo& key) const {
+		const std::size_t hashPrime = 11;
+		return key.Data() * hashPrime;
+	}
+}
+
+namespace LibraryDesktopTests {
+	/// <summary>
+	/// A deliberately terrible hash that sends every key to the same probe sequence, to exercise group overflow and deleted slots.
+	/// </summary>
+	struct CollidingFooHash final {
+		std::size_t operator()(const Foo&) const {
+			return 0;
+		}
+	};
+
+	/// <summary>
+	/// A value whose construction can be made to throw, to check that a failed insertion or rehash leaves the FlatHashMap as it was.
+	/// </summary>
+	struct ThrowingValue final {
+		inline static bool ThrowOnTransfer{ false };
+
+		explicit ThrowingValue(int data, bool throwOnConstruction = false) :
+			Data{ data }
+		{
+			if (throwOnConstruction) throw std::runtime_error("Construction failed.");
+		}
+
+		ThrowingValue(const ThrowingValue& rhs) :
+			Data{ rhs.Data }
+		{
+			if (ThrowOnTransfer) throw std::runtime_error("Copy failed.");
+		}
+
+		ThrowingValue(ThrowingValue&& rhs) :
+			Data{ rhs.Data }
+		{
+			if (ThrowOnTransfer) throw std::runtime_error("Move failed.");
+		}
+
+		int Data;
+	};
+}
+
+namespace Microsoft::VisualStudio::CppUnitTestFramework {
+	template<>
+	std::wstring ToString<FlatHashMap<Foo, int>::Iterator>(const FlatHashMap<Foo, int>::Iterator& t) {
+		std::wstring value;
+		try {
+			value = ToString((*t).first) + L", "s + ToString((*t).second);
+		}
+		catch (const std::exception&) {
+			value = L"end()"s;
+		}
+		return value;
+	}
+
+	template<>
+	std::wstring ToString<FlatHashMap<Foo, int>::ConstIterator>(const FlatHashMap<Foo, int>::ConstIterator& t) {
+		std::wstring value;
+		try {
+			value = ToString((*t).first) + L", "s + ToString((*t).second);
+		}
+		catch (const std::exception&) {
+			value = L"end()"s;
+		}
+		return value;
+	}
+}
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(FlatHashMapTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(DefaultConstructor)
+		{
+			FlatHashMap<Foo, int> hashMap;
+			Assert::AreEqual(size_t(0), hashMap.Size());
+			Assert::AreEqual(FlatHashMap<Foo, int>::GroupWidth, hashMap.Capacity());
+			Assert::AreEqual(0.0, hashMap.GetLoadFactor());
+			Assert::AreEqual(hashMap.begin(), hashMap.end());
+			Assert::ExpectException<std::runtime_error>([&hashMap]() {auto& value = *(hashMap.begin()); UNREFERENCED_LOCAL(value); });
+
+			FlatHashMap<Foo, int> anotherHashMap(size_t(40));
+			Assert::AreEqual(size_t(0), anotherHashMap.Size());
+			Assert::AreEqual(size_t(64), anotherHashMap.Capacity());
+			Assert::AreEqual(anotherHashMap.begin(), anotherHashMap.end());
+
+			FlatHashMap<Foo, int> tinyHashMap(size_t(2));
+			Assert::AreEqual(FlatHashMap<Foo, int>::GroupWidth, tinyHashMap.Capacity());
+		}
+
+		TEST_METHOD(InitializerListConstructor)
+		{
+			const Foo a(10);
+			const Foo b(20);
+			const Foo c(30);
+
+			FlatHashMap<Foo, int> hashMap{ {a, a.Data()}, {b, b.Data()}, {c, c.Data()} };
+			Assert::AreEqual(size_t(3), hashMap.Size());
+			Assert::AreEqual(a.Data(), hashMap.At(a));
+			Assert::AreEqual(b.Data(), hashMap.At(b));
+			Assert::AreEqual(c.Data(), hashMap.At(c));
+
+			FlatHashMap<Foo, int> anotherHashMap{ {{a, a.Data()}, {b, b.Data()}, {c, c.Data()}}, 64 };
+			Assert::AreEqual(size_t(3), anotherHashMap.Size());
+			Assert::AreEqual(size_t(64), anotherHashMap.Capacity());
+			Assert::AreEqual(a.Data(), anotherHashMap.At(a));
+			Assert::AreEqual(b.Data(), anotherHashMap.At(b));
+			Assert::AreEqual(c.Data(), anotherHashMap.At(c));
+		}
+
+		TEST_METHOD(CopySemantics)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			const Foo c{ 30 };
+			FlatHashMap<Foo, int> hashMap{ {a, a.Data()}, {b, b.Data()}, {c, c.Data()} };
+			hashMap.Remove(b);
+
+			{
+				FlatHashMap<Foo, int> copyOfHashMap{ hashMap };
+				Assert::AreEqual(hashMap.Size(), copyOfHashMap.Size());
+				Assert::AreNotSame(hashMap.begin()->first, copyOfHashMap.begin()->first);
+				Assert::IsTrue(std::equal(hashMap.cbegin(), hashMap.cend(), copyOfHashMap.cbegin()));
+				Assert::IsTrue(std::equal(hashMap.begin(), hashMap.end(), copyOfHashMap.begin()));
+				Assert::IsFalse(copyOfHashMap.ContainsKey(b));
+			}
+			{
+				FlatHashMap<Foo, int> copyOfHashMap{ {b, b.Data()} };
+				copyOfHashMap = hashMap;
+				Assert::AreEqual(hashMap.Size(), copyOfHashMap.Size());
+				Assert::AreNotSame(hashMap.begin()->second, copyOfHashMap.begin()->second);
+				Assert::IsTrue(std::equal(hashMap.cbegin(), hashMap.cend(), copyOfHashMap.cbegin()));
+				Assert::IsFalse(copyOfHashMap.ContainsKey(b));
+			}
+		}
+
+		TEST_METHOD(MoveSemantics)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			const Foo c{ 30 };
+			FlatHashMap<Foo, int> hashMap{ {a, a.Data()}, {b, b.Data()}, {c, c.Data()} };
+
+			FlatHashMap<Foo, int> anotherHashMap{ std::move(hashMap) };
+			Assert::AreEqual(std::size_t(3), anotherHashMap.Size());
+			Assert::AreEqual(a.Data(), anotherHashMap[a]);
+			Assert::AreEqual(b.Data(), anotherHashMap[b]);
+			Assert::AreEqual(c.Data(), anotherHashMap[c]);
+
+#pragma warning(push)
+#pragma warning(disable:26800)
+			Assert::AreEqual(std::size_t(0), hashMap.Size());
+			Assert::AreEqual(std::size_t(0), hashMap.Capacity());
+			Assert::AreEqual(hashMap.begin(), hashMap.end());
+			Assert::IsFalse(hashMap.ContainsKey(a));
+			hashMap[a] = a.Data();
+			Assert::AreEqual(a.Data(), hashMap.At(a));
+#pragma warning(pop)
+
+			FlatHashMap<Foo, int> yetAnotherHashMap{ {c, c.Data()} };
+			yetAnotherHashMap = std::move(anotherHashMap);
+			Assert::AreEqual(std::size_t(3), yetAnotherHashMap.Size());
+			Assert::AreEqual(a.Data(), yetAnotherHashMap[a]);
+			Assert::AreEqual(b.Data(), yetAnotherHashMap[b]);
+			Assert::AreEqual(c.Data(), yetAnotherHashMap[c]);
+		}
+
+		TEST_METHOD(GetLoadFactor)
+		{
+			FlatHashMap<Foo, int> hashMap(32);
+			Assert::AreEqual(0.0, hashMap.GetLoadFactor());
+
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			hashMap.Insert({ a, a.Data() });
+			Assert::AreEqual(1 / 32.0, hashMap.GetLoadFactor());
+
+			hashMap.Insert({ b, b.Data() });
+			Assert::AreEqual(2 / 32.0, hashMap.GetLoadFactor());
+
+			hashMap.Remove(a);
+			Assert::AreEqual(1 / 32.0, hashMap.GetLoadFactor());
+
+			hashMap.Clear();
+			Assert::AreEqual(0.0, hashMap.GetLoadFactor());
+			Assert::AreEqual(size_t(32), hashMap.Capacity());
+		}
+
+		TEST_METHOD(Find)
+		{
+			const Foo a(10);
+			const Foo b(20);
+			const Foo c(30);
+			{
+				FlatHashMap<Foo, int> hashMap{ {a, a.Data()}, {b, b.Data()}, {c, c.Data()} };
+
+				FlatHashMap<Foo, int>::Iterator iter = hashMap.Find(a);
+				Assert::AreEqual(a, iter->first);
+				Assert::AreEqual(a.Data(), iter->second);
+				Assert::AreNotEqual(hashMap.end(), iter);
+
+				iter = hashMap.Find(Foo(69));
+				Assert::AreEqual(hashMap.end(), iter);
+				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *(iter); UNREFERENCED_LOCAL(value); });
+				Assert::IsTrue(hashMap.ContainsKey(c));
+				Assert::IsFalse(hashMap.ContainsKey(Foo(69)));
+			}
+			{
+				const FlatHashMap<Foo, int> hashMap{ {a, a.Data()}, {b, b.Data()} };
+
+				FlatHashMap<Foo, int>::ConstIterator iter = hashMap.Find(b);
+				Assert::AreEqual(b, iter->first);
+				Assert::AreEqual(b.Data(), iter->second);
+
+				iter = hashMap.Find(c);
+				Assert::AreEqual(hashMap.end(), iter);
+				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *(iter); UNREFERENCED_LOCAL(value); });
+			}
+		}
+
+		TEST_METHOD(At)
+		{
+			const Foo a(10);
+			const Foo b(20);
+			FlatHashMap<Foo, int> hashMap{ {a, a.Data()} };
+			const FlatHashMap<Foo, int>& constHashMap = hashMap;
+
+			Assert::AreEqual(a.Data(), hashMap.At(a));
+			Assert::AreEqual(a.Data(), constHashMap.At(a));
+			hashMap.At(a) = b.Data();
+			Assert::AreEqual(b.Data(), constHashMap.At(a));
+
+			Assert::ExpectException<std::runtime_error>([&hashMap, &b]() {auto& value = hashMap.At(b); UNREFERENCED_LOCAL(value); });
+			Assert::ExpectException<std::runtime_error>([&constHashMap, &b]() {auto& value = constHashMap.At(b); UNREFERENCED_LOCAL(value); });
+		}
+
+		TEST_METHOD(BracketAccessOperator)
+		{
+			const Foo a(10);
+			const Foo d(50);
+
+			FlatHashMap<Foo, int> hashMap{ {a, a.Data()} };
+			Assert::AreEqual(a.Data(), hashMap[a]);
+
+			int& value = hashMap[d];
+			Assert::AreEqual(int(), value);
+			Assert::AreEqual(size_t(2), hashMap.Size());
+
+			hashMap[d] = d.Data();
+			Assert::AreEqual(d.Data(), hashMap.At(d));
+			Assert::AreEqual(size_t(2), hashMap.Size());
+		}
+
+		TEST_METHOD(Insert)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			const Foo c{ 30 };
+			FlatHashMap<Foo, int> hashMap;
+
+			std::pair<FlatHashMap<Foo, int>::Iterator, bool> insertResult = hashMap.Insert({ a, a.Data() });
+			Assert::IsTrue(insertResult.second);
+			Assert::AreEqual(hashMap.begin(), insertResult.first);
+			Assert::AreEqual(a, insertResult.first->first);
+			Assert::AreEqual(size_t(1), hashMap.Size());
+
+			insertResult = hashMap.Insert({ a, c.Data() });
+			Assert::IsFalse(insertResult.second);
+			Assert::AreEqual(a.Data(), insertResult.first->second);
+			Assert::AreEqual(size_t(1), hashMap.Size());
+
+			std::pair<Foo, int> bPair{ b, b.Data() };
+			insertResult = hashMap.Insert(std::move(bPair));
+			Assert::IsTrue(insertResult.second);
+			Assert::AreEqual(b, insertResult.first->first);
+			Assert::AreEqual(size_t(2), hashMap.Size());
+		}
+
+		TEST_METHOD(InsertGrows)
+		{
+			FlatHashMap<Foo, int> hashMap;
+			const size_t count = 1000;
+
+			for (int i = 0; i < int(count); ++i) {
+				auto [iter, inserted] = hashMap.Insert({ Foo(i), i * 2 });
+				Assert::IsTrue(inserted);
+				Assert::AreEqual(i * 2, iter->second);
+			}
+			Assert::AreEqual(count, hashMap.Size());
+			Assert::IsTrue(hashMap.Capacity() >= count);
+			Assert::IsTrue(hashMap.GetLoadFactor() <= 0.875);
+
+			for (int i = 0; i < int(count); ++i) {
+				Assert::AreEqual(i * 2, hashMap.At(Foo(i)));
+			}
+			Assert::IsFalse(hashMap.ContainsKey(Foo(int(count))));
+
+			size_t visited = 0;
+			for (const auto& [key, value] : hashMap) {
+				Assert::AreEqual(key.Data() * 2, value);
+				++visited;
+			}
+			Assert::AreEqual(count, visited);
+		}
+
+		TEST_METHOD(Reserve)
+		{
+			FlatHashMap<Foo, int> hashMap;
+			hashMap.Reserve(100);
+			size_t capacity = hashMap.Capacity();
+			Assert::IsTrue(capacity >= 100);
+
+			for (int i = 0; i < 100; ++i) {
+				hashMap[Foo(i)] = i;
+			}
+			Assert::AreEqual(capacity, hashMap.Capacity());
+
+			hashMap.Reserve(10);
+			Assert::AreEqual(capacity, hashMap.Capacity());
+			Assert::AreEqual(size_t(100), hashMap.Size());
+		}
+
+		TEST_METHOD(Remove)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			const Foo c{ 30 };
+			FlatHashMap<Foo, int> hashMap{ {a, a.Data()}, {b, b.Data()}, {c, c.Data()} };
+
+			hashMap.Remove(b);
+			Assert::AreEqual(size_t(2), hashMap.Size());
+			Assert::IsFalse(hashMap.ContainsKey(b));
+			Assert::IsTrue(hashMap.ContainsKey(a));
+			Assert::IsTrue(hashMap.ContainsKey(c));
+
+			hashMap.Remove(b);
+			Assert::AreEqual(size_t(2), hashMap.Size());
+
+			hashMap.Remove(hashMap.Find(a));
+			Assert::AreEqual(size_t(1), hashMap.Size());
+			Assert::IsFalse(hashMap.ContainsKey(a));
+
+			hashMap.Remove(hashMap.end());
+			Assert::AreEqual(size_t(1), hashMap.Size());
+
+			hashMap.Remove(c);
+			Assert::AreEqual(size_t(0), hashMap.Size());
+			Assert::AreEqual(hashMap.begin(), hashMap.end());
+		}
+
+		TEST_METHOD(RemoveWithCollisions)
+		{
+			FlatHashMap<Foo, int, CollidingFooHash> hashMap;
+			const int count = 40;
+
+			for (int i = 0; i < count; ++i) {
+				hashMap.Insert({ Foo(i), i });
+			}
+			Assert::AreEqual(size_t(count), hashMap.Size());
+
+			//removing from full groups leaves deleted slots behind, which lookups must probe past
+			for (int i = 0; i < count; i += 2) {
+				hashMap.Remove(Foo(i));
+			}
+			Assert::AreEqual(size_t(count / 2), hashMap.Size());
+			for (int i = 0; i < count; ++i) {
+				Assert::AreEqual(i % 2 == 1, hashMap.ContainsKey(Foo(i)));
+			}
+
+			//churning through inserts and removes should reuse deleted slots rather than grow forever
+			size_t capacity = hashMap.Capacity();
+			for (int round = 0; round < 10; ++round) {
+				for (int i = 0; i < count; i += 2) {
+					hashMap.Insert({ Foo(i), i });
+				}
+				for (int i = 0; i < count; i += 2) {
+					hashMap.Remove(Foo(i));
+				}
+			}
+			Assert::AreEqual(capacity, hashMap.Capacity());
+			for (int i = 1; i < count; i += 2) {
+				Assert::AreEqual(i, hashMap.At(Foo(i)));
+			}
+		}
+
+		TEST_METHOD(Clear)
+		{
+			FlatHashMap<Foo, int> hashMap{ {Foo(10), 10}, {Foo(20), 20} };
+			hashMap.Clear();
+			Assert::AreEqual(size_t(0), hashMap.Size());
+			Assert::AreEqual(hashMap.begin(), hashMap.end());
+			Assert::AreEqual(hashMap.cbegin(), hashMap.cend());
+			Assert::IsFalse(hashMap.ContainsKey(Foo(10)));
+
+			hashMap.Insert({ Foo(10), 10 });
+			Assert::AreEqual(10, hashMap.At(Foo(10)));
+		}
+
+		TEST_METHOD(StringKeys)
+		{
+			FlatHashMap<std::string, std::unique_ptr<int>> hashMap;
+			hashMap.Insert({ "alpha"s, std::make_unique<int>(1) });
+			hashMap.Insert({ "beta"s, std::make_unique<int>(2) });
+			for (int i = 0; i < 100; ++i) {
+				hashMap.Insert({ "key"s + std::to_string(i), std::make_unique<int>(i) });
+			}
+
+			Assert::AreEqual(size_t(102), hashMap.Size());
+			Assert::AreEqual(1, *hashMap.At("alpha"s));
+			Assert::AreEqual(2, *hashMap.At("beta"s));
+			Assert::AreEqual(57, *hashMap.At("key57"s));
+			Assert::IsFalse(hashMap.ContainsKey("gamma"s));
+
+			hashMap.Remove("alpha"s);
+			Assert::IsFalse(hashMap.ContainsKey("alpha"s));
+			Assert::AreEqual(size_t(101), hashMap.Size());
+		}
+
+#ifdef USE_HASHMAP_STATISTICS
+		TEST_METHOD(Statistics)
+		{
+			FlatHashMap<Foo, int> hashMap;
+			for (int i = 0; i < 10; ++i) {
+				hashMap.Insert({ Foo(i), i });
+			}
+
+			HashMapStatistics statistics = hashMap.GetStatistics();
+			Assert::AreEqual(hashMap.Capacity(), statistics.BucketCount);
+			Assert::AreEqual(size_t(10), statistics.Population);
+			Assert::AreEqual(size_t(10), statistics.InsertCount);
+			Assert::AreEqual(size_t(10), statistics.FindCount);
+			Assert::IsTrue(statistics.LongestChain >= size_t(1));
+			Assert::IsTrue(statistics.MeanChainLength >= 1.0);
+			size_t histogramTotal = 0;
+			for (size_t count : statistics.ChainLengthHistogram) {
+				histogramTotal += count;
+			}
+			Assert::AreEqual(size_t(10), histogramTotal);
+			Assert::IsTrue(statistics.MemoryFootprint >= sizeof(hashMap) + hashMap.Capacity() * sizeof(std::pair<const Foo, int>));
+
+			hashMap.ResetStatistics();
+			Assert::IsTrue(hashMap.ContainsKey(Foo(3)));
+			statistics = hashMap.GetStatistics();
+			Assert::AreEqual(size_t(0), statistics.InsertCount);
+			Assert::AreEqual(size_t(1), statistics.FindCount);
+			Assert::IsTrue(statistics.ProbeCount >= size_t(1));
+		}
+#endif // USE_HASHMAP_STATISTICS
+
+		TEST_METHOD(EqualityPolicy)
+		{
+			struct CaseInsensitiveHash {
+				size_t operator()(const std::string& key) const {
+					size_t hashValue = 0;
+					for (char letter : key) {
+						hashValue = hashValue * 31 + static_cast<size_t>(std::tolower(static_cast<unsigned char>(letter)));
+					}
+					return hashValue;
+				}
+			};
+			struct CaseInsensitiveEquality {
+				bool operator()(const std::string& lhs, const std::string& rhs) const {
+					return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](char a, char b) {
+						return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+					});
+				}
+			};
+			using RuntimeEquality = std::function<bool(const std::string&, const std::string&)>;
+
+			Assert::IsTrue(std::is_same_v<DefaultEquality<const Foo>, FlatHashMap<Foo, int>::key_equal>);
+			Assert::IsTrue(sizeof(FlatHashMap<std::string, int>) < sizeof(FlatHashMap<std::string, int, DefaultHash<std::string>, RuntimeEquality>));
+			{
+				FlatHashMap<std::string, int, CaseInsensitiveHash, CaseInsensitiveEquality> hashMap{ { "Health"s, 100 }, { "Armor"s, 50 } };
+				Assert::IsTrue(hashMap.ContainsKey("HEALTH"s));
+				Assert::AreEqual(50, hashMap.At("armor"s));
+				Assert::IsFalse(hashMap.Insert({ "health"s, 0 }).second);
+				Assert::AreEqual(size_t(2), hashMap.Size());
+				hashMap.Remove("ARMOR"s);
+				Assert::IsFalse(hashMap.ContainsKey("Armor"s));
+			}
+			{
+				FlatHashMap<std::string, int, DefaultHash<std::string>, RuntimeEquality> hashMap(size_t(16), [](const std::string& lhs, const std::string& rhs) { return lhs == rhs; });
+				hashMap["Health"s] = 100;
+				Assert::IsTrue(hashMap.ContainsKey("Health"s));
+				Assert::IsFalse(hashMap.ContainsKey("HEALTH"s));
+
+				auto copy = hashMap;
+				copy = hashMap;
+				Assert::AreEqual(100, copy.At("Health"s));
+			}
+		}
+
+		TEST_METHOD(Emplace)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			FlatHashMap<Foo, int> hashMap;
+
+			auto [iter, inserted] = hashMap.Emplace(a, a.Data());
+			Assert::IsTrue(inserted);
+			Assert::AreEqual(a, iter->first);
+			Assert::AreEqual(a.Data(), iter->second);
+
+			std::tie(iter, inserted) = hashMap.Emplace(std::piecewise_construct, std::forward_as_tuple(b.Data()), std::forward_as_tuple(b.Data()));
+			Assert::IsTrue(inserted);
+			Assert::AreEqual(b, iter->first);
+			Assert::AreEqual(size_t(2), hashMap.Size());
+
+			std::tie(iter, inserted) = hashMap.Emplace(a, 0);
+			Assert::IsFalse(inserted);
+			Assert::AreEqual(a.Data(), iter->second);
+			Assert::AreEqual(size_t(2), hashMap.Size());
+		}
+
+		TEST_METHOD(TryEmplace)
+		{
+			{
+				FlatHashMap<std::string, std::string> hashMap;
+				std::string value = "Health";
+
+				auto [iter, inserted] = hashMap.TryEmplace("hp"s, std::move(value));
+				Assert::IsTrue(inserted);
+				Assert::AreEqual("Health"s, iter->second);
+				Assert::IsTrue(value.empty());
+
+				value = "Armor";
+				std::tie(iter, inserted) = hashMap.TryEmplace("hp"s, std::move(value));
+				Assert::IsFalse(inserted);
+				Assert::AreEqual("Health"s, iter->second);
+				Assert::AreEqual("Armor"s, value);
+
+				std::string key = "ap";
+				std::tie(iter, inserted) = hashMap.TryEmplace(key, size_t(3), 'x');
+				Assert::IsTrue(inserted);
+				Assert::AreEqual("xxx"s, iter->second);
+				Assert::AreEqual("ap"s, key);
+
+				std::tie(iter, inserted) = hashMap.TryEmplace("mp"sv);
+				Assert::IsTrue(inserted);
+				Assert::AreEqual("mp"s, iter->first);
+				Assert::IsTrue(iter->second.empty());
+
+				std::tie(iter, inserted) = hashMap.TryEmplace("hp");
+				Assert::IsFalse(inserted);
+				Assert::AreEqual("Health"s, iter->second);
+				Assert::AreEqual(size_t(3), hashMap.Size());
+			}
+			{
+				FlatHashMap<std::string, int> hashMap;
+				for (int i = 0; i < 50; ++i) {
+					Assert::IsTrue(hashMap.TryEmplace("key"s + std::to_string(i), i).second);
+				}
+				for (int i = 0; i < 50; ++i) {
+					Assert::AreEqual(i, hashMap["key"s + std::to_string(i)]);
+				}
+				hashMap["key7"sv] = 70;
+				Assert::AreEqual(70, hashMap.At("key7"));
+				Assert::AreEqual(0, hashMap["key50"]);
+				Assert::AreEqual(size_t(51), hashMap.Size());
+			}
+		}
+
+		TEST_METHOD(ThrowingConstructionLeavesMapUnchanged)
+		{
+			{
+				FlatHashMap<int, ThrowingValue> hashMap;
+				hashMap.TryEmplace(1, 10);
+				Assert::ExpectException<std::runtime_error>([&hashMap]() { hashMap.TryEmplace(2, 20, true); });
+				Assert::AreEqual(size_t(1), hashMap.Size());
+				Assert::IsTrue(hashMap.Find(2) == hashMap.end());
+				size_t visited = 0;
+				for (const auto& entry : hashMap) {
+					Assert::AreEqual(entry.first * 10, entry.second.Data);
+					++visited;
+				}
+				Assert::AreEqual(size_t(1), visited);
+
+				Assert::IsTrue(hashMap.TryEmplace(2, 20).second);
+				Assert::AreEqual(20, hashMap.At(2).Data);
+				Assert::AreEqual(size_t(2), hashMap.Size());
+			}
+			{
+				FlatHashMap<int, ThrowingValue> hashMap;
+				int key = 0;
+				size_t capacity = 0;
+				do {
+					Assert::IsTrue(hashMap.TryEmplace(key, key * 10).second);
+					capacity = hashMap.Capacity();
+					++key;
+				} while (hashMap.Size() < hashMap.Capacity() - hashMap.Capacity() / 8);
+
+				ThrowingValue::ThrowOnTransfer = true;
+				Assert::ExpectException<std::runtime_error>([&hashMap, key]() { hashMap.TryEmplace(key, key * 10); });
+				ThrowingValue::ThrowOnTransfer = false;
+
+				Assert::AreEqual(size_t(key), hashMap.Size());
+				Assert::AreEqual(capacity, hashMap.Capacity());
+				for (int i = 0; i < key; ++i) {
+					Assert::AreEqual(i * 10, hashMap.At(i).Data);
+				}
+				Assert::IsTrue(hashMap.TryEmplace(key, key * 10).second);
+				Assert::IsTrue(hashMap.Capacity() > capacity);
+			}
+		}
+
+		TEST_METHOD(InsertOrAssign)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			{
+				FlatHashMap<Foo, Foo> hashMap;
+
+				auto [iter, inserted] = hashMap.InsertOrAssign(a, b);
+				Assert::IsTrue(inserted);
+				Assert::AreEqual(b, iter->second);
+
+				std::tie(iter, inserted) = hashMap.InsertOrAssign(a, a);
+				Assert::IsFalse(inserted);
+				Assert::AreEqual(a, iter->second);
+
+				Foo key{ 30 };
+				std::tie(iter, inserted) = hashMap.InsertOrAssign(std::move(key), Foo{ 40 });
+				Assert::IsTrue(inserted);
+				Assert::AreEqual(Foo{ 30 }, iter->first);
+				Assert::AreEqual(Foo{ 40 }, iter->second);
+				Assert::AreEqual(size_t(2), hashMap.Size());
+			}
+			{
+				FlatHashMap<std::string, int> hashMap;
+				Assert::IsTrue(hashMap.InsertOrAssign("hp"sv, 100).second);
+				Assert::IsFalse(hashMap.InsertOrAssign("hp", 50).second);
+				Assert::IsFalse(hashMap.InsertOrAssign("hp"s, 25).second);
+				Assert::AreEqual(25, hashMap.At("hp"));
+				Assert::AreEqual(size_t(1), hashMap.Size());
+			}
+		}
+
+		TEST_METHOD(HeterogeneousLookup)
+		{
+			FlatHashMap<std::string, int> hashMap;
+			for (int i = 0; i < 50; ++i) {
+				hashMap.Insert({ "key"s + std::to_string(i), i });
+			}
+
+			const std::string_view key = "key17"sv;
+			Assert::IsTrue(hashMap.ContainsKey(key));
+			Assert::IsTrue(hashMap.ContainsKey("key42"));
+			Assert::IsFalse(hashMap.ContainsKey("key50"sv));
+			Assert::AreEqual(17, hashMap.At(key));
+			Assert::AreEqual(42, hashMap.At("key42"));
+			Assert::AreEqual(hashMap.Find("key3"s), hashMap.Find("key3"));
+			Assert::AreEqual(hashMap.end(), hashMap.Find("missing"sv));
+			Assert::ExpectException<std::runtime_error>([&hashMap]() {auto& value = hashMap.At("missing"); UNREFERENCED_LOCAL(value); });
+
+			const FlatHashMap<std::string, int>& constHashMap = hashMap;
+			Assert::AreEqual(17, constHashMap.At(key));
+			Assert::AreEqual(constHashMap.cend(), constHashMap.Find("missing"));
+			Assert::AreEqual(std::string("key3"), constHashMap.Find("key3"sv)->first);
+
+			hashMap.Remove("key17"sv);
+			hashMap.Remove("key18");
+			Assert::IsFalse(hashMap.ContainsKey(key));
+			Assert::IsFalse(hashMap.ContainsKey("key18"s));
+			Assert::AreEqual(size_t(48), hashMap.Size());
+		}
+
+		TEST_METHOD(IteratorIncrement)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			const Foo c{ 30 };
+			FlatHashMap<Foo, int> hashMap{ {a, a.Data()}, {b, b.Data()}, {c, c.Data()} };
+
+			FlatHashMap<Foo, int>::Iterator iter = hashMap.begin();
+			int sum = 0;
+			for (size_t i = 0; i < hashMap.Size(); ++i) {
+				sum += (iter++)->second;
+			}
+			Assert::AreEqual(a.Data() + b.Data() + c.Data(), sum);
+			Assert::AreEqual(hashMap.end(), iter);
+			Assert::AreEqual(hashMap.end(), ++iter);
+
+			FlatHashMap<Foo, int>::ConstIterator constIter = hashMap.cbegin();
+			FlatHashMap<Foo, int>::ConstIterator convertedIter = hashMap.begin();
+			Assert::AreEqual(constIter, convertedIter);
+			Assert::AreEqual(size_t(3), size_t(std::distance(hashMap.cbegin(), hashMap.cend())));
+
+			FlatHashMap<Foo, int>::Iterator unassigned;
+			Assert::ExpectException<std::runtime_error>([&unassigned]() { ++unassigned; });
+			Assert::ExpectException<std::runtime_error>([&unassigned]() {auto& value = *unassigned; UNREFERENCED_LOCAL(value); });
+			FlatHashMap<Foo, int>::ConstIterator unassignedConst;
+			Assert::ExpectException<std::runtime_error>([&unassignedConst]() { ++unassignedConst; });
+			Assert::ExpectException<std::runtime_error>([&unassignedConst]() {auto& value = *unassignedConst; UNREFERENCED_LOCAL(value); });
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
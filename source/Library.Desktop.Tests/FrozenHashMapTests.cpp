@@ -0,0 +1,222 @@
+/// <summary>
+/// Unit tests exercising the functionality of FrozenHashMap.
+/// </summary>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Foo.h"
+#include "ToStringSpecializations.h"
+#include "FrozenHashMap.h"
+#include "HashMap.h"
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+using namespace FIEAGameEngine;
+using namespace std;
+using namespace std::string_literals;
+
+namespace FIEAGameEngine {
+	template<>
+	struct DefaultEquality<const Foo> final {
+		bool operator()(const Foo& lhs, const Foo& rhs) const {
+			return lhs == rhs;
+		}
+	};
+
+	template<>
+	inline std::size_t DefaultHash<Foo>::operator()(const Foo& key) const {
+		const std::size_t hashPrime = 11;
+		return key.Data() * hashPrime;
+	}
+}
+
+namespace LibraryDesktopTests
+{
+	struct CollidingHash final {
+		std::size_t operator()(const int& key) const {
+			return static_cast<std::size_t>(key % 4);
+		}
+	};
+
+	TEST_CLASS(FrozenHashMapTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Constructors)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			const Foo c{ 30 };
+			{
+				FrozenHashMap<Foo, int> frozenMap;
+				Assert::AreEqual(size_t(0), frozenMap.Size());
+				Assert::AreEqual(size_t(0), frozenMap.SlotCount());
+				Assert::IsTrue(frozenMap.IsEmpty());
+				Assert::IsFalse(frozenMap.ContainsKey(a));
+				Assert::IsTrue(frozenMap.Find(a) == frozenMap.end());
+				Assert::IsTrue(frozenMap.begin() == frozenMap.end());
+				Assert::ExpectException<std::runtime_error>([&frozenMap, &a]() { auto& value = frozenMap.At(a); UNREFERENCED_LOCAL(value); });
+			}
+			{
+				FrozenHashMap<Foo, int> frozenMap{ { a, a.Data() }, { b, b.Data() }, { a, 0 } };
+				Assert::AreEqual(size_t(2), frozenMap.Size());
+				Assert::IsFalse(frozenMap.IsEmpty());
+				Assert::IsTrue(frozenMap.SlotCount() >= frozenMap.Size());
+				Assert::AreEqual(a.Data(), frozenMap.At(a));
+				Assert::AreEqual(b.Data(), frozenMap.At(b));
+
+				FrozenHashMap<Foo, int> copiedMap(frozenMap);
+				Assert::AreEqual(size_t(2), copiedMap.Size());
+				Assert::AreEqual(b.Data(), copiedMap.At(b));
+
+				FrozenHashMap<Foo, int> movedMap(std::move(copiedMap));
+				Assert::AreEqual(size_t(2), movedMap.Size());
+				Assert::AreEqual(a.Data(), movedMap.At(a));
+
+				movedMap = FrozenHashMap<Foo, int>{ { c, c.Data() } };
+				Assert::AreEqual(size_t(1), movedMap.Size());
+				Assert::IsFalse(movedMap.ContainsKey(a));
+				Assert::AreEqual(c.Data(), movedMap.At(c));
+
+				movedMap = frozenMap;
+				Assert::AreEqual(size_t(2), movedMap.Size());
+				Assert::IsFalse(movedMap.ContainsKey(c));
+			}
+			{
+				HashMap<Foo, int> hashMap{ { a, a.Data() }, { b, b.Data() }, { c, c.Data() } };
+				FrozenHashMap<Foo, int> frozenMap(hashMap.begin(), hashMap.end());
+				Assert::AreEqual(hashMap.Size(), frozenMap.Size());
+				for (const auto& entry : hashMap) {
+					Assert::AreEqual(entry.second, frozenMap.At(entry.first));
+				}
+			}
+		}
+
+		TEST_METHOD(FindAndAt)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			const Foo c{ 30 };
+			const Foo d{ 40 };
+			const FrozenHashMap<Foo, int> frozenMap{ { a, a.Data() }, { b, b.Data() }, { c, c.Data() } };
+
+			Assert::IsTrue(frozenMap.ContainsKey(a));
+			Assert::IsTrue(frozenMap.ContainsKey(c));
+			Assert::IsFalse(frozenMap.ContainsKey(d));
+
+			auto found = frozenMap.Find(b);
+			Assert::IsTrue(found != frozenMap.end());
+			Assert::AreEqual(b, (*found).first);
+			Assert::AreEqual(b.Data(), (*found).second);
+			Assert::IsTrue(frozenMap.Find(d) == frozenMap.cend());
+
+			Assert::AreEqual(c.Data(), frozenMap.At(c));
+			Assert::ExpectException<std::runtime_error>([&frozenMap, &d]() { auto& value = frozenMap.At(d); UNREFERENCED_LOCAL(value); });
+		}
+
+		TEST_METHOD(HeterogeneousLookup)
+		{
+			const FrozenHashMap<std::string, int> frozenMap{ { "Integer"s, 1 }, { "Float"s, 2 }, { "String"s, 3 } };
+
+			const std::string_view key = "Float"sv;
+			Assert::IsTrue(frozenMap.ContainsKey(key));
+			Assert::IsTrue(frozenMap.ContainsKey("String"));
+			Assert::IsFalse(frozenMap.ContainsKey("Table"sv));
+			Assert::AreEqual(2, frozenMap.At(key));
+			Assert::AreEqual(3, frozenMap.At("String"));
+			Assert::IsTrue(frozenMap.Find("Integer"s) == frozenMap.Find("Integer"));
+			Assert::IsTrue(frozenMap.Find("Table"sv) == frozenMap.end());
+			Assert::ExpectException<std::runtime_error>([&frozenMap]() { auto& value = frozenMap.At("Table"); UNREFERENCED_LOCAL(value); });
+		}
+
+		TEST_METHOD(IterationOrder)
+		{
+			const FrozenHashMap<std::string, int> frozenMap{ { "c"s, 3 }, { "a"s, 1 }, { "b"s, 2 }, { "a"s, 4 } };
+
+			const std::string expectedKeys[] = { "c"s, "a"s, "b"s };
+			const int expectedData[] = { 3, 1, 2 };
+			std::size_t index = 0;
+			for (const auto& entry : frozenMap) {
+				Assert::AreEqual(expectedKeys[index], entry.first);
+				Assert::AreEqual(expectedData[index], entry.second);
+				++index;
+			}
+			Assert::AreEqual(size_t(3), index);
+		}
+
+		TEST_METHOD(ManyKeys)
+		{
+			const int keyCount = 4096;
+			HashMap<std::string, int> hashMap;
+			for (int i = 0; i < keyCount; ++i) {
+				hashMap.Insert({ "key"s + std::to_string(i), i });
+			}
+
+			const FrozenHashMap<std::string, int> frozenMap(hashMap.begin(), hashMap.end());
+			Assert::AreEqual(size_t(keyCount), frozenMap.Size());
+			Assert::IsTrue(frozenMap.SlotCount() <= size_t(4) * size_t(keyCount));
+			for (int i = 0; i < keyCount; ++i) {
+				Assert::AreEqual(i, frozenMap.At("key"s + std::to_string(i)));
+			}
+			for (int i = keyCount; i < 2 * keyCount; ++i) {
+				Assert::IsFalse(frozenMap.ContainsKey("key"s + std::to_string(i)));
+			}
+
+			const FrozenHashMap<int, int> integerMap{ { 0, 0 }, { 1, 1 }, { -1, -1 }, { 1 << 20, 2 }, { 1 << 30, 3 } };
+			Assert::AreEqual(-1, integerMap.At(-1));
+			Assert::AreEqual(3, integerMap.At(1 << 30));
+			Assert::IsFalse(integerMap.ContainsKey(2));
+		}
+
+		TEST_METHOD(CollidingHashCodes)
+		{
+			using CollidingMap = FrozenHashMap<int, int, CollidingHash>;
+			const CollidingMap frozenMap{ { 0, 0 }, { 1, 1 }, { 2, 2 }, { 3, 3 }, { 0, 4 } };
+			Assert::AreEqual(size_t(4), frozenMap.Size());
+			Assert::AreEqual(2, frozenMap.At(2));
+			Assert::IsFalse(frozenMap.ContainsKey(5));
+			Assert::IsTrue(frozenMap.SlotCount() > size_t(0));
+
+			const CollidingMap collidingMap{ { 1, 1 }, { 5, 5 }, { 2, 2 }, { 9, 9 } };
+			Assert::AreEqual(size_t(4), collidingMap.Size());
+			Assert::AreEqual(size_t(0), collidingMap.SlotCount());
+			Assert::AreEqual(5, collidingMap.At(5));
+			Assert::AreEqual(9, collidingMap.At(9));
+			Assert::AreEqual(2, (*collidingMap.Find(2)).second);
+			Assert::IsFalse(collidingMap.ContainsKey(13));
+			Assert::IsTrue(collidingMap.Find(13) == collidingMap.end());
+			Assert::ExpectException<std::runtime_error>([&collidingMap]() { auto& value = collidingMap.At(13); UNREFERENCED_LOCAL(value); });
+
+			int index = 0;
+			for (const auto& [key, value] : collidingMap) {
+				Assert::AreEqual(key, value);
+				++index;
+			}
+			Assert::AreEqual(4, index);
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
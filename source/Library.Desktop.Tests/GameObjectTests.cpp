@@ -12,6 +12,8 @@
 #include "ActionList.h"
 #include "DummyAction.h"
 #include "GameTime.h"
+#include "CountingResource.h"
+#include <sstream>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace UnitTests;
@@ -345,6 +347,71 @@ namespace LibraryDesktopTests
 			Assert::AreEqual(4, dummyAction3->updateNumber);
 		}
 
+		TEST_METHOD(DeserializeAllocations)
+		{
+			const string fileName = R"(TestFiles\TestGameObject.json)"s;
+			CountingResource counting;
+			size_t loadAllocations = 0;
+			size_t scopeSize = 0;
+
+			MemoryResource* previous = SetDefaultResource(&counting);
+			{
+				Scope parentScope;
+				shared_ptr<Wrapper> wrapper = make_shared<JsonTableParseHelper::Wrapper>(parentScope);
+				JsonParseCoordinator parseCoordinator(wrapper);
+				parseCoordinator.AddHelper(make_shared<JsonTableParseHelper>());
+
+				size_t before = counting.Allocations;
+				parseCoordinator.DeserializeObjectFromFile(fileName);
+				loadAllocations = counting.Allocations - before;
+				scopeSize = parentScope.Size();
+			}
+			SetDefaultResource(previous);
+
+			std::ostringstream report;
+			report << "Loading " << fileName << " made " << loadAllocations << " allocations through the default resource.\n";
+			Logger::WriteMessage(report.str().c_str());
+
+			Assert::AreEqual(size_t(1), scopeSize);
+			Assert::IsTrue(loadAllocations > 0);
+			Assert::AreEqual(size_t(0), counting.Outstanding);
+		}
+
+		TEST_METHOD(SceneResourceUsage)
+		{
+			const size_t gameObjectCount = 16;
+			CountingResource counting;
+			size_t resourceBytes = 0;
+			size_t datumCount = 0;
+			size_t attributeCount = 0;
+			size_t childCount = 0;
+
+			MemoryResource* previous = SetDefaultResource(&counting);
+			{
+				GameObject root;
+				size_t before = counting.OutstandingBytes;
+				for (size_t i = 0; i < gameObjectCount; ++i) {
+					root.CreateChild("GameObject"s, "child"s);
+				}
+				resourceBytes = counting.OutstandingBytes - before;
+
+				Datum& children = root.At("children"s);
+				childCount = children.Size();
+				attributeCount = children.GetAsTable(0).Size();
+				for (size_t i = 0; i < childCount; ++i) {
+					datumCount += children.GetAsTable(i).Size();
+				}
+			}
+			SetDefaultResource(previous);
+
+			Assert::AreEqual(gameObjectCount, childCount);
+			Assert::AreEqual(gameObjectCount * attributeCount, datumCount);
+			Assert::IsTrue(sizeof(Datum) <= size_t(64));
+			//each child's node pool and the nodes holding its Datums are obtained through the default resource
+			Assert::IsTrue(resourceBytes >= gameObjectCount * (sizeof(NodePool) + attributeCount * sizeof(Datum)));
+			Assert::AreEqual(size_t(0), counting.Outstanding);
+		}
+
 		TEST_METHOD(CreateChild)
 		{
 			GameObject gameObject;
@@ -0,0 +1,123 @@
+/// <summary>
+/// Unit tests exercising the growth policies and their use by Vector.
+/// </summary>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "GrowthPolicy.h"
+#include "Vector.h"
+#include "ToStringSpecializations.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+using namespace FIEAGameEngine;
+using namespace std;
+
+namespace LibraryDesktopTests
+{
+	static_assert(HalfAgainGrowth{}(10) == 5);
+	static_assert(DoublingGrowth{}(10) == 10);
+	static_assert(FixedGrowth<8>{}(100) == 8);
+	static_assert(NextCapacity(HalfAgainGrowth{}, 0, sizeof(int)) == 1);
+	static_assert(NextCapacity(PageRoundedGrowth<>{}, 0, sizeof(int)) == 1024);
+	static_assert(sizeof(Vector<int>) == sizeof(Vector<int, DoublingGrowth>));
+
+	TEST_CLASS(GrowthPolicyTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Policies)
+		{
+			for (size_t capacity : { size_t(0), size_t(1), size_t(7), size_t(100), size_t(4096) }) {
+				Assert::AreEqual(DefaultGrowth{}(capacity), HalfAgainGrowth{}(capacity));
+				Assert::AreEqual(NextCapacity(DefaultGrowth{}, capacity, sizeof(int)), NextCapacity(HalfAgainGrowth{}, capacity, sizeof(int)));
+				Assert::AreEqual(std::max(capacity * 2, size_t(1)), NextCapacity(DoublingGrowth{}, capacity, sizeof(int)));
+				Assert::AreEqual(capacity + 16, NextCapacity(FixedGrowth<16>{}, capacity, sizeof(int)));
+			}
+
+			for (size_t elementSize : { size_t(1), size_t(12), sizeof(int), size_t(64), size_t(5000) }) {
+				size_t capacity = 0;
+				for (int i = 0; i < 10; ++i) {
+					size_t nextCapacity = NextCapacity(PageRoundedGrowth<>{}, capacity, elementSize);
+					Assert::IsTrue(nextCapacity >= NextCapacity(HalfAgainGrowth{}, capacity, elementSize));
+					Assert::IsTrue((nextCapacity + 1) * elementSize > ((nextCapacity * elementSize + 4095) / 4096) * 4096);
+					capacity = nextCapacity;
+				}
+			}
+
+			RuntimeGrowth runtimeGrowth;
+			Assert::AreEqual(size_t(5), runtimeGrowth(10));
+			runtimeGrowth = [](size_t capacity) { return capacity + 3; };
+			Assert::AreEqual(size_t(13), runtimeGrowth(10));
+			Assert::AreEqual(size_t(1), NextCapacity(RuntimeGrowth{ [](size_t) { return size_t(0); } }, 0, sizeof(int)));
+		}
+
+		TEST_METHOD(VectorGrowth)
+		{
+			{
+				Vector<int, DoublingGrowth> vector;
+				for (int i = 0; i < 5; ++i) {
+					vector.PushBack(i);
+				}
+				Assert::AreEqual(size_t(8), vector.Capacity());
+			}
+			{
+				Vector<int, FixedGrowth<3>> vector;
+				for (int i = 0; i < 7; ++i) {
+					vector.PushBack(i);
+				}
+				Assert::AreEqual(size_t(9), vector.Capacity());
+				Assert::AreEqual(6, vector.Back());
+			}
+			{
+				Vector<int, PageRoundedGrowth<>> vector;
+				vector.PushBack(1);
+				Assert::AreEqual(size_t(4096) / sizeof(int), vector.Capacity());
+			}
+			{
+				Vector<int, RuntimeGrowth> vector(0, [](size_t capacity) { return capacity + 2; });
+				vector.PushBack(1);
+				vector.PushBack(2);
+				Assert::AreEqual(size_t(2), vector.Capacity());
+				vector.PushBack(3);
+				Assert::AreEqual(size_t(6), vector.Capacity());
+				Assert::AreEqual(size_t(7), vector.GetGrowthPolicy()(size_t(5)));
+
+				Vector<int, RuntimeGrowth> copy(vector);
+				Assert::AreEqual(size_t(7), copy.GetGrowthPolicy()(size_t(5)));
+
+				Vector<int, RuntimeGrowth> moved(std::move(copy));
+				Assert::AreEqual(size_t(7), moved.GetGrowthPolicy()(size_t(5)));
+
+				Vector<int, RuntimeGrowth> assigned;
+				Assert::AreEqual(size_t(2), assigned.GetGrowthPolicy()(size_t(5)));
+				assigned = moved;
+				Assert::AreEqual(size_t(7), assigned.GetGrowthPolicy()(size_t(5)));
+				Assert::AreEqual(size_t(3), assigned.Size());
+			}
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
@@ -10,6 +10,10 @@
 #include "HashMap.h"
 #include "DefaultHash.h"
 #include "DefaultEquality.h"
+#include <algorithm>
+#include <cctype>
+#include <functional>
+#include <tuple>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace UnitTests;
@@ -716,6 +720,116 @@ namespace LibraryDesktopTests
 			}
 		}
 
+		TEST_METHOD(Emplace)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			HashMap<Foo, int> hashMap;
+
+			auto [iter, inserted] = hashMap.Emplace(a, a.Data());
+			Assert::IsTrue(inserted);
+			Assert::AreEqual(a, iter->first);
+			Assert::AreEqual(a.Data(), iter->second);
+
+			std::tie(iter, inserted) = hashMap.Emplace(std::piecewise_construct, std::forward_as_tuple(b.Data()), std::forward_as_tuple(b.Data()));
+			Assert::IsTrue(inserted);
+			Assert::AreEqual(b, iter->first);
+			Assert::AreEqual(size_t(2), hashMap.Size());
+
+			std::tie(iter, inserted) = hashMap.Emplace(a, 0);
+			Assert::IsFalse(inserted);
+			Assert::AreEqual(a.Data(), iter->second);
+			Assert::AreEqual(size_t(2), hashMap.Size());
+		}
+
+		TEST_METHOD(TryEmplace)
+		{
+			{
+				HashMap<std::string, std::string> hashMap;
+				std::string value = "Health";
+
+				auto [iter, inserted] = hashMap.TryEmplace("hp"s, std::move(value));
+				Assert::IsTrue(inserted);
+				Assert::AreEqual("Health"s, iter->second);
+				Assert::IsTrue(value.empty());
+
+				value = "Armor";
+				std::tie(iter, inserted) = hashMap.TryEmplace("hp"s, std::move(value));
+				Assert::IsFalse(inserted);
+				Assert::AreEqual("Health"s, iter->second);
+				Assert::AreEqual("Armor"s, value);
+
+				std::string key = "ap";
+				std::tie(iter, inserted) = hashMap.TryEmplace(key, size_t(3), 'x');
+				Assert::IsTrue(inserted);
+				Assert::AreEqual("xxx"s, iter->second);
+				Assert::AreEqual("ap"s, key);
+
+				std::tie(iter, inserted) = hashMap.TryEmplace("mp"sv);
+				Assert::IsTrue(inserted);
+				Assert::AreEqual("mp"s, iter->first);
+				Assert::IsTrue(iter->second.empty());
+
+				std::tie(iter, inserted) = hashMap.TryEmplace("hp");
+				Assert::IsFalse(inserted);
+				Assert::AreEqual("Health"s, iter->second);
+				Assert::AreEqual(size_t(3), hashMap.Size());
+			}
+			{
+				HashMap<std::string, int> hashMap;
+				for (int i = 0; i < 50; ++i) {
+					Assert::IsTrue(hashMap.TryEmplace("key"s + std::to_string(i), i).second);
+				}
+				for (int i = 0; i < 50; ++i) {
+					Assert::AreEqual(i, hashMap["key"s + std::to_string(i)]);
+				}
+				hashMap["key7"sv] = 70;
+				Assert::AreEqual(70, hashMap.At("key7"));
+				Assert::AreEqual(0, hashMap["key50"]);
+				Assert::AreEqual(size_t(51), hashMap.Size());
+			}
+			{
+				HashMap<std::string, int, StoredHash<DefaultHash<std::string>>> hashMap;
+				Assert::IsTrue(hashMap.TryEmplace("hp"sv, 100).second);
+				Assert::IsFalse(hashMap.TryEmplace("hp"s, 50).second);
+				Assert::AreEqual(100, hashMap["hp"]);
+				hashMap.InsertOrAssign("hp", 50);
+				Assert::AreEqual(50, hashMap.At("hp"s));
+			}
+		}
+
+		TEST_METHOD(InsertOrAssign)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			{
+				HashMap<Foo, Foo> hashMap;
+
+				auto [iter, inserted] = hashMap.InsertOrAssign(a, b);
+				Assert::IsTrue(inserted);
+				Assert::AreEqual(b, iter->second);
+
+				std::tie(iter, inserted) = hashMap.InsertOrAssign(a, a);
+				Assert::IsFalse(inserted);
+				Assert::AreEqual(a, iter->second);
+
+				Foo key{ 30 };
+				std::tie(iter, inserted) = hashMap.InsertOrAssign(std::move(key), Foo{ 40 });
+				Assert::IsTrue(inserted);
+				Assert::AreEqual(Foo{ 30 }, iter->first);
+				Assert::AreEqual(Foo{ 40 }, iter->second);
+				Assert::AreEqual(size_t(2), hashMap.Size());
+			}
+			{
+				HashMap<std::string, int> hashMap;
+				Assert::IsTrue(hashMap.InsertOrAssign("hp"sv, 100).second);
+				Assert::IsFalse(hashMap.InsertOrAssign("hp", 50).second);
+				Assert::IsFalse(hashMap.InsertOrAssign("hp"s, 25).second);
+				Assert::AreEqual(25, hashMap.At("hp"));
+				Assert::AreEqual(size_t(1), hashMap.Size());
+			}
+		}
+
 		TEST_METHOD(RemoveByKey)
 		{
 			const Foo a(10);
@@ -1106,6 +1220,339 @@ namespace LibraryDesktopTests
 			}
 		}
 
+		TEST_METHOD(HeterogeneousLookup)
+		{
+			DefaultHash<std::string> hashFunc;
+			Assert::AreEqual(hashFunc("key"s), hashFunc("key"sv));
+			Assert::AreEqual(hashFunc("key"s), hashFunc("key"));
+
+			HashMap<std::string, int> hashMap;
+			for (int i = 0; i < 50; ++i) {
+				hashMap.Insert({ "key"s + std::to_string(i), i });
+			}
+
+			const std::string_view key = "key17"sv;
+			Assert::IsTrue(hashMap.ContainsKey(key));
+			Assert::IsTrue(hashMap.ContainsKey("key42"));
+			Assert::IsFalse(hashMap.ContainsKey("key50"sv));
+			Assert::AreEqual(17, hashMap.At(key));
+			Assert::AreEqual(42, hashMap.At("key42"));
+			Assert::IsTrue(hashMap.Find("key3"s) == hashMap.Find("key3"));
+			Assert::IsTrue(hashMap.end() == hashMap.Find("missing"sv));
+			Assert::ExpectException<std::runtime_error>([&hashMap]() {auto& value = hashMap.At("missing"); UNREFERENCED_LOCAL(value); });
+
+			const HashMap<std::string, int>& constHashMap = hashMap;
+			Assert::AreEqual(17, constHashMap.At(key));
+			Assert::IsTrue(constHashMap.cend() == constHashMap.Find("missing"));
+			Assert::AreEqual(std::string("key3"), constHashMap.Find("key3"sv)->first);
+
+			hashMap.Remove("key17"sv);
+			hashMap.Remove("key18");
+			Assert::IsFalse(hashMap.ContainsKey(key));
+			Assert::IsFalse(hashMap.ContainsKey("key18"s));
+			Assert::AreEqual(size_t(48), hashMap.Size());
+		}
+
+		TEST_METHOD(Reserve)
+		{
+			HashMap<Foo, int> hashMap(size_t(2));
+			Assert::AreEqual(size_t(2), hashMap.ChainCount());
+
+			hashMap.Reserve(size_t(1));
+			Assert::AreEqual(size_t(2), hashMap.ChainCount());
+
+			for (int i = 0; i < 10; ++i) {
+				hashMap.Insert({ Foo(i), i });
+			}
+			hashMap.Reserve(size_t(100));
+			Assert::AreEqual(size_t(100), hashMap.ChainCount());
+			Assert::AreEqual(size_t(10), hashMap.Size());
+			for (int i = 0; i < 10; ++i) {
+				Assert::AreEqual(i, hashMap.At(Foo(i)));
+			}
+
+			for (int i = 10; i < 100; ++i) {
+				hashMap.Insert({ Foo(i), i });
+			}
+			Assert::AreEqual(size_t(100), hashMap.ChainCount());
+
+			hashMap.SetMaxLoadFactor(4.0);
+			hashMap.Reserve(size_t(100));
+			Assert::AreEqual(size_t(100), hashMap.ChainCount());
+			hashMap.Reserve(size_t(800));
+			Assert::AreEqual(size_t(200), hashMap.ChainCount());
+		}
+
+		TEST_METHOD(Rehash)
+		{
+			HashMap<Foo, int> hashMap(size_t(2));
+			hashMap.SetMaxLoadFactor(0.0);
+			for (int i = 0; i < 50; ++i) {
+				hashMap.Insert({ Foo(i), i });
+			}
+			Assert::AreEqual(size_t(2), hashMap.ChainCount());
+			Assert::AreEqual(1.0, hashMap.GetLoadFactor());
+
+			int& stored = hashMap.At(Foo(25));
+			hashMap.Rehash(size_t(50));
+			Assert::AreEqual(size_t(50), hashMap.ChainCount());
+			Assert::AreEqual(size_t(50), hashMap.Size());
+			Assert::AreSame(stored, hashMap.At(Foo(25)));
+
+			size_t count = 0;
+			for (const auto& [key, value] : hashMap) {
+				Assert::AreEqual(key.Data(), value);
+				++count;
+			}
+			Assert::AreEqual(size_t(50), count);
+
+			hashMap.Rehash(size_t(3));
+			Assert::AreEqual(size_t(3), hashMap.ChainCount());
+			Assert::AreEqual(1.0, hashMap.GetLoadFactor());
+			Assert::AreSame(stored, hashMap.At(Foo(25)));
+			for (int i = 0; i < 50; ++i) {
+				Assert::AreEqual(i, hashMap.At(Foo(i)));
+			}
+		}
+
+		TEST_METHOD(MaxLoadFactor)
+		{
+			HashMap<Foo, int> hashMap(size_t(2));
+			Assert::AreEqual(1.0, hashMap.GetMaxLoadFactor());
+
+			hashMap.Insert({ Foo(0), 0 });
+			hashMap.Insert({ Foo(1), 1 });
+			Assert::AreEqual(size_t(2), hashMap.ChainCount());
+
+			auto [iter, inserted] = hashMap.Insert({ Foo(2), 2 });
+			Assert::IsTrue(inserted);
+			Assert::AreEqual(Foo(2), iter->first);
+			Assert::AreEqual(size_t(5), hashMap.ChainCount());
+
+			for (int i = 3; i < 1000; ++i) {
+				hashMap[Foo(i)] = i;
+			}
+			Assert::AreEqual(size_t(1000), hashMap.Size());
+			Assert::IsTrue(hashMap.Size() <= hashMap.ChainCount() * hashMap.GetMaxLoadFactor());
+			for (int i = 0; i < 1000; ++i) {
+				Assert::AreEqual(i, hashMap.At(Foo(i)));
+			}
+
+			HashMap<Foo, int> anotherHashMap(size_t(2));
+			anotherHashMap.SetMaxLoadFactor(0.0);
+			for (int i = 0; i < 100; ++i) {
+				anotherHashMap.Insert({ Foo(i), i });
+			}
+			Assert::AreEqual(size_t(2), anotherHashMap.ChainCount());
+			Assert::AreEqual(size_t(100), anotherHashMap.Size());
+		}
+
+		TEST_METHOD(IncrementalRehash)
+		{
+			HashMap<Foo, int> hashMap(size_t(8));
+			hashMap.SetIncrementalRehash(size_t(4));
+			Assert::AreEqual(size_t(4), hashMap.GetIncrementalRehash());
+
+			Vector<const int*> addresses;
+			for (int i = 0; i < 8; ++i) {
+				addresses.PushBack(&hashMap.Insert({ Foo(i), i }).first->second);
+			}
+			Assert::IsFalse(hashMap.IsRehashing());
+
+			hashMap.Insert({ Foo(8), 8 });
+			Assert::IsTrue(hashMap.IsRehashing());
+			Assert::AreEqual(size_t(17), hashMap.ChainCount());
+
+			for (int i = 0; i < 9; ++i) {
+				Assert::IsTrue(hashMap.ContainsKey(Foo(i)));
+			}
+			size_t count = 0;
+			for (auto iter = hashMap.cbegin(); iter != hashMap.cend(); ++iter) {
+				++count;
+			}
+			Assert::AreEqual(size_t(9), count);
+
+			hashMap.Insert({ Foo(9), 9 });
+			Assert::IsTrue(hashMap.IsRehashing());
+			hashMap.Remove(Foo(8));
+			Assert::IsFalse(hashMap.IsRehashing());
+			hashMap[Foo(10)] = 10;
+			Assert::AreEqual(size_t(17), hashMap.ChainCount());
+			Assert::AreEqual(size_t(10), hashMap.Size());
+			Assert::IsFalse(hashMap.ContainsKey(Foo(8)));
+			for (int i = 0; i < 8; ++i) {
+				Assert::AreEqual(addresses[i], &hashMap.At(Foo(i)));
+			}
+
+			for (int i = 11; i < 19; ++i) {
+				hashMap.Insert({ Foo(i), i });
+			}
+			Assert::IsTrue(hashMap.IsRehashing());
+			hashMap.SetIncrementalRehash(size_t(0));
+			Assert::IsFalse(hashMap.IsRehashing());
+			Assert::AreEqual(size_t(35), hashMap.ChainCount());
+			Assert::AreEqual(size_t(18), hashMap.Size());
+
+			for (int i = 19; i < 36; ++i) {
+				hashMap.Insert({ Foo(i), i });
+			}
+			hashMap.SetIncrementalRehash(size_t(1));
+			hashMap.Insert({ Foo(36), 36 });
+			Assert::IsTrue(hashMap.IsRehashing());
+			hashMap.Clear();
+			Assert::IsFalse(hashMap.IsRehashing());
+			Assert::AreEqual(size_t(0), hashMap.Size());
+			Assert::AreEqual(0.0, hashMap.GetLoadFactor());
+			Assert::AreEqual(hashMap.begin(), hashMap.end());
+		}
+
+		TEST_METHOD(EqualityPolicy)
+		{
+			struct CaseInsensitiveHash {
+				size_t operator()(const std::string& key) const {
+					size_t hashValue = 0;
+					for (char letter : key) {
+						hashValue = hashValue * 31 + static_cast<size_t>(std::tolower(static_cast<unsigned char>(letter)));
+					}
+					return hashValue;
+				}
+			};
+			struct CaseInsensitiveEquality {
+				bool operator()(const std::string& lhs, const std::string& rhs) const {
+					return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](char a, char b) {
+						return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+					});
+				}
+			};
+			using RuntimeEquality = std::function<bool(const std::string&, const std::string&)>;
+
+			Assert::IsTrue(std::is_same_v<DefaultEquality<const Foo>, HashMap<Foo, int>::key_equal>);
+			Assert::IsTrue(sizeof(HashMap<std::string, int>) < sizeof(HashMap<std::string, int, DefaultHash<std::string>, RuntimeEquality>));
+			{
+				HashMap<std::string, int, CaseInsensitiveHash, CaseInsensitiveEquality> hashMap{ { "Health"s, 100 }, { "Armor"s, 50 } };
+				Assert::IsTrue(hashMap.ContainsKey("HEALTH"s));
+				Assert::AreEqual(50, hashMap.At("armor"s));
+				Assert::IsFalse(hashMap.Insert({ "health"s, 0 }).second);
+				Assert::AreEqual(size_t(2), hashMap.Size());
+				hashMap.Remove("ARMOR"s);
+				Assert::IsFalse(hashMap.ContainsKey("Armor"s));
+			}
+			{
+				HashMap<std::string, int, DefaultHash<std::string>, RuntimeEquality> hashMap(size_t(13), [](const std::string& lhs, const std::string& rhs) { return lhs == rhs; });
+				hashMap["Health"s] = 100;
+				Assert::IsTrue(hashMap.ContainsKey("Health"s));
+				Assert::IsFalse(hashMap.ContainsKey("HEALTH"s));
+
+				auto copy = hashMap;
+				copy = hashMap;
+				Assert::AreEqual(100, copy.At("Health"s));
+			}
+		}
+
+#ifdef USE_HASHMAP_STATISTICS
+		TEST_METHOD(Statistics)
+		{
+			HashMap<Foo, int> hashMap(size_t(4));
+			hashMap.SetMaxLoadFactor(0.0);
+			for (int i = 0; i < 12; ++i) {
+				hashMap.Insert({ Foo(i), i });
+			}
+
+			HashMapStatistics statistics = hashMap.GetStatistics();
+			Assert::AreEqual(size_t(4), statistics.BucketCount);
+			Assert::AreEqual(size_t(12), statistics.Population);
+			Assert::AreEqual(size_t(3), statistics.LongestChain);
+			Assert::AreEqual(3.0, statistics.MeanChainLength);
+			Assert::AreEqual(size_t(4), statistics.ChainLengthHistogram.Size());
+			Assert::AreEqual(size_t(4), statistics.ChainLengthHistogram[3]);
+			Assert::AreEqual(size_t(12), statistics.InsertCount);
+			Assert::AreEqual(size_t(12), statistics.FindCount);
+			Assert::AreEqual(size_t(12), statistics.ProbeCount);
+			Assert::IsTrue(statistics.MemoryFootprint >= sizeof(hashMap) + 4 * sizeof(HashMap<Foo, int>::ChainType) + 12 * HashMap<Foo, int>::ChainType::NodeSize);
+			Assert::IsFalse(statistics.ToString().empty());
+
+			hashMap.ResetStatistics();
+			Assert::IsTrue(hashMap.ContainsKey(Foo(0)));
+			Assert::IsFalse(hashMap.ContainsKey(Foo(100)));
+			statistics = hashMap.GetStatistics();
+			Assert::AreEqual(size_t(0), statistics.InsertCount);
+			Assert::AreEqual(size_t(2), statistics.FindCount);
+			Assert::AreEqual(size_t(4), statistics.ProbeCount);
+			Assert::AreEqual(2.0, statistics.ProbesPerFind());
+
+			hashMap.Clear();
+			statistics = hashMap.GetStatistics();
+			Assert::AreEqual(size_t(0), statistics.LongestChain);
+			Assert::AreEqual(0.0, statistics.MeanChainLength);
+			Assert::AreEqual(size_t(4), statistics.ChainLengthHistogram[0]);
+		}
+#endif // USE_HASHMAP_STATISTICS
+
+		TEST_METHOD(StoredHashCodes)
+		{
+			size_t comparisons = 0;
+			auto countingEquality = [&comparisons](const Foo& lhs, const Foo& rhs) { ++comparisons; return lhs == rhs; };
+			using CountingEquality = decltype(countingEquality);
+			using StoredHashMap = HashMap<Foo, int, StoredHash<DefaultHash<Foo>>, CountingEquality>;
+			Assert::IsTrue(StoredHashMap::StoresHashes);
+			Assert::IsFalse(HashMap<Foo, int>::StoresHashes);
+			{
+				StoredHashMap hashMap(size_t(2), countingEquality);
+				hashMap.SetMaxLoadFactor(0.0);
+				for (int i = 0; i < 20; i += 2) {
+					Assert::IsTrue(hashMap.Insert({ Foo(i), i }).second);
+				}
+				Assert::AreEqual(size_t(0), comparisons);
+
+				for (int i = 0; i < 20; i += 2) {
+					Assert::AreEqual(i, hashMap.At(Foo(i)));
+				}
+				Assert::AreEqual(size_t(10), comparisons);
+
+				Assert::IsFalse(hashMap.ContainsKey(Foo(68)));
+				Assert::IsFalse(hashMap.Insert({ Foo(6), 60 }).second);
+				Assert::AreEqual(size_t(11), comparisons);
+				Assert::AreEqual(6, hashMap[Foo(6)]);
+
+				hashMap.Remove(Foo(10));
+				Assert::IsFalse(hashMap.ContainsKey(Foo(10)));
+				Assert::AreEqual(size_t(9), hashMap.Size());
+			}
+			{
+				comparisons = 0;
+				HashMap<Foo, int, DefaultHash<Foo>, CountingEquality> hashMap(size_t(2), countingEquality);
+				hashMap.SetMaxLoadFactor(0.0);
+				for (int i = 0; i < 20; i += 2) {
+					hashMap.Insert({ Foo(i), i });
+				}
+				Assert::IsTrue(comparisons > size_t(11));
+			}
+			{
+				StoredHashMap hashMap(size_t(4), countingEquality);
+				hashMap.SetIncrementalRehash(size_t(2));
+				Vector<const int*> addresses;
+				for (int i = 0; i < 40; ++i) {
+					addresses.PushBack(&hashMap.Insert({ Foo(i), i }).first->second);
+				}
+				hashMap.SetIncrementalRehash(size_t(0));
+				Assert::IsTrue(hashMap.ChainCount() > size_t(4));
+
+				size_t count = 0;
+				for (const auto& [key, value] : hashMap) {
+					Assert::AreEqual(key.Data(), value);
+					++count;
+				}
+				Assert::AreEqual(size_t(40), count);
+				for (int i = 0; i < 40; ++i) {
+					Assert::AreEqual(addresses[i], &hashMap.At(Foo(i)));
+				}
+
+				StoredHashMap copy = hashMap;
+				Assert::AreEqual(size_t(40), copy.Size());
+				Assert::AreEqual(20, copy.Find(Foo(20))->second);
+			}
+		}
+
 #pragma region IteratorTests
 		TEST_METHOD(IteratorConstructors)
 		{
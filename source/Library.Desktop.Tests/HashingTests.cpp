@@ -0,0 +1,228 @@
+/// <summary>
+/// Unit tests exercising the byte hashing functions behind DefaultHash, including a quality report over the keys used by the test JSON files.
+/// </summary>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Hashing.h"
+#include "DefaultHash.h"
+#include "json/json.h"
+#include <algorithm>
+#include <bitset>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FIEAGameEngine;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(HashingTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(HashBytes)
+		{
+			const std::string text = "The quick brown fox jumps over the lazy dog, then does it again for good measure."s;
+			Assert::AreEqual(Hashing::HashBytes(text.data(), text.size()), Hashing::HashBytes(text.data(), text.size()));
+			Assert::AreNotEqual(Hashing::HashBytes(text.data(), text.size()), Hashing::HashBytes(text.data(), text.size(), 1));
+			Assert::AreEqual(Hashing::HashBytes(nullptr, 0), Hashing::HashBytes(text.data(), 0));
+
+			Assert::AreNotEqual(Hashing::HashBytes("ab", 2), Hashing::HashBytes("ba", 2));
+			Assert::AreNotEqual(Hashing::HashBytes("listen", 6), Hashing::HashBytes("silent", 6));
+
+			std::vector<std::uint64_t> prefixHashes;
+			for (size_t length = 0; length <= text.size(); ++length) {
+				prefixHashes.push_back(Hashing::HashBytes(text.data(), length));
+			}
+			std::sort(prefixHashes.begin(), prefixHashes.end());
+			Assert::IsTrue(std::adjacent_find(prefixHashes.begin(), prefixHashes.end()) == prefixHashes.end());
+
+			Assert::AreNotEqual(Hashing::HashWord(1), Hashing::HashWord(2));
+			Assert::AreEqual(Hashing::HashWord(42), Hashing::HashWord(42));
+		}
+
+		TEST_METHOD(Avalanche)
+		{
+			std::string text = "attribute_0123456789_abcdefghijklmnopqrstuvwxyz_0123456789"s;
+			size_t flippedBits = 0;
+			size_t trials = 0;
+			for (size_t length : { size_t(3), size_t(8), size_t(16), size_t(40), text.size() }) {
+				const std::uint64_t original = Hashing::HashBytes(text.data(), length);
+				for (size_t bit = 0; bit < length * 8; ++bit) {
+					text[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+					flippedBits += std::bitset<64>(original ^ Hashing::HashBytes(text.data(), length)).count();
+					text[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+					++trials;
+				}
+			}
+
+			const double averageFlipped = static_cast<double>(flippedBits) / trials;
+			Assert::IsTrue(averageFlipped > 30.0 && averageFlipped < 34.0);
+		}
+
+		TEST_METHOD(DefaultHashAgreement)
+		{
+			const std::string key = "children"s;
+			DefaultHash<std::string> stringHash;
+			DefaultHash<const std::string> constStringHash;
+			DefaultHash<const char*> cStringHash;
+			DefaultHash<char* const> constCStringHash;
+			const std::size_t expected = static_cast<std::size_t>(Hashing::HashBytes(key.data(), key.size()));
+
+			Assert::AreEqual(expected, stringHash(key));
+			Assert::AreEqual(expected, stringHash(std::string_view(key)));
+			Assert::AreEqual(expected, constStringHash(key));
+			Assert::AreEqual(expected, cStringHash(key.c_str()));
+			Assert::AreEqual(expected, constCStringHash(key.c_str()));
+
+			DefaultHash<int> intHash;
+			DefaultHash<std::uint64_t> wordHash;
+			Assert::AreEqual(intHash(7), wordHash(7));
+			Assert::AreNotEqual(intHash(7), intHash(-7));
+		}
+
+		TEST_METHOD(TestFileKeyDistribution)
+		{
+			std::vector<std::string> keys;
+			for (const auto& entry : std::filesystem::directory_iterator("TestFiles")) {
+				if (entry.path().extension() != ".json") continue;
+
+				std::ifstream file(entry.path());
+				std::stringstream contents;
+				contents << file.rdbuf();
+				const std::string json = contents.str();
+
+				Json::CharReaderBuilder builder;
+				std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+				Json::Value root;
+				Assert::IsTrue(reader->parse(json.c_str(), json.c_str() + json.size(), &root, nullptr));
+				CollectKeys(root, keys);
+			}
+			std::sort(keys.begin(), keys.end());
+			keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+			Assert::IsTrue(keys.size() > size_t(10));
+
+			std::vector<std::string> indexedKeys;
+			for (const std::string& key : keys) {
+				for (int index = 0; index < 100; ++index) {
+					indexedKeys.push_back(key + std::to_string(index));
+				}
+			}
+
+			auto additiveHash = [](const std::string& key) {
+				std::size_t hashValue = 0;
+				for (char letter : key) {
+					hashValue += static_cast<std::size_t>(letter) * 11;
+				}
+				return hashValue;
+			};
+			DefaultHash<std::string> defaultHash;
+
+			for (const std::vector<std::string>* keySet : { &keys, &indexedKeys }) {
+				const KeyStatistics additive = Measure(*keySet, additiveHash);
+				const KeyStatistics current = Measure(*keySet, defaultHash);
+
+				std::stringstream report;
+				report << keySet->size() << " keys from TestFiles/*.json, " << current.BucketCount << " buckets\n"
+					<< "  additive: " << additive.Collisions << " full collisions, " << additive.EmptyBuckets << " empty buckets, longest chain " << additive.LongestChain << ", " << additive.AverageProbes << " average probes\n"
+					<< "  default:  " << current.Collisions << " full collisions, " << current.EmptyBuckets << " empty buckets, longest chain " << current.LongestChain << ", " << current.AverageProbes << " average probes\n";
+				Logger::WriteMessage(report.str().c_str());
+
+				Assert::AreEqual(size_t(0), current.Collisions);
+				Assert::IsTrue(current.Collisions <= additive.Collisions);
+				Assert::IsTrue(current.AverageProbes <= additive.AverageProbes);
+				Assert::IsTrue(current.AverageProbes < 2.0);
+			}
+		}
+
+	private:
+		/// <summary>
+		/// How a set of keys distributes across a table with as many buckets as keys.
+		/// </summary>
+		struct KeyStatistics final {
+			size_t BucketCount{ 0 };
+			size_t Collisions{ 0 };
+			size_t EmptyBuckets{ 0 };
+			size_t LongestChain{ 0 };
+			double AverageProbes{ 0.0 };
+		};
+
+		/// <summary>
+		/// Gathers every member name and string value in a JSON document.
+		/// </summary>
+		static void CollectKeys(const Json::Value& value, std::vector<std::string>& keys) {
+			if (value.isString()) {
+				keys.push_back(value.asString());
+			}
+			else if (value.isObject()) {
+				for (auto iter = value.begin(); iter != value.end(); ++iter) {
+					keys.push_back(iter.key().asString());
+					CollectKeys(*iter, keys);
+				}
+			}
+			else if (value.isArray()) {
+				for (const Json::Value& element : value) {
+					CollectKeys(element, keys);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Hashes every key and measures full hash collisions along with the chain lengths a HashMap sized to the key count would see.
+		/// </summary>
+		template <typename THashFunctor>
+		static KeyStatistics Measure(const std::vector<std::string>& keys, THashFunctor hashFunctor) {
+			KeyStatistics statistics;
+			statistics.BucketCount = keys.size();
+
+			std::vector<std::size_t> hashes;
+			std::vector<size_t> buckets(statistics.BucketCount);
+			for (const std::string& key : keys) {
+				const std::size_t hash = hashFunctor(key);
+				hashes.push_back(hash);
+				++buckets[hash % statistics.BucketCount];
+			}
+
+			std::sort(hashes.begin(), hashes.end());
+			for (size_t i = 1; i < hashes.size(); ++i) {
+				if (hashes[i] == hashes[i - 1]) ++statistics.Collisions;
+			}
+
+			size_t probes = 0;
+			for (size_t chainLength : buckets) {
+				if (chainLength == 0) ++statistics.EmptyBuckets;
+				statistics.LongestChain = std::max(statistics.LongestChain, chainLength);
+				probes += chainLength * (chainLength + 1) / 2;
+			}
+			statistics.AverageProbes = static_cast<double>(probes) / keys.size();
+			return statistics;
+		}
+
+		inline static _CrtMemState _startMemState;
+	};
+}
@@ -0,0 +1,207 @@
+/// <summary>
+/// Unit tests exercising the functionality of IntrusiveDList.
+/// </summary>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "IntrusiveDList.h"
+#include "ToStringSpecializations.h"
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+using namespace FIEAGameEngine;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	struct DListLinkedFoo {
+		DListLinkedFoo(int data = 0) :
+			data{ data }
+		{};
+
+		int data;
+		IntrusiveDListHook hook;
+		IntrusiveDListHook otherHook;
+	};
+
+	TEST_CLASS(IntrusiveDListTests)
+	{
+		using List = IntrusiveDList<DListLinkedFoo, &DListLinkedFoo::hook>;
+		using OtherList = IntrusiveDList<DListLinkedFoo, &DListLinkedFoo::otherHook>;
+
+		static std::vector<int> Contents(const List& list) {
+			std::vector<int> contents;
+			for (const DListLinkedFoo& element : list) contents.push_back(element.data);
+			return contents;
+		}
+
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(PushAndPop)
+		{
+			DListLinkedFoo a{ 10 }, b{ 20 }, c{ 30 };
+			List list;
+			Assert::IsTrue(list.IsEmpty());
+			Assert::ExpectException<std::runtime_error>([&list] { auto& front = list.Front(); UNREFERENCED_LOCAL(front); });
+			Assert::ExpectException<std::runtime_error>([&list] { auto& back = list.Back(); UNREFERENCED_LOCAL(back); });
+			Assert::ExpectException<std::runtime_error>([&list] { list.PopFront(); });
+			Assert::ExpectException<std::runtime_error>([&list] { list.PopBack(); });
+
+			list.PushBack(b);
+			list.PushFront(a);
+			list.PushBack(c);
+			Assert::AreEqual(size_t(3), list.Size());
+			Assert::IsTrue(a.hook.IsLinked());
+			Assert::AreSame(a, list.Front());
+			Assert::AreSame(c, list.Back());
+			Assert::IsTrue(Contents(list) == std::vector<int>{ 10, 20, 30 });
+			Assert::ExpectException<std::runtime_error>([&list, &a] { list.PushBack(a); });
+
+			Assert::AreSame(c, list.PopBack());
+			Assert::AreSame(a, list.PopFront());
+			Assert::IsFalse(a.hook.IsLinked());
+			Assert::AreSame(b, list.PopFront());
+			Assert::IsTrue(list.IsEmpty());
+		}
+
+		TEST_METHOD(InsertAndRemove)
+		{
+			DListLinkedFoo a{ 10 }, b{ 20 }, c{ 30 }, d{ 40 };
+			List list;
+			List other;
+			Assert::ExpectException<std::runtime_error>([&list, &other, &a] { list.InsertBefore(a, other.begin()); });
+
+			auto it = list.InsertBefore(c, list.end());
+			list.InsertBefore(a, list.begin());
+			list.InsertBefore(b, it);
+			list.InsertBefore(d, list.end());
+			Assert::IsTrue(Contents(list) == std::vector<int>{ 10, 20, 30, 40 });
+			Assert::IsTrue(list.Contains(c));
+			Assert::IsFalse(other.Contains(c));
+
+			Assert::IsTrue(list.Remove(c));
+			Assert::IsFalse(list.Remove(c));
+			Assert::IsFalse(other.Remove(a));
+			Assert::IsTrue(Contents(list) == std::vector<int>{ 10, 20, 40 });
+
+			it = list.Remove(list.begin());
+			Assert::AreSame(b, *it);
+			Assert::IsTrue(list.Remove(list.end()) == list.end());
+			Assert::ExpectException<std::runtime_error>([&list, &other] { list.Remove(other.begin()); });
+			Assert::IsTrue(Contents(list) == std::vector<int>{ 20, 40 });
+
+			other.PushBack(a);
+			other.PushBack(c);
+			Assert::IsTrue(Contents(other) == std::vector<int>{ 10, 30 });
+			other.Clear();
+			Assert::IsFalse(a.hook.IsLinked());
+			list.Clear();
+			Assert::IsTrue(list.IsEmpty());
+			Assert::IsFalse(d.hook.IsLinked());
+		}
+
+		TEST_METHOD(NextAndPrevious)
+		{
+			DListLinkedFoo a{ 10 }, b{ 20 }, c{ 30 }, stranger{ 40 };
+			List list;
+			list.PushBack(a);
+			list.PushBack(b);
+			list.PushBack(c);
+
+			Assert::AreSame(b, *list.Next(a));
+			Assert::IsNull(list.Next(c));
+			Assert::AreSame(b, *list.Previous(c));
+			Assert::IsNull(list.Previous(a));
+			Assert::ExpectException<std::runtime_error>([&list, &stranger] { auto next = list.Next(stranger); UNREFERENCED_LOCAL(next); });
+			Assert::ExpectException<std::runtime_error>([&list, &stranger] { auto previous = list.Previous(stranger); UNREFERENCED_LOCAL(previous); });
+			list.Clear();
+		}
+
+		TEST_METHOD(SeveralHooks)
+		{
+			DListLinkedFoo a{ 10 }, b{ 20 };
+			List list;
+			OtherList otherList;
+			list.PushBack(a);
+			list.PushBack(b);
+			otherList.PushBack(b);
+			otherList.PushBack(a);
+
+			Assert::AreSame(a, list.Front());
+			Assert::AreSame(b, otherList.Front());
+			list.Remove(a);
+			Assert::IsFalse(a.hook.IsLinked());
+			Assert::IsTrue(a.otherHook.IsLinked());
+			Assert::AreSame(a, otherList.Back());
+
+			DListLinkedFoo copy = b;
+			Assert::IsFalse(copy.hook.IsLinked());
+			Assert::IsFalse(copy.otherHook.IsLinked());
+			copy = a;
+			Assert::IsFalse(copy.otherHook.IsLinked());
+			b = copy;
+			Assert::IsTrue(b.hook.IsLinked());
+			Assert::AreEqual(10, b.data);
+
+			list.Clear();
+			otherList.Clear();
+		}
+
+		TEST_METHOD(Iterators)
+		{
+			DListLinkedFoo a{ 10 }, b{ 20 };
+			List list;
+			List::Iterator unassociated;
+			Assert::ExpectException<std::runtime_error>([&unassociated] { ++unassociated; });
+			Assert::ExpectException<std::runtime_error>([&unassociated] { --unassociated; });
+			Assert::ExpectException<std::runtime_error>([&list] { auto& element = *list.end(); UNREFERENCED_LOCAL(element); });
+			Assert::IsTrue(list.begin() == list.end());
+
+			list.PushBack(a);
+			list.PushBack(b);
+			auto it = list.end();
+			Assert::AreSame(b, *--it);
+			(*it).data = 25;
+			Assert::AreEqual(25, b.data);
+			Assert::AreSame(b, *it--);
+			Assert::AreSame(a, *it);
+			Assert::IsTrue(it++ == list.begin());
+			Assert::IsTrue(++it == list.end());
+
+			const List& constList = list;
+			List::ConstIterator constIt = list.begin();
+			Assert::IsTrue(constIt == constList.begin());
+			Assert::IsTrue(constList.cbegin() != constList.cend());
+			Assert::AreSame(a, *constIt++);
+			Assert::AreSame(b, *constIt--);
+			Assert::AreSame(a, *constIt);
+			Assert::IsTrue(--constIt == constList.cend());
+			list.Clear();
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
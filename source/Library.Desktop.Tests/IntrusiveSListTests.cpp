@@ -0,0 +1,178 @@
+/// <summary>
+/// Unit tests exercising the functionality of IntrusiveSList.
+/// </summary>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "IntrusiveSList.h"
+#include "ToStringSpecializations.h"
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+using namespace FIEAGameEngine;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	struct SListLinkedFoo {
+		SListLinkedFoo(int data = 0) :
+			data{ data }
+		{};
+
+		int data;
+		IntrusiveSListHook hook;
+	};
+
+	TEST_CLASS(IntrusiveSListTests)
+	{
+		using List = IntrusiveSList<SListLinkedFoo, &SListLinkedFoo::hook>;
+
+		static std::vector<int> Contents(const List& list) {
+			std::vector<int> contents;
+			for (const SListLinkedFoo& element : list) contents.push_back(element.data);
+			return contents;
+		}
+
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(PushAndPop)
+		{
+			SListLinkedFoo a{ 10 }, b{ 20 }, c{ 30 };
+			List list;
+			Assert::IsTrue(list.IsEmpty());
+			Assert::ExpectException<std::runtime_error>([&list] { auto& front = list.Front(); UNREFERENCED_LOCAL(front); });
+			Assert::ExpectException<std::runtime_error>([&list] { auto& back = list.Back(); UNREFERENCED_LOCAL(back); });
+			Assert::ExpectException<std::runtime_error>([&list] { list.PopFront(); });
+
+			list.PushBack(b);
+			list.PushFront(a);
+			list.PushBack(c);
+			Assert::AreEqual(size_t(3), list.Size());
+			Assert::AreSame(a, list.Front());
+			Assert::AreSame(c, list.Back());
+			Assert::IsTrue(Contents(list) == std::vector<int>{ 10, 20, 30 });
+
+			Assert::AreSame(a, list.PopFront());
+			Assert::AreSame(b, list.PopFront());
+			Assert::AreSame(c, list.PopFront());
+			Assert::IsTrue(list.IsEmpty());
+
+			list.PushFront(c);
+			Assert::AreSame(c, list.Front());
+			Assert::AreSame(c, list.Back());
+		}
+
+		TEST_METHOD(InsertAndRemove)
+		{
+			SListLinkedFoo a{ 10 }, b{ 20 }, c{ 30 }, d{ 40 }, stranger{ 50 };
+			List list;
+			List other;
+			Assert::ExpectException<std::runtime_error>([&list, &other, &a] { list.InsertAfter(a, other.begin()); });
+
+			auto it = list.InsertAfter(a, list.end());
+			list.InsertAfter(c, it);
+			list.InsertAfter(b, it);
+			list.InsertAfter(d, list.end());
+			Assert::IsTrue(Contents(list) == std::vector<int>{ 10, 20, 30, 40 });
+
+			Assert::IsFalse(list.Remove(stranger));
+			Assert::IsTrue(list.Remove(d));
+			Assert::AreSame(c, list.Back());
+			Assert::IsTrue(list.Remove(a));
+			Assert::AreSame(b, list.Front());
+			Assert::IsTrue(Contents(list) == std::vector<int>{ 20, 30 });
+
+			list.PushBack(d);
+			Assert::IsTrue(Contents(list) == std::vector<int>{ 20, 30, 40 });
+			list.Clear();
+			Assert::IsTrue(list.IsEmpty());
+			list.PushBack(a);
+			Assert::IsTrue(Contents(list) == std::vector<int>{ 10 });
+		}
+
+		TEST_METHOD(SpliceAndMove)
+		{
+			SListLinkedFoo a{ 10 }, b{ 20 }, c{ 30 }, d{ 40 }, e{ 50 };
+			List list;
+			List other;
+			list.PushBack(a);
+			list.PushBack(b);
+			other.PushBack(c);
+			other.PushBack(d);
+
+			list.SpliceBack(other);
+			Assert::IsTrue(other.IsEmpty());
+			Assert::AreEqual(size_t(4), list.Size());
+			Assert::IsTrue(Contents(list) == std::vector<int>{ 10, 20, 30, 40 });
+			other.SpliceBack(list);
+			Assert::IsTrue(Contents(other) == std::vector<int>{ 10, 20, 30, 40 });
+			Assert::AreSame(d, other.Back());
+
+			List moved{ std::move(other) };
+			Assert::IsTrue(other.IsEmpty());
+			Assert::IsTrue(Contents(moved) == std::vector<int>{ 10, 20, 30, 40 });
+
+			list.PushBack(e);
+			list = std::move(moved);
+			Assert::IsTrue(moved.IsEmpty());
+			Assert::IsTrue(Contents(list) == std::vector<int>{ 10, 20, 30, 40 });
+
+			SListLinkedFoo copy = a;
+			list.PushFront(copy);
+			Assert::IsTrue(Contents(list) == std::vector<int>{ 10, 10, 20, 30, 40 });
+			list.Clear();
+		}
+
+		TEST_METHOD(Iterators)
+		{
+			SListLinkedFoo a{ 10 }, b{ 20 };
+			List list;
+			List::Iterator unassociated;
+			Assert::ExpectException<std::runtime_error>([&unassociated] { ++unassociated; });
+			Assert::ExpectException<std::runtime_error>([&list] { auto& element = *list.begin(); UNREFERENCED_LOCAL(element); });
+			Assert::IsTrue(list.begin() == list.end());
+
+			list.PushBack(a);
+			list.PushBack(b);
+			auto it = list.begin();
+			(*it).data = 15;
+			Assert::AreEqual(15, a.data);
+			Assert::AreSame(a, *it++);
+			Assert::AreSame(b, *it);
+			Assert::IsTrue(++it == list.end());
+
+			const List& constList = list;
+			List::ConstIterator constIt = list.begin();
+			Assert::IsTrue(constIt == constList.begin());
+			Assert::IsTrue(constList.cbegin() != constList.cend());
+			Assert::AreSame(a, *constIt++);
+			Assert::AreSame(b, *constIt);
+			Assert::IsTrue(++constIt == constList.end());
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
@@ -0,0 +1,704 @@
+/// <summary>
+/// Unit tests exercising MemoryResource, MonotonicArena, PoolResource, NodePool, and the containers that allocate through them.
+/// </summary>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "MemoryResource.h"
+#include "MonotonicArena.h"
+#include "PoolResource.h"
+#include "NodePool.h"
+#include "Vector.h"
+#include "SList.h"
+#include "HashMap.h"
+#include "Datum.h"
+#include "Scope.h"
+#include "JsonParseCoordinator.h"
+#include "JsonTableParseHelper.h"
+#include "ToStringSpecializations.h"
+#include "CountingResource.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+using namespace FIEAGameEngine;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(MemoryResourceTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(DefaultResource)
+		{
+			Assert::IsTrue(GetDefaultResource() == HeapResource());
+
+			CountingResource counting;
+			Assert::IsTrue(SetDefaultResource(&counting) == HeapResource());
+			Assert::IsTrue(GetDefaultResource() == &counting);
+			{
+				Vector<int> vector;
+				vector.PushBack(1);
+				Assert::IsTrue(vector.GetResource() == &counting);
+				Assert::AreEqual(size_t(1), counting.Allocations);
+			}
+			Assert::AreEqual(size_t(0), counting.Outstanding);
+			Assert::IsTrue(SetDefaultResource(nullptr) == &counting);
+			Assert::IsTrue(GetDefaultResource() == HeapResource());
+
+			MemoryResource* heap = HeapResource();
+			Assert::IsTrue(heap->IsEqual(*heap));
+			Assert::IsFalse(heap->IsEqual(counting));
+
+			void* block = heap->Allocate(16);
+			Assert::IsNotNull(block);
+			memset(block, 7, 16);
+			block = heap->Reallocate(block, 16, 4096);
+			Assert::AreEqual(7, static_cast<int>(static_cast<unsigned char*>(block)[15]));
+			heap->Deallocate(block, 4096);
+			heap->Deallocate(nullptr, 0);
+
+			void* aligned = heap->Allocate(100, 64);
+			Assert::AreEqual(size_t(0), reinterpret_cast<uintptr_t>(aligned) % 64);
+			aligned = heap->Reallocate(aligned, 100, 200, 64);
+			Assert::AreEqual(size_t(0), reinterpret_cast<uintptr_t>(aligned) % 64);
+			heap->Deallocate(aligned, 200, 64);
+		}
+
+		TEST_METHOD(MonotonicArenaAllocation)
+		{
+			CountingResource upstream;
+			{
+				MonotonicArena arena(256, &upstream);
+				Assert::IsTrue(arena.Upstream() == &upstream);
+				Assert::AreEqual(size_t(0), arena.ChunkCount());
+
+				void* first = arena.Allocate(10, 1);
+				void* second = arena.Allocate(8, 8);
+				Assert::AreEqual(size_t(1), arena.ChunkCount());
+				Assert::AreEqual(size_t(0), reinterpret_cast<uintptr_t>(second) % 8);
+				Assert::IsTrue(static_cast<std::byte*>(second) >= static_cast<std::byte*>(first) + 10);
+				Assert::AreEqual(size_t(24), arena.BytesUsed());
+
+				void* grown = arena.Reallocate(second, 8, 64, 8);
+				Assert::IsTrue(grown == second);
+				Assert::AreEqual(size_t(80), arena.BytesUsed());
+
+				arena.Deallocate(grown, 64, 8);
+				Assert::AreEqual(size_t(16), arena.BytesUsed());
+				arena.Deallocate(first, 10, 1);
+				Assert::AreEqual(size_t(16), arena.BytesUsed());
+
+				void* large = arena.Allocate(1000);
+				Assert::IsNotNull(large);
+				Assert::AreEqual(size_t(2), arena.ChunkCount());
+				Assert::AreEqual(size_t(0), reinterpret_cast<uintptr_t>(large) % MemoryResource::DefaultAlignment);
+
+				arena.Release();
+				Assert::AreEqual(size_t(0), arena.ChunkCount());
+				Assert::AreEqual(size_t(0), arena.BytesUsed());
+				Assert::AreEqual(size_t(0), arena.BytesReserved());
+				Assert::AreEqual(size_t(0), upstream.Outstanding);
+
+				arena.Allocate(32);
+				Assert::AreEqual(size_t(1), upstream.Outstanding);
+			}
+			Assert::AreEqual(size_t(0), upstream.Outstanding);
+
+			alignas(MemoryResource::DefaultAlignment) std::byte buffer[128];
+			{
+				MonotonicArena arena(buffer, sizeof(buffer), &upstream);
+				std::byte* block = static_cast<std::byte*>(arena.Allocate(64));
+				Assert::IsTrue(block >= buffer && block + 64 <= buffer + sizeof(buffer));
+				Assert::AreEqual(size_t(0), arena.ChunkCount());
+				Assert::AreEqual(size_t(0), upstream.Allocations - upstream.Deallocations);
+
+				arena.Allocate(128);
+				Assert::AreEqual(size_t(1), arena.ChunkCount());
+
+				arena.Release();
+				Assert::IsTrue(arena.Allocate(16) == buffer);
+			}
+			Assert::AreEqual(size_t(0), upstream.Outstanding);
+		}
+
+		TEST_METHOD(PoolResourceAllocation)
+		{
+			CountingResource upstream;
+			{
+				PoolResource pool(4, &upstream);
+				Assert::IsTrue(pool.Upstream() == &upstream);
+
+				void* first = pool.Allocate(24);
+				void* second = pool.Allocate(24);
+				Assert::AreEqual(size_t(2), pool.BlocksInUse());
+				Assert::AreEqual(size_t(1), upstream.Allocations);
+				Assert::IsTrue(first != second);
+
+				pool.Deallocate(first, 24);
+				Assert::AreEqual(size_t(1), pool.BlocksInUse());
+				Assert::IsTrue(pool.Allocate(20) == first);
+
+				for (size_t i = 0; i < 2; ++i) {
+					pool.Allocate(32);
+				}
+				Assert::AreEqual(size_t(1), upstream.Allocations);
+				pool.Allocate(32);
+				Assert::AreEqual(size_t(2), upstream.Allocations);
+
+				Assert::IsTrue(pool.Reallocate(second, 24, 30) == second);
+				void* moved = pool.Reallocate(second, 30, 100);
+				Assert::IsTrue(moved != second);
+				Assert::AreEqual(size_t(0), reinterpret_cast<uintptr_t>(moved) % MemoryResource::DefaultAlignment);
+
+				size_t pooledChunks = upstream.Outstanding;
+				void* large = pool.Allocate(PoolResource::LargestPooledBlock + 1);
+				Assert::AreEqual(pooledChunks + 1, upstream.Outstanding);
+				pool.Deallocate(large, PoolResource::LargestPooledBlock + 1);
+				Assert::AreEqual(pooledChunks, upstream.Outstanding);
+
+				pool.Release();
+				Assert::AreEqual(size_t(0), pool.BlocksInUse());
+				Assert::AreEqual(size_t(0), pool.BytesReserved());
+				Assert::AreEqual(size_t(0), upstream.Outstanding);
+
+				pool.Allocate(8);
+			}
+			Assert::AreEqual(size_t(0), upstream.Outstanding);
+		}
+
+		TEST_METHOD(NodePoolAllocation)
+		{
+			CountingResource upstream;
+			{
+				NodePool pool(40, 8, &upstream);
+				Assert::IsTrue(pool.Upstream() == &upstream);
+				Assert::AreEqual(size_t(40), pool.BlockSize());
+
+				Vector<std::byte*> blocks;
+				for (size_t i = 0; i < NodeSlabs::FirstSlabBlocks; ++i) {
+					blocks.PushBack(static_cast<std::byte*>(pool.Allocate(40, 8)));
+				}
+				Assert::AreEqual(size_t(1), upstream.Allocations);
+				Assert::AreEqual(size_t(1), pool.SlabCount());
+				for (size_t i = 1; i < blocks.Size(); ++i) {
+					Assert::IsTrue(blocks[i] - blocks[i - 1] == 40);
+				}
+
+				pool.Allocate(24, 8);
+				Assert::AreEqual(size_t(2), upstream.Allocations);
+				Assert::AreEqual(NodeSlabs::FirstSlabBlocks + 1, pool.BlocksInUse());
+
+				pool.Deallocate(blocks[2], 40, 8);
+				Assert::IsTrue(pool.Allocate(40, 8) == blocks[2]);
+				Assert::IsTrue(pool.Reallocate(blocks[1], 40, 32, 8) == blocks[1]);
+
+				size_t slabs = upstream.Outstanding;
+				void* large = pool.Allocate(41, 8);
+				void* aligned = pool.Allocate(16, 64);
+				Assert::AreEqual(slabs + 2, upstream.Outstanding);
+				Assert::AreEqual(size_t(0), reinterpret_cast<uintptr_t>(aligned) % 64);
+				pool.Deallocate(large, 41, 8);
+				pool.Deallocate(aligned, 16, 64);
+				Assert::AreEqual(slabs, upstream.Outstanding);
+
+				Assert::IsTrue(pool.BytesReserved() >= pool.BlocksInUse() * pool.BlockSize());
+				pool.Release();
+				Assert::AreEqual(size_t(0), pool.BlocksInUse());
+				Assert::AreEqual(size_t(0), pool.SlabCount());
+				Assert::AreEqual(size_t(0), pool.BytesReserved());
+				Assert::AreEqual(size_t(0), upstream.Outstanding);
+
+				for (size_t i = 0; i < 1000; ++i) {
+					pool.Allocate(40, 8);
+				}
+				Assert::IsTrue(pool.SlabCount() < 10);
+			}
+			Assert::AreEqual(size_t(0), upstream.Outstanding);
+		}
+
+		TEST_METHOD(VectorResource)
+		{
+			CountingResource counting;
+			MonotonicArena arena;
+			{
+				Vector<int> vector(0, DefaultGrowth{}, &counting);
+				Assert::IsTrue(vector.GetResource() == &counting);
+				for (int i = 0; i < 100; ++i) {
+					vector.PushBack(i);
+				}
+				Assert::IsTrue(counting.Allocations > 0);
+				Assert::AreEqual(size_t(1), counting.Outstanding);
+
+				Vector<int> copy(vector);
+				Assert::IsTrue(copy.GetResource() == GetDefaultResource());
+				Assert::IsTrue(std::equal(vector.begin(), vector.end(), copy.begin(), copy.end()));
+
+				Vector<int> arenaCopy(vector, &arena);
+				Assert::IsTrue(arenaCopy.GetResource() == &arena);
+				Assert::IsTrue(std::equal(vector.begin(), vector.end(), arenaCopy.begin(), arenaCopy.end()));
+
+				Vector<int> moved(std::move(arenaCopy));
+				Assert::IsTrue(moved.GetResource() == &arena);
+				Assert::AreEqual(size_t(100), moved.Size());
+
+				copy = std::move(moved);
+				Assert::IsTrue(copy.GetResource() == GetDefaultResource());
+				Assert::IsTrue(std::equal(vector.begin(), vector.end(), copy.begin(), copy.end()));
+				Assert::IsTrue(moved.IsEmpty());
+
+				copy.Clear();
+				copy.ShrinkToFit();
+				vector = std::move(copy);
+				Assert::IsTrue(vector.GetResource() == &counting);
+				Assert::IsTrue(vector.IsEmpty());
+				Assert::AreEqual(size_t(0), counting.Outstanding);
+
+				Vector<string> strings({ "a"s, "b"s, "c"s }, DefaultGrowth{}, &counting);
+				strings.Reserve(50);
+				Assert::AreEqual("c"s, strings.Back());
+
+				Vector<SList<int>> lists(0, DefaultGrowth{}, &arena);
+				lists.PushBack(SList<int>{ 1, 2, 3 });
+				Vector<SList<int>> listsCopy(lists, &counting);
+				Assert::IsTrue(listsCopy[0].GetResource() == &counting);
+				Assert::AreEqual(3, listsCopy[0].Back());
+			}
+			Assert::AreEqual(size_t(0), counting.Outstanding);
+		}
+
+		TEST_METHOD(SListResource)
+		{
+			CountingResource counting;
+			{
+				PoolResource pool(16, &counting);
+				SList<int> list(&pool);
+				Assert::IsTrue(list.GetResource() == &pool);
+				for (int i = 0; i < 10; ++i) {
+					list.PushBack(i);
+				}
+				Assert::AreEqual(size_t(10), pool.BlocksInUse());
+				Assert::AreEqual(size_t(1), counting.Allocations);
+
+				list.PopFront();
+				list.PopBack();
+				list.Remove(5);
+				list.InsertAfter(42, list.begin());
+				Assert::AreEqual(size_t(8), pool.BlocksInUse());
+
+				SList<int> heapList{ 100, 200 };
+				heapList.SpliceFrontToBack(list);
+				Assert::AreEqual(size_t(3), heapList.Size());
+				Assert::AreEqual(1, heapList.Back());
+				Assert::AreEqual(size_t(7), pool.BlocksInUse());
+
+				SList<int> pooledCopy(heapList, &pool);
+				list.SpliceFrontToBack(pooledCopy);
+				Assert::AreEqual(100, list.Back());
+				Assert::AreEqual(size_t(10), pool.BlocksInUse());
+
+				heapList = std::move(list);
+				Assert::IsTrue(heapList.GetResource() == GetDefaultResource());
+				Assert::AreEqual(size_t(8), heapList.Size());
+				Assert::IsTrue(list.IsEmpty());
+				Assert::AreEqual(size_t(2), pool.BlocksInUse());
+
+				SList<int> moved(std::move(pooledCopy));
+				Assert::IsTrue(moved.GetResource() == &pool);
+				Assert::AreEqual(size_t(2), moved.Size());
+
+				moved.Clear();
+				Assert::AreEqual(size_t(0), pool.BlocksInUse());
+			}
+			Assert::AreEqual(size_t(0), counting.Outstanding);
+		}
+
+		TEST_METHOD(SListPooledNodes)
+		{
+			CountingResource counting;
+			{
+				SList<int> list(&counting, NodeStorage::Pooled);
+				Assert::IsTrue(list.PoolsNodes());
+				Assert::IsTrue(list.GetResource() == &counting);
+				for (int i = 0; i < 100; ++i) {
+					list.PushBack(i);
+				}
+				Assert::IsTrue(counting.Allocations < 10);
+				auto second = ++list.begin();
+				Assert::IsTrue(reinterpret_cast<std::byte*>(&*second) - reinterpret_cast<std::byte*>(&list.Front()) == SList<int>::NodeSize);
+
+				size_t slabs = counting.Outstanding;
+				for (int i = 0; i < 50; ++i) {
+					list.PopFront();
+					list.PushBack(i);
+				}
+				Assert::AreEqual(slabs, counting.Outstanding);
+
+				SList<int> copy(list);
+				Assert::IsTrue(copy.PoolsNodes());
+				Assert::IsTrue(copy.GetResource() == GetDefaultResource());
+				Assert::IsTrue(std::equal(list.begin(), list.end(), copy.begin(), copy.end()));
+
+				SList<int> moved(std::move(list));
+				Assert::IsTrue(moved.PoolsNodes());
+				Assert::AreEqual(size_t(100), moved.Size());
+				Assert::AreEqual(slabs, counting.Outstanding);
+
+				SList<int> other(&counting);
+				other.PushBack(-1);
+				int& front = moved.Front();
+				other.SpliceFrontToBack(moved);
+				Assert::AreNotSame(front, other.Back());
+				Assert::AreEqual(size_t(2), other.Size());
+
+				moved.Clear();
+				Assert::AreEqual(size_t(2), counting.Outstanding);
+				moved.PushBack(1);
+				Assert::AreEqual(size_t(3), counting.Outstanding);
+
+				other = std::move(moved);
+				Assert::IsFalse(other.PoolsNodes());
+				Assert::AreEqual(size_t(1), other.Size());
+				Assert::AreEqual(size_t(1), counting.Outstanding);
+			}
+			Assert::AreEqual(size_t(0), counting.Outstanding);
+		}
+
+		TEST_METHOD(HashMapResource)
+		{
+			CountingResource counting;
+			{
+				PoolResource pool(32, &counting);
+				HashMap<int, string> map(13, {}, &pool);
+				Assert::IsTrue(map.GetResource() == &pool);
+				for (int i = 0; i < 200; ++i) {
+					map.Insert({ i, to_string(i) });
+				}
+				Assert::AreEqual(size_t(200), map.Size());
+				Assert::IsTrue(map.ChainCount() > 13);
+				Assert::IsTrue(pool.BlocksInUse() > size_t(0));
+				Assert::AreEqual("150"s, map.At(150));
+
+				map.SetIncrementalRehash(4);
+				map.Rehash(1000);
+				map.Insert({ 1000, "1000"s });
+				Assert::IsTrue(map.GetResource() == &pool);
+				Assert::AreEqual("1000"s, map.At(1000));
+
+				HashMap<int, string> copy(map);
+				Assert::IsTrue(copy.GetResource() == GetDefaultResource());
+				Assert::AreEqual(map.Size(), copy.Size());
+
+				HashMap<int, string> moved(std::move(map));
+				Assert::IsTrue(moved.GetResource() == &pool);
+				Assert::AreEqual("42"s, moved.At(42));
+
+				copy = std::move(moved);
+				Assert::IsTrue(copy.GetResource() == GetDefaultResource());
+				Assert::AreEqual("42"s, copy.At(42));
+				Assert::AreEqual(size_t(1), pool.BlocksInUse());
+			}
+			Assert::AreEqual(size_t(0), counting.Outstanding);
+		}
+
+		TEST_METHOD(HashMapNodePool)
+		{
+			CountingResource counting;
+			{
+				HashMap<int, int> map(13, {}, &counting);
+				map.SetMaxLoadFactor(0.0);
+				for (int i = 0; i < 12; ++i) {
+					map.Insert({ i, i });
+				}
+				size_t outstanding = counting.Outstanding;
+				map.Insert({ 12, 12 });
+				map.Insert({ 13, 13 });
+				Assert::AreEqual(outstanding + 1, counting.Outstanding);
+				Assert::IsTrue(counting.Allocations < 10);
+
+				map.SetMaxLoadFactor(1.0);
+				int& value = map.At(5);
+				for (int i = 14; i < 200; ++i) {
+					map.Insert({ i, i });
+				}
+				Assert::IsTrue(map.ChainCount() > 13);
+				Assert::AreSame(value, map.At(5));
+
+				map.Clear();
+				Assert::AreEqual(size_t(2), counting.Outstanding);
+				map.Insert({ 1, 1 });
+				Assert::AreEqual(1, map.At(1));
+			}
+			Assert::AreEqual(size_t(0), counting.Outstanding);
+		}
+
+		TEST_METHOD(DatumResource)
+		{
+			CountingResource counting;
+			{
+				MonotonicArena arena(1024, &counting);
+				Datum datum(Datum::DatumTypes::String, 0, Datum::GrowthStrategies::HalfAgain, &arena);
+				Assert::IsTrue(datum.GetResource() == &arena);
+				datum.PushBack("hello"s);
+				datum.PushBack("world"s);
+				Assert::IsTrue(arena.BytesUsed() > 0);
+
+				datum.SetResource(&counting);
+				Assert::IsTrue(datum.GetResource() == &counting);
+				Assert::AreEqual("world"s, datum.BackAsString());
+				Assert::AreEqual(size_t(2), counting.Outstanding);
+
+				Datum arenaDatum(Datum::GrowthStrategies::HalfAgain, &arena);
+				arenaDatum = std::move(datum);
+				Assert::IsTrue(arenaDatum.GetResource() == &arena);
+				Assert::AreEqual(size_t(2), arenaDatum.Size());
+				Assert::AreEqual("hello"s, arenaDatum.FrontAsString());
+				Assert::AreEqual(size_t(1), counting.Outstanding);
+
+				Datum copy(arenaDatum, &counting);
+				Assert::IsTrue(copy.GetResource() == &counting);
+				Assert::IsTrue(arenaDatum == copy);
+
+				Datum moved(std::move(copy));
+				Assert::IsTrue(moved.GetResource() == &counting);
+
+				Datum vectors = { glm::vec4(1), glm::vec4(2) };
+				vectors.SetResource(&arena);
+				vectors.PushBack(glm::vec4(3));
+				Assert::IsTrue(glm::vec4(3) == vectors.BackAsVector());
+
+				int32_t external[] = { 1, 2, 3 };
+				Datum externalDatum;
+				externalDatum.SetStorage(external, 3);
+				externalDatum.SetResource(&arena);
+				Assert::IsTrue(externalDatum.GetResource() == &arena);
+				Assert::AreEqual(2, externalDatum.GetAsInt(1));
+			}
+			Assert::AreEqual(size_t(0), counting.Outstanding);
+		}
+
+		TEST_METHOD(DatumInlineStorage)
+		{
+			CountingResource counting;
+			{
+				Datum integers(Datum::DatumTypes::Integer, 0, Datum::GrowthStrategies::HalfAgain, &counting);
+				for (int32_t i = 0; i < 4; ++i) {
+					integers.PushBack(i);
+				}
+				Assert::AreEqual(size_t(0), counting.Allocations);
+				integers.PushBack(4);
+				Assert::AreEqual(size_t(1), counting.Outstanding);
+				for (int32_t i = 0; i < 5; ++i) {
+					Assert::AreEqual(i, integers.GetAsInt(i));
+				}
+				integers.Resize(2);
+				Assert::AreEqual(size_t(0), counting.Outstanding);
+				Assert::AreEqual(1, integers.GetAsInt(1));
+
+				size_t allocations = counting.Allocations;
+				Datum floatDatum(Datum::DatumTypes::Float, 1, Datum::GrowthStrategies::HalfAgain, &counting);
+				floatDatum.PushBack(1.5f);
+				Datum vectorDatum(Datum::DatumTypes::Vector, 1, Datum::GrowthStrategies::HalfAgain, &counting);
+				vectorDatum.PushBack(glm::vec4(1, 2, 3, 4));
+				Foo foo(7);
+				Datum pointerDatum(Datum::DatumTypes::Pointer, 2, Datum::GrowthStrategies::HalfAgain, &counting);
+				pointerDatum.PushBack(&foo);
+				pointerDatum.PushBack(static_cast<RTTI*>(nullptr));
+				Datum vectorCopy(vectorDatum, &counting);
+				Datum pointerCopy(pointerDatum, &counting);
+				Assert::AreEqual(allocations, counting.Allocations);
+				Assert::IsTrue(vectorDatum == vectorCopy);
+				Assert::IsTrue(pointerDatum == pointerCopy);
+
+				Datum movedVector(std::move(vectorCopy));
+				Assert::IsTrue(glm::vec4(1, 2, 3, 4) == movedVector.FrontAsVector());
+				Assert::AreEqual(size_t(0), vectorCopy.Size());
+				vectorCopy.PushBack(glm::vec4(5));
+				Assert::IsTrue(glm::vec4(1, 2, 3, 4) == movedVector.FrontAsVector());
+
+				Datum assigned(Datum::GrowthStrategies::HalfAgain, &counting);
+				assigned = std::move(floatDatum);
+				Assert::AreEqual(1.5f, assigned.FrontAsFloat());
+				assigned.SetResource(HeapResource());
+				Assert::AreEqual(1.5f, assigned.FrontAsFloat());
+				Assert::AreEqual(allocations, counting.Allocations);
+
+				Datum matrixDatum(Datum::DatumTypes::Matrix, 1, Datum::GrowthStrategies::HalfAgain, &counting);
+				Datum stringDatum(Datum::DatumTypes::String, 1, Datum::GrowthStrategies::HalfAgain, &counting);
+				Assert::AreEqual(allocations + 2, counting.Allocations);
+			}
+			Assert::AreEqual(size_t(0), counting.Outstanding);
+		}
+
+		TEST_METHOD(ScopeTreeInArena)
+		{
+			const string inputString = R"delim(
+			{
+				"Level":
+				{
+					"type": "Integer",
+					"value": 3
+				},
+				"Character" :
+				{
+					"type": "Table",
+					"value":
+					{
+						"Name":
+						{
+							"type": "String",
+							"value": "pip"
+						},
+						"Inventory":
+						{
+							"type": "Table",
+							"value":
+							{
+								"Coins":
+								{
+									"type": "Integer",
+									"value": [ 1, 2, 3 ]
+								}
+							}
+						}
+					}
+				}
+			})delim"s;
+
+			CountingResource upstream;
+			{
+				MonotonicArena arena(4096, &upstream);
+				Scope root(0, &arena);
+				Assert::IsTrue(root.GetResource() == &arena);
+
+				{
+					shared_ptr<Wrapper> wrapper = make_shared<JsonTableParseHelper::Wrapper>(root);
+					JsonParseCoordinator parseCoordinator(wrapper);
+					parseCoordinator.AddHelper(make_shared<JsonTableParseHelper>());
+					parseCoordinator.DeserializeObject(inputString);
+				}
+
+				Assert::AreEqual(size_t(2), root.Size());
+				Assert::IsTrue(root.At("Level").GetResource() == &arena);
+				Scope& character = root.At("Character").GetAsTable();
+				Assert::IsTrue(character.GetResource() == &arena);
+				Assert::IsTrue(character.At("Name").GetResource() == &arena);
+				Scope& inventory = character.At("Inventory").GetAsTable();
+				Assert::IsTrue(inventory.GetResource() == &arena);
+				Assert::AreEqual(3, inventory.At("Coins").BackAsInt());
+				Assert::IsTrue(arena.BytesUsed() > 0);
+
+				Scope heapScope;
+				heapScope = std::move(character);
+				Assert::IsTrue(heapScope.GetResource() == GetDefaultResource());
+				Assert::IsTrue(heapScope.At("Name").GetResource() == GetDefaultResource());
+				Assert::AreEqual("pip"s, heapScope.At("Name").FrontAsString());
+				Assert::IsTrue(heapScope.At("Inventory").GetAsTable().GetParent() == &heapScope);
+				Assert::AreEqual(size_t(0), root.At("Character").Size());
+			}
+			Assert::AreEqual(size_t(0), upstream.Outstanding);
+		}
+
+		TEST_METHOD(CrossResourceMoveAssignment)
+		{
+			CountingResource source;
+			CountingResource destination;
+			{
+				Vector<string> vector({ "alpha"s, "beta"s, "gamma"s }, DefaultGrowth{}, &source);
+				Vector<string> assigned({ "old"s }, DefaultGrowth{}, &destination);
+				size_t destinationAllocations = destination.Allocations;
+				assigned = std::move(vector);
+				Assert::IsTrue(assigned.GetResource() == &destination);
+				Assert::AreEqual(size_t(3), assigned.Size());
+				Assert::AreEqual("gamma"s, assigned.Back());
+				Assert::IsTrue(vector.IsEmpty());
+				Assert::AreEqual(size_t(0), source.Outstanding);
+				Assert::IsTrue(destination.Allocations > destinationAllocations);
+
+				Datum datum(Datum::DatumTypes::String, 0, Datum::GrowthStrategies::HalfAgain, &source);
+				for (int i = 0; i < 10; ++i) {
+					datum.PushBack("value"s + to_string(i));
+				}
+				Datum assignedDatum(Datum::DatumTypes::String, 0, Datum::GrowthStrategies::HalfAgain, &destination);
+				assignedDatum = std::move(datum);
+				Assert::IsTrue(assignedDatum.GetResource() == &destination);
+				Assert::AreEqual(size_t(10), assignedDatum.Size());
+				Assert::AreEqual("value9"s, assignedDatum.BackAsString());
+				Assert::AreEqual(size_t(0), datum.Size());
+				Assert::AreEqual(size_t(0), source.Outstanding);
+
+				HashMap<int, string> map(13, {}, &source);
+				for (int i = 0; i < 50; ++i) {
+					map.Insert({ i, to_string(i) });
+				}
+				HashMap<int, string> assignedMap(13, {}, &destination);
+				assignedMap = std::move(map);
+				Assert::IsTrue(assignedMap.GetResource() == &destination);
+				Assert::AreEqual(size_t(50), assignedMap.Size());
+				Assert::AreEqual("42"s, assignedMap.At(42));
+				Assert::AreEqual(size_t(0), map.Size());
+			}
+			Assert::AreEqual(size_t(0), source.Outstanding);
+			Assert::AreEqual(size_t(0), destination.Outstanding);
+		}
+
+		TEST_METHOD(ScopeInArenaMakesNoGlobalAllocations)
+		{
+			CountingResource upstream;
+			CountingResource counting;
+			MemoryResource* previous = SetDefaultResource(&counting);
+			{
+				alignas(std::max_align_t) std::byte buffer[8192];
+				MonotonicArena arena(buffer, sizeof(buffer), &upstream);
+#if defined(DEBUG) || defined(_DEBUG)
+				_CrtMemState beforeState, duringState, diffState;
+				_CrtMemCheckpoint(&beforeState);
+#endif
+				{
+					Scope scope(0, &arena);
+					scope.Append("Health") = 100;
+					scope.Append("Speed") = 2.5f;
+					scope.Append("Name") = "pip"s;
+					for (int32_t i = 0; i < 3; ++i) {
+						scope["Coins"].PushBack(i);
+					}
+#if defined(DEBUG) || defined(_DEBUG)
+					_CrtMemCheckpoint(&duringState);
+					Assert::IsFalse(_CrtMemDifference(&diffState, &beforeState, &duringState));
+					Assert::AreEqual(beforeState.lTotalCount, duringState.lTotalCount);
+#endif
+					Assert::AreEqual(size_t(4), scope.Size());
+					Assert::AreEqual(2, scope.At("Coins").BackAsInt());
+				}
+				Assert::IsTrue(arena.BytesUsed() > 0);
+			}
+			SetDefaultResource(previous);
+			Assert::AreEqual(size_t(0), counting.Allocations);
+			Assert::AreEqual(size_t(0), upstream.Allocations);
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
@@ -0,0 +1,151 @@
+/// <summary>
+/// Unit tests exercising the functionality of MpscQueue, both from a single thread and pushed to from several.
+/// </summary>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Foo.h"
+#include "ToStringSpecializations.h"
+#include "MpscQueue.h"
+#include "PoolResource.h"
+#include "Vector.h"
+#include <atomic>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+using namespace FIEAGameEngine;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(MpscQueueTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(PushAndPop)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			const Foo c{ 30 };
+			MpscQueue<Foo> queue;
+			Assert::IsTrue(queue.IsEmpty());
+			Assert::IsTrue(queue.Resource() == GetDefaultResource());
+
+			Foo popped;
+			Assert::IsFalse(queue.TryPop(popped));
+
+			queue.Push(a);
+			queue.Push(Foo{ 20 });
+			queue.Emplace(30);
+			Assert::IsFalse(queue.IsEmpty());
+
+			Assert::IsTrue(queue.TryPop(popped));
+			Assert::AreEqual(a, popped);
+			Assert::IsTrue(queue.TryPop(popped));
+			Assert::AreEqual(b, popped);
+			Assert::IsTrue(queue.TryPop(popped));
+			Assert::AreEqual(c, popped);
+			Assert::IsFalse(queue.TryPop(popped));
+			Assert::IsTrue(queue.IsEmpty());
+
+			queue.Push(a);
+			queue.Push(b);
+		}
+
+		TEST_METHOD(DrainAndSwap)
+		{
+			PoolResource pool;
+			MpscQueue<Foo> queue{ &pool };
+			MpscQueue<Foo> other;
+			Assert::AreEqual(size_t(0), queue.Drain([](Foo&&) { Assert::Fail(); }));
+
+			for (int i = 0; i < 5; ++i) {
+				queue.Emplace(i);
+			}
+			other.Emplace(100);
+
+			queue.Swap(other);
+			Assert::IsTrue(queue.Resource() == GetDefaultResource());
+			Assert::IsTrue(other.Resource() == &pool);
+
+			int expected = 0;
+			Assert::AreEqual(size_t(5), other.Drain([&expected](Foo&& foo) { Assert::AreEqual(expected++, foo.Data()); }));
+			Assert::IsTrue(other.IsEmpty());
+
+			Foo popped;
+			Assert::IsTrue(queue.TryPop(popped));
+			Assert::AreEqual(Foo{ 100 }, popped);
+			Assert::IsTrue(queue.IsEmpty());
+		}
+
+		TEST_METHOD(ManyProducers)
+		{
+			const int producerCount = 8;
+			const int valuesPerProducer = 20000;
+			MpscQueue<std::pair<int, int>> queue;
+			std::atomic<int> finishedProducers{ 0 };
+
+			Vector<std::thread> producers(producerCount);
+			for (int p = 0; p < producerCount; ++p) {
+				producers.PushBack(std::thread([&queue, &finishedProducers, p]() {
+					for (int i = 0; i < valuesPerProducer; ++i) {
+						queue.Emplace(p, i);
+					}
+					++finishedProducers;
+				}));
+			}
+
+			//Consume while the producers are still pushing, checking each producer's values arrive in the order it pushed them
+			Vector<int> nextExpected(producerCount);
+			for (int p = 0; p < producerCount; ++p) {
+				nextExpected.PushBack(0);
+			}
+			size_t consumed = 0;
+			bool inOrder = true;
+			auto consume = [&nextExpected, &consumed, &inOrder](std::pair<int, int>&& value) {
+				inOrder = inOrder && value.second == nextExpected[value.first];
+				++nextExpected[value.first];
+				++consumed;
+			};
+			while (finishedProducers.load() < producerCount) {
+				queue.Drain(consume);
+			}
+			for (std::thread& producer : producers) {
+				producer.join();
+			}
+			queue.Drain(consume);
+
+			Assert::IsTrue(inOrder);
+			Assert::AreEqual(size_t(producerCount) * size_t(valuesPerProducer), consumed);
+			for (int p = 0; p < producerCount; ++p) {
+				Assert::AreEqual(valuesPerProducer, nextExpected[p]);
+			}
+			Assert::IsTrue(queue.IsEmpty());
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
@@ -309,6 +309,37 @@ namespace LibraryDesktopTests
 			GameState::GetEventQueue().Clear();
 		}
 
+		TEST_METHOD(NotifyCopiesParametersExactly)
+		{
+			GameObject gameObject;
+			GameState::SetRootObject(gameObject);
+			GameState::SetGameClockEnabled(false);
+
+			gameObject.AppendAuxiliaryAttribute("A"s) = 1;
+			const string subtype = "Test"s;
+			ReactionAttributed* reaction = new ReactionAttributed("Test Reaction"s, subtype);
+			gameObject.Adopt(*reaction, "reactions"s);
+			reaction->CreateAction("ActionIncrement"s, "Increment Action"s);
+			ActionIncrement* incrementAction = reaction->At("actions"s).GetAsTable().As<ActionIncrement>();
+			Datum& scale = incrementAction->AppendAuxiliaryAttribute("scale"s) = 0.0f;
+			Datum& offset = incrementAction->AppendAuxiliaryAttribute("offset"s) = glm::vec4(0.0f);
+
+			const float exactScale = 0.1234567f;
+			const glm::vec4 exactOffset(1.0f / 3.0f, -2.5e-8f, 16777215.0f, 3.4e38f);
+			EventMessageAttributed payload(subtype);
+			payload.AppendAuxiliaryAttribute("target"s) = "A"s;
+			payload.AppendAuxiliaryAttribute("scale"s) = exactScale;
+			payload.AppendAuxiliaryAttribute("offset"s) = exactOffset;
+			Event<EventMessageAttributed> eventPayload(payload);
+
+			reaction->Notify(eventPayload);
+
+			Assert::AreEqual(exactScale, scale.GetAsFloat());
+			Assert::IsTrue(exactOffset == offset.GetAsVector());
+
+			GameState::GetEventQueue().Clear();
+		}
+
 		TEST_METHOD(NotifyWrongSubtype)
 		{
 			GameObject gameObject;
@@ -470,6 +470,87 @@ namespace LibraryDesktopTests
 			Assert::ExpectException<std::runtime_error>([&list]() {list.PopFront();});
 		}
 
+		TEST_METHOD(SpliceFrontToBack)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			const Foo c{ 30 };
+			SList<Foo> list{ a, b };
+			SList<Foo> otherList{ c };
+			Foo& spliced = list.Front();
+
+			SList<Foo>::Iterator iter = otherList.SpliceFrontToBack(list);
+			Assert::AreSame(spliced, *iter);
+			Assert::AreEqual(size_t(1), list.Size());
+			Assert::AreEqual(b, list.Front());
+			Assert::AreEqual(b, list.Back());
+			Assert::AreEqual(size_t(2), otherList.Size());
+			Assert::AreEqual(c, otherList.Front());
+			Assert::AreSame(spliced, otherList.Back());
+
+			otherList.SpliceFrontToBack(list);
+			Assert::AreEqual(size_t(0), list.Size());
+			Assert::ExpectException<std::runtime_error>([&list]() {auto& front = list.Front(); UNREFERENCED_LOCAL(front); });
+			Assert::AreEqual(size_t(3), otherList.Size());
+			Assert::AreEqual(b, otherList.Back());
+
+			list.SpliceFrontToBack(otherList);
+			Assert::AreEqual(size_t(1), list.Size());
+			Assert::AreEqual(c, list.Front());
+			Assert::AreEqual(c, list.Back());
+			Assert::AreEqual(a, otherList.Front());
+
+			list.PushBack(a);
+			Assert::AreEqual(size_t(2), list.Size());
+			Assert::AreEqual(a, list.Back());
+
+			SList<Foo> emptyList;
+			Assert::ExpectException<std::runtime_error>([&list, &emptyList]() {list.SpliceFrontToBack(emptyList); });
+		}
+
+		TEST_METHOD(PooledNodes)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			const Foo c{ 30 };
+			SList<Foo> list(nullptr, NodeStorage::Pooled);
+			Assert::IsTrue(list.PoolsNodes());
+			Assert::IsFalse(SList<Foo>().PoolsNodes());
+
+			list.PushBack(a);
+			list.PushFront(b);
+			list.InsertAfter(c, list.begin());
+			Assert::AreEqual(size_t(3), list.Size());
+			Assert::AreEqual(b, list.Front());
+			Assert::AreEqual(a, list.Back());
+
+			Assert::IsTrue(list.Remove(c));
+			list.PopBack();
+			list.PushBack(c);
+			Assert::AreEqual(size_t(2), list.Size());
+			Assert::AreEqual(c, list.Back());
+
+			SList<Foo> individual{ a };
+			individual = list;
+			Assert::IsFalse(individual.PoolsNodes());
+			Assert::IsTrue(std::equal(list.begin(), list.end(), individual.begin(), individual.end()));
+
+			list.Clear();
+			Assert::IsTrue(list.IsEmpty());
+			for (int i = 0; i < 50; ++i) {
+				list.PushBack(Foo(i));
+			}
+			Assert::AreEqual(Foo(49), list.Back());
+
+			SList<Foo> copy = list;
+			Assert::IsTrue(copy.PoolsNodes());
+			list = std::move(individual);
+			Assert::IsTrue(list.PoolsNodes());
+			Assert::AreEqual(size_t(2), list.Size());
+			Assert::AreEqual(c, list.Back());
+			Assert::AreEqual(size_t(50), copy.Size());
+		}
+
 		TEST_METHOD(PopBack)
 		{
 			SList<Foo> list;
@@ -448,6 +448,50 @@ namespace  LibraryDesktopTests
 			}
 		}
 
+#ifdef USE_HASHMAP_STATISTICS
+		TEST_METHOD(AttributeStatistics)
+		{
+			Scope scope;
+			for (int i = 0; i < 20; ++i) {
+				scope.Append("attribute"s + std::to_string(i)) = i;
+			}
+			Assert::IsNotNull(scope.Find("attribute7"s));
+
+			HashMapStatistics statistics = scope.GetAttributeStatistics();
+			Assert::AreEqual(size_t(20), statistics.Population);
+			Assert::AreEqual(size_t(20), statistics.InsertCount);
+			Assert::IsTrue(statistics.FindCount > size_t(20));
+			Assert::IsTrue(statistics.LongestChain >= size_t(1));
+		}
+#endif // USE_HASHMAP_STATISTICS
+
+		TEST_METHOD(FindStringView)
+		{
+			Scope scope;
+			scope.Append("A") = 1;
+			Scope& childScope = scope.AppendScope("child"sv);
+			childScope["B"sv] = 2;
+
+			const std::string_view key = "A"sv;
+			Datum* foundDatum = scope.Find(key);
+			Assert::IsNotNull(foundDatum);
+			Assert::AreSame(scope[0], *foundDatum);
+			Assert::AreSame(*foundDatum, scope.At("A"));
+			Assert::AreSame(*foundDatum, scope["A"sv]);
+			Assert::IsNull(scope.Find("missing"sv));
+
+			Scope* foundScope = nullptr;
+			Assert::AreSame(*foundDatum, *childScope.Search(key, foundScope));
+			Assert::AreEqual(&scope, foundScope);
+			Assert::AreEqual(2, childScope.Find("B")->GetAsInt());
+
+			const Scope& constScope = scope;
+			Assert::AreSame(*constScope.Find(key), constScope.At("A"sv));
+			Assert::AreEqual(size_t(2), scope.Size());
+			scope.Append(key);
+			Assert::AreEqual(size_t(2), scope.Size());
+		}
+
 		TEST_METHOD(Search)
 		{
 			Scope scope;
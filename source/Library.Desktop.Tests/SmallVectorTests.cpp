@@ -0,0 +1,256 @@
+/// <summary>
+/// Unit tests exercising the functionality of SmallVector.
+/// </summary>
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "SmallVector.h"
+#include "Foo.h"
+#include "ToStringSpecializations.h"
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+using namespace FIEAGameEngine;
+using namespace std;
+using namespace std::string_literals;
+
+namespace LibraryDesktopTests
+{
+	TEST_CLASS(SmallVectorTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&_startMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &_startMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Constructors)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			const Foo c{ 30 };
+			{
+				SmallVector<Foo, 2> smallVector;
+				Assert::AreEqual(size_t(0), smallVector.Size());
+				Assert::AreEqual(size_t(2), smallVector.Capacity());
+				Assert::IsTrue(smallVector.IsEmpty());
+				Assert::IsTrue(smallVector.IsInline());
+				Assert::IsTrue(smallVector.begin() == smallVector.end());
+				Assert::ExpectException<std::runtime_error>([&smallVector]() { auto& value = smallVector.Front(); UNREFERENCED_LOCAL(value); });
+				Assert::ExpectException<std::runtime_error>([&smallVector]() { auto& value = smallVector[0]; UNREFERENCED_LOCAL(value); });
+			}
+			{
+				SmallVector<Foo, 2> smallVector(size_t(5));
+				Assert::AreEqual(size_t(0), smallVector.Size());
+				Assert::AreEqual(size_t(5), smallVector.Capacity());
+				Assert::IsFalse(smallVector.IsInline());
+			}
+			{
+				SmallVector<Foo, 4> smallVector{ a, b, c };
+				Assert::AreEqual(size_t(3), smallVector.Size());
+				Assert::IsTrue(smallVector.IsInline());
+				Assert::AreEqual(a, smallVector.Front());
+				Assert::AreEqual(c, smallVector.Back());
+				Assert::AreEqual(b, smallVector.At(1));
+			}
+		}
+
+		TEST_METHOD(CopySemantics)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			const Foo c{ 30 };
+
+			SmallVector<Foo, 2> inlineVector{ a, b };
+			SmallVector<Foo, 2> heapVector{ a, b, c };
+			Assert::IsTrue(inlineVector.IsInline());
+			Assert::IsFalse(heapVector.IsInline());
+
+			SmallVector<Foo, 2> inlineCopy(inlineVector);
+			Assert::AreEqual(size_t(2), inlineCopy.Size());
+			Assert::IsTrue(inlineCopy.IsInline());
+			Assert::AreEqual(b, inlineCopy[1]);
+			Assert::IsTrue(inlineCopy.Data() != inlineVector.Data());
+
+			SmallVector<Foo, 2> heapCopy(heapVector);
+			Assert::AreEqual(size_t(3), heapCopy.Size());
+			Assert::IsFalse(heapCopy.IsInline());
+			Assert::AreEqual(c, heapCopy[2]);
+			Assert::IsTrue(heapCopy.Data() != heapVector.Data());
+
+			inlineCopy = heapVector;
+			Assert::AreEqual(size_t(3), inlineCopy.Size());
+			Assert::AreEqual(c, inlineCopy.Back());
+
+			heapCopy = inlineVector;
+			Assert::AreEqual(size_t(2), heapCopy.Size());
+			Assert::AreEqual(b, heapCopy.Back());
+
+			heapCopy = heapCopy;
+			Assert::AreEqual(size_t(2), heapCopy.Size());
+			Assert::AreEqual(a, heapCopy.Front());
+		}
+
+		TEST_METHOD(MoveSemantics)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			const Foo c{ 30 };
+			{
+				SmallVector<Foo, 2> inlineVector{ a, b };
+				SmallVector<Foo, 2> movedVector(std::move(inlineVector));
+				Assert::AreEqual(size_t(2), movedVector.Size());
+				Assert::IsTrue(movedVector.IsInline());
+				Assert::AreEqual(a, movedVector[0]);
+				Assert::AreEqual(b, movedVector[1]);
+#pragma warning(push)
+#pragma warning(disable:26800)
+				Assert::IsTrue(inlineVector.IsEmpty());
+				Assert::IsTrue(inlineVector.IsInline());
+#pragma warning(pop)
+			}
+			{
+				SmallVector<Foo, 2> heapVector{ a, b, c };
+				const Foo* data = heapVector.Data();
+				SmallVector<Foo, 2> movedVector(std::move(heapVector));
+				Assert::AreEqual(size_t(3), movedVector.Size());
+				Assert::IsTrue(data == movedVector.Data());
+				Assert::AreEqual(c, movedVector[2]);
+#pragma warning(push)
+#pragma warning(disable:26800)
+				Assert::IsTrue(heapVector.IsEmpty());
+				Assert::IsTrue(heapVector.IsInline());
+				Assert::AreEqual(size_t(2), heapVector.Capacity());
+#pragma warning(pop)
+
+				SmallVector<Foo, 2> assignedVector{ c };
+				assignedVector = std::move(movedVector);
+				Assert::AreEqual(size_t(3), assignedVector.Size());
+				Assert::IsTrue(data == assignedVector.Data());
+
+				assignedVector = SmallVector<Foo, 2>{ b };
+				Assert::AreEqual(size_t(1), assignedVector.Size());
+				Assert::IsTrue(assignedVector.IsInline());
+				Assert::AreEqual(b, assignedVector.Front());
+			}
+		}
+
+		TEST_METHOD(GrowAndShrink)
+		{
+			SmallVector<int, 4> smallVector;
+			for (int i = 0; i < 4; ++i) {
+				smallVector.PushBack(i);
+				Assert::IsTrue(smallVector.IsInline());
+			}
+			Assert::AreEqual(size_t(4), smallVector.Capacity());
+
+			smallVector.PushBack(4);
+			Assert::IsFalse(smallVector.IsInline());
+			Assert::IsTrue(smallVector.Capacity() > size_t(4));
+			for (int i = 5; i < 100; ++i) {
+				smallVector.PushBack(i);
+			}
+			Assert::AreEqual(size_t(100), smallVector.Size());
+			for (int i = 0; i < 100; ++i) {
+				Assert::AreEqual(i, smallVector[i]);
+			}
+
+			smallVector.Reserve(size_t(10));
+			Assert::IsTrue(smallVector.Capacity() >= size_t(100));
+
+			smallVector.ShrinkToFit();
+			Assert::AreEqual(size_t(100), smallVector.Capacity());
+			Assert::IsFalse(smallVector.IsInline());
+
+			while (smallVector.Size() > 3) {
+				smallVector.PopBack();
+			}
+			smallVector.ShrinkToFit();
+			Assert::IsTrue(smallVector.IsInline());
+			Assert::AreEqual(size_t(4), smallVector.Capacity());
+			Assert::AreEqual(2, smallVector.Back());
+
+			smallVector.Clear();
+			Assert::IsTrue(smallVector.IsEmpty());
+			Assert::AreEqual(size_t(4), smallVector.Capacity());
+			Assert::ExpectException<std::runtime_error>([&smallVector]() { smallVector.PopBack(); });
+		}
+
+		TEST_METHOD(IterationAndFind)
+		{
+			const Foo a{ 10 };
+			const Foo b{ 20 };
+			const Foo c{ 30 };
+			const Foo d{ 40 };
+			SmallVector<Foo, 2> smallVector{ a, b, c };
+
+			int expected = 10;
+			for (const Foo& foo : smallVector) {
+				Assert::AreEqual(expected, foo.Data());
+				expected += 10;
+			}
+			Assert::AreEqual(std::ptrdiff_t(3), smallVector.cend() - smallVector.cbegin());
+			Assert::AreEqual(size_t(3), smallVector.AsSpan().size());
+
+			Assert::IsTrue(smallVector.Find(b) == smallVector.begin() + 1);
+			Assert::IsTrue(smallVector.Find(d) == smallVector.end());
+
+			const SmallVector<Foo, 2>& constVector = smallVector;
+			Assert::IsTrue(constVector.Find(c) == constVector.begin() + 2);
+			Assert::IsTrue(constVector.Find(d) == constVector.end());
+			Assert::AreEqual(a, constVector.Front());
+			Assert::AreEqual(c, constVector.Back());
+			Assert::AreEqual(b, constVector[1]);
+			Assert::ExpectException<std::runtime_error>([&constVector]() { auto& value = constVector.At(3); UNREFERENCED_LOCAL(value); });
+		}
+
+		TEST_METHOD(Remove)
+		{
+			SmallVector<std::string, 2> smallVector{ "a"s, "b"s, "c"s, "d"s, "e"s };
+
+			Assert::IsTrue(smallVector.Remove("b"s));
+			Assert::IsFalse(smallVector.Remove("z"s));
+			Assert::AreEqual(size_t(4), smallVector.Size());
+			Assert::AreEqual("c"s, smallVector[1]);
+
+			Assert::IsTrue(smallVector.Remove(smallVector.begin()));
+			Assert::AreEqual("c"s, smallVector.Front());
+
+			Assert::IsFalse(smallVector.Remove(smallVector.begin() + 1, smallVector.begin()));
+			Assert::IsFalse(smallVector.Remove(smallVector.end()));
+			Assert::IsTrue(smallVector.Remove(smallVector.begin(), smallVector.begin() + 2));
+			Assert::AreEqual(size_t(1), smallVector.Size());
+			Assert::AreEqual("e"s, smallVector.Front());
+
+			smallVector.ShrinkToFit();
+			Assert::IsTrue(smallVector.IsInline());
+			Assert::AreEqual("e"s, smallVector.Front());
+
+			SmallVector<int, 4> integers{ 1, 2, 3, 4 };
+			Assert::IsTrue(integers.Remove(integers.begin() + 1, integers.begin() + 3));
+			Assert::AreEqual(size_t(2), integers.Size());
+			Assert::AreEqual(1, integers[0]);
+			Assert::AreEqual(4, integers[1]);
+		}
+
+	private:
+		inline static _CrtMemState _startMemState;
+	};
+}
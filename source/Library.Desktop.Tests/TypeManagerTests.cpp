@@ -5,6 +5,7 @@
 #include "AttributedFoo.h"
 #include "ToStringSpecializations.h"
 #include <algorithm>
+#include <thread>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace UnitTests;
@@ -449,6 +450,78 @@ namespace  LibraryDesktopTests
 			TypeManager::Remove(DerivedFoo::TypeIdClass());
 		}
 
+		TEST_METHOD(Freeze)
+		{
+			const Signature signature("A"s, Datum::DatumTypes::Integer, 5, 10);
+			const Signature signatureParent("B"s, Datum::DatumTypes::Float, 2, 11);
+			RTTI::IdType id = 13;
+			RTTI::IdType idParent = 15;
+			Vector<Signature> vectorTogether{ signature, signatureParent };
+
+			TypeManager::Add(idParent, { signatureParent });
+			TypeManager::Add(id, idParent, { signature });
+			Assert::IsFalse(TypeManager::IsFrozen());
+
+			TypeManager::Freeze();
+			Assert::IsTrue(TypeManager::IsFrozen());
+			Assert::IsTrue(TypeManager::ContainsSignature(id));
+			Assert::IsTrue(TypeManager::ContainsSignature(idParent));
+			Assert::IsFalse(TypeManager::ContainsSignature(0));
+			Assert::AreEqual(&TypeManager::Types().At(id), &TypeManager::GetSignatureByTypeID(id));
+			Assert::IsTrue(std::equal(vectorTogether.cbegin(), vectorTogether.cend(), TypeManager::GetSignatureByTypeID(id).cbegin()));
+			Assert::ExpectException<std::runtime_error>([] {auto& val = TypeManager::GetSignatureByTypeID(0); UNREFERENCED_LOCAL(val); });
+
+			Assert::IsFalse(TypeManager::Add(id, { signature }));
+			Assert::IsFalse(TypeManager::IsFrozen());
+			TypeManager::Freeze();
+			TypeManager::Remove(id);
+			Assert::IsFalse(TypeManager::IsFrozen());
+			Assert::IsFalse(TypeManager::ContainsSignature(id));
+
+			TypeManager::Freeze();
+			TypeManager::Clear();
+			Assert::IsFalse(TypeManager::IsFrozen());
+			Assert::IsFalse(TypeManager::ContainsSignature(idParent));
+		}
+
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		TEST_METHOD(ConcurrentRegistration)
+		{
+			const Signature parentSignature("Parent"s, Datum::DatumTypes::Float, 1, 0);
+			const RTTI::IdType parentID = 1;
+			TypeManager::Add(parentID, { parentSignature });
+
+			const RTTI::IdType threadCount = 8;
+			const RTTI::IdType typesPerThread = 8;
+			{
+				Vector<std::thread> threads(threadCount);
+				for (RTTI::IdType t = 0; t < threadCount; ++t) {
+					threads.PushBack(std::thread([t, &parentSignature]() {
+						for (RTTI::IdType i = 0; i < typesPerThread; ++i) {
+							RTTI::IdType id = 100 + t * typesPerThread + i;
+							TypeManager::Add(id, parentID, { Signature("Child"s + std::to_string(id), Datum::DatumTypes::Integer, 1, 4) });
+							const Vector<Signature>& parentSignatures = TypeManager::GetSignatureByTypeID(parentID);
+							if (parentSignatures.Size() != 1 || parentSignatures[0]._name != parentSignature._name) return;
+						}
+					}));
+				}
+				for (std::thread& thread : threads) {
+					thread.join();
+				}
+			}
+
+			Assert::AreEqual(size_t(threadCount * typesPerThread + 1), TypeManager::Types().Size());
+			for (RTTI::IdType id = 100; id < 100 + threadCount * typesPerThread; ++id) {
+				const Vector<Signature>& signatures = TypeManager::GetSignatureByTypeID(id);
+				Assert::AreEqual(size_t(2), signatures.Size());
+				Assert::AreEqual("Child"s + std::to_string(id), signatures[0]._name);
+				Assert::AreEqual(parentSignature._name, signatures[1]._name);
+			}
+
+			TypeManager::Clear();
+		}
+#endif // USE_THREAD_SAFE_REGISTRIES
+
 	private:
 		inline static _CrtMemState _startMemState;
 	};
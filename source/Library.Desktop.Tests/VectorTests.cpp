@@ -1,10 +1,13 @@
 #include "pch.h"
 #include "CppUnitTest.h"
 #include "Vector.h"
+#include "SList.h"
 #include "Foo.h"
 #include "ToStringSpecializations.h"
 #include <algorithm>
 #include <limits>
+#include <iterator>
+#include <sstream>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace UnitTests;
@@ -39,6 +42,48 @@ namespace Microsoft::VisualStudio::CppUnitTestFramework {
 
 namespace  LibraryDesktopTests
 {
+	/// <summary>
+	/// A type that points into itself, so it is only valid if moved with its move constructor.
+	/// </summary>
+	struct SelfReferencing final {
+		explicit SelfReferencing(int value) : _value{ value } {}
+		SelfReferencing(const SelfReferencing& rhs) : _value{ rhs._value } {}
+		SelfReferencing(SelfReferencing&& rhs) noexcept : _value{ rhs._value } {}
+		SelfReferencing& operator=(const SelfReferencing&) = delete;
+		~SelfReferencing() { _self = nullptr; }
+
+		[[nodiscard]] bool IsValid() const { return _self == this; }
+
+		int _value;
+		const SelfReferencing* _self{ this };
+	};
+
+	/// <summary>
+	/// A trivially relocatable value built from an int that refuses negative ones, to check that a failed insertion leaves a Vector as it was.
+	/// </summary>
+	struct NonNegative final {
+		NonNegative(int value) : _value{ value } { if (value < 0) throw std::runtime_error("Value is negative."); }
+
+		int _value;
+	};
+
+	/// <summary>
+	/// A Foo built from an int that refuses negative ones, for the same check on a type that is not trivially relocatable.
+	/// </summary>
+	struct NonNegativeFoo final {
+		NonNegativeFoo(int value) : _foo{ value } { if (value < 0) throw std::runtime_error("Value is negative."); }
+
+		Foo _foo;
+	};
+
+	static_assert(IsTriviallyRelocatableV<NonNegative>);
+	static_assert(!IsTriviallyRelocatableV<NonNegativeFoo>);
+	static_assert(IsTriviallyRelocatableV<int>);
+	static_assert(IsTriviallyRelocatableV<Foo*>);
+	static_assert(IsTriviallyRelocatableV<std::unique_ptr<Foo>>);
+	static_assert(!IsTriviallyRelocatableV<std::string>);
+	static_assert(!IsTriviallyRelocatableV<SelfReferencing>);
+
 	TEST_CLASS(VectorTests)
 	{
 	public:
@@ -465,12 +510,16 @@ namespace  LibraryDesktopTests
 			{
 				Vector<Foo>::Iterator iter = vector.end();
 				Assert::AreNotEqual(iter, vector.begin());
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo>::ConstIterator iter = vector.cend();
 				Assert::AreNotEqual(iter, vector.cbegin());
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -484,12 +533,16 @@ namespace  LibraryDesktopTests
 			{
 				Vector<Foo>::ConstIterator iter = vector.end();
 				Assert::AreNotEqual(iter, vector.begin());
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo>::ConstIterator iter = vector.cend();
 				Assert::AreNotEqual(iter, vector.cbegin());
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -915,7 +968,9 @@ namespace  LibraryDesktopTests
 				Vector<Foo>::Iterator iter;
 				Assert::AreEqual(size_t(1), vector.Size());
 				Assert::AreEqual(originalCapacity, vector.Capacity());
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter, &vector]() {vector.Remove(iter); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo> vector{ a };
@@ -926,7 +981,9 @@ namespace  LibraryDesktopTests
 				Vector<Foo>::Iterator iter = anotherVector.begin();
 				Assert::AreEqual(size_t(1), vector.Size());
 				Assert::AreEqual(originalCapacity, vector.Capacity());
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter, &vector]() {vector.Remove(iter); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo> vector{ a, b };
@@ -1096,8 +1153,10 @@ namespace  LibraryDesktopTests
 				std::size_t originalCapacity = vector.Capacity();
 
 				Vector<Foo>::Iterator iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter, &vector]() {vector.Remove(vector.begin(), iter); });
 				Assert::ExpectException<std::runtime_error>([&iter, &vector]() {vector.Remove(iter, vector.end()); });
+#endif // USE_CHECKED_ITERATORS
 				Assert::AreEqual(originalCapacity, vector.Capacity());
 			}
 			{
@@ -1107,9 +1166,11 @@ namespace  LibraryDesktopTests
 				std::size_t originalCapacity = vector.Capacity();
 
 				Vector<Foo>::Iterator iter = anotherVector.begin();
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherVector, &vector]() {vector.Remove(anotherVector.begin(), anotherVector.end()); });
 				Assert::ExpectException<std::runtime_error>([&anotherVector, &vector]() {vector.Remove(vector.begin(), anotherVector.end()); });
 				Assert::ExpectException<std::runtime_error>([&anotherVector, &vector]() {vector.Remove(anotherVector.begin(), vector.end()); });
+#endif // USE_CHECKED_ITERATORS
 				Assert::AreEqual(originalCapacity, vector.Capacity());
 			}
 			{
@@ -1190,6 +1251,293 @@ namespace  LibraryDesktopTests
 			Assert::ExpectException<std::runtime_error>([&vector]() {vector.PopBack(); });
 		}
 
+		TEST_METHOD(EmplaceBack)
+		{
+			Vector<Foo> vector;
+			auto iter = vector.EmplaceBack(10);
+			Assert::AreEqual(Foo(10), *iter);
+			vector.EmplaceBack();
+			Assert::AreEqual(size_t(2), vector.Size());
+			Assert::AreEqual(Foo(0), vector.Back());
+
+			Vector<std::pair<int, std::string>> pairs;
+			for (int i = 0; i < 10; ++i) {
+				pairs.EmplaceBack(i, std::to_string(i));
+			}
+			Assert::AreEqual(size_t(10), pairs.Size());
+			Assert::AreEqual("9"s, pairs.Back().second);
+		}
+
+		TEST_METHOD(InsertRange)
+		{
+			{
+				Vector<Foo> vector{ Foo(1), Foo(5) };
+				const Foo middle[] = { Foo(2), Foo(3), Foo(4) };
+				auto iter = vector.Insert(vector.begin() + 1, std::begin(middle), std::end(middle));
+				Assert::AreEqual(Foo(2), *iter);
+				Assert::AreEqual(size_t(5), vector.Size());
+				for (int i = 0; i < 5; ++i) {
+					Assert::AreEqual(Foo(i + 1), vector[i]);
+				}
+
+				iter = vector.Insert(vector.end(), std::begin(middle), std::begin(middle));
+				Assert::AreEqual(size_t(5), vector.Size());
+				Assert::IsTrue(iter == vector.end());
+
+				SList<Foo> list{ Foo(-1), Foo(0) };
+				vector.Insert(vector.begin(), list.begin(), list.end());
+				Assert::AreEqual(Foo(-1), vector.Front());
+				Assert::AreEqual(Foo(5), vector.Back());
+				Assert::AreEqual(size_t(7), vector.Size());
+
+#ifdef USE_CHECKED_ITERATORS
+				Vector<Foo> other;
+				Assert::ExpectException<std::runtime_error>([&vector, &other, &list]() {vector.Insert(other.begin(), list.begin(), list.end()); });
+#endif // USE_CHECKED_ITERATORS
+			}
+			{
+				Vector<SelfReferencing> vector;
+				for (int i = 0; i < 10; ++i) {
+					vector.PushBack(SelfReferencing(i));
+				}
+				Vector<SelfReferencing> inserted;
+				for (int i = 100; i < 120; ++i) {
+					inserted.PushBack(SelfReferencing(i));
+				}
+				vector.Insert(vector.begin() + 5, inserted.begin(), inserted.end());
+				Assert::AreEqual(size_t(30), vector.Size());
+				Assert::AreEqual(4, vector[4]._value);
+				Assert::AreEqual(100, vector[5]._value);
+				Assert::AreEqual(5, vector[25]._value);
+				Assert::IsTrue(std::all_of(vector.begin(), vector.end(), [](const SelfReferencing& value) { return value.IsValid(); }));
+			}
+			{
+				Vector<std::unique_ptr<Foo>> vector;
+				vector.PushBack(std::make_unique<Foo>(0));
+				vector.PushBack(std::make_unique<Foo>(3));
+				std::unique_ptr<Foo> middle[] = { std::make_unique<Foo>(1), std::make_unique<Foo>(2) };
+				vector.Insert(vector.begin() + 1, std::make_move_iterator(std::begin(middle)), std::make_move_iterator(std::end(middle)));
+				Assert::AreEqual(size_t(4), vector.Size());
+				for (int i = 0; i < 4; ++i) {
+					Assert::AreEqual(i, vector[i]->Data());
+				}
+				Assert::IsTrue(middle[0] == nullptr);
+			}
+		}
+
+		TEST_METHOD(InsertRangeSinglePass)
+		{
+			{
+				Vector<int> vector{ 1, 2, 6 };
+				std::istringstream stream("3 4 5");
+				auto iter = vector.Insert(vector.begin() + 2, std::istream_iterator<int>(stream), std::istream_iterator<int>());
+				Assert::AreEqual(3, *iter);
+				Assert::AreEqual(size_t(6), vector.Size());
+				for (int i = 0; i < 6; ++i) {
+					Assert::AreEqual(i + 1, vector[i]);
+				}
+
+				std::istringstream emptyStream("");
+				iter = vector.Insert(vector.end(), std::istream_iterator<int>(emptyStream), std::istream_iterator<int>());
+				Assert::IsTrue(iter == vector.end());
+				Assert::AreEqual(size_t(6), vector.Size());
+			}
+			{
+				Vector<Foo> vector{ Foo(1), Foo(4) };
+				std::istringstream stream("2 3");
+				vector.Insert(vector.begin() + 1, std::istream_iterator<int>(stream), std::istream_iterator<int>());
+				Assert::AreEqual(size_t(4), vector.Size());
+				for (int i = 0; i < 4; ++i) {
+					Assert::AreEqual(Foo(i + 1), vector[i]);
+				}
+			}
+		}
+
+		TEST_METHOD(InsertRangeThrowing)
+		{
+			const int values[] = { 10, 11, -1 };
+			{
+				Vector<NonNegative> vector;
+				for (int i = 1; i <= 3; ++i) {
+					vector.PushBack(NonNegative(i));
+				}
+				Assert::ExpectException<std::runtime_error>([&vector, &values]() { vector.Insert(vector.begin() + 1, std::begin(values), std::end(values)); });
+				Assert::AreEqual(size_t(3), vector.Size());
+				for (int i = 0; i < 3; ++i) {
+					Assert::AreEqual(i + 1, vector[i]._value);
+				}
+
+				std::istringstream stream("10 -1");
+				Assert::ExpectException<std::runtime_error>([&vector, &stream]() { vector.Insert(vector.begin(), std::istream_iterator<int>(stream), std::istream_iterator<int>()); });
+				Assert::AreEqual(size_t(3), vector.Size());
+				Assert::AreEqual(1, vector.Front()._value);
+			}
+			{
+				Vector<NonNegativeFoo> vector;
+				for (int i = 1; i <= 3; ++i) {
+					vector.PushBack(NonNegativeFoo(i));
+				}
+				Assert::ExpectException<std::runtime_error>([&vector, &values]() { vector.Insert(vector.begin() + 1, std::begin(values), std::end(values)); });
+				Assert::AreEqual(size_t(3), vector.Size());
+				for (int i = 0; i < 3; ++i) {
+					Assert::AreEqual(Foo(i + 1), vector[i]._foo);
+				}
+			}
+		}
+
+		TEST_METHOD(Append)
+		{
+			Vector<std::string> vector{ "a"s };
+			Vector<std::string> other{ "b"s, "c"s };
+			auto iter = vector.Append(other);
+			Assert::AreEqual("b"s, *iter);
+			Assert::AreEqual(size_t(3), vector.Size());
+			Assert::AreEqual("c"s, other.Back());
+
+			vector.Append(std::move(other));
+			Assert::AreEqual(size_t(5), vector.Size());
+			Assert::AreEqual("c"s, vector.Back());
+			Assert::IsTrue(other.Back().empty());
+
+			vector.Append(std::initializer_list<std::string>{ "d"s, "e"s });
+			Assert::AreEqual("e"s, vector.Back());
+
+			Vector<int> numbers(4);
+			numbers.Append(Vector<int>{ 1, 2, 3, 4, 5, 6 });
+			Assert::AreEqual(size_t(6), numbers.Size());
+			Assert::IsTrue(numbers.Capacity() >= size_t(6));
+			iter = vector.Append(Vector<std::string>{});
+			Assert::IsTrue(iter == vector.end());
+		}
+
+		TEST_METHOD(RemoveIf)
+		{
+			{
+				Vector<Foo> vector;
+				for (int i = 0; i < 10; ++i) {
+					vector.EmplaceBack(i);
+				}
+				std::size_t capacity = vector.Capacity();
+				Assert::AreEqual(size_t(5), vector.RemoveIf([](const Foo& foo) { return foo.Data() % 2 == 0; }));
+				Assert::AreEqual(size_t(5), vector.Size());
+				Assert::AreEqual(capacity, vector.Capacity());
+				for (int i = 0; i < 5; ++i) {
+					Assert::AreEqual(Foo(2 * i + 1), vector[i]);
+				}
+				Assert::AreEqual(size_t(0), vector.RemoveIf([](const Foo&) { return false; }));
+				Assert::AreEqual(size_t(5), vector.RemoveIf([](const Foo&) { return true; }));
+				Assert::IsTrue(vector.IsEmpty());
+			}
+			{
+				Vector<SelfReferencing> vector;
+				for (int i = 0; i < 20; ++i) {
+					vector.PushBack(SelfReferencing(i));
+				}
+				vector.RemoveIf([](const SelfReferencing& value) { return value._value < 3 || value._value % 5 == 0; });
+				Assert::AreEqual(size_t(14), vector.Size());
+				Assert::AreEqual(3, vector.Front()._value);
+				Assert::AreEqual(6, vector[2]._value);
+				Assert::IsTrue(std::all_of(vector.begin(), vector.end(), [](const SelfReferencing& value) { return value.IsValid(); }));
+			}
+			{
+				Vector<std::unique_ptr<Foo>> vector;
+				for (int i = 0; i < 10; ++i) {
+					vector.PushBack(std::make_unique<Foo>(i));
+				}
+				int calls = 0;
+				vector.RemoveIf([&calls](const std::unique_ptr<Foo>& foo) { ++calls; return foo->Data() >= 3 && foo->Data() < 8; });
+				Assert::AreEqual(10, calls);
+				Assert::AreEqual(size_t(5), vector.Size());
+				Assert::AreEqual(2, vector[2]->Data());
+				Assert::AreEqual(8, vector[3]->Data());
+			}
+		}
+
+		TEST_METHOD(RemoveIfThrowing)
+		{
+			{
+				Vector<std::string> vector;
+				for (int i = 0; i < 10; ++i) {
+					vector.PushBack("value"s + std::to_string(i));
+				}
+				int calls = 0;
+				auto removeEvensUntilFive = [&calls](const std::string&) {
+					if (calls == 5) throw std::runtime_error("Predicate failed.");
+					return (calls++ % 2) == 0;
+				};
+				Assert::ExpectException<std::runtime_error>([&vector, &removeEvensUntilFive]() { vector.RemoveIf(removeEvensUntilFive); });
+				Assert::AreEqual(size_t(7), vector.Size());
+				Assert::AreEqual("value1"s, vector[0]);
+				Assert::AreEqual("value3"s, vector[1]);
+				for (int i = 5; i < 10; ++i) {
+					Assert::AreEqual("value"s + std::to_string(i), vector[i - 3]);
+				}
+			}
+			{
+				Vector<std::unique_ptr<Foo>> vector;
+				for (int i = 0; i < 10; ++i) {
+					vector.PushBack(std::make_unique<Foo>(i));
+				}
+				Assert::ExpectException<std::runtime_error>([&vector]() {
+					vector.RemoveIf([](const std::unique_ptr<Foo>& foo) {
+						if (foo->Data() == 6) throw std::runtime_error("Predicate failed.");
+						return foo->Data() < 2;
+					});
+				});
+				Assert::AreEqual(size_t(8), vector.Size());
+				for (int i = 0; i < 8; ++i) {
+					Assert::AreEqual(i + 2, vector[i]->Data());
+				}
+			}
+		}
+
+		TEST_METHOD(Relocation)
+		{
+			{
+				Vector<SelfReferencing> vector(1);
+				for (int i = 0; i < 20; ++i) {
+					vector.PushBack(SelfReferencing(i));
+				}
+				vector.Reserve(100);
+				Assert::IsTrue(std::all_of(vector.begin(), vector.end(), [](const SelfReferencing& value) { return value.IsValid(); }));
+
+				vector.Remove(vector.begin() + 2, vector.begin() + 5);
+				vector.Remove(vector.begin());
+				Assert::AreEqual(size_t(16), vector.Size());
+				Assert::AreEqual(1, vector.Front()._value);
+				Assert::AreEqual(5, vector[1]._value);
+				Assert::AreEqual(19, vector.Back()._value);
+
+				vector.ShrinkToFit();
+				Assert::AreEqual(size_t(16), vector.Capacity());
+				Assert::IsTrue(std::all_of(vector.begin(), vector.end(), [](const SelfReferencing& value) { return value.IsValid(); }));
+			}
+			{
+				Vector<std::string> vector(1);
+				for (int i = 0; i < 20; ++i) {
+					vector.PushBack((i % 2 == 0) ? std::to_string(i) : "a string too long for any small string buffer "s + std::to_string(i));
+				}
+				vector.Remove(vector.begin() + 3);
+				vector.ShrinkToFit();
+				Assert::AreEqual(size_t(19), vector.Size());
+				Assert::AreEqual("0"s, vector[0]);
+				Assert::AreEqual("a string too long for any small string buffer 1"s, vector[1]);
+				Assert::AreEqual("4"s, vector[3]);
+				Assert::AreEqual("a string too long for any small string buffer 19"s, vector.Back());
+			}
+			{
+				Vector<std::unique_ptr<Foo>> vector(1);
+				for (int i = 0; i < 10; ++i) {
+					vector.PushBack(std::make_unique<Foo>(i));
+				}
+				vector.Remove(vector.begin());
+				vector.ShrinkToFit();
+				Assert::AreEqual(size_t(9), vector.Size());
+				Assert::AreEqual(1, vector.Front()->Data());
+				Assert::AreEqual(9, vector.Back()->Data());
+			}
+		}
+
 		TEST_METHOD(IteratorConstructors)
 		{
 			const Foo a(10);
@@ -1282,16 +1630,22 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(*iter, c);
 
 				iter = vector.end();
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo>::Iterator iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo> vector{ a, b, c };
 				Vector<Foo>::Iterator iter = vector.begin() + 5;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -1312,16 +1666,22 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(*iter, c);
 
 				iter = vector.end();
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo>::ConstIterator iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo> vector{ a, b, c };
 				Vector<Foo>::Iterator iter = vector.begin() + 5;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -1340,7 +1700,9 @@ namespace  LibraryDesktopTests
 				++iter;
 				Assert::AreEqual(*iter, c);
 				++iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo> vector{ a, b, c };
@@ -1352,6 +1714,7 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(*anotherIter, b);
 				Assert::AreEqual(anotherIter, iter);
 			}
+#ifdef USE_CHECKED_ITERATORS
 			{
 				Vector<Foo> vector{ a };
 				Vector<Foo>::Iterator iter = vector.begin();
@@ -1366,9 +1729,12 @@ namespace  LibraryDesktopTests
 				++iter;
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
 			}
+#endif // USE_CHECKED_ITERATORS
 			{
 				Vector<Foo>::Iterator iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {++iter; });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo> vector{ a, b, c };
@@ -1380,7 +1746,9 @@ namespace  LibraryDesktopTests
 				iter++;
 				Assert::AreEqual(*iter, c);
 				iter++;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo> vector{ a, b, c };
@@ -1392,6 +1760,7 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(*anotherIter, a);
 				Assert::AreNotEqual(anotherIter, iter);
 			}
+#ifdef USE_CHECKED_ITERATORS
 			{
 				Vector<Foo> vector{ a };
 				Vector<Foo>::Iterator iter = vector.begin();
@@ -1406,9 +1775,12 @@ namespace  LibraryDesktopTests
 				iter++;
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
 			}
+#endif // USE_CHECKED_ITERATORS
 			{
 				Vector<Foo>::Iterator iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {iter++; });
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -1427,7 +1799,9 @@ namespace  LibraryDesktopTests
 				++iter;
 				Assert::AreEqual(*iter, c);
 				++iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				const Vector<Foo> vector{ a, b, c };
@@ -1439,6 +1813,7 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(*anotherIter, b);
 				Assert::AreEqual(anotherIter, iter);
 			}
+#ifdef USE_CHECKED_ITERATORS
 			{
 				const Vector<Foo> vector{ a };
 				Vector<Foo>::ConstIterator iter = vector.begin();
@@ -1453,9 +1828,12 @@ namespace  LibraryDesktopTests
 				++iter;
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
 			}
+#endif // USE_CHECKED_ITERATORS
 			{
 				Vector<Foo>::ConstIterator iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {++iter; });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				const Vector<Foo> vector{ a, b, c };
@@ -1467,7 +1845,9 @@ namespace  LibraryDesktopTests
 				iter++;
 				Assert::AreEqual(*iter, c);
 				iter++;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				const Vector<Foo> vector{ a, b, c };
@@ -1479,6 +1859,7 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(*anotherIter, a);
 				Assert::AreNotEqual(anotherIter, iter);
 			}
+#ifdef USE_CHECKED_ITERATORS
 			{
 				const Vector<Foo> vector{ a };
 				Vector<Foo>::ConstIterator iter = vector.begin();
@@ -1493,9 +1874,12 @@ namespace  LibraryDesktopTests
 				iter++;
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
 			}
+#endif // USE_CHECKED_ITERATORS
 			{
 				Vector<Foo>::ConstIterator iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {iter++; });
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -1507,7 +1891,9 @@ namespace  LibraryDesktopTests
 			{
 				Vector<Foo> vector{ a, b, c };
 				Vector<Foo>::Iterator iter = vector.end();
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 
 				--iter;
 				Assert::AreEqual(*iter, c);
@@ -1526,20 +1912,26 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(*anotherIter, b);
 				Assert::AreEqual(anotherIter, iter);
 			}
+#ifdef USE_CHECKED_ITERATORS
 			{
 				Vector<Foo> vector{ a };
 				Vector<Foo>::Iterator iter = vector.begin();
 				--iter;
 				Assert::AreEqual(*iter, a);
 			}
+#endif // USE_CHECKED_ITERATORS
 			{
 				Vector<Foo>::Iterator iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {--iter; });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo> vector{ a, b, c };
 				Vector<Foo>::Iterator iter = vector.end();
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 
 				iter--;
 				Assert::AreEqual(*iter, c);
@@ -1558,15 +1950,19 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(*anotherIter, c);
 				Assert::AreNotEqual(anotherIter, iter);
 			}
+#ifdef USE_CHECKED_ITERATORS
 			{
 				Vector<Foo> vector{ a };
 				Vector<Foo>::Iterator iter = vector.begin();
 				--iter;
 				Assert::AreEqual(*iter, a);
 			}
+#endif // USE_CHECKED_ITERATORS
 			{
 				Vector<Foo>::Iterator iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {iter--; });
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -1578,7 +1974,9 @@ namespace  LibraryDesktopTests
 			{
 				const Vector<Foo> vector{ a, b, c };
 				Vector<Foo>::ConstIterator iter = vector.end();
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 
 				--iter;
 				Assert::AreEqual(*iter, c);
@@ -1597,20 +1995,26 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(*anotherIter, b);
 				Assert::AreEqual(anotherIter, iter);
 			}
+#ifdef USE_CHECKED_ITERATORS
 			{
 				const Vector<Foo> vector{ a };
 				Vector<Foo>::ConstIterator iter = vector.begin();
 				--iter;
 				Assert::AreEqual(*iter, a);
 			}
+#endif // USE_CHECKED_ITERATORS
 			{
 				Vector<Foo>::ConstIterator iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {--iter; });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				const Vector<Foo> vector{ a, b, c };
 				Vector<Foo>::ConstIterator iter = vector.end();
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 
 				iter--;
 				Assert::AreEqual(*iter, c);
@@ -1629,15 +2033,19 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(*anotherIter, c);
 				Assert::AreNotEqual(anotherIter, iter);
 			}
+#ifdef USE_CHECKED_ITERATORS
 			{
 				const Vector<Foo> vector{ a };
 				Vector<Foo>::ConstIterator iter = vector.begin();
 				--iter;
 				Assert::AreEqual(*iter, a);
 			}
+#endif // USE_CHECKED_ITERATORS
 			{
 				Vector<Foo>::ConstIterator iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {iter--; });
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -1710,7 +2118,9 @@ namespace  LibraryDesktopTests
 				iter += 1;
 				Assert::AreEqual(*iter, a);
 				iter += 1;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo> vector{ a, b, c, b };
@@ -1721,9 +2131,12 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(*iter, b);
 				iter += -1;
 				Assert::AreEqual(*iter, c);
+#ifdef USE_CHECKED_ITERATORS
 				iter += -20;
 				Assert::AreEqual(*iter, a);
+#endif // USE_CHECKED_ITERATORS
 			}
+#ifdef USE_CHECKED_ITERATORS
 			{
 				Vector<Foo> vector{ a };
 				Vector<Foo>::Iterator iter = vector.begin();
@@ -1738,9 +2151,12 @@ namespace  LibraryDesktopTests
 				iter += 2;
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
 			}
+#endif // USE_CHECKED_ITERATORS
 			{
 				Vector<Foo>::Iterator iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {iter += 1; });
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -1759,7 +2175,9 @@ namespace  LibraryDesktopTests
 				iter += 1;
 				Assert::AreEqual(*iter, a);
 				iter += 1;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				const Vector<Foo> vector{ a, b, c, b };
@@ -1770,9 +2188,12 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(*iter, b);
 				iter += -1;
 				Assert::AreEqual(*iter, c);
+#ifdef USE_CHECKED_ITERATORS
 				iter += -20;
 				Assert::AreEqual(*iter, a);
+#endif // USE_CHECKED_ITERATORS
 			}
+#ifdef USE_CHECKED_ITERATORS
 			{
 				const Vector<Foo> vector{ a };
 				Vector<Foo>::ConstIterator iter = vector.begin();
@@ -1787,9 +2208,12 @@ namespace  LibraryDesktopTests
 				iter += 2;
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
 			}
+#endif // USE_CHECKED_ITERATORS
 			{
 				Vector<Foo>::ConstIterator iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {iter += 1; });
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -1807,8 +2231,10 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(*iter, b);
 				iter -= 1;
 				Assert::AreEqual(*iter, a);
+#ifdef USE_CHECKED_ITERATORS
 				iter -= 1;
 				Assert::AreEqual(*iter, a);
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo> vector{ a, b, c, b };
@@ -1820,17 +2246,23 @@ namespace  LibraryDesktopTests
 				iter -= -1;
 				Assert::AreEqual(*iter, b);
 				iter -= -20;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
+#ifdef USE_CHECKED_ITERATORS
 			{
 				Vector<Foo> vector{ a };
 				Vector<Foo>::Iterator iter = vector.begin();
 				iter -= 10;
 				Assert::AreEqual(*iter, a);
 			}
+#endif // USE_CHECKED_ITERATORS
 			{
 				Vector<Foo>::Iterator iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {iter -= 1; });
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -1848,8 +2280,10 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(*iter, b);
 				iter -= 1;
 				Assert::AreEqual(*iter, a);
+#ifdef USE_CHECKED_ITERATORS
 				iter -= 1;
 				Assert::AreEqual(*iter, a);
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				const Vector<Foo> vector{ a, b, c, b };
@@ -1861,17 +2295,23 @@ namespace  LibraryDesktopTests
 				iter -= -1;
 				Assert::AreEqual(*iter, b);
 				iter -= -20;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
+#ifdef USE_CHECKED_ITERATORS
 			{
 				const Vector<Foo> vector{ a };
 				Vector<Foo>::ConstIterator iter = vector.begin();
 				iter -= 10;
 				Assert::AreEqual(*iter, a);
 			}
+#endif // USE_CHECKED_ITERATORS
 			{
 				Vector<Foo>::ConstIterator iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {iter -= 1; });
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -1893,17 +2333,22 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(c, iter[2]);
 				Assert::AreNotSame(c, iter[2]);
 
+#ifdef USE_CHECKED_ITERATORS
 				--iter;
 				Assert::AreEqual(b, *iter);
 				Assert::AreNotSame(b, *iter);
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo> vector{ a, b, c };
 				Vector<Foo>::Iterator iter = vector.begin();
 
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {iter[3]; });
 				Assert::ExpectException<std::runtime_error>([&iter]() {iter[10]; });
+#endif // USE_CHECKED_ITERATORS
 
+#ifdef USE_CHECKED_ITERATORS
 				vector.Reserve(50);
 				Assert::ExpectException<std::runtime_error>([&iter]() {iter[3]; });
 				Assert::ExpectException<std::runtime_error>([&iter]() {iter[10]; });
@@ -1912,10 +2357,13 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(a, iter[3]);
 				Assert::AreNotSame(a, iter[3]);
 				Assert::ExpectException<std::runtime_error>([&iter]() {iter[4]; });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo>::Iterator iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {iter[0]; });
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -1937,20 +2385,26 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(c, iter[2]);
 				Assert::AreNotSame(c, iter[2]);
 
+#ifdef USE_CHECKED_ITERATORS
 				--iter;
 				Assert::AreEqual(b, *iter);
 				Assert::AreNotSame(b, *iter);
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				const Vector<Foo> vector{ a, b, c };
 				Vector<Foo>::ConstIterator iter = vector.begin();
 
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {iter[3]; });
 				Assert::ExpectException<std::runtime_error>([&iter]() {iter[10]; });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo>::ConstIterator iter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter]() {iter[0]; });
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -1964,7 +2418,9 @@ namespace  LibraryDesktopTests
 				Vector<Foo>::Iterator iter = vector.begin();
 				Vector<Foo>::Iterator anotherIter;
 				Assert::AreEqual(*iter, a);
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherIter]() {auto& value = *anotherIter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 
 				anotherIter = iter + 2;
 				Assert::AreEqual(*iter, a);
@@ -1975,14 +2431,18 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(*anotherIter, a);
 				iter += 1;
 				anotherIter = iter + 1;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherIter]() {auto& value = *anotherIter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo> vector{ a, b, c, b };
 				Vector<Foo>::Iterator iter = vector.begin();
 				Vector<Foo>::Iterator anotherIter;
 				Assert::AreEqual(*iter, a);
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherIter]() {auto& value = *anotherIter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 
 				anotherIter = iter + 3;
 				Assert::AreEqual(*iter, a);
@@ -1993,8 +2453,11 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(*anotherIter, c);
 				anotherIter = iter + -20;
 				Assert::AreEqual(*iter, b);
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherIter]() {auto& value = *anotherIter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
+#ifdef USE_CHECKED_ITERATORS
 			{
 				Vector<Foo> vector{ a };
 				Vector<Foo>::Iterator iter = vector.begin();
@@ -2017,10 +2480,13 @@ namespace  LibraryDesktopTests
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
 				Assert::AreEqual(*anotherIter, a);
 			}
+#endif // USE_CHECKED_ITERATORS
 			{
 				Vector<Foo>::Iterator iter;
 				Vector<Foo>::Iterator anotherIter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter, &anotherIter]() {anotherIter = iter + 1; });
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -2034,7 +2500,9 @@ namespace  LibraryDesktopTests
 				Vector<Foo>::ConstIterator iter = vector.begin();
 				Vector<Foo>::ConstIterator anotherIter;
 				Assert::AreEqual(*iter, a);
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherIter]() {auto& value = *anotherIter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 
 				anotherIter = iter + 2;
 				Assert::AreEqual(*iter, a);
@@ -2045,14 +2513,18 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(*anotherIter, a);
 				iter += 1;
 				anotherIter = iter + 1;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherIter]() {auto& value = *anotherIter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				const Vector<Foo> vector{ a, b, c, b };
 				Vector<Foo>::ConstIterator iter = vector.begin();
 				Vector<Foo>::ConstIterator anotherIter;
 				Assert::AreEqual(*iter, a);
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherIter]() {auto& value = *anotherIter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 
 				anotherIter = iter + 3;
 				Assert::AreEqual(*iter, a);
@@ -2063,8 +2535,11 @@ namespace  LibraryDesktopTests
 				Assert::AreEqual(*anotherIter, c);
 				anotherIter = iter + -20;
 				Assert::AreEqual(*iter, b);
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherIter]() {auto& value = *anotherIter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
+#ifdef USE_CHECKED_ITERATORS
 			{
 				const Vector<Foo> vector{ a };
 				Vector<Foo>::ConstIterator iter = vector.begin();
@@ -2087,10 +2562,13 @@ namespace  LibraryDesktopTests
 				Assert::ExpectException<std::runtime_error>([&iter]() {auto& value = *iter; UNREFERENCED_LOCAL(value); });
 				Assert::AreEqual(*anotherIter, a);
 			}
+#endif // USE_CHECKED_ITERATORS
 			{
 				Vector<Foo>::ConstIterator iter;
 				Vector<Foo>::ConstIterator anotherIter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter, &anotherIter]() {anotherIter = iter + 1; });
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -2104,7 +2582,9 @@ namespace  LibraryDesktopTests
 				Vector<Foo>::Iterator iter = vector.end() - 1;
 				Vector<Foo>::Iterator anotherIter;
 				Assert::AreEqual(*iter, a);
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherIter]() {auto& value = *anotherIter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 
 				anotherIter = iter - 2;
 				Assert::AreEqual(*iter, a);
@@ -2120,14 +2600,18 @@ namespace  LibraryDesktopTests
 
 				anotherIter = iter - 1;
 				Assert::AreEqual(*iter, a);
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherIter]() {auto& value = *anotherIter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo> vector{ a, b, c, b };
 				Vector<Foo>::Iterator iter = vector.end() - 1;
 				Vector<Foo>::Iterator anotherIter;
 				Assert::AreEqual(*iter, b);
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherIter]() {auto& value = *anotherIter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 
 				anotherIter = iter - 3;
 				Assert::AreEqual(*iter, b);
@@ -2143,7 +2627,9 @@ namespace  LibraryDesktopTests
 
 				anotherIter = iter - -20;
 				Assert::AreEqual(*iter, b);
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherIter]() {auto& value = *anotherIter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo> vector{ a };
@@ -2154,12 +2640,16 @@ namespace  LibraryDesktopTests
 
 				anotherIter = iter - -10;
 				Assert::AreEqual(*iter, a);
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherIter]() {auto& value = *anotherIter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo>::Iterator iter;
 				Vector<Foo>::Iterator anotherIter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter, &anotherIter]() {anotherIter = iter - 1; });
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -2173,7 +2663,9 @@ namespace  LibraryDesktopTests
 				Vector<Foo>::ConstIterator iter = vector.end() - 1;
 				Vector<Foo>::ConstIterator anotherIter;
 				Assert::AreEqual(*iter, a);
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherIter]() {auto& value = *anotherIter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 
 				anotherIter = iter - 2;
 				Assert::AreEqual(*iter, a);
@@ -2189,14 +2681,18 @@ namespace  LibraryDesktopTests
 
 				anotherIter = iter - 1;
 				Assert::AreEqual(*iter, a);
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherIter]() {auto& value = *anotherIter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				const Vector<Foo> vector{ a, b, c, b };
 				Vector<Foo>::ConstIterator iter = vector.end() - 1;
 				Vector<Foo>::ConstIterator anotherIter;
 				Assert::AreEqual(*iter, b);
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherIter]() {auto& value = *anotherIter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 
 				anotherIter = iter - 3;
 				Assert::AreEqual(*iter, b);
@@ -2212,7 +2708,9 @@ namespace  LibraryDesktopTests
 
 				anotherIter = iter - -20;
 				Assert::AreEqual(*iter, b);
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherIter]() {auto& value = *anotherIter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				const Vector<Foo> vector{ a };
@@ -2223,12 +2721,16 @@ namespace  LibraryDesktopTests
 
 				anotherIter = iter - -10;
 				Assert::AreEqual(*iter, a);
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&anotherIter]() {auto& value = *anotherIter; UNREFERENCED_LOCAL(value); });
+#endif // USE_CHECKED_ITERATORS
 			}
 			{
 				Vector<Foo>::ConstIterator iter;
 				Vector<Foo>::ConstIterator anotherIter;
+#ifdef USE_CHECKED_ITERATORS
 				Assert::ExpectException<std::runtime_error>([&iter, &anotherIter]() {anotherIter = iter - 1; });
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -2335,6 +2837,7 @@ namespace  LibraryDesktopTests
 				Assert::IsTrue(iter <= anotherIter);
 				Assert::IsFalse(iter >= anotherIter);
 			}
+#ifdef USE_CHECKED_ITERATORS
 			{
 				Vector<Foo> vector{ a, b, c };
 				Vector<Foo> anotherVector{ a, b, c };
@@ -2343,16 +2846,19 @@ namespace  LibraryDesktopTests
 				Assert::IsFalse(vector.end() <= anotherVector.end());
 				Assert::IsFalse(vector.end() >= anotherVector.end());
 			}
+#endif // USE_CHECKED_ITERATORS
 			{
 				Vector<Foo>::Iterator iter;
 				Vector<Foo>::Iterator anotherIter;
 				Assert::IsTrue(iter >= anotherIter);
 				Assert::IsTrue(iter <= anotherIter);
 
+#ifdef USE_CHECKED_ITERATORS
 				Vector<Foo> vector{ a, b, c };
 				anotherIter = vector.begin();
 				Assert::IsFalse(iter >= anotherIter);
 				Assert::IsFalse(iter <= anotherIter);
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -2383,6 +2889,7 @@ namespace  LibraryDesktopTests
 				Assert::IsTrue(iter <= anotherIter);
 				Assert::IsFalse(iter >= anotherIter);
 			}
+#ifdef USE_CHECKED_ITERATORS
 			{
 				const Vector<Foo> vector{ a, b, c };
 				const Vector<Foo> anotherVector{ a, b, c };
@@ -2391,16 +2898,19 @@ namespace  LibraryDesktopTests
 				Assert::IsFalse(vector.end() <= anotherVector.end());
 				Assert::IsFalse(vector.end() >= anotherVector.end());
 			}
+#endif // USE_CHECKED_ITERATORS
 			{
 				Vector<Foo>::ConstIterator iter;
 				Vector<Foo>::ConstIterator anotherIter;
 				Assert::IsTrue(iter >= anotherIter);
 				Assert::IsTrue(iter <= anotherIter);
 
+#ifdef USE_CHECKED_ITERATORS
 				const Vector<Foo> vector{ a, b, c };
 				anotherIter = vector.begin();
 				Assert::IsFalse(iter >= anotherIter);
 				Assert::IsFalse(iter <= anotherIter);
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -2438,6 +2948,7 @@ namespace  LibraryDesktopTests
 				Assert::IsFalse(iter < anotherIter);
 				Assert::IsFalse(iter > anotherIter);
 			}
+#ifdef USE_CHECKED_ITERATORS
 			{
 				Vector<Foo> vector{ a, b, c };
 				Vector<Foo> anotherVector{ a, b, c };
@@ -2446,16 +2957,19 @@ namespace  LibraryDesktopTests
 				Assert::IsFalse(vector.end() < anotherVector.end());
 				Assert::IsFalse(vector.end() > anotherVector.end());
 			}
+#endif // USE_CHECKED_ITERATORS
 			{
 				Vector<Foo>::Iterator iter;
 				Vector<Foo>::Iterator anotherIter;
 				Assert::IsFalse(iter > anotherIter);
 				Assert::IsFalse(iter < anotherIter);
 
+#ifdef USE_CHECKED_ITERATORS
 				Vector<Foo> vector{ a, b, c };
 				anotherIter = vector.begin();
 				Assert::IsFalse(iter > anotherIter);
 				Assert::IsFalse(iter < anotherIter);
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
@@ -2493,6 +3007,7 @@ namespace  LibraryDesktopTests
 				Assert::IsFalse(iter < anotherIter);
 				Assert::IsFalse(iter > anotherIter);
 			}
+#ifdef USE_CHECKED_ITERATORS
 			{
 				const Vector<Foo> vector{ a, b, c };
 				const Vector<Foo> anotherVector{ a, b, c };
@@ -2501,16 +3016,19 @@ namespace  LibraryDesktopTests
 				Assert::IsFalse(vector.end() < anotherVector.end());
 				Assert::IsFalse(vector.end() > anotherVector.end());
 			}
+#endif // USE_CHECKED_ITERATORS
 			{
 				Vector<Foo>::ConstIterator iter;
 				Vector<Foo>::ConstIterator anotherIter;
 				Assert::IsFalse(iter > anotherIter);
 				Assert::IsFalse(iter < anotherIter);
 
+#ifdef USE_CHECKED_ITERATORS
 				const Vector<Foo> vector{ a, b, c };
 				anotherIter = vector.begin();
 				Assert::IsFalse(iter > anotherIter);
 				Assert::IsFalse(iter < anotherIter);
+#endif // USE_CHECKED_ITERATORS
 			}
 		}
 
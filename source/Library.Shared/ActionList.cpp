@@ -37,7 +37,7 @@ namespace FIEAGameEngine {
 		}
 	}
 	
-	void ActionList::CreateAction(const std::string& actionClassName, const std::string& actionName) {
+	void ActionList::CreateAction(std::string_view actionClassName, const std::string& actionName) {
 		Scope* newAction = Factory<Scope>::Create(actionClassName);
 
 #ifdef USE_EXCEPTIONS
@@ -47,7 +47,7 @@ namespace FIEAGameEngine {
 		assert(newAction->Is(Action::TypeIdClass()));
 		Action* newGameObject = static_cast<Action*>(newAction);
 		newGameObject->SetName(actionName);
-		Adopt(*newGameObject, "actions"s);
+		Adopt(*newGameObject, "actions");
 	}
 
 	bool ActionList::Equals(const RTTI* rhs) const {
@@ -58,7 +58,7 @@ namespace FIEAGameEngine {
 		/// </summary>
 		/// <param name="childClassName">The class name of the action to create.</param>
 		/// <param name="childName">The name of the action to create.</param>
-		void CreateAction(const std::string& actionClassName, const std::string& actionName);
+		void CreateAction(std::string_view actionClassName, const std::string& actionName);
 
 		/// <summary>
 		/// Overriden RTTI functionality - Compare the equality of this ActionList with another object.
@@ -28,14 +28,14 @@ namespace FIEAGameEngine {
 	}
 
 	void ActionListWhile::Update(const GameTime& gameTime) {
-		RunActionsBlock("preamble"s, gameTime);
+		RunActionsBlock("preamble", gameTime);
 		while (condition) {
-			RunActionsBlock("loop"s, gameTime);
-			RunActionsBlock("increment"s, gameTime);
+			RunActionsBlock("loop", gameTime);
+			RunActionsBlock("increment", gameTime);
 		}
 	}
 
-	void ActionListWhile::RunActionsBlock(const std::string& tableName, const GameTime& gameTime) {
+	void ActionListWhile::RunActionsBlock(std::string_view tableName, const GameTime& gameTime) {
 		Datum& actions = At(tableName);
 		for (std::size_t i = 0; i < actions.Size(); ++i) {
 			Scope& scopeAction = actions.GetAsTable(i);
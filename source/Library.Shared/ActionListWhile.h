@@ -68,7 +68,7 @@ namespace FIEAGameEngine {
 		/// Helper function to run the given block of actions.
 		/// </summary>
 		/// <param name="gameTime">The current game time.</param>
-		void RunActionsBlock(const std::string& tableName, const GameTime& gameTime);
+		void RunActionsBlock(std::string_view tableName, const GameTime& gameTime);
 	};
 
 	/// <summary>
@@ -43,7 +43,7 @@ namespace FIEAGameEngine {
 	}
 
 	void Attributed::Populate(RTTI::IdType typeID) {
-		(*this)["this"s] = this;
+		(*this)["this"] = this;
 		ForEachSignature(typeID, [this](const Signature& signature) {
 			(*this)[signature._name].SetType(signature._type);
 			if (signature._type != Datum::DatumTypes::Table) {
@@ -55,7 +55,7 @@ namespace FIEAGameEngine {
 	}
 
 	void Attributed::UpdateExternalStorage(RTTI::IdType typeID) {
-		(*this)["this"s] = this;
+		(*this)["this"] = this;
 		ForEachSignature(typeID, [this](const Signature& signature) {
 			if (signature._type != Datum::DatumTypes::Table) { 
 				void* ptr = reinterpret_cast<std::byte*>(this) + signature._offset;
@@ -65,11 +65,11 @@ namespace FIEAGameEngine {
 		});
 	}
 
-	bool Attributed::IsAttribute(const std::string& key) const {
+	bool Attributed::IsAttribute(std::string_view key) const {
 		return (Find(key) != nullptr);
 	}
 	
-	bool Attributed::IsPrescribedAttribute(const std::string& key) const {
+	bool Attributed::IsPrescribedAttribute(std::string_view key) const {
 		bool isPrescribed = (key == "this");
 		if (!isPrescribed) {
 			ForEachSignature(TypeIdInstance(), [&key, &isPrescribed](const Signature& signature) {
@@ -83,11 +83,11 @@ namespace FIEAGameEngine {
 		return isPrescribed;
 	}
 	
-	bool Attributed::IsAuxiliaryAttribute(const std::string& key) const {
+	bool Attributed::IsAuxiliaryAttribute(std::string_view key) const {
 		return (IsAttribute(key) && !IsPrescribedAttribute(key));
 	}
 
-	Datum& Attributed::AppendAuxiliaryAttribute(const std::string& key) {
+	Datum& Attributed::AppendAuxiliaryAttribute(std::string_view key) {
 #ifdef USE_EXCEPTIONS
 		if (IsPrescribedAttribute(key)) throw std::runtime_error("Given key name is a prescribed attribute.");
 #endif // USE_EXCEPTIONS
@@ -58,26 +58,26 @@ namespace FIEAGameEngine {
 		/// </summary>
 		/// <param name="key">The name to look up.</param>
 		/// <returns>A boolean indicating if the given key is the name of an attribute.</returns>
-		[[nodiscard]] bool IsAttribute(const std::string& key) const;
+		[[nodiscard]] bool IsAttribute(std::string_view key) const;
 		/// <summary>
 		/// Check if the given key is the name of a prescribed attribute.
 		/// </summary>
 		/// <param name="key">The name to look up.</param>
 		/// <returns>A boolean indicating if the given key is the name of a prescribed attribute.</returns>
-		[[nodiscard]] bool IsPrescribedAttribute(const std::string& key) const;
+		[[nodiscard]] bool IsPrescribedAttribute(std::string_view key) const;
 		/// <summary>
 		/// Check if the given key is the name of an auxiliary attribute.
 		/// </summary>
 		/// <param name="key">The name to look up.</param>
 		/// <returns>A boolean indicating if the given key is the name of an auxiliary attribute.</returns>
-		[[nodiscard]] bool IsAuxiliaryAttribute(const std::string& key) const;
+		[[nodiscard]] bool IsAuxiliaryAttribute(std::string_view key) const;
 
 		/// <summary>
 		/// A thin wrapper for Scope's Append. You cannot append something with the same name as a prescribed attribute.
 		/// </summary>
 		/// <param name="key">The string name to append on.</param>
 		/// <returns>The Datum, either newly created or preexisting, associated with the key.</returns>
-		Datum& AppendAuxiliaryAttribute(const std::string& key);
+		Datum& AppendAuxiliaryAttribute(std::string_view key);
 
 		using AttributeFunction = std::function<bool(const std::string&, Datum&)>;
 		/// <summary>
@@ -0,0 +1,369 @@
+/// <summary>
+/// The declaration of the templated class ConcurrentHashMap, a HashMap split into independently locked shards.
+/// </summary>
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+#include <utility>
+#include "HashMap.h"
+#include "DefaultHash.h"
+#include "DefaultEquality.h"
+#include "HashMapStatistics.h"
+
+namespace FIEAGameEngine {
+	/// <summary>
+	/// A templated hash map that can be shared between threads.
+	/// Entries are spread over ShardCount shards by their hash; each shard is a HashMap guarded by its own reader-writer lock, so operations on keys in different shards never wait on each other and any number of lookups can share a shard.
+	/// There are no iterators, since they could not stay valid while other threads modify the map. Find returns a pointer to the stored data instead, ForEach visits every entry, and Visit runs a function on one entry while its shard is locked.
+	/// HashMap relinks nodes rather than copying them when it grows, so pointers and references to stored data stay valid until that entry is removed or the map is cleared. Synchronizing access to the data itself is up to the caller, or can be done through Visit.
+	/// </summary>
+	/// <typeparam name="TKey">The type of object used as a key.</typeparam>
+	/// <typeparam name="TData">The type of object stored at a key.</typeparam>
+	/// <typeparam name="THashFunctor">The functor used to hash a key type, used both to pick a shard and by the shard itself.</typeparam>
+	/// <typeparam name="TEqualityFunctor">The functor used to compare two keys.</typeparam>
+	/// <typeparam name="ShardCount">The number of independently locked shards. Must be a power of two.</typeparam>
+	template <typename TKey, typename TData, typename THashFunctor = DefaultHash<TKey>, typename TEqualityFunctor = DefaultEquality<const TKey>, std::size_t ShardCount = 16>
+	class ConcurrentHashMap final {
+		static_assert(ShardCount > 0 && (ShardCount & (ShardCount - 1)) == 0, "ShardCount must be a power of two.");
+
+	public:
+		using MapType = HashMap<TKey, TData, THashFunctor, TEqualityFunctor>;
+		using PairType = typename MapType::PairType;
+		using key_type = typename MapType::key_type;
+		using mapped_type = TData;
+		using value_type = PairType;
+		using size_type = std::size_t;
+		using hasher = THashFunctor;
+		using key_equal = TEqualityFunctor;
+		using EqualityFunctor = TEqualityFunctor;
+
+		/// <summary>
+		/// Whether TLookup can be used to search the ConcurrentHashMap without constructing a key, following the same rules as HashMap.
+		/// </summary>
+		template <typename TLookup>
+		static constexpr bool IsLookupType = MapType::template IsLookupType<TLookup>;
+
+		/// <summary>
+		/// The main constructor for a ConcurrentHashMap.
+		/// </summary>
+		/// <param name="chainCount">The number of chains each shard should start with, defaulted to 13. Must be greater than 1.</param>
+		/// <param name="equalityFunctor">A method used to determine relevant equality between two keys</param>
+		explicit ConcurrentHashMap(size_type chainCount = 13, EqualityFunctor equalityFunctor = EqualityFunctor{});
+		/// <summary>
+		/// An Initializer list constructor for ConcurrentHashMap.
+		/// </summary>
+		/// <param name="list">A set of items to add to the ConcurrentHashMap as it's being constructed</param>
+		/// <param name="chainCount">The number of chains each shard should start with, defaulted to 13. Must be greater than 1.</param>
+		/// <param name="equalityFunctor">A method used to determine relevant equality between two keys</param>
+		ConcurrentHashMap(std::initializer_list<PairType> list, size_type chainCount = 13, EqualityFunctor equalityFunctor = EqualityFunctor{});
+		/// <summary>
+		/// The copy constructor for a ConcurrentHashMap has been deleted, since the locks cannot be copied and a copy of a map other threads are modifying would not be a consistent snapshot.
+		/// </summary>
+		/// <param name="rhs">The ConcurrentHashMap to copy</param>
+		ConcurrentHashMap(const ConcurrentHashMap& rhs) = delete;
+		/// <summary>
+		/// The move constructor for a ConcurrentHashMap has been deleted, since the locks cannot be moved.
+		/// </summary>
+		/// <param name="rhs">The ConcurrentHashMap to move data from</param>
+		ConcurrentHashMap(ConcurrentHashMap&& rhs) noexcept = delete;
+		/// <summary>
+		/// The copy assignment operator for a ConcurrentHashMap has been deleted.
+		/// </summary>
+		/// <param name="rhs">The ConcurrentHashMap to copy</param>
+		/// <returns>A reference to the updated ConcurrentHashMap</returns>
+		ConcurrentHashMap& operator=(const ConcurrentHashMap& rhs) = delete;
+		/// <summary>
+		/// The move assignment operator for a ConcurrentHashMap has been deleted.
+		/// </summary>
+		/// <param name="rhs">The ConcurrentHashMap to move data from</param>
+		/// <returns>A reference to the updated ConcurrentHashMap</returns>
+		ConcurrentHashMap& operator=(ConcurrentHashMap&& rhs) noexcept = delete;
+		/// <summary>
+		/// The destructor for a ConcurrentHashMap. Using the compiler provided default implementation.
+		/// </summary>
+		~ConcurrentHashMap() = default;
+
+		/// <summary>
+		/// Get the number of shards entries are spread over.
+		/// </summary>
+		/// <returns>The number of shards</returns>
+		[[nodiscard]] static constexpr size_type Shards();
+		/// <summary>
+		/// Get the current population. Each shard is counted under its lock, but other threads may change the total while it is being summed.
+		/// </summary>
+		/// <returns>The current population of the ConcurrentHashMap</returns>
+		[[nodiscard]] size_type Size() const;
+		/// <summary>
+		/// Check if the ConcurrentHashMap is empty. Subject to the same caveat as Size.
+		/// </summary>
+		/// <returns>A boolean indicating if no shard holds any entries</returns>
+		[[nodiscard]] bool IsEmpty() const;
+#ifdef USE_HASHMAP_STATISTICS
+		/// <summary>
+		/// Combine the statistics of every shard into one snapshot.
+		/// </summary>
+		/// <returns>A snapshot of the ConcurrentHashMap's statistics</returns>
+		[[nodiscard]] HashMapStatistics GetStatistics() const;
+		/// <summary>
+		/// Zero the cumulative find, insert, and probe counters of every shard.
+		/// </summary>
+		void ResetStatistics();
+#endif // USE_HASHMAP_STATISTICS
+
+		/// <summary>
+		/// Check if the ConcurrentHashMap contains a given key.
+		/// </summary>
+		/// <param name="key">The key to look for</param>
+		/// <returns>A boolean determining if the ConcurrentHashMap contains the given key</returns>
+		[[nodiscard]] bool ContainsKey(const TKey& key) const;
+		/// <summary>
+		/// Check if the ConcurrentHashMap contains a key equal to the given lookup value, without constructing a key.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>A boolean determining if the ConcurrentHashMap contains an equal key</returns>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		[[nodiscard]] bool ContainsKey(const TLookup& key) const;
+		/// <summary>
+		/// Find the data stored at a given key.
+		/// </summary>
+		/// <param name="key">The key to look for</param>
+		/// <returns>A pointer to the data, valid until the entry is removed, or nullptr if the key is not present</returns>
+		[[nodiscard]] TData* Find(const TKey& key);
+		/// <summary>
+		/// Find the data stored at a given key.
+		/// </summary>
+		/// <param name="key">The key to look for</param>
+		/// <returns>A const pointer to the data, valid until the entry is removed, or nullptr if the key is not present</returns>
+		[[nodiscard]] const TData* Find(const TKey& key) const;
+		/// <summary>
+		/// Find the data stored at a key equal to the given lookup value, without constructing a key.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>A pointer to the data, valid until the entry is removed, or nullptr if no equal key is present</returns>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		[[nodiscard]] TData* Find(const TLookup& key);
+		/// <summary>
+		/// Find the data stored at a key equal to the given lookup value, without constructing a key.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>A const pointer to the data, valid until the entry is removed, or nullptr if no equal key is present</returns>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		[[nodiscard]] const TData* Find(const TLookup& key) const;
+		/// <summary>
+		/// Get the data stored at a given key.
+		/// </summary>
+		/// <param name="key">The key to look for</param>
+		/// <returns>A reference to the data, valid until the entry is removed</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the key is not present</exception>
+		[[nodiscard]] TData& At(const TKey& key);
+		/// <summary>
+		/// Get the data stored at a given key.
+		/// </summary>
+		/// <param name="key">The key to look for</param>
+		/// <returns>A const reference to the data, valid until the entry is removed</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the key is not present</exception>
+		[[nodiscard]] const TData& At(const TKey& key) const;
+		/// <summary>
+		/// Get the data stored at a key equal to the given lookup value, without constructing a key.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>A reference to the data, valid until the entry is removed</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and no equal key is present</exception>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		[[nodiscard]] TData& At(const TLookup& key);
+		/// <summary>
+		/// Get the data stored at a key equal to the given lookup value, without constructing a key.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>A const reference to the data, valid until the entry is removed</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and no equal key is present</exception>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		[[nodiscard]] const TData& At(const TLookup& key) const;
+
+		/// <summary>
+		/// Call a function on the data stored at a key while holding its shard's write lock, so the data can be read and modified without racing other threads.
+		/// The function must not call back into this ConcurrentHashMap.
+		/// </summary>
+		/// <param name="key">The key (or lookup value) to look for</param>
+		/// <param name="visitor">The function to call, taking a TData&</param>
+		/// <returns>A boolean indicating if the key was present and the function was called</returns>
+		template <typename TLookup, typename TVisitor>
+		bool Visit(const TLookup& key, TVisitor&& visitor);
+		/// <summary>
+		/// Call a function on the data stored at a key while holding its shard's read lock.
+		/// The function must not call back into this ConcurrentHashMap.
+		/// </summary>
+		/// <param name="key">The key (or lookup value) to look for</param>
+		/// <param name="visitor">The function to call, taking a const TData&</param>
+		/// <returns>A boolean indicating if the key was present and the function was called</returns>
+		template <typename TLookup, typename TVisitor>
+		bool Visit(const TLookup& key, TVisitor&& visitor) const;
+		/// <summary>
+		/// Call a function on every entry, one shard at a time while holding that shard's read lock. Entries added to or removed from other shards meanwhile may or may not be seen.
+		/// The function must not call back into this ConcurrentHashMap.
+		/// </summary>
+		/// <param name="visitor">The function to call, taking a const PairType&</param>
+		template <typename TVisitor>
+		void ForEach(TVisitor&& visitor) const;
+
+		/// <summary>
+		/// Insert a PairType into the ConcurrentHashMap, if its key is not already present.
+		/// </summary>
+		/// <param name="entry">The PairType to insert</param>
+		/// <returns>A pair of a pointer to the data stored at the key and a boolean indicating if the insert happened</returns>
+		std::pair<TData*, bool> Insert(const PairType& entry);
+		/// <summary>
+		/// Insert a PairType into the ConcurrentHashMap using move semantics, if its key is not already present.
+		/// </summary>
+		/// <param name="entry">The PairType to insert</param>
+		/// <returns>A pair of a pointer to the data stored at the key and a boolean indicating if the insert happened</returns>
+		std::pair<TData*, bool> Insert(PairType&& entry);
+		/// <summary>
+		/// Construct data in place at the given key if the key is not already present. If it is, the arguments are left untouched.
+		/// </summary>
+		/// <param name="key">The key to insert at</param>
+		/// <param name="args">The arguments to construct the data from</param>
+		/// <returns>A pair of a pointer to the data stored at the key and a boolean indicating if the insert happened</returns>
+		template <typename... Args>
+		std::pair<TData*, bool> TryEmplace(const TKey& key, Args&&... args);
+		/// <summary>
+		/// Construct data in place at the given key, moving the key in, if the key is not already present. If it is, the key and arguments are left untouched.
+		/// </summary>
+		/// <param name="key">The key to insert at</param>
+		/// <param name="args">The arguments to construct the data from</param>
+		/// <returns>A pair of a pointer to the data stored at the key and a boolean indicating if the insert happened</returns>
+		template <typename... Args>
+		std::pair<TData*, bool> TryEmplace(TKey&& key, Args&&... args);
+		/// <summary>
+		/// Construct data in place at a key built from the given lookup value, if no equal key is present. If one is, no key is constructed and the arguments are left untouched.
+		/// </summary>
+		/// <param name="key">The lookup value to insert at</param>
+		/// <param name="args">The arguments to construct the data from</param>
+		/// <returns>A pair of a pointer to the data stored at the key and a boolean indicating if the insert happened</returns>
+		template <typename TLookup, typename... Args, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		std::pair<TData*, bool> TryEmplace(const TLookup& key, Args&&... args);
+		/// <summary>
+		/// Insert data at the given key, or assign it over the data already stored there.
+		/// </summary>
+		/// <param name="key">The key to insert at</param>
+		/// <param name="data">The data to insert or assign</param>
+		/// <returns>A pair of a pointer to the data stored at the key and a boolean indicating if an insert (rather than an assignment) happened</returns>
+		template <typename TValue>
+		std::pair<TData*, bool> InsertOrAssign(const TKey& key, TValue&& data);
+		/// <summary>
+		/// Insert data at the given key, moving the key in, or assign it over the data already stored there.
+		/// </summary>
+		/// <param name="key">The key to insert at</param>
+		/// <param name="data">The data to insert or assign</param>
+		/// <returns>A pair of a pointer to the data stored at the key and a boolean indicating if an insert (rather than an assignment) happened</returns>
+		template <typename TValue>
+		std::pair<TData*, bool> InsertOrAssign(TKey&& key, TValue&& data);
+		/// <summary>
+		/// Insert data at a key built from the given lookup value, or assign it over the data already stored at an equal key.
+		/// </summary>
+		/// <param name="key">The lookup value to insert at</param>
+		/// <param name="data">The data to insert or assign</param>
+		/// <returns>A pair of a pointer to the data stored at the key and a boolean indicating if an insert (rather than an assignment) happened</returns>
+		template <typename TLookup, typename TValue, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		std::pair<TData*, bool> InsertOrAssign(const TLookup& key, TValue&& data);
+		/// <summary>
+		/// Remove the entry at a given key. Any pointer or reference to its data held by another thread is invalidated.
+		/// </summary>
+		/// <param name="key">The key to remove</param>
+		/// <returns>A boolean indicating if the key was present</returns>
+		bool Remove(const TKey& key);
+		/// <summary>
+		/// Remove the entry at a key equal to the given lookup value, without constructing a key.
+		/// </summary>
+		/// <param name="key">The lookup value to remove</param>
+		/// <returns>A boolean indicating if an equal key was present</returns>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		bool Remove(const TLookup& key);
+		/// <summary>
+		/// Remove every entry, one shard at a time. Entries inserted into already cleared shards meanwhile are kept.
+		/// </summary>
+		void Clear();
+
+	private:
+		/// <summary>
+		/// The number of hash bits used to pick a shard.
+		/// </summary>
+		static constexpr int ShardBits = []() { int bits = 0; while ((size_type(1) << bits) < ShardCount) ++bits; return bits; }();
+
+		/// <summary>
+		/// One independently locked part of the ConcurrentHashMap. Aligned to its own cache lines so that threads locking neighbouring shards do not contend on the same line.
+		/// </summary>
+		struct alignas(64) Shard final {
+			/// <summary>
+			/// Shared by lookups, held exclusively by anything that modifies the shard.
+			/// </summary>
+			mutable std::shared_mutex Mutex;
+			/// <summary>
+			/// The entries whose hash selects this shard.
+			/// </summary>
+			MapType Map;
+		};
+
+#ifdef USE_HASHMAP_STATISTICS
+		/// <summary>
+		/// HashMap counts lookups in mutable members while collecting statistics, so lookups cannot share a shard and take the write lock as well.
+		/// </summary>
+		using ReadLock = std::unique_lock<std::shared_mutex>;
+#else
+		/// <summary>
+		/// The lock held by lookups, shared with any other lookup in the same shard.
+		/// </summary>
+		using ReadLock = std::shared_lock<std::shared_mutex>;
+#endif // USE_HASHMAP_STATISTICS
+		/// <summary>
+		/// The lock held by anything that modifies a shard.
+		/// </summary>
+		using WriteLock = std::unique_lock<std::shared_mutex>;
+
+		/// <summary>
+		/// Pick the shard a key belongs to from the top bits of its Fibonacci-scrambled hash, so that the choice of shard is independent of the low bits each shard uses to pick a chain.
+		/// </summary>
+		/// <param name="key">The key or lookup value</param>
+		/// <returns>The shard the key belongs to</returns>
+		template <typename TLookup>
+		[[nodiscard]] Shard& GetShard(const TLookup& key);
+		/// <summary>
+		/// Pick the shard a key belongs to.
+		/// </summary>
+		/// <param name="key">The key or lookup value</param>
+		/// <returns>The shard the key belongs to</returns>
+		template <typename TLookup>
+		[[nodiscard]] const Shard& GetShard(const TLookup& key) const;
+		/// <summary>
+		/// Map a full hash code to a shard index.
+		/// </summary>
+		/// <param name="hash">The hash code</param>
+		/// <returns>The shard index</returns>
+		[[nodiscard]] static constexpr size_type GetShardIndex(size_type hash);
+		/// <summary>
+		/// Look a key up in its shard under a read lock.
+		/// </summary>
+		/// <param name="key">The key or lookup value</param>
+		/// <returns>A pointer to the data, or nullptr if the key is not present</returns>
+		template <typename TLookup>
+		[[nodiscard]] const TData* FindInShard(const TLookup& key) const;
+		/// <summary>
+		/// Throw if a key looked up by At was not present.
+		/// </summary>
+		/// <param name="data">The result of the lookup</param>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and data is nullptr</exception>
+		static void CheckFound(const TData* data);
+
+		/// <summary>
+		/// The shards entries are spread over.
+		/// </summary>
+		std::array<Shard, ShardCount> _shards;
+	};
+}
+
+#include "ConcurrentHashMap.inl"
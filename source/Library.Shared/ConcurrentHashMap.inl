@@ -0,0 +1,305 @@
+/// <summary>
+/// The fully specified implementation of the templated class ConcurrentHashMap.
+/// </summary>
+
+#pragma once
+
+#include "ConcurrentHashMap.h"
+
+namespace FIEAGameEngine {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::ConcurrentHashMap(size_type chainCount, EqualityFunctor equalityFunctor) {
+		for (Shard& shard : _shards) {
+			shard.Map = MapType(chainCount, equalityFunctor);
+		}
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::ConcurrentHashMap(std::initializer_list<PairType> list, size_type chainCount, EqualityFunctor equalityFunctor) :
+		ConcurrentHashMap(chainCount, std::move(equalityFunctor))
+	{
+		for (const PairType& entry : list) {
+			Insert(entry);
+		}
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	inline constexpr typename ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::size_type ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::Shards() {
+		return ShardCount;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	typename ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::size_type ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::Size() const {
+		size_type size = 0;
+		for (const Shard& shard : _shards) {
+			ReadLock lock(shard.Mutex);
+			size += shard.Map.Size();
+		}
+		return size;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	bool ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::IsEmpty() const {
+		for (const Shard& shard : _shards) {
+			ReadLock lock(shard.Mutex);
+			if (shard.Map.Size() != 0) return false;
+		}
+		return true;
+	}
+
+#ifdef USE_HASHMAP_STATISTICS
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	HashMapStatistics ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::GetStatistics() const {
+		HashMapStatistics statistics;
+		for (const Shard& shard : _shards) {
+			ReadLock lock(shard.Mutex);
+			statistics.Merge(shard.Map.GetStatistics());
+		}
+		statistics.MemoryFootprint += sizeof(*this) - sizeof(_shards);
+		return statistics;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	void ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::ResetStatistics() {
+		for (Shard& shard : _shards) {
+			WriteLock lock(shard.Mutex);
+			shard.Map.ResetStatistics();
+		}
+	}
+#endif // USE_HASHMAP_STATISTICS
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	inline bool ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::ContainsKey(const TKey& key) const {
+		return FindInShard(key) != nullptr;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	template<typename TLookup, typename>
+	inline bool ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::ContainsKey(const TLookup& key) const {
+		return FindInShard(key) != nullptr;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	inline TData* ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::Find(const TKey& key) {
+		return const_cast<TData*>(FindInShard(key));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	inline const TData* ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::Find(const TKey& key) const {
+		return FindInShard(key);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	template<typename TLookup, typename>
+	inline TData* ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::Find(const TLookup& key) {
+		return const_cast<TData*>(FindInShard(key));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	template<typename TLookup, typename>
+	inline const TData* ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::Find(const TLookup& key) const {
+		return FindInShard(key);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	inline TData& ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::At(const TKey& key) {
+		TData* data = Find(key);
+		CheckFound(data);
+		return *data;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	inline const TData& ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::At(const TKey& key) const {
+		const TData* data = Find(key);
+		CheckFound(data);
+		return *data;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	template<typename TLookup, typename>
+	inline TData& ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::At(const TLookup& key) {
+		TData* data = Find(key);
+		CheckFound(data);
+		return *data;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	template<typename TLookup, typename>
+	inline const TData& ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::At(const TLookup& key) const {
+		const TData* data = Find(key);
+		CheckFound(data);
+		return *data;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	template<typename TLookup, typename TVisitor>
+	bool ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::Visit(const TLookup& key, TVisitor&& visitor) {
+		Shard& shard = GetShard(key);
+		WriteLock lock(shard.Mutex);
+		auto found = shard.Map.Find(key);
+		if (found == shard.Map.end()) return false;
+		visitor(found->second);
+		return true;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	template<typename TLookup, typename TVisitor>
+	bool ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::Visit(const TLookup& key, TVisitor&& visitor) const {
+		const Shard& shard = GetShard(key);
+		ReadLock lock(shard.Mutex);
+		auto found = shard.Map.Find(key);
+		if (found == shard.Map.cend()) return false;
+		visitor(found->second);
+		return true;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	template<typename TVisitor>
+	void ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::ForEach(TVisitor&& visitor) const {
+		for (const Shard& shard : _shards) {
+			ReadLock lock(shard.Mutex);
+			for (const PairType& entry : shard.Map) {
+				visitor(entry);
+			}
+		}
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	std::pair<TData*, bool> ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::Insert(const PairType& entry) {
+		Shard& shard = GetShard(entry.first);
+		WriteLock lock(shard.Mutex);
+		auto [iter, inserted] = shard.Map.Insert(entry);
+		return { &iter->second, inserted };
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	std::pair<TData*, bool> ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::Insert(PairType&& entry) {
+		Shard& shard = GetShard(entry.first);
+		WriteLock lock(shard.Mutex);
+		auto [iter, inserted] = shard.Map.Insert(std::move(entry));
+		return { &iter->second, inserted };
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	template<typename... Args>
+	std::pair<TData*, bool> ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::TryEmplace(const TKey& key, Args&&... args) {
+		Shard& shard = GetShard(key);
+		WriteLock lock(shard.Mutex);
+		auto [iter, inserted] = shard.Map.TryEmplace(key, std::forward<Args>(args)...);
+		return { &iter->second, inserted };
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	template<typename... Args>
+	std::pair<TData*, bool> ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::TryEmplace(TKey&& key, Args&&... args) {
+		Shard& shard = GetShard(key);
+		WriteLock lock(shard.Mutex);
+		auto [iter, inserted] = shard.Map.TryEmplace(std::move(key), std::forward<Args>(args)...);
+		return { &iter->second, inserted };
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	template<typename TLookup, typename... Args, typename>
+	std::pair<TData*, bool> ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::TryEmplace(const TLookup& key, Args&&... args) {
+		Shard& shard = GetShard(key);
+		WriteLock lock(shard.Mutex);
+		auto [iter, inserted] = shard.Map.TryEmplace(key, std::forward<Args>(args)...);
+		return { &iter->second, inserted };
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	template<typename TValue>
+	std::pair<TData*, bool> ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::InsertOrAssign(const TKey& key, TValue&& data) {
+		Shard& shard = GetShard(key);
+		WriteLock lock(shard.Mutex);
+		auto [iter, inserted] = shard.Map.InsertOrAssign(key, std::forward<TValue>(data));
+		return { &iter->second, inserted };
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	template<typename TValue>
+	std::pair<TData*, bool> ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::InsertOrAssign(TKey&& key, TValue&& data) {
+		Shard& shard = GetShard(key);
+		WriteLock lock(shard.Mutex);
+		auto [iter, inserted] = shard.Map.InsertOrAssign(std::move(key), std::forward<TValue>(data));
+		return { &iter->second, inserted };
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	template<typename TLookup, typename TValue, typename>
+	std::pair<TData*, bool> ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::InsertOrAssign(const TLookup& key, TValue&& data) {
+		Shard& shard = GetShard(key);
+		WriteLock lock(shard.Mutex);
+		auto [iter, inserted] = shard.Map.InsertOrAssign(key, std::forward<TValue>(data));
+		return { &iter->second, inserted };
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	bool ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::Remove(const TKey& key) {
+		Shard& shard = GetShard(key);
+		WriteLock lock(shard.Mutex);
+		auto found = shard.Map.Find(key);
+		if (found == shard.Map.end()) return false;
+		shard.Map.Remove(found);
+		return true;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	template<typename TLookup, typename>
+	bool ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::Remove(const TLookup& key) {
+		Shard& shard = GetShard(key);
+		WriteLock lock(shard.Mutex);
+		auto found = shard.Map.Find(key);
+		if (found == shard.Map.end()) return false;
+		shard.Map.Remove(found);
+		return true;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	void ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::Clear() {
+		for (Shard& shard : _shards) {
+			WriteLock lock(shard.Mutex);
+			shard.Map.Clear();
+		}
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	template<typename TLookup>
+	inline typename ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::Shard& ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::GetShard(const TLookup& key) {
+		return _shards[GetShardIndex(hasher{}(key))];
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	template<typename TLookup>
+	inline const typename ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::Shard& ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::GetShard(const TLookup& key) const {
+		return _shards[GetShardIndex(hasher{}(key))];
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	inline constexpr typename ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::size_type ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::GetShardIndex(size_type hash) {
+		if constexpr (ShardBits == 0) {
+			UNREFERENCED_LOCAL(hash);
+			return 0;
+		}
+		else {
+			return static_cast<size_type>((static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> (64 - ShardBits));
+		}
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	template<typename TLookup>
+	const TData* ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::FindInShard(const TLookup& key) const {
+		const Shard& shard = GetShard(key);
+		ReadLock lock(shard.Mutex);
+		auto found = shard.Map.Find(key);
+		return (found == shard.Map.cend()) ? nullptr : &found->second;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor, std::size_t ShardCount>
+	inline void ConcurrentHashMap<TKey, TData, THashFunctor, TEqualityFunctor, ShardCount>::CheckFound(const TData* data) {
+		UNREFERENCED_LOCAL(data);
+#ifdef USE_EXCEPTIONS
+		if (data == nullptr) throw std::runtime_error("Out of bounds - key does not exist in container.");
+#endif // USE_EXCEPTIONS
+	}
+}
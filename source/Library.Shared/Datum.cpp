@@ -4,16 +4,20 @@
 
 #include "pch.h"
 #include "Datum.h"
+#include "DatumMath.h"
+#include <charconv>
 
 namespace FIEAGameEngine {
+	static_assert(sizeof(Datum) <= 64, "A Datum should fit in a cache line; every attribute of every Scope is one.");
+
 #pragma region Constructors
-	Datum::Datum(Datum::IncrementFunctor incrementFunctor) :
-		_incrementFunctor{ incrementFunctor } 
+	Datum::Datum(GrowthStrategies growthStrategy, MemoryResource* resource) :
+		_growthStrategy{ growthStrategy }, _resource{ resource != nullptr ? resource : GetDefaultResource() }
 	{
 	}
 
-	Datum::Datum(DatumTypes type, std::size_t size, Datum::IncrementFunctor incrementFunctor) :
-		_type{type}, _incrementFunctor{ incrementFunctor }
+	Datum::Datum(DatumTypes type, std::size_t size, GrowthStrategies growthStrategy, MemoryResource* resource) :
+		_type{type}, _growthStrategy{ growthStrategy }, _resource{ resource != nullptr ? resource : GetDefaultResource() }
 	{
 #ifdef USE_EXCEPTIONS
 		if (type == DatumTypes::Unknown) throw std::runtime_error("Type cannot be Unknown.");
@@ -21,8 +25,8 @@ namespace FIEAGameEngine {
 		Reserve(size);
 	}
 
-	Datum::Datum(std::initializer_list<std::int32_t> list, Datum::IncrementFunctor incrementFunctor ) :
-		_type{ DatumTypes::Integer}, _incrementFunctor{incrementFunctor}
+	Datum::Datum(std::initializer_list<std::int32_t> list, GrowthStrategies growthStrategy) :
+		_type{ DatumTypes::Integer}, _growthStrategy{ growthStrategy }
 	{
 		Reserve(list.size());
 		for (auto& value : list) {
@@ -30,8 +34,8 @@ namespace FIEAGameEngine {
 		}
 	}
 
-	Datum::Datum(std::initializer_list<float> list, Datum::IncrementFunctor incrementFunctor) :
-		_type{ DatumTypes::Float }, _incrementFunctor{ incrementFunctor }
+	Datum::Datum(std::initializer_list<float> list, GrowthStrategies growthStrategy) :
+		_type{ DatumTypes::Float }, _growthStrategy{ growthStrategy }
 	{
 		Reserve(list.size());
 		for (auto& value : list) {
@@ -39,8 +43,8 @@ namespace FIEAGameEngine {
 		}
 	}
 
-	Datum::Datum(std::initializer_list<std::string> list, Datum::IncrementFunctor incrementFunctor) :
-		_type{ DatumTypes::String }, _incrementFunctor{ incrementFunctor }
+	Datum::Datum(std::initializer_list<std::string> list, GrowthStrategies growthStrategy) :
+		_type{ DatumTypes::String }, _growthStrategy{ growthStrategy }
 	{
 		Reserve(list.size());
 		for (auto& value : list) {
@@ -48,8 +52,8 @@ namespace FIEAGameEngine {
 		}
 	}
 
-	Datum::Datum(std::initializer_list<glm::vec4> list, Datum::IncrementFunctor incrementFunctor) :
-		_type{ DatumTypes::Vector }, _incrementFunctor{ incrementFunctor }
+	Datum::Datum(std::initializer_list<glm::vec4> list, GrowthStrategies growthStrategy) :
+		_type{ DatumTypes::Vector }, _growthStrategy{ growthStrategy }
 	{
 		Reserve(list.size());
 		for (auto& value : list) {
@@ -57,8 +61,8 @@ namespace FIEAGameEngine {
 		}
 	}
 
-	Datum::Datum(std::initializer_list<glm::mat4> list, Datum::IncrementFunctor incrementFunctor) :
-		_type{ DatumTypes::Matrix }, _incrementFunctor{ incrementFunctor }
+	Datum::Datum(std::initializer_list<glm::mat4> list, GrowthStrategies growthStrategy) :
+		_type{ DatumTypes::Matrix }, _growthStrategy{ growthStrategy }
 	{
 		Reserve(list.size());
 		for (auto& value : list) {
@@ -66,8 +70,8 @@ namespace FIEAGameEngine {
 		}
 	}
 
-	Datum::Datum(std::initializer_list<RTTI*> list, Datum::IncrementFunctor incrementFunctor) :
-		_type{ DatumTypes::Pointer }, _incrementFunctor{ incrementFunctor }
+	Datum::Datum(std::initializer_list<RTTI*> list, GrowthStrategies growthStrategy) :
+		_type{ DatumTypes::Pointer }, _growthStrategy{ growthStrategy }
 	{
 		Reserve(list.size());
 		for (auto& value : list) {
@@ -79,45 +83,56 @@ namespace FIEAGameEngine {
 		CopyHelper(rhs);
 	}
 
-	Datum::Datum(std::int32_t rhs, Datum::IncrementFunctor incrementFunctor) :
-		_type{ DatumTypes::Integer }, _incrementFunctor{ incrementFunctor }
+	Datum::Datum(const Datum& rhs, MemoryResource* resource) :
+		_resource{ resource != nullptr ? resource : GetDefaultResource() }
+	{
+		CopyHelper(rhs);
+	}
+
+	Datum::Datum(std::int32_t rhs, GrowthStrategies growthStrategy) :
+		_type{ DatumTypes::Integer }, _growthStrategy{ growthStrategy }
 	{
 		PushBack(rhs);
 	}
 
-	Datum::Datum(float rhs, Datum::IncrementFunctor incrementFunctor) :
-		_type{ DatumTypes::Float }, _incrementFunctor{ incrementFunctor }
+	Datum::Datum(float rhs, GrowthStrategies growthStrategy) :
+		_type{ DatumTypes::Float }, _growthStrategy{ growthStrategy }
 	{
 		PushBack(rhs);
 	}
 
-	Datum::Datum(const std::string& rhs, Datum::IncrementFunctor incrementFunctor) :
-		_type{ DatumTypes::String }, _incrementFunctor{ incrementFunctor }
+	Datum::Datum(const std::string& rhs, GrowthStrategies growthStrategy) :
+		_type{ DatumTypes::String }, _growthStrategy{ growthStrategy }
 	{
 		PushBack(rhs);
 	}
 
-	Datum::Datum(const glm::vec4& rhs, Datum::IncrementFunctor incrementFunctor) :
-		_type{ DatumTypes::Vector }, _incrementFunctor{ incrementFunctor }
+	Datum::Datum(const glm::vec4& rhs, GrowthStrategies growthStrategy) :
+		_type{ DatumTypes::Vector }, _growthStrategy{ growthStrategy }
 	{
 		PushBack(rhs);
 	}
 
-	Datum::Datum(const glm::mat4& rhs, Datum::IncrementFunctor incrementFunctor) :
-		_type{ DatumTypes::Matrix }, _incrementFunctor{ incrementFunctor }
+	Datum::Datum(const glm::mat4& rhs, GrowthStrategies growthStrategy) :
+		_type{ DatumTypes::Matrix }, _growthStrategy{ growthStrategy }
 	{
 		PushBack(rhs);
 	}
 
-	Datum::Datum(RTTI* rhs, Datum::IncrementFunctor incrementFunctor) :
-		_type{ DatumTypes::Pointer }, _incrementFunctor{ incrementFunctor }
+	Datum::Datum(RTTI* rhs, GrowthStrategies growthStrategy) :
+		_type{ DatumTypes::Pointer }, _growthStrategy{ growthStrategy }
 	{
 		PushBack(rhs);
 	}
 
 	Datum::Datum(Datum&& rhs) noexcept :
-		_data{ rhs._data }, _type{ rhs._type }, _capacity{ rhs._capacity }, _size{ rhs._size }, _isExternal{ rhs._isExternal }, _incrementFunctor{ rhs._incrementFunctor }
+		_data{ rhs._data }, _type{ rhs._type }, _capacity{ rhs._capacity }, _size{ rhs._size }, _isExternal{ rhs._isExternal }, _growthStrategy{ rhs._growthStrategy }, _customGrowth{ std::move(rhs._customGrowth) }, _resource{ rhs._resource }
 	{
+		if (rhs.IsInline()) {
+			memcpy(_inlineStorage, rhs._inlineStorage, InlineBytes);
+			_data.vp = _inlineStorage;
+		}
+		rhs._data.vp = nullptr;
 		rhs._isExternal = false;
 		rhs._size = rhs._capacity = 0;
 	}
@@ -217,7 +232,8 @@ namespace FIEAGameEngine {
 	}
 
 	void Datum::CopyHelper(const Datum& rhs) {
-		_incrementFunctor = rhs._incrementFunctor;
+		_growthStrategy = rhs._growthStrategy;
+		_customGrowth = rhs._customGrowth;
 		_isExternal = rhs._isExternal;
 		_type = rhs._type;
 		if (_isExternal) {
@@ -242,12 +258,37 @@ namespace FIEAGameEngine {
 	void Datum::CopySwapHelper(Datum& rhs) {
 		rhs.SetType(_type);
 		rhs.ResetInternalStorage();
+		if (!_isExternal && !rhs._resource->IsEqual(*_resource)) {
+			if (rhs._isExternal) {
+				rhs._isExternal = false;
+				rhs._data.vp = nullptr;
+				rhs._size = rhs._capacity = 0;
+			}
+			if (_size > 0) {
+				rhs.Reserve(_size);
+				if (_type == DatumTypes::String) {
+					for (std::size_t i = 0; i < _size; ++i) {
+						new (rhs._data.s + i) std::string(std::move(_data.s[i]));
+					}
+				}
+				else {
+					memcpy(rhs._data.vp, _data.vp, _size * _typeSizes[static_cast<std::int32_t>(_type)]);
+				}
+				rhs._size = _size;
+			}
+			ResetInternalStorage();
+			return;
+		}
 		rhs._size = _size;
 		rhs._capacity = _capacity;
 		rhs._isExternal = _isExternal;
 		std::swap(rhs._data.vp, _data.vp);
+		if (rhs._data.vp == _inlineStorage) {
+			memcpy(rhs._inlineStorage, _inlineStorage, InlineBytes);
+			rhs._data.vp = rhs._inlineStorage;
+		}
 
-		_size = _capacity = std::size_t(0);
+		_size = _capacity = 0;
 		_data.vp = nullptr;
 	}
 
@@ -271,13 +312,11 @@ namespace FIEAGameEngine {
 #endif // USE_EXCEPTIONS
 		if (_capacity > _size) {
 			if (_size == 0) {
-				free(_data.vp);
+				if (!IsInline()) _resource->Deallocate(_data.vp, _capacity * _typeSizes[static_cast<std::int32_t>(_type)], MemoryResource::DefaultAlignment);
 				_data.vp = nullptr;
 			}
 			else {
-				void* allocatedMem = realloc(_data.vp, _size * _typeSizes[static_cast<std::int32_t>(_type)]);
-				assert(allocatedMem != nullptr);
-				_data.vp = allocatedMem;
+				Reallocate(_size);
 			}
 			_capacity = _size;
 		}
@@ -293,7 +332,7 @@ namespace FIEAGameEngine {
 					_data.s[i].~basic_string();
 				}
 			}
-			_size = newSize;
+			_size = static_cast<std::uint32_t>(newSize);
 			ShrinkToFit();
 		}
 		else if (newSize > _size) {
@@ -310,21 +349,99 @@ namespace FIEAGameEngine {
 		}
 	}
 
+	void Datum::Resize(std::size_t newSize, std::int32_t value) {
+		ResizeWith(newSize, value);
+	}
+
+	void Datum::Resize(std::size_t newSize, float value) {
+		ResizeWith(newSize, value);
+	}
+
+	void Datum::Resize(std::size_t newSize, const std::string& value) {
+		ResizeWith(newSize, value);
+	}
+
+	void Datum::Resize(std::size_t newSize, const glm::vec4& value) {
+		ResizeWith(newSize, value);
+	}
+
+	void Datum::Resize(std::size_t newSize, const glm::mat4& value) {
+		ResizeWith(newSize, value);
+	}
+
+	void Datum::Resize(std::size_t newSize, RTTI* value) {
+		ResizeWith(newSize, value);
+	}
+
 	void Datum::Reserve(std::size_t capacity) {
 #ifdef USE_EXCEPTIONS
 		if (_isExternal) throw std::runtime_error("Datum does not own this memory, cannot resize.");
 		if (_type == DatumTypes::Unknown) throw std::runtime_error("Datum does not have an assigned type to resize on yet.");
+		if (capacity > MaxCapacity) throw std::runtime_error("Datum cannot hold more than MaxCapacity values.");
 #endif // USE_EXCEPTIONS
 
 		if (capacity > _capacity) {
-			std::size_t size = _typeSizes[static_cast<std::int32_t>(_type)];
-			assert(size > 0);
+			Reallocate(capacity);
+		}
+	}
+
+	void Datum::Reallocate(std::size_t capacity) {
+		assert(capacity >= _size && capacity > 0 && capacity <= MaxCapacity);
+		std::size_t size = _typeSizes[static_cast<std::int32_t>(_type)];
+		assert(size > 0);
 
-			void* allocatedMem = realloc(_data.vp, capacity * size);
+		if (_type == DatumTypes::String) {
+			std::string* allocatedMem = reinterpret_cast<std::string*>(_resource->Allocate(capacity * size, MemoryResource::DefaultAlignment));
+			assert(allocatedMem != nullptr);
+			for (std::size_t i = 0; i < _size; ++i) {
+				new (allocatedMem + i) std::string(std::move(_data.s[i]));
+				_data.s[i].~basic_string();
+			}
+			_resource->Deallocate(_data.vp, _capacity * size, MemoryResource::DefaultAlignment);
+			_data.s = allocatedMem;
+		}
+		else if (FitsInline(capacity)) {
+			if (!IsInline()) {
+				if (_data.vp != nullptr) {
+					memcpy(_inlineStorage, _data.vp, _size * size);
+					_resource->Deallocate(_data.vp, _capacity * size, MemoryResource::DefaultAlignment);
+				}
+				_data.vp = _inlineStorage;
+			}
+		}
+		else if (IsInline()) {
+			void* allocatedMem = _resource->Allocate(capacity * size, MemoryResource::DefaultAlignment);
 			assert(allocatedMem != nullptr);
+			memcpy(allocatedMem, _inlineStorage, _size * size);
 			_data.vp = allocatedMem;
-			_capacity = capacity;
 		}
+		else {
+			void* allocatedMem = _resource->Reallocate(_data.vp, _capacity * size, capacity * size, MemoryResource::DefaultAlignment);
+			assert(allocatedMem != nullptr);
+			_data.vp = allocatedMem;
+		}
+		_capacity = static_cast<std::uint32_t>(capacity);
+	}
+
+	void Datum::SetResource(MemoryResource* resource) {
+		if (resource == nullptr) resource = GetDefaultResource();
+		if (!_isExternal && _capacity > std::size_t(0) && !IsInline() && !resource->IsEqual(*_resource)) {
+			std::size_t size = _typeSizes[static_cast<std::int32_t>(_type)];
+			void* allocatedMem = resource->Allocate(_capacity * size, MemoryResource::DefaultAlignment);
+			assert(allocatedMem != nullptr);
+			if (_type == DatumTypes::String) {
+				for (std::size_t i = 0; i < _size; ++i) {
+					new (reinterpret_cast<std::string*>(allocatedMem) + i) std::string(std::move(_data.s[i]));
+					_data.s[i].~basic_string();
+				}
+			}
+			else {
+				memcpy(allocatedMem, _data.vp, _size * size);
+			}
+			_resource->Deallocate(_data.vp, _capacity * size, MemoryResource::DefaultAlignment);
+			_data.vp = allocatedMem;
+		}
+		_resource = resource;
 	}
 
 	void Datum::ResetInternalStorage() {
@@ -338,12 +455,13 @@ namespace FIEAGameEngine {
 #ifdef USE_EXCEPTIONS
 		if (array == nullptr) throw std::runtime_error("Cannot assign a null array pointer.");
 		if (arraySize == std::size_t(0)) throw std::runtime_error("Cannot assign a size zero array.");
+		if (arraySize > MaxCapacity) throw std::runtime_error("Datum cannot refer to more than MaxCapacity values.");
 #endif // USE_EXCEPTIONS
 
 		SetType(type);
 		ResetInternalStorage();
 		_isExternal = true;
-		_size = _capacity = arraySize;
+		_size = _capacity = static_cast<std::uint32_t>(arraySize);
 		_data.vp = array;
 	}
 
@@ -354,8 +472,27 @@ namespace FIEAGameEngine {
 
 		SetType(type);
 		if (_size == _capacity) {
-			std::size_t increment = std::max(_incrementFunctor(_capacity), std::size_t(1));
-			Reserve(_capacity + increment);
+#ifdef USE_EXCEPTIONS
+			if (_capacity == MaxCapacity) throw std::runtime_error("Datum cannot hold more than MaxCapacity values.");
+#endif // USE_EXCEPTIONS
+			Reserve(std::min(GrowCapacity(), MaxCapacity));
+		}
+	}
+
+	std::size_t Datum::GrowCapacity() const {
+		const std::size_t elementSize = _typeSizes[static_cast<std::int32_t>(_type)];
+		switch (_growthStrategy) {
+		case GrowthStrategies::Doubling:
+			return NextCapacity(DoublingGrowth{}, _capacity, elementSize);
+		case GrowthStrategies::FixedChunk:
+			return NextCapacity(FixedGrowth<FixedGrowthChunk>{}, _capacity, elementSize);
+		case GrowthStrategies::PageRounded:
+			return NextCapacity(PageRoundedGrowth<>{}, _capacity, elementSize);
+		case GrowthStrategies::Custom:
+			if (_customGrowth != nullptr) return NextCapacity(*_customGrowth, _capacity, elementSize);
+			[[fallthrough]];
+		default:
+			return NextCapacity(HalfAgainGrowth{}, _capacity, elementSize);
 		}
 	}
 
@@ -377,17 +514,25 @@ namespace FIEAGameEngine {
 
 		bool removed = false;
 		if (index < _size) {
-			if (_type == DatumTypes::String) _data.s[index].~basic_string();
-
-			std::size_t typeSize = _typeSizes[static_cast<std::int32_t>(_type)];
-			std::size_t shiftAmount = (_size-- - index) * typeSize;
-			if (shiftAmount > 0) {
-				std::byte* ptr = reinterpret_cast<std::byte*>(_data.vp);
+			if (_type == DatumTypes::String) {
+				_data.s[index].~basic_string();
+				for (std::size_t i = index + 1; i < _size; ++i) {
+					new (_data.s + i - 1) std::string(std::move(_data.s[i]));
+					_data.s[i].~basic_string();
+				}
+				--_size;
+			}
+			else {
+				std::size_t typeSize = _typeSizes[static_cast<std::int32_t>(_type)];
+				std::size_t shiftAmount = (--_size - index) * typeSize;
+				if (shiftAmount > 0) {
+					std::byte* ptr = reinterpret_cast<std::byte*>(_data.vp);
 #ifdef _WINDOWS
-				memmove_s(ptr + (index * typeSize), shiftAmount, ptr + ((index + 1) * typeSize), shiftAmount);
+					memmove_s(ptr + (index * typeSize), shiftAmount, ptr + ((index + 1) * typeSize), shiftAmount);
 #else
-				memmove(ptr + (index * typeSize), ptr + ((index + 1) * typeSize), shiftAmount);
+					memmove(ptr + (index * typeSize), ptr + ((index + 1) * typeSize), shiftAmount);
 #endif
+				}
 			}
 			removed = true;
 		}
@@ -400,21 +545,14 @@ namespace FIEAGameEngine {
 #ifdef USE_EXCEPTIONS
 		if (_type != DatumTypes::Integer) throw std::runtime_error("Datum is not of the given type.");
 #endif // USE_EXCEPTIONS
-
-		for (std::size_t i = 0; i < _size; ++i) {
-			if (_data.i[i] == value) return i;
-		}
-		return _size;
+		return DatumMath::Find(gsl::span<const std::int32_t>(_data.i, _size), value);
 	}
 
 	std::size_t Datum::FindIndex(float value) const {
 #ifdef USE_EXCEPTIONS
 		if (_type != DatumTypes::Float) throw std::runtime_error("Datum is not of the given type.");
 #endif // USE_EXCEPTIONS
-		for (std::size_t i = 0; i < _size; ++i) {
-			if (_data.f[i] == value) return i;
-		}
-		return _size;
+		return DatumMath::Find(gsl::span<const float>(_data.f, _size), value);
 	}
 
 	std::size_t Datum::FindIndex(const std::string& value) const {
@@ -431,10 +569,7 @@ namespace FIEAGameEngine {
 #ifdef USE_EXCEPTIONS
 		if (_type != DatumTypes::Vector) throw std::runtime_error("Datum is not of the given type.");
 #endif // USE_EXCEPTIONS
-		for (std::size_t i = 0; i < _size; ++i) {
-			if (_data.v[i] == value) return i;
-		}
-		return _size;
+		return DatumMath::Find(gsl::span<const glm::vec4>(_data.v, _size), value);
 	}
 
 	std::size_t Datum::FindIndex(const glm::mat4& value) const {
@@ -461,55 +596,261 @@ namespace FIEAGameEngine {
 #ifdef USE_EXCEPTIONS
 		if (_type != DatumTypes::Table) throw std::runtime_error("Datum is not of the given type.");
 #endif // USE_EXCEPTIONS
-		for (std::size_t i = 0; i < _size; ++i) {
-			if (_data.t[i] == &value) return i;
-		}
-		return _size;
+		return DatumMath::FindAddress(gsl::span<const void* const>(reinterpret_cast<const void* const*>(_data.t), _size), &value);
 	}
 #pragma endregion FindIndex
 
+#pragma region FindAll
+	Vector<std::size_t> Datum::FindAll(std::int32_t value) const {
+#ifdef USE_EXCEPTIONS
+		if (_type != DatumTypes::Integer) throw std::runtime_error("Datum is not of the given type.");
+#endif // USE_EXCEPTIONS
+		gsl::span<const std::int32_t> values(_data.i, _size);
+		return FindAllWith([values, value](std::size_t start) { return start + DatumMath::Find(values.subspan(start, values.size() - start), value); });
+	}
+
+	Vector<std::size_t> Datum::FindAll(float value) const {
+#ifdef USE_EXCEPTIONS
+		if (_type != DatumTypes::Float) throw std::runtime_error("Datum is not of the given type.");
+#endif // USE_EXCEPTIONS
+		gsl::span<const float> values(_data.f, _size);
+		return FindAllWith([values, value](std::size_t start) { return start + DatumMath::Find(values.subspan(start, values.size() - start), value); });
+	}
+
+	Vector<std::size_t> Datum::FindAll(const std::string& value) const {
+#ifdef USE_EXCEPTIONS
+		if (_type != DatumTypes::String) throw std::runtime_error("Datum is not of the given type.");
+#endif // USE_EXCEPTIONS
+		return FindAllWith([this, &value](std::size_t start) {
+			for (; start < _size && _data.s[start] != value; ++start);
+			return start;
+		});
+	}
+
+	Vector<std::size_t> Datum::FindAll(const glm::vec4& value) const {
+#ifdef USE_EXCEPTIONS
+		if (_type != DatumTypes::Vector) throw std::runtime_error("Datum is not of the given type.");
+#endif // USE_EXCEPTIONS
+		gsl::span<const glm::vec4> values(_data.v, _size);
+		return FindAllWith([values, &value](std::size_t start) { return start + DatumMath::Find(values.subspan(start, values.size() - start), value); });
+	}
+
+	Vector<std::size_t> Datum::FindAll(const glm::mat4& value) const {
+#ifdef USE_EXCEPTIONS
+		if (_type != DatumTypes::Matrix) throw std::runtime_error("Datum is not of the given type.");
+#endif // USE_EXCEPTIONS
+		return FindAllWith([this, &value](std::size_t start) {
+			for (; start < _size && _data.m[start] != value; ++start);
+			return start;
+		});
+	}
+
+	Vector<std::size_t> Datum::FindAll(RTTI* value) const {
+#ifdef USE_EXCEPTIONS
+		if (_type != DatumTypes::Pointer) throw std::runtime_error("Datum is not of the given type.");
+#endif // USE_EXCEPTIONS
+		return FindAllWith([this, value](std::size_t start) {
+			for (; start < _size && !_data.p[start]->Equals(value); ++start);
+			return start;
+		});
+	}
+
+	Vector<std::size_t> Datum::FindAll(Scope& value) const {
+#ifdef USE_EXCEPTIONS
+		if (_type != DatumTypes::Table) throw std::runtime_error("Datum is not of the given type.");
+#endif // USE_EXCEPTIONS
+		gsl::span<const void* const> addresses(reinterpret_cast<const void* const*>(_data.t), _size);
+		const void* address = &value;
+		return FindAllWith([addresses, address](std::size_t start) { return start + DatumMath::FindAddress(addresses.subspan(start, addresses.size() - start), address); });
+	}
+#pragma endregion FindAll
+
 #pragma region StringConversions
-	void Datum::SetVectorFromString(const std::string& strValue, size_t index) {
+	namespace {
+		/// <summary>
+		/// Skip the whitespace at the front of some text.
+		/// </summary>
+		/// <param name="text">The text to advance</param>
+		void SkipWhitespace(std::string_view& text) {
+			const std::size_t first = text.find_first_not_of(" \t\n\r\f\v");
+			text.remove_prefix(first == std::string_view::npos ? text.size() : first);
+		}
+
+		/// <summary>
+		/// Read a number from the front of some text the way std::stoi, std::stof and scanf do, allowing leading whitespace and a plus sign,
+		/// but through std::from_chars, which neither allocates nor consults the locale. Whatever follows the number is left in the text.
+		/// </summary>
+		/// <param name="text">The text to read from, advanced past the number if one was read</param>
+		/// <param name="value">The number read</param>
+		/// <returns>The error std::from_chars reports, which is value initialized on success</returns>
+		template <typename T>
+		std::errc ReadNumber(std::string_view& text, T& value) {
+			SkipWhitespace(text);
+			if (text.size() > 1 && text[0] == '+' && text[1] != '-') text.remove_prefix(1);
+			const std::from_chars_result result = std::from_chars(text.data(), text.data() + text.size(), value);
+			if (result.ec == std::errc()) text.remove_prefix(static_cast<std::size_t>(result.ptr - text.data()));
+			return result.ec;
+		}
+
+		/// <summary>
+		/// Read the given literal from the front of some text, after any whitespace.
+		/// </summary>
+		/// <param name="text">The text to read from, advanced past the literal if it was there</param>
+		/// <param name="literal">The characters that must come next</param>
+		/// <returns>A boolean indicating whether the literal was there</returns>
+		bool ReadLiteral(std::string_view& text, std::string_view literal) {
+			SkipWhitespace(text);
+			if (text.substr(0, literal.size()) != literal) return false;
+			text.remove_prefix(literal.size());
+			return true;
+		}
+
+		/// <summary>
+		/// Read a comma separated run of floats from the front of some text.
+		/// </summary>
+		/// <param name="text">The text to read from</param>
+		/// <param name="components">Where to store the floats</param>
+		/// <param name="count">The number of floats to read</param>
+		/// <returns>A boolean indicating whether every float was read</returns>
+		bool ReadComponents(std::string_view& text, float* components, std::size_t count) {
+			for (std::size_t i = 0; i < count; ++i) {
+				if (i > 0 && !ReadLiteral(text, ",")) return false;
+				if (ReadNumber(text, components[i]) != std::errc()) return false;
+			}
+			return true;
+		}
+
+		/// <summary>
+		/// Append a float to a string through std::to_chars, which neither allocates nor consults the locale.
+		/// </summary>
+		/// <param name="out">The string to append to</param>
+		/// <param name="value">The float to write</param>
+		/// <param name="format">Whether to write six decimal places or the shortest text that reads back exactly</param>
+		void AppendFloat(std::string& out, float value, Datum::StringFormat format) {
+			//The longest fixed float is 39 digits before the point, a sign, the point, and six decimals
+			char buffer[64];
+			const std::to_chars_result result = (format == Datum::StringFormat::Exact) ?
+				std::to_chars(std::begin(buffer), std::end(buffer), value) :
+				std::to_chars(std::begin(buffer), std::end(buffer), value, std::chars_format::fixed, 6);
+			assert(result.ec == std::errc());
+			out.append(std::begin(buffer), result.ptr);
+		}
+
+		/// <summary>
+		/// Append a comma separated run of floats to a string.
+		/// </summary>
+		/// <param name="out">The string to append to</param>
+		/// <param name="components">The floats to write</param>
+		/// <param name="count">The number of floats to write</param>
+		/// <param name="format">How to write each float</param>
+		void AppendComponents(std::string& out, const float* components, std::size_t count, Datum::StringFormat format) {
+			for (std::size_t i = 0; i < count; ++i) {
+				if (i > 0) out += ", ";
+				AppendFloat(out, components[i], format);
+			}
+		}
+
+		/// <summary>
+		/// Throw the exception std::stoi or std::stof would have for a failed read.
+		/// </summary>
+		/// <param name="error">The error std::from_chars reported</param>
+		void NumberErrorChecker(std::errc error) {
+#ifdef USE_EXCEPTIONS
+			if (error == std::errc::invalid_argument) throw std::invalid_argument("Datum could not find a number at the start of the string.");
+			if (error == std::errc::result_out_of_range) throw std::out_of_range("Datum's string holds a number out of the range of its type.");
+#endif // USE_EXCEPTIONS
+			UNREFERENCED_LOCAL(error);
+		}
+	}
+
+	void Datum::AppendIntToString(std::string& out, size_t index, StringFormat) const {
+		char buffer[16];
+		const std::to_chars_result result = std::to_chars(std::begin(buffer), std::end(buffer), GetAsInt(index));
+		assert(result.ec == std::errc());
+		out.append(std::begin(buffer), result.ptr);
+	}
+
+	void Datum::AppendFloatToString(std::string& out, size_t index, StringFormat format) const {
+		AppendFloat(out, GetAsFloat(index), format);
+	}
+
+	void Datum::AppendVectorToString(std::string& out, size_t index, StringFormat format) const {
+		const glm::vec4& vectorData = GetAsVector(index);
+		out += "vec4(";
+		AppendComponents(out, &vectorData[0], vectorData.length(), format);
+		out += ')';
+	}
+
+	void Datum::AppendMatrixToString(std::string& out, size_t index, StringFormat format) const {
+		const glm::mat4& matrixData = GetAsMatrix(index);
+		out += "mat4x4(";
+		for (glm::length_t column = 0; column < matrixData.length(); ++column) {
+			out += (column == 0) ? "(" : ", (";
+			AppendComponents(out, &matrixData[column][0], matrixData[column].length(), format);
+			out += ')';
+		}
+		out += ')';
+	}
+
+	void Datum::SetIntFromString(std::string_view strValue, size_t index) {
+		std::int32_t intData{ 0 };
+		NumberErrorChecker(ReadNumber(strValue, intData));
+		Set(intData, index);
+	}
+
+	void Datum::SetFloatFromString(std::string_view strValue, size_t index) {
+		float floatData{ 0.0f };
+		NumberErrorChecker(ReadNumber(strValue, floatData));
+		Set(floatData, index);
+	}
+
+	void Datum::SetVectorFromString(std::string_view strValue, size_t index) {
 		glm::vec4 vectorData;
-		int capturedVals = sscanf_s(strValue.c_str(), "vec4(%f, %f, %f, %f)", &vectorData[0], &vectorData[1], &vectorData[2], &vectorData[3]);
+		bool captured = ReadLiteral(strValue, "vec4(") && ReadComponents(strValue, &vectorData[0], vectorData.length()) && ReadLiteral(strValue, ")");
 #ifdef USE_EXCEPTIONS
-		if (capturedVals != vectorData.length()) throw std::runtime_error("Datum could not find correct format to get variables from.");
+		if (!captured) throw std::runtime_error("Datum could not find correct format to get variables from.");
 #else
-		UNREFERENCED_LOCAL(capturedVals);
+		UNREFERENCED_LOCAL(captured);
 #endif // USE_EXCEPTIONS
 		Set(vectorData, index);
 	}
 
-	void Datum::SetMatrixFromString(const std::string& strValue, size_t index) {
+	void Datum::SetMatrixFromString(std::string_view strValue, size_t index) {
 		glm::mat4 matrixData;
-		int capturedVals = sscanf_s(strValue.c_str(), "mat4x4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f))",
-			&matrixData[0][0], &matrixData[0][1], &matrixData[0][2], &matrixData[0][3],
-			&matrixData[1][0], &matrixData[1][1], &matrixData[1][2], &matrixData[1][3],
-			&matrixData[2][0], &matrixData[2][1], &matrixData[2][2], &matrixData[2][3],
-			&matrixData[3][0], &matrixData[3][1], &matrixData[3][2], &matrixData[3][3]
-		);
+		bool captured = ReadLiteral(strValue, "mat4x4(");
+		for (glm::length_t column = 0; captured && column < matrixData.length(); ++column) {
+			captured = (column == 0 || ReadLiteral(strValue, ",")) && ReadLiteral(strValue, "(")
+				&& ReadComponents(strValue, &matrixData[column][0], matrixData[column].length()) && ReadLiteral(strValue, ")");
+		}
+		captured = captured && ReadLiteral(strValue, ")");
 #ifdef USE_EXCEPTIONS
-		if (capturedVals != (matrixData.length() * matrixData[0].length())) throw std::runtime_error("Datum could not find correct format to get variables from.");
+		if (!captured) throw std::runtime_error("Datum could not find correct format to get variables from.");
 #else
-		UNREFERENCED_LOCAL(capturedVals);
+		UNREFERENCED_LOCAL(captured);
 #endif // USE_EXCEPTIONS
 		Set(matrixData, index);
 	}
 
-	std::string Datum::ToString(std::size_t index) const {
-		ToStringFunction strFunction = _toStringFunctions[static_cast<std::int32_t>(_type)];
+	std::string Datum::ToString(std::size_t index, StringFormat format) const {
+		std::string result;
+		AppendToString(result, index, format);
+		return result;
+	}
+
+	void Datum::AppendToString(std::string& out, std::size_t index, StringFormat format) const {
+		AppendToStringFunction appendFunction = _appendToStringFunctions[static_cast<std::int32_t>(_type)];
 #ifdef USE_EXCEPTIONS
-		if (strFunction == nullptr) throw std::runtime_error("Datum has no known way to be converted to a string.");
+		if (appendFunction == nullptr) throw std::runtime_error("Datum has no known way to be converted to a string.");
 #endif // USE_EXCEPTIONS
-		return (this->*strFunction)(index);
+		(this->*appendFunction)(out, index, format);
 	}
 
-	void Datum::PushBackFromString(const std::string& stringValue) {
+	void Datum::PushBackFromString(std::string_view stringValue) {
 		Resize(Size() + 1);
 		SetFromString(stringValue, Size() - 1);
 	}
 
-	void Datum::SetFromString(const std::string& stringValue, std::size_t index) {
+	void Datum::SetFromString(std::string_view stringValue, std::size_t index) {
 		SetFromStringFunction setFunction = _setFromStringFunctions[static_cast<std::int32_t>(_type)];
 #ifdef USE_EXCEPTIONS
 		if (setFunction == nullptr) throw std::runtime_error("Datum has no known way to be converted from a string.");
@@ -520,6 +861,7 @@ namespace FIEAGameEngine {
 
 	bool Datum::operator==(const Datum& rhs) const {
 		if (_type != rhs._type || _size != rhs._size) return false;
+		if (_data.vp == rhs._data.vp) return true;
 		if (_type == DatumTypes::String) {
 			for (std::size_t i = 0; i < _size; ++i) {
 				if (_data.s[i] != rhs._data.s[i]) return false;
@@ -527,7 +869,7 @@ namespace FIEAGameEngine {
 		}
 		else if (_type == DatumTypes::Pointer || _type == DatumTypes::Table) {
 			for (std::size_t i = 0; i < _size; ++i) {
-				if (_data.p[i] == nullptr && rhs._data.p[i] == nullptr) continue;
+				if (_data.p[i] == rhs._data.p[i]) continue;
 				if (_data.p[i] == nullptr || !_data.p[i]->Equals(rhs._data.p[i])) return false;
 			}
 		}
@@ -4,15 +4,27 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <cassert>
 #include <stdexcept>
 #include <functional>
+#include <memory>
 #include "glm/glm.hpp"
 #include "RTTI.h"
 #include "HashMap.h"
-#include "DefaultGrowth.h"
+#include "FrozenHashMap.h"
+#include "GrowthPolicy.h"
+#include "MemoryResource.h"
+#include "Vector.h"
+#include "gsl/gsl"
 
 #pragma warning(push)
 #pragma warning(disable:4201)
@@ -25,6 +37,8 @@ namespace FIEAGameEngine {
 	/// <summary>
 	/// The Datum class, representing data of some type. The data can be owned internally or externally, but externally owned data cannot have its memory changed (individual
 	/// values may be set to different values, though). 
+	/// Internally owned arrays are allocated from the Datum's MemoryResource, the default resource unless one is given. The characters of String values still come from the global heap.
+	/// Arrays of any type but String that fit in InlineBytes, such as a single integer, float, pointer, or vector, are kept inside the Datum itself and allocate nothing.
 	/// </summary>
 	class Datum final {
 		friend class Scope;
@@ -32,10 +46,15 @@ namespace FIEAGameEngine {
 	public:
 		using IncrementFunctor = std::function<std::size_t(std::size_t)>;
 
+		/// <summary>
+		/// The most values a Datum can hold or refer to. Sizes and capacities are stored in 32 bits to keep the Datum small.
+		/// </summary>
+		static constexpr std::size_t MaxCapacity = std::numeric_limits<std::uint32_t>::max();
+
 		/// <summary>
 		/// The allowed types of data that can be stored in a Datum. End is not a supported type; it acts only as a sentinel within the enum.
 		/// </summary>
-		enum class DatumTypes {
+		enum class DatumTypes : std::uint8_t {
 			Unknown = 0,
 			Integer,
 			Float,
@@ -48,9 +67,40 @@ namespace FIEAGameEngine {
 			End = Table
 		};
 		/// <summary>
+		/// The ways a Datum can grow its capacity when a PushBack finds it full. Each maps to one of the policies in GrowthPolicy.h, which the Datum calls directly.
+		/// HalfAgain adds half the current capacity, Doubling doubles it, FixedChunk adds FixedGrowthChunk elements, and PageRounded adds half and rounds the allocation up to a whole page.
+		/// Custom calls the functor given to SetIncrementFunction.
+		/// </summary>
+		enum class GrowthStrategies : std::uint8_t {
+			HalfAgain = 0,
+			Doubling,
+			FixedChunk,
+			PageRounded,
+			Custom
+		};
+		/// <summary>
+		/// The number of elements a Datum with the FixedChunk growth strategy adds each time it grows.
+		/// </summary>
+		static constexpr std::size_t FixedGrowthChunk = 16;
+		/// <summary>
+		/// The ways float components are written when a value is converted to a string. Fixed writes six decimal places, as std::to_string and glm::to_string do.
+		/// Exact writes the shortest text that reads back as the very same float, so values survive a round trip through SetFromString unchanged.
+		/// </summary>
+		enum class StringFormat : std::uint8_t {
+			Fixed = 0,
+			Exact
+		};
+		/// <summary>
+		/// Retrieve the type of Datum that holds values of the given C++ type. Fails to compile for any type but std::int32_t, float, std::string, glm::vec4, glm::mat4 and RTTI*.
+		/// </summary>
+		/// <typeparam name="T">The C++ type of the values.</typeparam>
+		/// <returns>The matching DatumTypes value.</returns>
+		template <typename T>
+		[[nodiscard]] static constexpr DatumTypes TypeOf();
+		/// <summary>
 		/// A lookup table to convert between a Datum type and a string representation of that type.
 		/// </summary>
-		inline static const HashMap<DatumTypes, std::string> typeToString{
+		inline static const FrozenHashMap<DatumTypes, std::string> typeToString{
 			{{DatumTypes::Unknown, "Unknown"},
 			{DatumTypes::Integer, "Integer"},
 			{DatumTypes::Float, "Float"},
@@ -58,13 +108,12 @@ namespace FIEAGameEngine {
 			{DatumTypes::Vector, "Vector"},
 			{DatumTypes::Matrix, "Matrix"},
 			{DatumTypes::Pointer, "Pointer"},
-			{DatumTypes::Table, "Table"}},
-			std::size_t(17)
+			{DatumTypes::Table, "Table"}}
 		}; 
 		/// <summary>
 		/// A lookup table to convert between a Datum type and a string representation of that type.
 		/// </summary>
-		inline static const HashMap<std::string, DatumTypes> stringToType{
+		inline static const FrozenHashMap<std::string, DatumTypes> stringToType{
 			{{"Unknown", DatumTypes::Unknown},
 			{"Integer", DatumTypes::Integer},
 			{"Float", DatumTypes::Float},
@@ -72,85 +121,92 @@ namespace FIEAGameEngine {
 			{"Vector", DatumTypes::Vector},
 			{"Matrix", DatumTypes::Matrix},
 			{"Pointer", DatumTypes::Pointer},
-			{"Table", DatumTypes::Table}},
-			std::size_t(17)
+			{"Table", DatumTypes::Table}}
 		};
 
 		/// <summary>
 		/// Default constructor for an empty Datum.
 		/// </summary>
-		explicit Datum(IncrementFunctor incrementFunctor = DefaultGrowth{});
+		/// <param name="resource">The resource to allocate internal storage from, or nullptr for the default resource.</param>
+		explicit Datum(GrowthStrategies growthStrategy = GrowthStrategies::HalfAgain, MemoryResource* resource = nullptr);
 		/// <summary>
 		/// Constructor for a Datum that allows specification of Datum type and initial capacity
 		/// </summary>
-		explicit Datum(DatumTypes type, std::size_t size = std::size_t(0), IncrementFunctor incrementFunctor = DefaultGrowth{});
+		/// <param name="resource">The resource to allocate internal storage from, or nullptr for the default resource.</param>
+		explicit Datum(DatumTypes type, std::size_t size = std::size_t(0), GrowthStrategies growthStrategy = GrowthStrategies::HalfAgain, MemoryResource* resource = nullptr);
 		/// <summary>
 		/// An Initializer list constructor for Datum. The items will be pushed back to the constructed Datum in the same order as given into this function.
 		/// </summary>
 		/// <param name="list">A set of items to add to an Datum as it's being constructed</param>
-		Datum(std::initializer_list<std::int32_t> list, IncrementFunctor incrementFunctor = DefaultGrowth{});
+		Datum(std::initializer_list<std::int32_t> list, GrowthStrategies growthStrategy = GrowthStrategies::HalfAgain);
 		/// <summary>
 		/// An Initializer list constructor for Datum. The items will be pushed back to the constructed Datum in the same order as given into this function.
 		/// </summary>
 		/// <param name="list">A set of items to add to an Datum as it's being constructed</param>
-		Datum(std::initializer_list<float> list, IncrementFunctor incrementFunctor = DefaultGrowth{});
+		Datum(std::initializer_list<float> list, GrowthStrategies growthStrategy = GrowthStrategies::HalfAgain);
 		/// <summary>
 		/// An Initializer list constructor for Datum. The items will be pushed back to the constructed Datum in the same order as given into this function.
 		/// </summary>
 		/// <param name="list">A set of items to add to an Datum as it's being constructed</param>
-		Datum(std::initializer_list<std::string> list, IncrementFunctor incrementFunctor = DefaultGrowth{});
+		Datum(std::initializer_list<std::string> list, GrowthStrategies growthStrategy = GrowthStrategies::HalfAgain);
 		/// <summary>
 		/// An Initializer list constructor for Datum. The items will be pushed back to the constructed Datum in the same order as given into this function.
 		/// </summary>
 		/// <param name="list">A set of items to add to an Datum as it's being constructed</param>
-		Datum(std::initializer_list<glm::vec4> list, IncrementFunctor incrementFunctor = DefaultGrowth{});
+		Datum(std::initializer_list<glm::vec4> list, GrowthStrategies growthStrategy = GrowthStrategies::HalfAgain);
 		/// <summary>
 		/// An Initializer list constructor for Datum. The items will be pushed back to the constructed Datum in the same order as given into this function.
 		/// </summary>
 		/// <param name="list">A set of items to add to an Datum as it's being constructed</param>
-		Datum(std::initializer_list<glm::mat4> list, IncrementFunctor incrementFunctor = DefaultGrowth{});
+		Datum(std::initializer_list<glm::mat4> list, GrowthStrategies growthStrategy = GrowthStrategies::HalfAgain);
 		/// <summary>
 		/// An Initializer list constructor for Datum. The items will be pushed back to the constructed Datum in the same order as given into this function.
 		/// </summary>
 		/// <param name="list">A set of items to add to an Datum as it's being constructed</param>
-		Datum(std::initializer_list<RTTI*> list, IncrementFunctor incrementFunctor = DefaultGrowth{});
+		Datum(std::initializer_list<RTTI*> list, GrowthStrategies growthStrategy = GrowthStrategies::HalfAgain);
 		/// <summary>
 		/// A copy constructor for an Datum that performs a deep copy during construction if the rhs is internally stored, or shallow copy otherwise.
 		/// </summary>
 		/// <param name="other">The Datum to copy</param>
 		Datum(const Datum& rhs);
 		/// <summary>
+		/// A copy constructor for an Datum that performs a deep copy into storage from the given resource if the rhs is internally stored, or shallow copy otherwise.
+		/// </summary>
+		/// <param name="rhs">The Datum to copy</param>
+		/// <param name="resource">The resource to allocate internal storage from, or nullptr for the default resource.</param>
+		Datum(const Datum& rhs, MemoryResource* resource);
+		/// <summary>
 		/// A copy constructor for an Datum that assigns the RHS scalar as a size of 1 datum.
 		/// </summary>
 		/// <param name="other">The scalar to copy</param>
-		Datum(std::int32_t rhs, IncrementFunctor incrementFunctor = DefaultGrowth{});
+		Datum(std::int32_t rhs, GrowthStrategies growthStrategy = GrowthStrategies::HalfAgain);
 		/// <summary>
 		/// A copy constructor for an Datum that assigns the RHS scalar as a size of 1 datum.
 		/// </summary>
 		/// <param name="rhs">The scalar to copy</param>
-		Datum(float rhs, IncrementFunctor incrementFunctor = DefaultGrowth{});
+		Datum(float rhs, GrowthStrategies growthStrategy = GrowthStrategies::HalfAgain);
 		/// <summary>
 		/// A copy constructor for an Datum that assigns the RHS scalar as a size of 1 datum.
 		/// </summary>
 		/// <param name="rhs">The scalar to copy</param>
-		Datum(const std::string& rhs, IncrementFunctor incrementFunctor = DefaultGrowth{});
+		Datum(const std::string& rhs, GrowthStrategies growthStrategy = GrowthStrategies::HalfAgain);
 		/// <summary>
 		/// A copy constructor for an Datum that assigns the RHS scalar as a size of 1 datum.
 		/// </summary>
 		/// <param name="rhs">The scalar to copy</param>
-		Datum(const glm::vec4& rhs, IncrementFunctor incrementFunctor = DefaultGrowth{});
+		Datum(const glm::vec4& rhs, GrowthStrategies growthStrategy = GrowthStrategies::HalfAgain);
 		/// <summary>
 		/// A copy constructor for an Datum that assigns the RHS scalar as a size of 1 datum.
 		/// </summary>
 		/// <param name="rhs">The scalar to copy</param>
-		Datum(const glm::mat4& rhs, IncrementFunctor incrementFunctor = DefaultGrowth{});
+		Datum(const glm::mat4& rhs, GrowthStrategies growthStrategy = GrowthStrategies::HalfAgain);
 		/// <summary>
 		/// A copy constructor for an Datum that assigns the RHS scalar as a size of 1 datum.
 		/// </summary>
 		/// <param name="rhs">The scalar to copy</param>
-		Datum(RTTI* rhs, IncrementFunctor incrementFunctor = DefaultGrowth{});
+		Datum(RTTI* rhs, GrowthStrategies growthStrategy = GrowthStrategies::HalfAgain);
 		/// <summary>
-		/// The move constructor for Datum, "stealing" the data from the RHS Datum.
+		/// The move constructor for Datum, "stealing" the data, and the resource it came from, from the RHS Datum.
 		/// </summary>
 		/// <param name="rhs">The Datum to move data from</param>
 		Datum(Datum&& rhs) noexcept;
@@ -233,7 +289,8 @@ namespace FIEAGameEngine {
 		/// <returns>A reference to the updated Datum</returns>
 		Datum& operator=(std::initializer_list<RTTI*> list);
 		/// <summary>
-		/// The move assignment operator for Datum, which "steals" data from the RHS Datum.
+		/// The move assignment operator for Datum, which "steals" data from the RHS Datum. When the two Datums allocate from resources that are not equal, the values are moved
+		/// one by one into new storage from this Datum's resource instead, and running out of memory while allocating it calls std::terminate.
 		/// </summary>
 		/// <param name="rhs">The Datum to move data from</param>
 		/// <returns>A reference to the updated Datum</returns>
@@ -273,6 +330,22 @@ namespace FIEAGameEngine {
 		/// </summary>
 		/// <returns>A function returning a size_t based on an input size_t</returns>
 		[[nodiscard]] IncrementFunctor GetIncrementFunction() const;
+		/// <summary>
+		/// Retrieves the strategy used to decide how much to increment the size of the Datum by when performing a PushBack when size == capacity.
+		/// </summary>
+		/// <returns>The growth strategy of the Datum.</returns>
+		[[nodiscard]] GrowthStrategies GetGrowthStrategy() const;
+		/// <summary>
+		/// Retrieve the resource the Datum allocates internal storage from.
+		/// </summary>
+		/// <returns>A pointer to the Datum's resource.</returns>
+		[[nodiscard]] MemoryResource* GetResource() const;
+		/// <summary>
+		/// Change the resource the Datum allocates internal storage from, moving any internally owned values into storage from the new resource.
+		/// External storage is left where it is.
+		/// </summary>
+		/// <param name="resource">The new resource, or nullptr for the default resource.</param>
+		void SetResource(MemoryResource* resource);
 
 		/// <summary>
 		/// Sets the type of the Datum. The type cannot be set to 'Unknown' nor can it be changed after being initially changed from 'Unknown.'
@@ -280,11 +353,17 @@ namespace FIEAGameEngine {
 		/// <param name="type">The new type of the Datum.</param>
 		void SetType(DatumTypes type);
 		/// <summary>
-		/// Set the IncrementFunctor, used to determine how much to increment capacity by when it becomes necessary on a PushBack call.
+		/// Set the IncrementFunctor, used to determine how much to increment capacity by when it becomes necessary on a PushBack call. Sets the growth strategy to Custom.
 		/// </summary>
 		/// <param name="incrementFunctor">The new functor to be used as an increment strategy.</param>
 		void SetIncrementFunction(IncrementFunctor incrementFunctor);
 		/// <summary>
+		/// Set the strategy used to determine how much to increment capacity by when it becomes necessary on a PushBack call.
+		/// Setting any strategy other than Custom releases a functor given to SetIncrementFunction; setting Custom without one grows like HalfAgain.
+		/// </summary>
+		/// <param name="growthStrategy">The new growth strategy.</param>
+		void SetGrowthStrategy(GrowthStrategies growthStrategy);
+		/// <summary>
 		/// Clear the contents of the Datum, setting size to zero. Capacity does not change. Cannot be performed on Datums that are marked external.
 		/// </summary>
 		void Clear();
@@ -293,7 +372,7 @@ namespace FIEAGameEngine {
 		/// </summary>
 		void ShrinkToFit();
 		/// <summary>
-		/// Reserve capacity for the Datum. Cannot be performed on a Datum that is marked as external.
+		/// Reserve capacity for the Datum. Cannot be performed on a Datum that is marked as external, or for more than MaxCapacity values.
 		/// </summary>
 		/// <param name="capacity">The new capacity for the Datum.</param>
 		void Reserve(std::size_t capacity);
@@ -303,6 +382,48 @@ namespace FIEAGameEngine {
 		/// </summary>
 		/// <param name="newSize">The new size.</param>
 		void Resize(std::size_t newSize);
+		/// <summary>
+		/// Resize the Datum, filling any added spots with copies of the given value and reserving for all of them at once. Sets the type of a Datum without one.
+		/// Cannot be performed on a Datum marked as external.
+		/// </summary>
+		/// <param name="newSize">The new size.</param>
+		/// <param name="value">The value to fill added spots with.</param>
+		void Resize(std::size_t newSize, std::int32_t value);
+		/// <summary>
+		/// Resize the Datum, filling any added spots with copies of the given value and reserving for all of them at once. Sets the type of a Datum without one.
+		/// Cannot be performed on a Datum marked as external.
+		/// </summary>
+		/// <param name="newSize">The new size.</param>
+		/// <param name="value">The value to fill added spots with.</param>
+		void Resize(std::size_t newSize, float value);
+		/// <summary>
+		/// Resize the Datum, filling any added spots with copies of the given value and reserving for all of them at once. Sets the type of a Datum without one.
+		/// Cannot be performed on a Datum marked as external.
+		/// </summary>
+		/// <param name="newSize">The new size.</param>
+		/// <param name="value">The value to fill added spots with.</param>
+		void Resize(std::size_t newSize, const std::string& value);
+		/// <summary>
+		/// Resize the Datum, filling any added spots with copies of the given value and reserving for all of them at once. Sets the type of a Datum without one.
+		/// Cannot be performed on a Datum marked as external.
+		/// </summary>
+		/// <param name="newSize">The new size.</param>
+		/// <param name="value">The value to fill added spots with.</param>
+		void Resize(std::size_t newSize, const glm::vec4& value);
+		/// <summary>
+		/// Resize the Datum, filling any added spots with copies of the given value and reserving for all of them at once. Sets the type of a Datum without one.
+		/// Cannot be performed on a Datum marked as external.
+		/// </summary>
+		/// <param name="newSize">The new size.</param>
+		/// <param name="value">The value to fill added spots with.</param>
+		void Resize(std::size_t newSize, const glm::mat4& value);
+		/// <summary>
+		/// Resize the Datum, filling any added spots with copies of the given value and reserving for all of them at once. Sets the type of a Datum without one.
+		/// Cannot be performed on a Datum marked as external.
+		/// </summary>
+		/// <param name="newSize">The new size.</param>
+		/// <param name="value">The value to fill added spots with.</param>
+		void Resize(std::size_t newSize, RTTI* value);
 
 		/// <summary>
 		/// Set the Datum's data to refer to externally owned data.
@@ -581,6 +702,25 @@ namespace FIEAGameEngine {
 		/// <param name="index">The index at which to set the data, defaulted to zero.</param>
 		void Set(RTTI* value, std::size_t index = std::size_t(0));
 
+		/// <summary>
+		/// View every value of the Datum as one contiguous span, checking the type once instead of on every access. Works on external storage too.
+		/// Invalidated by anything that changes the Datum's size or capacity.
+		/// </summary>
+		/// <typeparam name="T">The C++ type of the values; see TypeOf.</typeparam>
+		/// <returns>A span of Size() values, empty if the Datum has no type yet.</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Datum holds another type.</exception>
+		template <typename T>
+		[[nodiscard]] gsl::span<T> AsSpan();
+		/// <summary>
+		/// View every value of the Datum as one contiguous constant span, checking the type once instead of on every access.
+		/// Invalidated by anything that changes the Datum's size or capacity.
+		/// </summary>
+		/// <typeparam name="T">The C++ type of the values; see TypeOf.</typeparam>
+		/// <returns>A constant span of Size() values, empty if the Datum has no type yet.</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Datum holds another type.</exception>
+		template <typename T>
+		[[nodiscard]] gsl::span<const T> AsSpan() const;
+
 		/// <summary>
 		/// Add the given value to the end of the Datum.
 		/// </summary>
@@ -611,6 +751,20 @@ namespace FIEAGameEngine {
 		/// </summary>
 		/// <param name="data">The value to push onto Datum's data array.</param>
 		void PushBack(RTTI* data);
+		/// <summary>
+		/// Add copies of a range of values to the end of the Datum. Forward ranges reserve once, and ranges given as pointers to any type but std::string are copied with a single memcpy.
+		/// The values may be part of this Datum. Sets the type of a Datum without one. Cannot be performed on a Datum marked as external.
+		/// </summary>
+		/// <param name="first">An iterator pointing at the first value to add, whose value type is one of the types TypeOf accepts.</param>
+		/// <param name="last">An iterator pointing past the last value to add.</param>
+		template <typename InputIterator>
+		void PushBackRange(InputIterator first, InputIterator last);
+		/// <summary>
+		/// Replace the values of the Datum with copies of the values of a range, as Clear followed by PushBackRange. Capacity is kept if it is already large enough.
+		/// </summary>
+		/// <param name="range">Any range with begin and end over one of the types TypeOf accepts, such as a Vector, a gsl::span, or a C array. Must not refer to this Datum's values.</param>
+		template <typename Range>
+		void Assign(const Range& range);
 
 		/// <summary>
 		/// Remove the back value from the Datum. Does not reduce the Datum's capacity. Cannot be performed on a Datum marked as external.
@@ -701,24 +855,78 @@ namespace FIEAGameEngine {
 		/// <param name="value">The value to look for.</param>
 		/// <returns>The index the value exists at.</returns>
 		std::size_t FindIndex(Scope& value) const;
+		/// <summary>
+		/// Look for every occurrence of the given value in the Datum.
+		/// </summary>
+		/// <param name="value">The value to look for.</param>
+		/// <returns>The indices the value exists at, in increasing order.</returns>
+		[[nodiscard]] Vector<std::size_t> FindAll(std::int32_t value) const;
+		/// <summary>
+		/// Look for every occurrence of the given value in the Datum.
+		/// </summary>
+		/// <param name="value">The value to look for.</param>
+		/// <returns>The indices the value exists at, in increasing order.</returns>
+		[[nodiscard]] Vector<std::size_t> FindAll(float value) const;
+		/// <summary>
+		/// Look for every occurrence of the given value in the Datum.
+		/// </summary>
+		/// <param name="value">The value to look for.</param>
+		/// <returns>The indices the value exists at, in increasing order.</returns>
+		[[nodiscard]] Vector<std::size_t> FindAll(const std::string& value) const;
+		/// <summary>
+		/// Look for every occurrence of the given value in the Datum.
+		/// </summary>
+		/// <param name="value">The value to look for.</param>
+		/// <returns>The indices the value exists at, in increasing order.</returns>
+		[[nodiscard]] Vector<std::size_t> FindAll(const glm::vec4& value) const;
+		/// <summary>
+		/// Look for every occurrence of the given value in the Datum.
+		/// </summary>
+		/// <param name="value">The value to look for.</param>
+		/// <returns>The indices the value exists at, in increasing order.</returns>
+		[[nodiscard]] Vector<std::size_t> FindAll(const glm::mat4& value) const;
+		/// <summary>
+		/// Look for every occurrence of the given value in the Datum.
+		/// </summary>
+		/// <param name="value">The value to look for.</param>
+		/// <returns>The indices the value exists at, in increasing order.</returns>
+		[[nodiscard]] Vector<std::size_t> FindAll(RTTI* value) const;
+		/// <summary>
+		/// Look for every occurrence of the given value in the Datum.
+		/// </summary>
+		/// <param name="value">The value to look for.</param>
+		/// <returns>The indices the value exists at, in increasing order.</returns>
+		[[nodiscard]] Vector<std::size_t> FindAll(Scope& value) const;
 
 		/// <summary>
 		/// Push back a value based on the string passed in. The string should conform to standardized format for each type.
 		/// </summary>
 		/// <param name="stringValue">The string representing a value.</param>
-		void PushBackFromString(const std::string& stringValue);
+		void PushBackFromString(std::string_view stringValue);
 		/// <summary>
 		/// Set the value at the given index based on the string passed in. The string should conform to standardized format for each type.
+		/// Numbers are read without allocating or consulting the locale, and either StringFormat reads back.
 		/// </summary>
 		/// <param name="stringValue">The string representing a value.</param>
 		/// <param name="index">The index to set, defaulted to zero.</param>
-		void SetFromString(const std::string& stringValue, std::size_t index = std::size_t(0));
+		/// <exception cref="std::invalid_argument">Thrown if USE_EXCEPTIONS is defined and an Integer or Float Datum is given a string that does not start with a number.</exception>
+		/// <exception cref="std::out_of_range">Thrown if USE_EXCEPTIONS is defined and the number is out of the range of the Datum's type.</exception>
+		void SetFromString(std::string_view stringValue, std::size_t index = std::size_t(0));
 		/// <summary>
 		/// Return the string representation of the value at the given index.
 		/// </summary>
 		/// <param name="index">The index to convert, defaulted to zero.</param>
+		/// <param name="format">How float components are written, defaulted to Fixed.</param>
 		/// <returns>The string representation of the specified value.</returns>
-		std::string ToString(std::size_t index = std::size_t(0)) const;
+		std::string ToString(std::size_t index = std::size_t(0), StringFormat format = StringFormat::Fixed) const;
+		/// <summary>
+		/// Append the string representation of the value at the given index to a string, so a caller converting many values can reuse one buffer.
+		/// Numbers are written without allocating or consulting the locale; only the buffer's own growth, and the ToString of a Pointer or Table value, allocate.
+		/// </summary>
+		/// <param name="out">The string to append to.</param>
+		/// <param name="index">The index to convert, defaulted to zero.</param>
+		/// <param name="format">How float components are written, defaulted to Fixed.</param>
+		void AppendToString(std::string& out, std::size_t index = std::size_t(0), StringFormat format = StringFormat::Fixed) const;
 
 		/// <summary>
 		/// Test the equality of the Datum to another Datum.
@@ -909,30 +1117,46 @@ namespace FIEAGameEngine {
 		};
 
 		/// <summary>
-		/// The data of the Datum.
+		/// The number of bytes of values a Datum can hold without allocating: one vector, four integers or floats, or two pointers.
+		/// </summary>
+		static constexpr std::size_t InlineBytes = sizeof(glm::vec4);
+
+		/// <summary>
+		/// The data of the Datum. Points at _inlineStorage while the values fit there, so reading a value never has to check where it lives.
 		/// </summary>
 		DatumValues _data{ nullptr };
 		/// <summary>
+		/// The storage for internally owned values that fit in InlineBytes. Never holds Strings, which could not be moved along with the Datum by a byte copy.
+		/// </summary>
+		alignas(glm::vec4) alignas(RTTI*) std::byte _inlineStorage[InlineBytes]{};
+		/// <summary>
 		/// The size of the Datum.
 		/// </summary>
-		std::size_t _size{ 0 };
+		std::uint32_t _size{ 0 };
 		/// <summary>
 		/// The capacity of the Datum.
 		/// </summary>
-		std::size_t _capacity{ 0 };
+		std::uint32_t _capacity{ 0 };
 		/// <summary>
-		/// The type of the Datum.
+		/// The type of the Datum. A single byte, so it shares a word with the flag and growth strategy after it.
 		/// </summary>
 		DatumTypes _type{ DatumTypes::Unknown };
 		/// <summary>
 		/// Whether the Datum has been marked external and therefore does not own its memory.
 		/// </summary>
 		bool _isExternal{ false };
-
 		/// <summary>
-		/// A function that will return how much to increment the capacity of the Datum by when called on a certain current capacity.
+		/// How the Datum grows its capacity when a PushBack finds it full.
+		/// </summary>
+		GrowthStrategies _growthStrategy{ GrowthStrategies::HalfAgain };
+		/// <summary>
+		/// The functor used by the Custom growth strategy, if one was given. Kept out of line and shared between copies, since almost every Datum uses a built in strategy.
+		/// </summary>
+		std::shared_ptr<const IncrementFunctor> _customGrowth;
+		/// <summary>
+		/// The resource internally owned storage is allocated from.
 		/// </summary>
-		IncrementFunctor _incrementFunctor;
+		MemoryResource* _resource{ GetDefaultResource() };
 		/// <summary>
 		/// A lookup table to retrieve the size of any of the possible Datum Types.
 		/// </summary>
@@ -962,6 +1186,12 @@ namespace FIEAGameEngine {
 		/// <param name="rhs">The Datum to copy / steal from.</param>
 		void CopySwapHelper(Datum& rhs);
 		/// <summary>
+		/// A helper function to move the data into a buffer of exactly the given capacity. Strings are moved and destroyed one by one, every other type is relocated with realloc,
+		/// or byte copied into or out of the inline storage when the new or old buffer fits there.
+		/// </summary>
+		/// <param name="capacity">The capacity of the new buffer. Must not be less than the current size or zero.</param>
+		void Reallocate(std::size_t capacity);
+		/// <summary>
 		/// A helper function to set the Datum's data to refer to externally owned data regardless of data type.
 		/// </summary>
 		/// <param name="array">The external data to point to.</param>
@@ -973,6 +1203,47 @@ namespace FIEAGameEngine {
 		/// </summary>
 		/// <param name="type">The type of data the Datum is.</param>
 		void PushBackPrep(DatumTypes type);
+		/// <summary>
+		/// Helper function to compute the capacity to grow to from the current capacity, according to the growth strategy.
+		/// </summary>
+		/// <returns>The new capacity, which is greater than the current capacity.</returns>
+		[[nodiscard]] std::size_t GrowCapacity() const;
+		/// <summary>
+		/// Helper function to determine whether the values are currently kept in the inline storage.
+		/// </summary>
+		/// <returns>A boolean indicating whether the data points at the inline storage.</returns>
+		[[nodiscard]] bool IsInline() const;
+		/// <summary>
+		/// Helper function to determine whether a buffer of the given capacity would be kept in the inline storage for the current type.
+		/// </summary>
+		/// <param name="capacity">The capacity of the buffer.</param>
+		/// <returns>A boolean indicating whether the buffer fits in the inline storage.</returns>
+		[[nodiscard]] bool FitsInline(std::size_t capacity) const;
+		/// <summary>
+		/// Helper function shared by the Resize overloads that take a fill value.
+		/// </summary>
+		/// <param name="newSize">The new size.</param>
+		/// <param name="value">The value to fill added spots with.</param>
+		template <typename T>
+		void ResizeWith(std::size_t newSize, const T& value);
+		/// <summary>
+		/// Helper function shared by the FindAll overloads, collecting every index a search finds.
+		/// </summary>
+		/// <param name="findFrom">A functor taking a starting index and returning the index of the first match at or after it, or the size of the Datum if there is none.</param>
+		/// <returns>The indices found, in increasing order.</returns>
+		template <typename TFind>
+		[[nodiscard]] Vector<std::size_t> FindAllWith(TFind findFrom) const;
+		/// <summary>
+		/// Helper function that checks a span of the given type can be taken of the Datum, which must already have that type.
+		/// </summary>
+		/// <param name="type">The type of the span's values.</param>
+		void SpanChecker(DatumTypes type) const;
+		/// <summary>
+		/// Helper function that checks whether an address lies within the storage the Datum currently holds its values in.
+		/// </summary>
+		/// <param name="address">The address to check.</param>
+		/// <returns>A boolean indicating whether the address is part of the Datum's storage.</returns>
+		[[nodiscard]] bool IsInStorage(const void* address) const;
 
 		/// <summary>
 		/// Add the given value to the end of the Datum.
@@ -1006,78 +1277,85 @@ namespace FIEAGameEngine {
 		void PushDefaultPointer();
 
 		/// <summary>
-		/// Retrieve the string representation of the value at the current index.
+		/// Append the string representation of the value at the given index.
 		/// </summary>
+		/// <param name="out">The string to append to.</param>
 		/// <param name="index">The index to convert the value at.</param>
-		/// <returns>A string representation of the specified value.</returns>
-		std::string StringFromInt(size_t index) const;
+		/// <param name="format">How float components are written.</param>
+		void AppendIntToString(std::string& out, size_t index, StringFormat format) const;
 		/// <summary>
-		/// Retrieve the string representation of the value at the current index.
+		/// Append the string representation of the value at the given index.
 		/// </summary>
+		/// <param name="out">The string to append to.</param>
 		/// <param name="index">The index to convert the value at.</param>
-		/// <returns>A string representation of the specified value.</returns>
-		std::string StringFromFloat(size_t index) const;
+		/// <param name="format">How float components are written.</param>
+		void AppendFloatToString(std::string& out, size_t index, StringFormat format) const;
 		/// <summary>
-		/// Retrieve the string representation of the value at the current index.
+		/// Append the string representation of the value at the given index.
 		/// </summary>
+		/// <param name="out">The string to append to.</param>
 		/// <param name="index">The index to convert the value at.</param>
-		/// <returns>A string representation of the specified value.</returns>
-		std::string StringFromString(size_t index) const;
+		/// <param name="format">How float components are written.</param>
+		void AppendStringToString(std::string& out, size_t index, StringFormat format) const;
 		/// <summary>
-		/// Retrieve the string representation of the value at the current index.
+		/// Append the string representation of the value at the given index.
 		/// </summary>
+		/// <param name="out">The string to append to.</param>
 		/// <param name="index">The index to convert the value at.</param>
-		/// <returns>A string representation of the specified value.</returns>
-		std::string StringFromVector(size_t index) const;
+		/// <param name="format">How float components are written.</param>
+		void AppendVectorToString(std::string& out, size_t index, StringFormat format) const;
 		/// <summary>
-		/// Retrieve the string representation of the value at the current index.
+		/// Append the string representation of the value at the given index.
 		/// </summary>
+		/// <param name="out">The string to append to.</param>
 		/// <param name="index">The index to convert the value at.</param>
-		/// <returns>A string representation of the specified value.</returns>
-		std::string StringFromMatrix(size_t index) const;
+		/// <param name="format">How float components are written.</param>
+		void AppendMatrixToString(std::string& out, size_t index, StringFormat format) const;
 		/// <summary>
-		/// Retrieve the string representation of the value at the current index.
+		/// Append the string representation of the value at the given index.
 		/// </summary>
+		/// <param name="out">The string to append to.</param>
 		/// <param name="index">The index to convert the value at.</param>
-		/// <returns>A string representation of the specified value.</returns>
-		std::string StringFromPointer(size_t index) const;
+		/// <param name="format">How float components are written.</param>
+		void AppendPointerToString(std::string& out, size_t index, StringFormat format) const;
 		/// <summary>
-		/// Retrieve the string representation of the value at the current index.
+		/// Append the string representation of the value at the given index.
 		/// </summary>
+		/// <param name="out">The string to append to.</param>
 		/// <param name="index">The index to convert the value at.</param>
-		/// <returns>A string representation of the specified value.</returns>
-		std::string StringFromTable(size_t index) const;
+		/// <param name="format">How float components are written.</param>
+		void AppendTableToString(std::string& out, size_t index, StringFormat format) const;
 
 		/// <summary>
 		/// Set the value at the given index to a value specified via the given string.
 		/// </summary>
 		/// <param name="strValue">The string representing which value to set the data to.</param>
 		/// <param name="index">The index at which to set the data.</param>
-		void SetIntFromString(const std::string& strValue, size_t index);
+		void SetIntFromString(std::string_view strValue, size_t index);
 		/// <summary>
 		/// Set the value at the given index to a value specified via the given string.
 		/// </summary>
 		/// <param name="strValue">The string representing which value to set the data to.</param>
 		/// <param name="index">The index at which to set the data.</param>
-		void SetFloatFromString(const std::string& strValue, size_t index);
+		void SetFloatFromString(std::string_view strValue, size_t index);
 		/// <summary>
 		/// Set the value at the given index to a value specified via the given string.
 		/// </summary>
 		/// <param name="strValue">The string representing which value to set the data to.</param>
 		/// <param name="index">The index at which to set the data.</param>
-		void SetStringFromString(const std::string& strValue, size_t index);
+		void SetStringFromString(std::string_view strValue, size_t index);
 		/// <summary>
 		/// Set the value at the given index to a value specified via the given string.
 		/// </summary>
 		/// <param name="strValue">The string representing which value to set the data to.</param>
 		/// <param name="index">The index at which to set the data.</param>
-		void SetVectorFromString(const std::string& strValue, size_t index);
+		void SetVectorFromString(std::string_view strValue, size_t index);
 		/// <summary>
 		/// Set the value at the given index to a value specified via the given string.
 		/// </summary>
 		/// <param name="strValue">The string representing which value to set the data to.</param>
 		/// <param name="index">The index at which to set the data.</param>
-		void SetMatrixFromString(const std::string& strValue, size_t index);
+		void SetMatrixFromString(std::string_view strValue, size_t index);
 
 		/// <summary>
 		/// Helper function for Set and Get calls that checks if the type and index are valid.
@@ -1107,24 +1385,24 @@ namespace FIEAGameEngine {
 		};
 
 		/// <summary>
-		/// A function lookup table for retrieving the string representation of a given value based on the Datum's type.
-		/// </summary>
-		using ToStringFunction = std::string(Datum::*)(std::size_t) const;
-		inline static const ToStringFunction _toStringFunctions[static_cast<std::int32_t>(DatumTypes::End) + 1] = {
-			nullptr,					//Datum::Types::Unknown
-			&Datum::StringFromInt,		//Datum::Types::Integer
-			&Datum::StringFromFloat,	//Datum::Types::Float			
-			&Datum::StringFromString,	//Datum::Types::String
-			&Datum::StringFromVector,	//Datum::Types::Vector
-			&Datum::StringFromMatrix,	//Datum::Types::Matrix
-			&Datum::StringFromPointer,	//Datum::Types::Pointer
-			&Datum::StringFromTable,	//Datum::Types::Table
+		/// A function lookup table for appending the string representation of a given value to a string based on the Datum's type.
+		/// </summary>
+		using AppendToStringFunction = void(Datum::*)(std::string&, std::size_t, StringFormat) const;
+		inline static const AppendToStringFunction _appendToStringFunctions[static_cast<std::int32_t>(DatumTypes::End) + 1] = {
+			nullptr,							//Datum::Types::Unknown
+			&Datum::AppendIntToString,			//Datum::Types::Integer
+			&Datum::AppendFloatToString,		//Datum::Types::Float			
+			&Datum::AppendStringToString,		//Datum::Types::String
+			&Datum::AppendVectorToString,		//Datum::Types::Vector
+			&Datum::AppendMatrixToString,		//Datum::Types::Matrix
+			&Datum::AppendPointerToString,		//Datum::Types::Pointer
+			&Datum::AppendTableToString,		//Datum::Types::Table
 		};
 
 		/// <summary>
 		/// A function lookup table for setting the specified value to data represented in string format based on the Datum's type.
 		/// </summary>
-		using SetFromStringFunction = void(Datum::*)(const std::string&, std::size_t);
+		using SetFromStringFunction = void(Datum::*)(std::string_view, std::size_t);
 		inline static const SetFromStringFunction _setFromStringFunctions[static_cast<std::int32_t>(DatumTypes::End) + 1] = {
 			nullptr,						//Datum::Types::Unknown
 			&Datum::SetIntFromString,		//Datum::Types::Integer
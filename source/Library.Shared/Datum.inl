@@ -27,7 +27,37 @@ namespace FIEAGameEngine {
 	}
 
 	inline Datum::IncrementFunctor Datum::GetIncrementFunction() const {
-		return _incrementFunctor;
+		switch (_growthStrategy) {
+		case GrowthStrategies::Doubling:
+			return DoublingGrowth{};
+		case GrowthStrategies::FixedChunk:
+			return FixedGrowth<FixedGrowthChunk>{};
+		case GrowthStrategies::PageRounded:
+			return [elementSize = std::max(_typeSizes[static_cast<std::int32_t>(_type)], std::size_t(1))](std::size_t capacity) {
+				return PageRoundedGrowth<>{}(capacity, elementSize);
+			};
+		case GrowthStrategies::Custom:
+			if (_customGrowth != nullptr) return *_customGrowth;
+			[[fallthrough]];
+		default:
+			return DefaultGrowth{};
+		}
+	}
+
+	inline Datum::GrowthStrategies Datum::GetGrowthStrategy() const {
+		return _growthStrategy;
+	}
+
+	inline MemoryResource* Datum::GetResource() const {
+		return _resource;
+	}
+
+	inline bool Datum::IsInline() const {
+		return _data.vp == _inlineStorage;
+	}
+
+	inline bool Datum::FitsInline(std::size_t capacity) const {
+		return _type != DatumTypes::String && capacity * _typeSizes[static_cast<std::int32_t>(_type)] <= InlineBytes;
 	}
 
 	inline void Datum::SetType(DatumTypes type) {
@@ -39,7 +69,13 @@ namespace FIEAGameEngine {
 	}
 
 	inline void Datum::SetIncrementFunction(IncrementFunctor incrementFunctor) {
-		_incrementFunctor = incrementFunctor;
+		_customGrowth = std::make_shared<const IncrementFunctor>(std::move(incrementFunctor));
+		_growthStrategy = GrowthStrategies::Custom;
+	}
+
+	inline void Datum::SetGrowthStrategy(GrowthStrategies growthStrategy) {
+		if (growthStrategy != GrowthStrategies::Custom) _customGrowth.reset();
+		_growthStrategy = growthStrategy;
 	}
 
 #pragma region SetStorage
@@ -408,47 +444,24 @@ namespace FIEAGameEngine {
 #pragma endregion Removals
 
 #pragma region StringConversions
-	inline std::string Datum::StringFromInt(size_t index) const {
-		return std::to_string(GetAsInt(index));
+	inline void Datum::AppendStringToString(std::string& out, size_t index, StringFormat) const {
+		out += GetAsString(index);
 	}
 
-	inline std::string Datum::StringFromFloat(size_t index) const {
-		return std::to_string(GetAsFloat(index));
-	}
-
-	inline std::string Datum::StringFromString(size_t index) const {
-		return GetAsString(index);
-	}
-
-	inline std::string Datum::StringFromVector(size_t index) const {
-		return glm::to_string(GetAsVector(index));
-	}
-
-	inline std::string Datum::StringFromMatrix(size_t index) const {
-		return glm::to_string(GetAsMatrix(index));
-	}
-
-	inline std::string Datum::StringFromPointer(size_t index) const {
+	inline void Datum::AppendPointerToString(std::string& out, size_t index, StringFormat) const {
 		RTTI* ptr = GetAsPointer(index);
-		return (ptr == nullptr) ? std::string("nullptr") : ptr->ToString();
+		if (ptr == nullptr) out += "nullptr";
+		else out += ptr->ToString();
 	}
 
-	inline std::string Datum::StringFromTable(size_t index) const {
+	inline void Datum::AppendTableToString(std::string& out, size_t index, StringFormat) const {
 		GetSetChecker(DatumTypes::Table, index);
 		RTTI* ptr = _data.p[index];
-		return ptr->ToString();
+		out += ptr->ToString();
 	}
 
-	inline void Datum::SetIntFromString(const std::string& strValue, size_t index) {
-		Set(std::stoi(strValue), index);
-	}
-
-	inline void Datum::SetFloatFromString(const std::string& strValue, size_t index) {
-		Set(std::stof(strValue), index);
-	}
-
-	inline void Datum::SetStringFromString(const std::string& strValue, size_t index) {
-		Set(strValue, index);
+	inline void Datum::SetStringFromString(std::string_view strValue, size_t index) {
+		Set(std::string(strValue), index);
 	}
 #pragma endregion StringConversions
 
@@ -505,4 +518,126 @@ namespace FIEAGameEngine {
 		return !(operator==(rhs));
 	}
 #pragma endregion EqualityOperators
+
+#pragma region Ranges
+	template <typename T>
+	inline constexpr Datum::DatumTypes Datum::TypeOf() {
+		if constexpr (std::is_same_v<T, std::int32_t>) return DatumTypes::Integer;
+		else if constexpr (std::is_same_v<T, float>) return DatumTypes::Float;
+		else if constexpr (std::is_same_v<T, std::string>) return DatumTypes::String;
+		else if constexpr (std::is_same_v<T, glm::vec4>) return DatumTypes::Vector;
+		else if constexpr (std::is_same_v<T, glm::mat4>) return DatumTypes::Matrix;
+		else if constexpr (std::is_same_v<T, RTTI*>) return DatumTypes::Pointer;
+		else static_assert(sizeof(T) == 0, "A Datum cannot hold values of this type.");
+	}
+
+	inline void Datum::SpanChecker(DatumTypes type) const {
+#ifdef USE_EXCEPTIONS
+		if (_type != type) throw std::runtime_error("Datum is not of the indicated type.");
+#endif // USE_EXCEPTIONS
+	}
+
+	inline bool Datum::IsInStorage(const void* address) const {
+		const std::byte* begin = static_cast<const std::byte*>(_data.vp);
+		const std::byte* end = begin + _capacity * _typeSizes[static_cast<std::int32_t>(_type)];
+		const std::byte* target = static_cast<const std::byte*>(address);
+		return !std::less<const std::byte*>{}(target, begin) && std::less<const std::byte*>{}(target, end);
+	}
+
+	template <typename T>
+	inline gsl::span<T> Datum::AsSpan() {
+		SpanChecker(TypeOf<T>());
+		return gsl::span<T>(static_cast<T*>(_data.vp), _size);
+	}
+
+	template <typename T>
+	inline gsl::span<const T> Datum::AsSpan() const {
+		SpanChecker(TypeOf<T>());
+		return gsl::span<const T>(static_cast<const T*>(_data.vp), _size);
+	}
+
+	template <typename InputIterator>
+	inline void Datum::PushBackRange(InputIterator first, InputIterator last) {
+		using value_type = typename std::iterator_traits<InputIterator>::value_type;
+		using iterator_category = typename std::iterator_traits<InputIterator>::iterator_category;
+
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag, iterator_category>) {
+#ifdef USE_EXCEPTIONS
+			if (_isExternal) throw std::runtime_error("Datum does not own its storage; cannot change the size of its data.");
+#endif // USE_EXCEPTIONS
+			SetType(TypeOf<value_type>());
+			const std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+			if (count == std::size_t(0)) return;
+			if (_size + count > _capacity) {
+				//growing frees the current storage, so values of this Datum are copied out first
+				if constexpr (std::is_lvalue_reference_v<typename std::iterator_traits<InputIterator>::reference>) {
+					if (IsInStorage(std::addressof(*first))) {
+						Vector<value_type> values(count);
+						values.Insert(values.end(), first, last);
+						PushBackRange(values.Data(), values.Data() + count);
+						return;
+					}
+				}
+				Reserve(std::max(_size + count, std::min(GrowCapacity(), MaxCapacity)));
+			}
+
+			value_type* destination = static_cast<value_type*>(_data.vp);
+			if constexpr (std::is_pointer_v<InputIterator> && std::is_trivially_copyable_v<value_type>) {
+				std::memcpy(destination + _size, first, count * sizeof(value_type));
+				_size += static_cast<std::uint32_t>(count);
+			}
+			else {
+				for (; first != last; ++first) {
+					new (destination + _size) value_type(*first);
+					++_size;
+				}
+			}
+		}
+		else {
+			for (; first != last; ++first) {
+				PushBack(value_type(*first));
+			}
+		}
+	}
+
+	template <typename Range>
+	inline void Datum::Assign(const Range& range) {
+		using value_type = std::remove_cv_t<std::remove_reference_t<decltype(*std::begin(range))>>;
+		SetType(TypeOf<value_type>());
+		Clear();
+		PushBackRange(std::begin(range), std::end(range));
+	}
+
+	template <typename T>
+	inline void Datum::ResizeWith(std::size_t newSize, const T& value) {
+#ifdef USE_EXCEPTIONS
+		if (_isExternal) throw std::runtime_error("Datum does not own this memory, cannot resize.");
+#endif // USE_EXCEPTIONS
+		SetType(TypeOf<T>());
+		if (newSize <= _size) {
+			Resize(newSize);
+			return;
+		}
+
+		//the value may be one of this Datum's own, which growing frees
+		const T fill(value);
+		Reserve(newSize);
+		T* destination = static_cast<T*>(_data.vp);
+		while (_size < newSize) {
+			new (destination + _size) T(fill);
+			++_size;
+		}
+	}
+#pragma endregion Ranges
+
+#pragma region FindAll
+	template <typename TFind>
+	inline Vector<std::size_t> Datum::FindAllWith(TFind findFrom) const {
+		Vector<std::size_t> indices;
+		for (std::size_t index = findFrom(std::size_t(0)); index < _size; index = findFrom(index + 1)) {
+			indices.PushBack(index);
+		}
+		return indices;
+	}
+#pragma endregion FindAll
 }
@@ -0,0 +1,726 @@
+/// <summary>
+/// The definitions of the DatumMath functions, with a scalar, an SSE2, and an AVX2 version of every kernel and the runtime dispatch between them.
+/// </summary>
+
+#include "pch.h"
+#include "DatumMath.h"
+#include <algorithm>
+#include <cassert>
+#include <atomic>
+#include <utility>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define DATUM_MATH_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+//MSVC compiles any intrinsic anywhere; GCC and Clang only compile AVX2 and FMA intrinsics inside functions marked for them
+#if defined(DATUM_MATH_X86) && (defined(__GNUC__) || defined(__clang__))
+#define DATUM_MATH_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define DATUM_MATH_AVX2
+#endif
+
+namespace FIEAGameEngine::DatumMath {
+	namespace {
+		/// <summary>
+		/// One version of every kernel. Each works on raw components, so the Datum checks happen once per call rather than once per element.
+		/// </summary>
+		struct Kernels final {
+			/// <summary>
+			/// Multiplies count vectors by a matrix. The destination may be the source, and the matrix may be among the destinations, since it is read before anything is written.
+			/// </summary>
+			void (*Transform)(const glm::mat4& matrix, const glm::vec4* source, glm::vec4* destination, std::size_t count);
+			/// <summary>
+			/// Adds count addends to count values.
+			/// </summary>
+			void (*Add)(float* values, const float* addends, std::size_t count);
+			/// <summary>
+			/// Multiplies count values by a scale.
+			/// </summary>
+			void (*Scale)(float* values, float scale, std::size_t count);
+			/// <summary>
+			/// Moves count values a fraction of the way to count targets.
+			/// </summary>
+			void (*Lerp)(float* values, const float* targets, float t, std::size_t count);
+			/// <summary>
+			/// Finds the componentwise minimum of count vectors, where count is at least one.
+			/// </summary>
+			glm::vec4 (*Min)(const glm::vec4* vectors, std::size_t count);
+			/// <summary>
+			/// Finds the componentwise maximum of count vectors, where count is at least one.
+			/// </summary>
+			glm::vec4 (*Max)(const glm::vec4* vectors, std::size_t count);
+			/// <summary>
+			/// Finds the first of count integers equal to a value, returning count if none is.
+			/// </summary>
+			std::size_t (*FindInteger)(const std::int32_t* values, std::size_t count, std::int32_t value);
+			/// <summary>
+			/// Finds the first of count floats equal to a value, returning count if none is.
+			/// </summary>
+			std::size_t (*FindFloat)(const float* values, std::size_t count, float value);
+			/// <summary>
+			/// Finds the first of count vectors equal to a value, returning count if none is.
+			/// </summary>
+			std::size_t (*FindVector)(const glm::vec4* values, std::size_t count, const glm::vec4& value);
+			/// <summary>
+			/// Finds the first of count addresses equal to a value, returning count if none is.
+			/// </summary>
+			std::size_t (*FindAddress)(const std::uintptr_t* values, std::size_t count, std::uintptr_t value);
+		};
+
+#pragma region Scalar
+		void TransformScalar(const glm::mat4& matrix, const glm::vec4* source, glm::vec4* destination, std::size_t count) {
+			const glm::mat4 copy = matrix;
+			for (std::size_t i = 0; i < count; ++i) {
+				destination[i] = copy * source[i];
+			}
+		}
+
+		void AddScalar(float* values, const float* addends, std::size_t count) {
+			for (std::size_t i = 0; i < count; ++i) {
+				values[i] += addends[i];
+			}
+		}
+
+		void ScaleScalar(float* values, float scale, std::size_t count) {
+			for (std::size_t i = 0; i < count; ++i) {
+				values[i] *= scale;
+			}
+		}
+
+		void LerpScalar(float* values, const float* targets, float t, std::size_t count) {
+			for (std::size_t i = 0; i < count; ++i) {
+				values[i] += (targets[i] - values[i]) * t;
+			}
+		}
+
+		glm::vec4 MinScalar(const glm::vec4* vectors, std::size_t count) {
+			glm::vec4 result = vectors[0];
+			for (std::size_t i = 1; i < count; ++i) {
+				result = glm::min(result, vectors[i]);
+			}
+			return result;
+		}
+
+		glm::vec4 MaxScalar(const glm::vec4* vectors, std::size_t count) {
+			glm::vec4 result = vectors[0];
+			for (std::size_t i = 1; i < count; ++i) {
+				result = glm::max(result, vectors[i]);
+			}
+			return result;
+		}
+
+		template <typename T>
+		std::size_t FindScalar(const T* values, std::size_t count, T value) {
+			return std::find(values, values + count, value) - values;
+		}
+
+		std::size_t FindVectorScalar(const glm::vec4* values, std::size_t count, const glm::vec4& value) {
+			return std::find(values, values + count, value) - values;
+		}
+
+		constexpr Kernels ScalarKernels{ TransformScalar, AddScalar, ScaleScalar, LerpScalar, MinScalar, MaxScalar,
+			FindScalar<std::int32_t>, FindScalar<float>, FindVectorScalar, FindScalar<std::uintptr_t> };
+#pragma endregion Scalar
+
+#ifdef DATUM_MATH_X86
+		/// <summary>
+		/// Retrieve the index of the lowest set bit of a comparison mask.
+		/// </summary>
+		/// <param name="mask">A mask with at least one bit set</param>
+		/// <returns>The index of its lowest set bit</returns>
+		inline std::size_t LowestSetBit(unsigned int mask) {
+			assert(mask != 0);
+#ifdef _MSC_VER
+			unsigned long index;
+			_BitScanForward(&index, mask);
+			return index;
+#else
+			return static_cast<std::size_t>(__builtin_ctz(mask));
+#endif
+		}
+
+		/// <summary>
+		/// Retrieve the first vector whose four components all matched, given a mask holding four comparison bits per vector.
+		/// </summary>
+		/// <param name="mask">A mask whose bits 4i to 4i + 3 are the component comparisons of vector i</param>
+		/// <returns>The index of the first vector that matched, or 8 if none did</returns>
+		inline std::size_t FirstFullNibble(unsigned int mask) {
+			const unsigned int full = mask & (mask >> 1) & (mask >> 2) & (mask >> 3) & 0x11111111u;
+			return (full == 0) ? 8 : LowestSetBit(full) / 4;
+		}
+
+#pragma region SSE2
+		void TransformSSE2(const glm::mat4& matrix, const glm::vec4* source, glm::vec4* destination, std::size_t count) {
+			const float* columns = reinterpret_cast<const float*>(&matrix);
+			const __m128 column0 = _mm_loadu_ps(columns);
+			const __m128 column1 = _mm_loadu_ps(columns + 4);
+			const __m128 column2 = _mm_loadu_ps(columns + 8);
+			const __m128 column3 = _mm_loadu_ps(columns + 12);
+			const float* in = reinterpret_cast<const float*>(source);
+			float* out = reinterpret_cast<float*>(destination);
+
+			for (std::size_t i = 0; i < count; ++i, in += 4, out += 4) {
+				const __m128 vector = _mm_loadu_ps(in);
+				__m128 result = _mm_mul_ps(column0, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(0, 0, 0, 0)));
+				result = _mm_add_ps(result, _mm_mul_ps(column1, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(1, 1, 1, 1))));
+				result = _mm_add_ps(result, _mm_mul_ps(column2, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(2, 2, 2, 2))));
+				result = _mm_add_ps(result, _mm_mul_ps(column3, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(3, 3, 3, 3))));
+				_mm_storeu_ps(out, result);
+			}
+		}
+
+		void AddSSE2(float* values, const float* addends, std::size_t count) {
+			std::size_t i = 0;
+			for (; i + 4 <= count; i += 4) {
+				_mm_storeu_ps(values + i, _mm_add_ps(_mm_loadu_ps(values + i), _mm_loadu_ps(addends + i)));
+			}
+			AddScalar(values + i, addends + i, count - i);
+		}
+
+		void ScaleSSE2(float* values, float scale, std::size_t count) {
+			const __m128 factor = _mm_set1_ps(scale);
+			std::size_t i = 0;
+			for (; i + 4 <= count; i += 4) {
+				_mm_storeu_ps(values + i, _mm_mul_ps(_mm_loadu_ps(values + i), factor));
+			}
+			ScaleScalar(values + i, scale, count - i);
+		}
+
+		void LerpSSE2(float* values, const float* targets, float t, std::size_t count) {
+			const __m128 fraction = _mm_set1_ps(t);
+			std::size_t i = 0;
+			for (; i + 4 <= count; i += 4) {
+				const __m128 value = _mm_loadu_ps(values + i);
+				_mm_storeu_ps(values + i, _mm_add_ps(value, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(targets + i), value), fraction)));
+			}
+			LerpScalar(values + i, targets + i, t, count - i);
+		}
+
+		glm::vec4 MinSSE2(const glm::vec4* vectors, std::size_t count) {
+			const float* in = reinterpret_cast<const float*>(vectors);
+			__m128 result = _mm_loadu_ps(in);
+			for (std::size_t i = 1; i < count; ++i) {
+				result = _mm_min_ps(_mm_loadu_ps(in + 4 * i), result);
+			}
+			glm::vec4 minimum;
+			_mm_storeu_ps(reinterpret_cast<float*>(&minimum), result);
+			return minimum;
+		}
+
+		glm::vec4 MaxSSE2(const glm::vec4* vectors, std::size_t count) {
+			const float* in = reinterpret_cast<const float*>(vectors);
+			__m128 result = _mm_loadu_ps(in);
+			for (std::size_t i = 1; i < count; ++i) {
+				result = _mm_max_ps(_mm_loadu_ps(in + 4 * i), result);
+			}
+			glm::vec4 maximum;
+			_mm_storeu_ps(reinterpret_cast<float*>(&maximum), result);
+			return maximum;
+		}
+
+		//The search kernels compare four registers before each branch, since the branch costs more than the comparisons
+		std::size_t FindIntegerSSE2(const std::int32_t* values, std::size_t count, std::int32_t value) {
+			const __m128i target = _mm_set1_epi32(value);
+			const __m128i* in = reinterpret_cast<const __m128i*>(values);
+			std::size_t i = 0;
+			for (; i + 16 <= count; i += 16, in += 4) {
+				const unsigned int mask = static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128(in), target))))
+					| (static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128(in + 1), target)))) << 4)
+					| (static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128(in + 2), target)))) << 8)
+					| (static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128(in + 3), target)))) << 12);
+				if (mask != 0) return i + LowestSetBit(mask);
+			}
+			return i + FindScalar(values + i, count - i, value);
+		}
+
+		std::size_t FindFloatSSE2(const float* values, std::size_t count, float value) {
+			const __m128 target = _mm_set1_ps(value);
+			std::size_t i = 0;
+			for (; i + 16 <= count; i += 16) {
+				const unsigned int mask = static_cast<unsigned int>(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(values + i), target)))
+					| (static_cast<unsigned int>(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(values + i + 4), target))) << 4)
+					| (static_cast<unsigned int>(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(values + i + 8), target))) << 8)
+					| (static_cast<unsigned int>(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(values + i + 12), target))) << 12);
+				if (mask != 0) return i + LowestSetBit(mask);
+			}
+			return i + FindScalar(values + i, count - i, value);
+		}
+
+		std::size_t FindVectorSSE2(const glm::vec4* values, std::size_t count, const glm::vec4& value) {
+			const __m128 target = _mm_loadu_ps(reinterpret_cast<const float*>(&value));
+			const float* in = reinterpret_cast<const float*>(values);
+			std::size_t i = 0;
+			for (; i + 4 <= count; i += 4, in += 16) {
+				const unsigned int mask = static_cast<unsigned int>(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(in), target)))
+					| (static_cast<unsigned int>(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(in + 4), target))) << 4)
+					| (static_cast<unsigned int>(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(in + 8), target))) << 8)
+					| (static_cast<unsigned int>(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(in + 12), target))) << 12);
+				const std::size_t found = FirstFullNibble(mask);
+				if (found < 4) return i + found;
+			}
+			return i + FindVectorScalar(values + i, count - i, value);
+		}
+
+		/// <summary>
+		/// Compare two 64 bit lanes to a target. SSE2 has no 64 bit comparison, so both 32 bit halves of a lane must match.
+		/// </summary>
+		inline unsigned int CompareAddressesSSE2(const std::uintptr_t* values, __m128i target) {
+			const __m128i halves = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values)), target);
+			return static_cast<unsigned int>(_mm_movemask_pd(_mm_castsi128_pd(_mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1))))));
+		}
+
+		std::size_t FindAddressSSE2(const std::uintptr_t* values, std::size_t count, std::uintptr_t value) {
+			if constexpr (sizeof(std::uintptr_t) == sizeof(std::int32_t)) {
+				return FindIntegerSSE2(reinterpret_cast<const std::int32_t*>(values), count, static_cast<std::int32_t>(value));
+			}
+			else {
+				const __m128i target = _mm_set1_epi64x(static_cast<long long>(value));
+				std::size_t i = 0;
+				for (; i + 8 <= count; i += 8) {
+					const unsigned int mask = CompareAddressesSSE2(values + i, target) | (CompareAddressesSSE2(values + i + 2, target) << 2)
+						| (CompareAddressesSSE2(values + i + 4, target) << 4) | (CompareAddressesSSE2(values + i + 6, target) << 6);
+					if (mask != 0) return i + LowestSetBit(mask);
+				}
+				return i + FindScalar(values + i, count - i, value);
+			}
+		}
+
+		constexpr Kernels SSE2Kernels{ TransformSSE2, AddSSE2, ScaleSSE2, LerpSSE2, MinSSE2, MaxSSE2,
+			FindIntegerSSE2, FindFloatSSE2, FindVectorSSE2, FindAddressSSE2 };
+#pragma endregion SSE2
+
+#pragma region AVX2
+		DATUM_MATH_AVX2 void TransformAVX2(const glm::mat4& matrix, const glm::vec4* source, glm::vec4* destination, std::size_t count) {
+			//Each 256 bit register holds two vectors, so every column is repeated in both halves and each component is broadcast within its own half
+			const float* columns = reinterpret_cast<const float*>(&matrix);
+			const __m256 column0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(columns));
+			const __m256 column1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(columns + 4));
+			const __m256 column2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(columns + 8));
+			const __m256 column3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(columns + 12));
+			const float* in = reinterpret_cast<const float*>(source);
+			float* out = reinterpret_cast<float*>(destination);
+
+			std::size_t i = 0;
+			for (; i + 2 <= count; i += 2, in += 8, out += 8) {
+				const __m256 vectors = _mm256_loadu_ps(in);
+				__m256 result = _mm256_mul_ps(column0, _mm256_permute_ps(vectors, _MM_SHUFFLE(0, 0, 0, 0)));
+				result = _mm256_fmadd_ps(column1, _mm256_permute_ps(vectors, _MM_SHUFFLE(1, 1, 1, 1)), result);
+				result = _mm256_fmadd_ps(column2, _mm256_permute_ps(vectors, _MM_SHUFFLE(2, 2, 2, 2)), result);
+				result = _mm256_fmadd_ps(column3, _mm256_permute_ps(vectors, _MM_SHUFFLE(3, 3, 3, 3)), result);
+				_mm256_storeu_ps(out, result);
+			}
+			if (i < count) {
+				const __m128 vector = _mm_loadu_ps(in);
+				__m128 result = _mm_mul_ps(_mm256_castps256_ps128(column0), _mm_permute_ps(vector, _MM_SHUFFLE(0, 0, 0, 0)));
+				result = _mm_fmadd_ps(_mm256_castps256_ps128(column1), _mm_permute_ps(vector, _MM_SHUFFLE(1, 1, 1, 1)), result);
+				result = _mm_fmadd_ps(_mm256_castps256_ps128(column2), _mm_permute_ps(vector, _MM_SHUFFLE(2, 2, 2, 2)), result);
+				result = _mm_fmadd_ps(_mm256_castps256_ps128(column3), _mm_permute_ps(vector, _MM_SHUFFLE(3, 3, 3, 3)), result);
+				_mm_storeu_ps(out, result);
+			}
+		}
+
+		DATUM_MATH_AVX2 void AddAVX2(float* values, const float* addends, std::size_t count) {
+			std::size_t i = 0;
+			for (; i + 8 <= count; i += 8) {
+				_mm256_storeu_ps(values + i, _mm256_add_ps(_mm256_loadu_ps(values + i), _mm256_loadu_ps(addends + i)));
+			}
+			AddScalar(values + i, addends + i, count - i);
+		}
+
+		DATUM_MATH_AVX2 void ScaleAVX2(float* values, float scale, std::size_t count) {
+			const __m256 factor = _mm256_set1_ps(scale);
+			std::size_t i = 0;
+			for (; i + 8 <= count; i += 8) {
+				_mm256_storeu_ps(values + i, _mm256_mul_ps(_mm256_loadu_ps(values + i), factor));
+			}
+			ScaleScalar(values + i, scale, count - i);
+		}
+
+		DATUM_MATH_AVX2 void LerpAVX2(float* values, const float* targets, float t, std::size_t count) {
+			const __m256 fraction = _mm256_set1_ps(t);
+			std::size_t i = 0;
+			for (; i + 8 <= count; i += 8) {
+				const __m256 value = _mm256_loadu_ps(values + i);
+				_mm256_storeu_ps(values + i, _mm256_fmadd_ps(_mm256_sub_ps(_mm256_loadu_ps(targets + i), value), fraction, value));
+			}
+			LerpScalar(values + i, targets + i, t, count - i);
+		}
+
+		DATUM_MATH_AVX2 glm::vec4 MinAVX2(const glm::vec4* vectors, std::size_t count) {
+			const float* in = reinterpret_cast<const float*>(vectors);
+			__m128 result = _mm_loadu_ps(in);
+			if (count >= 2) {
+				__m256 pairs = _mm256_loadu_ps(in);
+				std::size_t i = 2;
+				for (; i + 2 <= count; i += 2) {
+					pairs = _mm256_min_ps(_mm256_loadu_ps(in + 4 * i), pairs);
+				}
+				if (i < count) result = _mm_loadu_ps(in + 4 * i);
+				result = _mm_min_ps(_mm_min_ps(_mm256_castps256_ps128(pairs), _mm256_extractf128_ps(pairs, 1)), result);
+			}
+			glm::vec4 minimum;
+			_mm_storeu_ps(reinterpret_cast<float*>(&minimum), result);
+			return minimum;
+		}
+
+		DATUM_MATH_AVX2 glm::vec4 MaxAVX2(const glm::vec4* vectors, std::size_t count) {
+			const float* in = reinterpret_cast<const float*>(vectors);
+			__m128 result = _mm_loadu_ps(in);
+			if (count >= 2) {
+				__m256 pairs = _mm256_loadu_ps(in);
+				std::size_t i = 2;
+				for (; i + 2 <= count; i += 2) {
+					pairs = _mm256_max_ps(_mm256_loadu_ps(in + 4 * i), pairs);
+				}
+				if (i < count) result = _mm_loadu_ps(in + 4 * i);
+				result = _mm_max_ps(_mm_max_ps(_mm256_castps256_ps128(pairs), _mm256_extractf128_ps(pairs, 1)), result);
+			}
+			glm::vec4 maximum;
+			_mm_storeu_ps(reinterpret_cast<float*>(&maximum), result);
+			return maximum;
+		}
+
+		DATUM_MATH_AVX2 std::size_t FindIntegerAVX2(const std::int32_t* values, std::size_t count, std::int32_t value) {
+			const __m256i target = _mm256_set1_epi32(value);
+			const __m256i* in = reinterpret_cast<const __m256i*>(values);
+			std::size_t i = 0;
+			for (; i + 32 <= count; i += 32, in += 4) {
+				const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256(in), target))))
+					| (static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256(in + 1), target)))) << 8)
+					| (static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256(in + 2), target)))) << 16)
+					| (static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256(in + 3), target)))) << 24);
+				if (mask != 0) return i + LowestSetBit(mask);
+			}
+			return i + FindIntegerSSE2(values + i, count - i, value);
+		}
+
+		DATUM_MATH_AVX2 std::size_t FindFloatAVX2(const float* values, std::size_t count, float value) {
+			const __m256 target = _mm256_set1_ps(value);
+			std::size_t i = 0;
+			for (; i + 32 <= count; i += 32) {
+				const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(values + i), target, _CMP_EQ_OQ)))
+					| (static_cast<unsigned int>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(values + i + 8), target, _CMP_EQ_OQ))) << 8)
+					| (static_cast<unsigned int>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(values + i + 16), target, _CMP_EQ_OQ))) << 16)
+					| (static_cast<unsigned int>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(values + i + 24), target, _CMP_EQ_OQ))) << 24);
+				if (mask != 0) return i + LowestSetBit(mask);
+			}
+			return i + FindFloatSSE2(values + i, count - i, value);
+		}
+
+		DATUM_MATH_AVX2 std::size_t FindVectorAVX2(const glm::vec4* values, std::size_t count, const glm::vec4& value) {
+			const __m256 target = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&value));
+			const float* in = reinterpret_cast<const float*>(values);
+			std::size_t i = 0;
+			for (; i + 8 <= count; i += 8, in += 32) {
+				const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(in), target, _CMP_EQ_OQ)))
+					| (static_cast<unsigned int>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(in + 8), target, _CMP_EQ_OQ))) << 8)
+					| (static_cast<unsigned int>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(in + 16), target, _CMP_EQ_OQ))) << 16)
+					| (static_cast<unsigned int>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(in + 24), target, _CMP_EQ_OQ))) << 24);
+				const std::size_t found = FirstFullNibble(mask);
+				if (found < 8) return i + found;
+			}
+			return i + FindVectorSSE2(values + i, count - i, value);
+		}
+
+		DATUM_MATH_AVX2 std::size_t FindAddressAVX2(const std::uintptr_t* values, std::size_t count, std::uintptr_t value) {
+			if constexpr (sizeof(std::uintptr_t) == sizeof(std::int32_t)) {
+				return FindIntegerAVX2(reinterpret_cast<const std::int32_t*>(values), count, static_cast<std::int32_t>(value));
+			}
+			else {
+				const __m256i target = _mm256_set1_epi64x(static_cast<long long>(value));
+				const __m256i* in = reinterpret_cast<const __m256i*>(values);
+				std::size_t i = 0;
+				for (; i + 16 <= count; i += 16, in += 4) {
+					const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_loadu_si256(in), target))))
+						| (static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_loadu_si256(in + 1), target)))) << 4)
+						| (static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_loadu_si256(in + 2), target)))) << 8)
+						| (static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_loadu_si256(in + 3), target)))) << 12);
+					if (mask != 0) return i + LowestSetBit(mask);
+				}
+				return i + FindAddressSSE2(values + i, count - i, value);
+			}
+		}
+
+		constexpr Kernels AVX2Kernels{ TransformAVX2, AddAVX2, ScaleAVX2, LerpAVX2, MinAVX2, MaxAVX2,
+			FindIntegerAVX2, FindFloatAVX2, FindVectorAVX2, FindAddressAVX2 };
+#pragma endregion AVX2
+#endif // DATUM_MATH_X86
+
+#pragma region Dispatch
+		/// <summary>
+		/// Ask the processor and operating system whether AVX2 and FMA instructions can run.
+		/// </summary>
+		/// <returns>A boolean indicating whether the AVX2 kernels can run</returns>
+		bool DetectAVX2() {
+#if defined(DATUM_MATH_X86) && defined(_MSC_VER)
+			int info[4];
+			__cpuid(info, 0);
+			if (info[0] < 7) return false;
+			__cpuid(info, 1);
+			const bool hasFMA = (info[2] & (1 << 12)) != 0;
+			const bool hasOSXSAVE = (info[2] & (1 << 27)) != 0;
+			const bool hasAVX = (info[2] & (1 << 28)) != 0;
+			//The operating system must also save the upper halves of the registers on a context switch
+			if (!hasFMA || !hasOSXSAVE || !hasAVX || (_xgetbv(0) & 0x6) != 0x6) return false;
+			__cpuidex(info, 7, 0);
+			return (info[1] & (1 << 5)) != 0;
+#elif defined(DATUM_MATH_X86)
+			return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+			return false;
+#endif
+		}
+
+		/// <summary>
+		/// Retrieve whether the AVX2 kernels can run, asking the processor only once.
+		/// </summary>
+		/// <returns>A boolean indicating whether the AVX2 kernels can run</returns>
+		bool HasAVX2() {
+			static const bool hasAVX2 = DetectAVX2();
+			return hasAVX2;
+		}
+
+		/// <summary>
+		/// Retrieve the best instruction set at or below the given one that this processor supports.
+		/// </summary>
+		/// <param name="instructionSet">The instruction set to start from</param>
+		/// <returns>The best supported instruction set no better than the one given</returns>
+		InstructionSet BestSupported(InstructionSet instructionSet = InstructionSet::AVX2) {
+			while (!IsSupported(instructionSet)) {
+				instructionSet = static_cast<InstructionSet>(static_cast<std::uint8_t>(instructionSet) - 1);
+			}
+			return instructionSet;
+		}
+
+		/// <summary>
+		/// Retrieve the instruction set the kernels run with, choosing the best supported one the first time.
+		/// </summary>
+		/// <returns>A reference to the active instruction set</returns>
+		std::atomic<InstructionSet>& ActiveSet() {
+			static std::atomic<InstructionSet> activeSet{ BestSupported() };
+			return activeSet;
+		}
+
+		/// <summary>
+		/// Retrieve the kernels for the active instruction set.
+		/// </summary>
+		/// <returns>A reference to the active kernels</returns>
+		const Kernels& ActiveKernels() {
+#ifdef DATUM_MATH_X86
+			switch (ActiveSet().load(std::memory_order_relaxed)) {
+			case InstructionSet::AVX2:
+				return AVX2Kernels;
+			case InstructionSet::SSE2:
+				return SSE2Kernels;
+			default:
+				return ScalarKernels;
+			}
+#else
+			return ScalarKernels;
+#endif // DATUM_MATH_X86
+		}
+#pragma endregion Dispatch
+
+#pragma region Checks
+		/// <summary>
+		/// Retrieve the number of floats each value of a Datum is made of, or zero if the Datum's type is not made of floats.
+		/// </summary>
+		/// <param name="type">The type of the Datum</param>
+		/// <returns>The number of floats per value</returns>
+		std::size_t ComponentsPerValue(Datum::DatumTypes type) {
+			switch (type) {
+			case Datum::DatumTypes::Float:
+				return 1;
+			case Datum::DatumTypes::Vector:
+				return 4;
+			case Datum::DatumTypes::Matrix:
+				return 16;
+			default:
+				return 0;
+			}
+		}
+
+		/// <summary>
+		/// Check that a Datum is of the given type.
+		/// </summary>
+		/// <param name="datum">The Datum to check</param>
+		/// <param name="type">The type it must be</param>
+		void TypeChecker(const Datum& datum, Datum::DatumTypes type) {
+#ifdef USE_EXCEPTIONS
+			if (datum.Type() != type) throw std::runtime_error("Datum is not of the type this operation works on.");
+#endif // USE_EXCEPTIONS
+			UNREFERENCED_LOCAL(datum);
+			UNREFERENCED_LOCAL(type);
+		}
+
+		/// <summary>
+		/// Check that two Datums are of the same type, made of floats, and of the same size.
+		/// </summary>
+		/// <param name="lhs">The first Datum</param>
+		/// <param name="rhs">The second Datum</param>
+		/// <returns>The total number of floats in either Datum, or zero if the check fails without exceptions</returns>
+		std::size_t PairChecker(const Datum& lhs, const Datum& rhs) {
+			const std::size_t componentsPerValue = ComponentsPerValue(lhs.Type());
+#ifdef USE_EXCEPTIONS
+			if (componentsPerValue == 0) throw std::runtime_error("Datum is not a Float, Vector, or Matrix Datum.");
+			if (lhs.Type() != rhs.Type()) throw std::runtime_error("Datums are not of the same type.");
+			if (lhs.Size() != rhs.Size()) throw std::runtime_error("Datums are not of the same size.");
+#endif // USE_EXCEPTIONS
+			if (lhs.Type() != rhs.Type() || lhs.Size() != rhs.Size()) return 0;
+			return componentsPerValue * lhs.Size();
+		}
+
+		/// <summary>
+		/// Retrieve the first float of a Datum made of floats.
+		/// </summary>
+		/// <param name="datum">A Float, Vector, or Matrix Datum</param>
+		/// <returns>A pointer to the first float</returns>
+		const float* Components(const Datum& datum) {
+			switch (datum.Type()) {
+			case Datum::DatumTypes::Vector:
+				return reinterpret_cast<const float*>(datum.AsSpan<glm::vec4>().data());
+			case Datum::DatumTypes::Matrix:
+				return reinterpret_cast<const float*>(datum.AsSpan<glm::mat4>().data());
+			default:
+				return datum.AsSpan<float>().data();
+			}
+		}
+
+		/// <summary>
+		/// Retrieve the first float of a Datum made of floats.
+		/// </summary>
+		/// <param name="datum">A Float, Vector, or Matrix Datum</param>
+		/// <returns>A pointer to the first float</returns>
+		float* Components(Datum& datum) {
+			return const_cast<float*>(Components(std::as_const(datum)));
+		}
+#pragma endregion Checks
+	}
+
+	bool IsSupported(InstructionSet instructionSet) {
+		switch (instructionSet) {
+		case InstructionSet::Scalar:
+			return true;
+#ifdef DATUM_MATH_X86
+		case InstructionSet::SSE2:
+			return true;
+		case InstructionSet::AVX2:
+			return HasAVX2();
+#endif // DATUM_MATH_X86
+		default:
+			return false;
+		}
+	}
+
+	InstructionSet ActiveInstructionSet() {
+		return ActiveSet().load(std::memory_order_relaxed);
+	}
+
+	InstructionSet SetInstructionSet(InstructionSet instructionSet) {
+		return ActiveSet().exchange(BestSupported(instructionSet), std::memory_order_relaxed);
+	}
+
+	void Transform(Datum& vectors, const glm::mat4& matrix) {
+		TypeChecker(vectors, Datum::DatumTypes::Vector);
+		if (vectors.IsEmpty()) return;
+
+		gsl::span<glm::vec4> values = vectors.AsSpan<glm::vec4>();
+		ActiveKernels().Transform(matrix, values.data(), values.data(), values.size());
+	}
+
+	void Multiply(const glm::mat4& lhs, Datum& matrices) {
+		TypeChecker(matrices, Datum::DatumTypes::Matrix);
+		if (matrices.IsEmpty()) return;
+
+		//Column j of lhs * rhs is lhs * (column j of rhs), so a batch of matrices is a batch of four times as many vectors
+		gsl::span<glm::mat4> values = matrices.AsSpan<glm::mat4>();
+		glm::vec4* columns = reinterpret_cast<glm::vec4*>(values.data());
+		ActiveKernels().Transform(lhs, columns, columns, values.size() * 4);
+	}
+
+	void Multiply(const Datum& lhs, const Datum& rhs, Datum& result) {
+		TypeChecker(lhs, Datum::DatumTypes::Matrix);
+		TypeChecker(rhs, Datum::DatumTypes::Matrix);
+#ifdef USE_EXCEPTIONS
+		if (lhs.Size() != rhs.Size()) throw std::runtime_error("Datums are not of the same size.");
+		if (result.IsExternal() && result.Size() != lhs.Size()) throw std::runtime_error("External result Datum is not of the same size as the operands.");
+#endif // USE_EXCEPTIONS
+		if (lhs.Size() != rhs.Size()) return;
+		if (!result.IsExternal()) result.Resize(lhs.Size(), glm::mat4(1.0f));
+		TypeChecker(result, Datum::DatumTypes::Matrix);
+		if (lhs.IsEmpty()) return;
+
+		const Kernels& kernels = ActiveKernels();
+		gsl::span<const glm::mat4> lhsValues = lhs.AsSpan<glm::mat4>();
+		gsl::span<const glm::mat4> rhsValues = rhs.AsSpan<glm::mat4>();
+		gsl::span<glm::mat4> resultValues = result.AsSpan<glm::mat4>();
+		for (std::size_t i = 0; i < lhsValues.size(); ++i) {
+			kernels.Transform(lhsValues[i], reinterpret_cast<const glm::vec4*>(&rhsValues[i]), reinterpret_cast<glm::vec4*>(&resultValues[i]), 4);
+		}
+	}
+
+	void Add(Datum& values, const Datum& addends) {
+		const std::size_t count = PairChecker(values, addends);
+		if (count == 0) return;
+		ActiveKernels().Add(Components(values), Components(addends), count);
+	}
+
+	void Scale(Datum& values, float scale) {
+		const std::size_t count = ComponentsPerValue(values.Type()) * values.Size();
+#ifdef USE_EXCEPTIONS
+		if (ComponentsPerValue(values.Type()) == 0 && values.Type() != Datum::DatumTypes::Unknown) throw std::runtime_error("Datum is not a Float, Vector, or Matrix Datum.");
+#endif // USE_EXCEPTIONS
+		if (count == 0) return;
+		ActiveKernels().Scale(Components(values), scale, count);
+	}
+
+	void Lerp(Datum& values, const Datum& targets, float t) {
+		const std::size_t count = PairChecker(values, targets);
+		if (count == 0) return;
+		ActiveKernels().Lerp(Components(values), Components(targets), t, count);
+	}
+
+	glm::vec4 Min(const Datum& vectors) {
+		TypeChecker(vectors, Datum::DatumTypes::Vector);
+#ifdef USE_EXCEPTIONS
+		if (vectors.IsEmpty()) throw std::runtime_error("Datum is empty.");
+#endif // USE_EXCEPTIONS
+		if (vectors.IsEmpty()) return glm::vec4();
+
+		gsl::span<const glm::vec4> values = vectors.AsSpan<glm::vec4>();
+		return ActiveKernels().Min(values.data(), values.size());
+	}
+
+	glm::vec4 Max(const Datum& vectors) {
+		TypeChecker(vectors, Datum::DatumTypes::Vector);
+#ifdef USE_EXCEPTIONS
+		if (vectors.IsEmpty()) throw std::runtime_error("Datum is empty.");
+#endif // USE_EXCEPTIONS
+		if (vectors.IsEmpty()) return glm::vec4();
+
+		gsl::span<const glm::vec4> values = vectors.AsSpan<glm::vec4>();
+		return ActiveKernels().Max(values.data(), values.size());
+	}
+
+	std::size_t Find(gsl::span<const std::int32_t> values, std::int32_t value) {
+		return ActiveKernels().FindInteger(values.data(), values.size(), value);
+	}
+
+	std::size_t Find(gsl::span<const float> values, float value) {
+		return ActiveKernels().FindFloat(values.data(), values.size(), value);
+	}
+
+	std::size_t Find(gsl::span<const glm::vec4> values, const glm::vec4& value) {
+		return ActiveKernels().FindVector(values.data(), values.size(), value);
+	}
+
+	std::size_t FindAddress(gsl::span<const void* const> addresses, const void* address) {
+		//Pointers and uintptr_t share a representation on every platform the engine builds for
+		return ActiveKernels().FindAddress(reinterpret_cast<const std::uintptr_t*>(addresses.data()), addresses.size(), reinterpret_cast<std::uintptr_t>(address));
+	}
+}
@@ -0,0 +1,131 @@
+/// <summary>
+/// The declaration of the DatumMath functions, batch math and search kernels that work directly on the storage of Datums.
+/// </summary>
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "glm/glm.hpp"
+#include "Datum.h"
+
+namespace FIEAGameEngine::DatumMath {
+	/// <summary>
+	/// The instruction sets the kernels are written for. Every function picks the best one the processor supports the first time any of them runs.
+	/// Scalar is plain C++ and always available; SSE2 is available on every x86 processor the engine builds for; AVX2 also requires FMA and operating system support for the wider registers.
+	/// </summary>
+	enum class InstructionSet : std::uint8_t {
+		Scalar = 0,
+		SSE2,
+		AVX2
+	};
+
+	/// <summary>
+	/// Determine whether this processor can run the kernels written for an instruction set.
+	/// </summary>
+	/// <param name="instructionSet">The instruction set to check</param>
+	/// <returns>A boolean indicating whether the kernels for the instruction set can run</returns>
+	[[nodiscard]] bool IsSupported(InstructionSet instructionSet);
+	/// <summary>
+	/// Retrieve the instruction set the kernels currently run with.
+	/// </summary>
+	/// <returns>The active instruction set</returns>
+	[[nodiscard]] InstructionSet ActiveInstructionSet();
+	/// <summary>
+	/// Run the kernels with the given instruction set instead of the best supported one, to compare them or to rule one out. Not meant to be called while kernels run on other threads.
+	/// </summary>
+	/// <param name="instructionSet">The instruction set to use. An unsupported set falls back to the best supported one below it.</param>
+	/// <returns>The instruction set that was active before</returns>
+	InstructionSet SetInstructionSet(InstructionSet instructionSet);
+
+	/// <summary>
+	/// Transform every vector of a Vector Datum by a matrix, in place.
+	/// </summary>
+	/// <param name="vectors">A Vector Datum, which may be external</param>
+	/// <param name="matrix">The matrix to multiply each vector by, on the left</param>
+	/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Datum is not a Vector Datum</exception>
+	void Transform(Datum& vectors, const glm::mat4& matrix);
+	/// <summary>
+	/// Multiply every matrix of a Matrix Datum by a matrix on the left, in place, as when applying a parent transform to many children.
+	/// </summary>
+	/// <param name="lhs">The matrix to multiply by</param>
+	/// <param name="matrices">A Matrix Datum, which may be external</param>
+	/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Datum is not a Matrix Datum</exception>
+	void Multiply(const glm::mat4& lhs, Datum& matrices);
+	/// <summary>
+	/// Multiply two Matrix Datums element by element into a third, which is resized to match unless it is external. The result may be either operand.
+	/// </summary>
+	/// <param name="lhs">The Matrix Datum of left hand matrices</param>
+	/// <param name="rhs">The Matrix Datum of right hand matrices, the same size as lhs</param>
+	/// <param name="result">A Matrix Datum, or a Datum with no type yet, to hold the products</param>
+	/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Datums are not Matrix Datums or their sizes do not match</exception>
+	void Multiply(const Datum& lhs, const Datum& rhs, Datum& result);
+
+	/// <summary>
+	/// Add the values of one Datum to another component by component, in place. Works on Float, Vector, and Matrix Datums.
+	/// </summary>
+	/// <param name="values">The Datum to add to</param>
+	/// <param name="addends">A Datum of the same type and size</param>
+	/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Datums are not of the same supported type and size</exception>
+	void Add(Datum& values, const Datum& addends);
+	/// <summary>
+	/// Multiply every component of a Datum by a scale, in place. Works on Float, Vector, and Matrix Datums.
+	/// </summary>
+	/// <param name="values">The Datum to scale</param>
+	/// <param name="scale">The factor to multiply by</param>
+	/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Datum is not of a supported type</exception>
+	void Scale(Datum& values, float scale);
+	/// <summary>
+	/// Move every component of a Datum the given fraction of the way to the matching component of another, in place, as values + (targets - values) * t.
+	/// Works on Float, Vector, and Matrix Datums.
+	/// </summary>
+	/// <param name="values">The Datum to move</param>
+	/// <param name="targets">A Datum of the same type and size</param>
+	/// <param name="t">The fraction of the way to move, where 0 leaves the values and 1 reaches the targets</param>
+	/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Datums are not of the same supported type and size</exception>
+	void Lerp(Datum& values, const Datum& targets, float t);
+
+	/// <summary>
+	/// Find the smallest value of each component across a Vector Datum.
+	/// </summary>
+	/// <param name="vectors">A non-empty Vector Datum</param>
+	/// <returns>A vector whose every component is the smallest of that component</returns>
+	/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Datum is not a Vector Datum or is empty</exception>
+	[[nodiscard]] glm::vec4 Min(const Datum& vectors);
+	/// <summary>
+	/// Find the largest value of each component across a Vector Datum.
+	/// </summary>
+	/// <param name="vectors">A non-empty Vector Datum</param>
+	/// <returns>A vector whose every component is the largest of that component</returns>
+	/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Datum is not a Vector Datum or is empty</exception>
+	[[nodiscard]] glm::vec4 Max(const Datum& vectors);
+
+	/// <summary>
+	/// Find the first integer equal to a value, comparing several at once.
+	/// </summary>
+	/// <param name="values">The integers to search, such as the span of an Integer Datum</param>
+	/// <param name="value">The integer to look for</param>
+	/// <returns>The index of the first match, or the number of values if there is none</returns>
+	[[nodiscard]] std::size_t Find(gsl::span<const std::int32_t> values, std::int32_t value);
+	/// <summary>
+	/// Find the first float equal to a value, comparing several at once. Equality is that of operator==, so 0.0f matches -0.0f and NaN matches nothing.
+	/// </summary>
+	/// <param name="values">The floats to search, such as the span of a Float Datum</param>
+	/// <param name="value">The float to look for</param>
+	/// <returns>The index of the first match, or the number of values if there is none</returns>
+	[[nodiscard]] std::size_t Find(gsl::span<const float> values, float value);
+	/// <summary>
+	/// Find the first vector whose every component equals that of a value, comparing several at once. Components compare as floats do with operator==.
+	/// </summary>
+	/// <param name="values">The vectors to search, such as the span of a Vector Datum</param>
+	/// <param name="value">The vector to look for</param>
+	/// <returns>The index of the first match, or the number of values if there is none</returns>
+	[[nodiscard]] std::size_t Find(gsl::span<const glm::vec4> values, const glm::vec4& value);
+	/// <summary>
+	/// Find the first pointer to the given address, comparing several at once. Only the addresses are compared; nothing is dereferenced.
+	/// </summary>
+	/// <param name="addresses">The pointers to search, such as the storage of a Table Datum</param>
+	/// <param name="address">The address to look for</param>
+	/// <returns>The index of the first match, or the number of pointers if there is none</returns>
+	[[nodiscard]] std::size_t FindAddress(gsl::span<const void* const> addresses, const void* address);
+}
@@ -8,10 +8,14 @@
 #include <cassert>
 #include <stdlib.h>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include "Hashing.h"
 
 namespace FIEAGameEngine {
 	/// <summary>
-	/// The default implementation of the hash function.
+	/// The default implementation of the hash function. Integral and enum keys are mixed as a single word; any other key is hashed over its object representation with Hashing::HashBytes.
+	/// Specialize this struct (or just its operator()) to hash a type by its value instead of its bytes.
 	/// </summary>
 	/// <typeparam name="T"></typeparam>
 	template <typename TKey>
@@ -24,24 +28,85 @@ namespace FIEAGameEngine {
 		std::size_t operator()(const TKey& key) const;
 	};
 
+	/// <summary>
+	/// Trait detecting whether a hash functor is transparent, meaning it declares is_transparent and can hash lookup types other than its key type (i.e. std::string_view for std::string) to the same value.
+	/// Containers use this to enable heterogeneous lookups that never construct a temporary key.
+	/// </summary>
+	/// <typeparam name="THashFunctor">The hash functor to inspect.</typeparam>
+	template <typename THashFunctor, typename = void>
+	struct IsTransparentHash : std::false_type {};
+
+	template <typename THashFunctor>
+	struct IsTransparentHash<THashFunctor, std::void_t<typename THashFunctor::is_transparent>> : std::true_type {};
+
+	/// <summary>
+	/// Base for hash functor adaptors that declares is_transparent only when the wrapped functor is transparent.
+	/// </summary>
+	template <bool IsTransparent>
+	struct TransparentHashTag {};
+
+	template <>
+	struct TransparentHashTag<true> {
+		/// <summary>
+		/// Marks the adaptor as transparent, forwarding the wrapped functor's transparency.
+		/// </summary>
+		using is_transparent = void;
+	};
+
+	/// <summary>
+	/// Hash functor adaptor that opts a HashMap into storing each entry's full hash code next to it.
+	/// Lookups then skip the key comparison for any entry whose stored hash differs, and growing the HashMap reuses the stored codes instead of hashing every key again.
+	/// </summary>
+	/// <typeparam name="THashFunctor">The hash functor that actually produces the hash values.</typeparam>
+	template <typename THashFunctor>
+	struct StoredHash final : TransparentHashTag<IsTransparentHash<THashFunctor>::value> {
+		/// <summary>
+		/// Hash a key, or any lookup value the wrapped functor accepts, with the wrapped functor.
+		/// </summary>
+		/// <param name="key">The object to hash</param>
+		/// <returns>The hashed value</returns>
+		template <typename TLookup>
+		std::size_t operator()(const TLookup& key) const;
+	};
+
+	/// <summary>
+	/// Trait detecting whether a hash functor is a StoredHash adaptor, meaning containers should store full hash codes alongside their entries.
+	/// </summary>
+	/// <typeparam name="THashFunctor">The hash functor to inspect.</typeparam>
+	template <typename THashFunctor>
+	struct IsStoredHash : std::false_type {};
+
+	template <typename THashFunctor>
+	struct IsStoredHash<StoredHash<THashFunctor>> : std::true_type {};
+
 	template<>
 	struct DefaultHash<std::string> final {
 		/// <summary>
-		/// Template for a functor that produces a hash value from an input of strings.
+		/// Marks this functor as transparent, so that string keyed containers can be searched with std::string_view and const char* keys.
+		/// </summary>
+		using is_transparent = void;
+
+		/// <summary>
+		/// Template for a functor that produces a hash value from an input of strings. Strings, string views, and C strings with the same characters hash to the same value.
 		/// </summary>
 		/// <param name="lhs">The object to hash</param>
 		/// <returns>The hashed value</returns>
-		std::size_t operator()(const std::string& key) const;
+		std::size_t operator()(std::string_view key) const;
 	};
 
 	template<>
 	struct DefaultHash<const std::string> final {
 		/// <summary>
-		/// Template for a functor that produces a hash value from an input of const strings
+		/// Marks this functor as transparent, so that string keyed containers can be searched with std::string_view and const char* keys.
+		/// </summary>
+		using is_transparent = void;
+
+		/// <summary>
+		/// Template for a functor that produces a hash value from an input of const strings. Strings, string views, and C strings with the same characters hash to the same value.
 		/// </summary>
 		/// <param name="lhs">The object to hash</param>
 		/// <returns>The hashed value</returns>
-		std::size_t operator()(const std::string& key) const;
+		std::size_t operator()(std::string_view key) const;
 	};
 
 	template<>
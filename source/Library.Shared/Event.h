@@ -3,6 +3,8 @@
 #include <stdexcept>
 #include "EventPublisher.h"
 #include "HashMap.h"
+#include "SmallVector.h"
+#include "IntrusiveDList.h"
 
 namespace FIEAGameEngine {
 	/// <summary>
@@ -47,6 +49,10 @@ namespace FIEAGameEngine {
 	struct Delegate final {
 		using SubscriberFunctor = std::function<void(EventPublisher&)>;
 		SubscriberFunctor subscriber;
+		/// <summary>
+		/// The hook linking this delegate into the subscribers of one event type, when it is subscribed through Event::Link rather than Event::Subscribe.
+		/// </summary>
+		IntrusiveDListHook link;
 	};
 
 	template <typename T>
@@ -112,6 +118,19 @@ namespace FIEAGameEngine {
 		/// <param name="subscriber">The functor to remove</param>
 		static void Unsubscribe(Delegate& subscriber);
 		/// <summary>
+		/// Link a delegate into the subscribers for this event type through the hook inside it, in constant time and without allocating.
+		/// A linked delegate is subscribed at most once, is notified after the subscribers added with Subscribe, and must be unlinked before it is destroyed.
+		/// Linking it during a delivery takes effect from the next delivery.
+		/// </summary>
+		/// <param name="subscriber">The delegate to link. Linking a delegate already linked to this event type does nothing.</param>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the delegate is linked to another event type</exception>
+		static void Link(Delegate& subscriber);
+		/// <summary>
+		/// Unlink a delegate from the subscribers for this event type in constant time, without searching for it. Unlinking it during a delivery takes effect immediately.
+		/// </summary>
+		/// <param name="subscriber">The delegate to unlink. Unlinking a delegate that is not linked to this event type does nothing.</param>
+		static void Unlink(Delegate& subscriber);
+		/// <summary>
 		/// Remove all subscribers from this event type.
 		/// </summary>
 		static void RequestClearSubscribers();
@@ -131,13 +150,25 @@ namespace FIEAGameEngine {
 		/// </summary>
 		inline static Vector<const Delegate*> _subscribers = Vector<const Delegate*>();
 		/// <summary>
-		/// List of subscribers that are pending add to the subscribers list.
+		/// List of subscribers that are pending add to the subscribers list. Usually empty or nearly so, so it is kept inline.
+		/// </summary>
+		inline static SmallVector<const Delegate*, 4> _pendingAddList = SmallVector<const Delegate*, 4>();
+		/// <summary>
+		/// List of subscribers that are pending remove from the subscribers list. Usually empty or nearly so, so it is kept inline.
+		/// </summary>
+		inline static SmallVector<const Delegate*, 4> _pendingRemoveList = SmallVector<const Delegate*, 4>();
+		/// <summary>
+		/// The subscribers linked through their own hooks, static to this class.
+		/// </summary>
+		inline static IntrusiveDList<Delegate, &Delegate::link> _linkedSubscribers;
+		/// <summary>
+		/// The linked subscriber a delivery notifies next, kept up to date when subscribers are unlinked mid delivery.
 		/// </summary>
-		inline static Vector<const Delegate*> _pendingAddList = Vector<const Delegate*>();
+		inline static Delegate* _nextLinked = nullptr;
 		/// <summary>
-		/// List of subscribers that are pending remove from the subscribers list.
+		/// The last linked subscriber a delivery notifies, so subscribers linked mid delivery wait for the next one.
 		/// </summary>
-		inline static Vector<const Delegate*> _pendingRemoveList = Vector<const Delegate*>();
+		inline static Delegate* _lastLinked = nullptr;
 		/// <summary>
 		/// boolean flag for if the event is in the middle of delivering itself to subscribers.
 		/// </summary>
@@ -18,7 +18,7 @@ namespace FIEAGameEngine {
 	 
 	template<typename T>
 	inline std::string Event<T>::ToString() const {
-		return "Event with " + std::to_string(Event<T>::_subscribers.Size()) + " subscribers."s;
+		return "Event with " + std::to_string(Event<T>::_subscribers.Size() + Event<T>::_linkedSubscribers.Size()) + " subscribers."s;
 	}
 
 	template<typename T>
@@ -31,6 +31,17 @@ namespace FIEAGameEngine {
 			if(subscriber && subscriber->subscriber) subscriber->subscriber(*this);
 		}
 
+		if (!_linkedSubscribers.IsEmpty()) {
+			_nextLinked = &_linkedSubscribers.Front();
+			_lastLinked = &_linkedSubscribers.Back();
+			while (_nextLinked != nullptr) {
+				Delegate* subscriber = _nextLinked;
+				_nextLinked = subscriber == _lastLinked ? nullptr : _linkedSubscribers.Next(*subscriber);
+				if (subscriber->subscriber) subscriber->subscriber(*this);
+			}
+			_lastLinked = nullptr;
+		}
+
 		_isDelivering = false;
 	}
 
@@ -51,6 +62,20 @@ namespace FIEAGameEngine {
 		else Event<T>::_pendingRemoveList.PushBack(&subscriber);
 	}
 	
+	template<typename T>
+	inline void Event<T>::Link(Delegate& subscriber) {
+		if (!_linkedSubscribers.Contains(subscriber)) _linkedSubscribers.PushBack(subscriber);
+	}
+
+	template<typename T>
+	inline void Event<T>::Unlink(Delegate& subscriber) {
+		if (!_linkedSubscribers.Contains(subscriber)) return;
+
+		if (&subscriber == _nextLinked) _nextLinked = &subscriber == _lastLinked ? nullptr : _linkedSubscribers.Next(subscriber);
+		if (&subscriber == _lastLinked) _lastLinked = _linkedSubscribers.Previous(subscriber);
+		_linkedSubscribers.Remove(subscriber);
+	}
+
 	template<typename T>
 	inline void Event<T>::ClearSubscribers() {
 		Event<T>::_subscribers.Clear();
@@ -59,6 +84,7 @@ namespace FIEAGameEngine {
 		Event<T>::_pendingAddList.ShrinkToFit();
 		Event<T>::_pendingRemoveList.Clear();
 		Event<T>::_pendingRemoveList.ShrinkToFit();
+		Event<T>::_linkedSubscribers.Clear();
 	}
 	
 	template<typename T>
@@ -70,17 +96,19 @@ namespace FIEAGameEngine {
 	template<typename T>
 	inline void Event<T>::HandlePendingEntries() {
 		if (_flagForClear) ClearSubscribers();
-		else {
-			for (auto& item : _pendingRemoveList) {
-				Event<T>::_subscribers.Remove(item);
-			}
+		else if (!_pendingRemoveList.IsEmpty()) {
+			Event<T>::_subscribers.RemoveIf([](const Delegate* subscriber) {
+				auto found = std::find(_pendingRemoveList.begin(), _pendingRemoveList.end(), subscriber);
+				if (found == _pendingRemoveList.end()) return false;
+				*found = _pendingRemoveList.Back();
+				_pendingRemoveList.PopBack();
+				return true;
+			});
 		}
 		_pendingRemoveList.Clear();
 		_flagForClear = false;
 
-		for (auto& item : _pendingAddList) {
-			_subscribers.PushBack(item);
-		}
+		_subscribers.Append(_pendingAddList);
 		_pendingAddList.Clear();
 	}
 }
\ No newline at end of file
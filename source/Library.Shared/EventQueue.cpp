@@ -2,11 +2,46 @@
 #include "EventQueue.h"
 
 namespace FIEAGameEngine {
+	EventQueue::EventQueue(const EventQueue& rhs) :
+		_queue{ rhs._queue }, _pendingAddQueue{ rhs._pendingAddQueue }, _pendingRemoveQueue{ rhs._pendingRemoveQueue }, _isUpdating{ rhs._isUpdating }, _flagForClear{ rhs._flagForClear }
+	{
+	}
+
+	EventQueue::EventQueue(EventQueue&& rhs) noexcept :
+		_queue{ std::move(rhs._queue) }, _pendingAddQueue{ std::move(rhs._pendingAddQueue) }, _pendingRemoveQueue{ std::move(rhs._pendingRemoveQueue) }, _isUpdating{ rhs._isUpdating }, _flagForClear{ rhs._flagForClear }
+	{
+		_incomingQueue.Swap(rhs._incomingQueue);
+	}
+
+	EventQueue& EventQueue::operator=(const EventQueue& rhs) {
+		if (this != &rhs) {
+			_queue = rhs._queue;
+			_pendingAddQueue = rhs._pendingAddQueue;
+			_pendingRemoveQueue = rhs._pendingRemoveQueue;
+			_isUpdating = rhs._isUpdating;
+			_flagForClear = rhs._flagForClear;
+		}
+		return *this;
+	}
+
+	EventQueue& EventQueue::operator=(EventQueue&& rhs) noexcept {
+		if (this != &rhs) {
+			_queue = std::move(rhs._queue);
+			_pendingAddQueue = std::move(rhs._pendingAddQueue);
+			_pendingRemoveQueue = std::move(rhs._pendingRemoveQueue);
+			_incomingQueue.Swap(rhs._incomingQueue);
+			_isUpdating = rhs._isUpdating;
+			_flagForClear = rhs._flagForClear;
+		}
+		return *this;
+	}
+
 	void EventQueue::Update(const GameTime& gameTime) {
 		if (_isUpdating) return;
 		_isUpdating = true;
 
 		HandlePendingEntries();
+		DrainIncomingEntries(gameTime);
 
 		auto iter = std::partition(_queue.begin(), _queue.end(), [&gameTime](QueueEntry entry) {return !entry.IsExpired(gameTime); });
 		for (auto iterCopy = iter; iterCopy != _queue.end(); ++iterCopy) {
@@ -21,11 +56,15 @@ namespace FIEAGameEngine {
 		else _pendingAddQueue.PushBack({ event, gameTime.CurrentTime() + delay});
 	}
 
+	void EventQueue::EnqueueFromAnyThread(std::shared_ptr<EventPublisher> event, std::chrono::milliseconds delay) {
+		_incomingQueue.Emplace(IncomingEntry{ std::move(event), delay });
+	}
+
 	void EventQueue::Dequeue(std::shared_ptr<EventPublisher> _event) {
 		for (auto iter = _queue.begin(); iter != _queue.end(); ++iter) {
 			if ((*iter).event == _event) {
 				if (!_isUpdating) _queue.Remove(iter);
-				else _pendingRemoveQueue.PushBack(iter);
+				else _pendingRemoveQueue.PushBack(_event.get());
 				break;
 			}
 		}		
@@ -39,23 +78,32 @@ namespace FIEAGameEngine {
 			_pendingAddQueue.ShrinkToFit();
 			_pendingRemoveQueue.Clear();
 			_pendingRemoveQueue.ShrinkToFit();
+			_incomingQueue.Drain([](IncomingEntry&&) {});
 		}
 		else _flagForClear = true;
 	}
 	
 	void EventQueue::HandlePendingEntries() {
 		if (_flagForClear) _queue.Clear();
-		else {
-			for (auto& item : _pendingRemoveQueue) {
-				_queue.Remove(item);
-			}
+		else if (!_pendingRemoveQueue.IsEmpty()) {
+			_queue.RemoveIf([this](const QueueEntry& entry) {
+				auto found = std::find(_pendingRemoveQueue.begin(), _pendingRemoveQueue.end(), entry.event.get());
+				if (found == _pendingRemoveQueue.end()) return false;
+				*found = _pendingRemoveQueue.Back();
+				_pendingRemoveQueue.PopBack();
+				return true;
+			});
 		}
 		_pendingRemoveQueue.Clear();
 		_flagForClear = false;
 
-		for (auto& item : _pendingAddQueue) { 
-			_queue.PushBack(std::move(item));
-		}
+		_queue.Append(std::move(_pendingAddQueue));
 		_pendingAddQueue.Clear();
 	}
+
+	void EventQueue::DrainIncomingEntries(const GameTime& gameTime) {
+		_incomingQueue.Drain([this, &gameTime](IncomingEntry&& entry) {
+			_queue.PushBack({ std::move(entry.event), gameTime.CurrentTime() + entry.delay });
+		});
+	}
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <functional>
 #include "EventPublisher.h"
 #include "GameTime.h"
+#include "MpscQueue.h"
 
 namespace FIEAGameEngine {
 	class EventQueue final {
@@ -30,40 +31,55 @@ namespace FIEAGameEngine {
 			};
 		};
 
+		/// <summary>
+		/// struct for an event submitted from another thread, which has no game time to measure its delay from until the queue drains it.
+		/// </summary>
+		struct IncomingEntry {
+			/// <summary>
+			/// The event itself.
+			/// </summary>
+			std::shared_ptr<EventPublisher> event;
+			/// <summary>
+			/// The delay from the update that drains this entry to when the event should be delivered.
+			/// </summary>
+			std::chrono::milliseconds delay;
+		};
+
 	public:
 		/// <summary>
 		/// Default constructor for a EventQueue.
 		/// </summary>
 		EventQueue() = default;
 		/// <summary>
-		/// A copy constructor for a EventQueue that performs a deep copy during construction.
+		/// A copy constructor for a EventQueue that performs a deep copy during construction. Events submitted with EnqueueFromAnyThread and not yet drained by an Update are not copied: they stay with the original and are only delivered by it.
 		/// </summary>
 		/// <param name="other">The EventQueue to copy</param>
-		EventQueue(const EventQueue& rhs) = default;
+		EventQueue(const EventQueue& rhs);
 		/// <summary>
-		/// The move constructor for EventQueue.
+		/// The move constructor for EventQueue. No other thread may be submitting events to either queue.
 		/// </summary>
 		/// <param name="rhs">The EventQueue to move data from</param>
-		EventQueue(EventQueue&& rhs) noexcept = default;
+		EventQueue(EventQueue&& rhs) noexcept;
 		/// <summary>
-		/// The copy assignment operator for an EventQueue that first clears the existing elements and then performs a deep copy.
+		/// The copy assignment operator for an EventQueue that first clears the existing elements and then performs a deep copy. Events submitted with EnqueueFromAnyThread and not yet drained by an Update are not copied: each queue keeps its own.
 		/// </summary>
 		/// <param name="rhs">The EventQueue to copy</param>
 		/// <returns>A reference to the updated EventQueue</returns>
-		EventQueue& operator=(const EventQueue& rhs) = default;
+		EventQueue& operator=(const EventQueue& rhs);
 		/// <summary>
-		/// The move assignment operator for a EventQueue that first clears the existing elements and then performs a move assignment.
+		/// The move assignment operator for a EventQueue that replaces its queued and pending events with those of the given queue. Events submitted with EnqueueFromAnyThread and not yet drained are exchanged,
+		/// so this queue's undrained events are left with the given one. No other thread may be submitting events to either queue.
 		/// </summary>
-		/// <param name="rhs">The EventQueue to copy</param>
+		/// <param name="rhs">The EventQueue to move data from</param>
 		/// <returns>A reference to the updated EventQueue</returns>
-		EventQueue& operator=(EventQueue&& rhs) noexcept = default;
+		EventQueue& operator=(EventQueue&& rhs) noexcept;
 		/// <summary>
 		/// The destructor for a EventQueue.
 		/// </summary>
 		~EventQueue() = default;
 
 		/// <summary>
-		/// Run through all queued events and deliver those that have expired.
+		/// Run through all queued events and deliver those that have expired. Events submitted from other threads are drained into the queue first.
 		/// </summary>
 		void Update(const GameTime& gameTime);
 		/// <summary>
@@ -73,12 +89,18 @@ namespace FIEAGameEngine {
 		/// <param name="delay">The delay in milliseconds from now for when this event should be delivered</param>
 		void Enqueue(std::shared_ptr<EventPublisher> event, const GameTime& gameTime, std::chrono::milliseconds delay = std::chrono::milliseconds(0));
 		/// <summary>
+		/// Enqueue a new event from any thread, without locking. The event joins the queue at the start of the next Update, and its delay counts from that update's game time.
+		/// </summary>
+		/// <param name="event">The event to enqueue</param>
+		/// <param name="delay">The delay in milliseconds from the draining update for when this event should be delivered</param>
+		void EnqueueFromAnyThread(std::shared_ptr<EventPublisher> event, std::chrono::milliseconds delay = std::chrono::milliseconds(0));
+		/// <summary>
 		/// Dequeue a currently queued event - no effect if the specified event is not in the queue.
 		/// </summary>
 		/// <param name="event">The event to dequeue.</param>
 		void Dequeue(std::shared_ptr<EventPublisher> event);
 		/// <summary>
-		/// Clear all queues, including pending ones.
+		/// Clear all queues, including pending ones and events submitted from other threads that have not been drained yet.
 		/// </summary>
 		void Clear();
 		/// <summary>
@@ -97,6 +119,11 @@ namespace FIEAGameEngine {
 		/// Helper function to process pending adds or removals from the queue.
 		/// </summary>
 		void HandlePendingEntries();
+		/// <summary>
+		/// Helper function to move events submitted from other threads into the queue.
+		/// </summary>
+		/// <param name="gameTime">The current game time, which their delays count from</param>
+		void DrainIncomingEntries(const GameTime& gameTime);
 
 		/// <summary>
 		/// The event queue.
@@ -107,9 +134,13 @@ namespace FIEAGameEngine {
 		/// </summary>
 		Vector<QueueEntry> _pendingAddQueue;
 		/// <summary>
-		/// A list of events pending removal from the event queue.
+		/// A list of events pending removal from the event queue. Events are identified by their publisher, since positions in the queue shift while it updates.
+		/// </summary>
+		Vector<const EventPublisher*> _pendingRemoveQueue;
+		/// <summary>
+		/// Events submitted from other threads, waiting for the next update to drain them.
 		/// </summary>
-		Vector<Vector<QueueEntry>::Iterator> _pendingRemoveQueue;
+		MpscQueue<IncomingEntry> _incomingQueue;
 		/// <summary>
 		/// A flag for if the event queue is actively processing events.
 		/// </summary>
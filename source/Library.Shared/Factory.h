@@ -6,8 +6,17 @@
 
 #include <cstddef>
 #include <cassert>
+#include <atomic>
+#include <string>
+#include <string_view>
 #include "RTTI.h"
-#include "HashMap.h"
+#ifdef USE_THREAD_SAFE_REGISTRIES
+#include <shared_mutex>
+#include "ConcurrentHashMap.h"
+#else
+#include "FlatHashMap.h"
+#endif // USE_THREAD_SAFE_REGISTRIES
+#include "FrozenHashMap.h"
 
 namespace FIEAGameEngine {
 	template <typename ProductType>
@@ -50,13 +59,13 @@ namespace FIEAGameEngine {
 		/// </summary>
 		/// <param name="className">The class name to look for a factory for.</param>
 		/// <returns>A pointer to the found factory, or nullptr if one doesn't exist.</returns>
-		static const Factory<ProductType>* Find(const std::string& className);
+		static const Factory<ProductType>* Find(std::string_view className);
 		/// <summary>
 		/// Convenience function to create an object from the static scope based on the given name.
 		/// </summary>
 		/// <param name="className">The name of the class to create.</param>
 		/// <returns>A gsl owner with a pointer to the created object.</returns>
-		static gsl::owner<ProductType*> Create(const std::string& className); 
+		static gsl::owner<ProductType*> Create(std::string_view className); 
 
 		/// <summary>
 		/// Create an object from this concrete factory.
@@ -74,6 +83,13 @@ namespace FIEAGameEngine {
 		/// </summary>
 		/// <returns>The number of registered factories.</returns>
 		static std::size_t Size();
+#ifdef USE_HASHMAP_STATISTICS
+		/// <summary>
+		/// Get the statistics of the map the registered factories are looked up in.
+		/// </summary>
+		/// <returns>A snapshot of the factory lookup's statistics.</returns>
+		static HashMapStatistics GetStatistics();
+#endif // USE_HASHMAP_STATISTICS
 		/// <summary>
 		/// Add a new factory to the factory "manager" - will not add something that has already been added.
 		/// </summary>
@@ -83,17 +99,58 @@ namespace FIEAGameEngine {
 		/// Given a class name, remove that factory from this factory "manager"
 		/// </summary>
 		/// <param name="className">The name of the class associated with the factory you want to remove.</param>
-		static void Remove(const std::string& className);
+		static void Remove(std::string_view className);
 		/// <summary>
 		/// Clear all registered factories from the base "manager".
 		/// </summary>
 		static void Clear();
+		/// <summary>
+		/// Build a perfect hash over the factories registered so far, and answer every Find and Create from it until the next Add, Remove, or Clear.
+		/// With USE_THREAD_SAFE_REGISTRIES defined, Freeze, Add, Remove, and Clear are serialized, and lookups never see the table while it is being swapped.
+		/// </summary>
+		static void Freeze();
+		/// <summary>
+		/// Check whether lookups are currently answered from the table built by Freeze.
+		/// </summary>
+		/// <returns>A boolean indicating if the factory "manager" is frozen.</returns>
+		[[nodiscard]] static bool IsFrozen();
 
 	private:
+		/// <summary>
+		/// Discard the table built by Freeze, so that lookups see the registered factories again. With USE_THREAD_SAFE_REGISTRIES defined, the caller must hold _frozenMutex exclusively.
+		/// </summary>
+		static void Thaw();
+
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		/// <summary>
+		/// The map factories are registered in. With USE_THREAD_SAFE_REGISTRIES defined it is a ConcurrentHashMap, so factories can be found and used to create objects from any thread.
+		/// </summary>
+		using FactoryMap = ConcurrentHashMap<std::string, std::unique_ptr<const Factory>>;
+#else
+		/// <summary>
+		/// The map factories are registered in.
+		/// </summary>
+		using FactoryMap = FlatHashMap<std::string, std::unique_ptr<const Factory>>;
+#endif // USE_THREAD_SAFE_REGISTRIES
+
 		/// <summary>
 		/// All the factories registered, associated with the name of the class they produce for.
 		/// </summary>
-		inline static HashMap<std::string, std::unique_ptr<const Factory>> _factoryLookup = HashMap<std::string, std::unique_ptr<const Factory<ProductType>>>();
+		inline static FactoryMap _factoryLookup = FactoryMap();
+		/// <summary>
+		/// A perfect hash over the registered factories, built by Freeze.
+		/// </summary>
+		inline static FrozenHashMap<std::string, const Factory*> _frozenLookup = FrozenHashMap<std::string, const Factory*>();
+		/// <summary>
+		/// Whether lookups are answered from _frozenLookup.
+		/// </summary>
+		inline static std::atomic<bool> _isFrozen{ false };
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		/// <summary>
+		/// Held exclusively while the factories are changed or _frozenLookup is built or discarded, and shared while a lookup reads _frozenLookup.
+		/// </summary>
+		inline static std::shared_mutex _frozenMutex;
+#endif // USE_THREAD_SAFE_REGISTRIES
 	};
 }
 
@@ -8,13 +8,29 @@
 
 namespace FIEAGameEngine {
 	template <typename ProductType>
-	inline const Factory<ProductType>* Factory<ProductType>::Find(const std::string& className) {
+	inline const Factory<ProductType>* Factory<ProductType>::Find(std::string_view className) {
+		if (_isFrozen) {
+#ifdef USE_THREAD_SAFE_REGISTRIES
+			std::shared_lock<std::shared_mutex> lock(_frozenMutex);
+			if (_isFrozen)
+#endif // USE_THREAD_SAFE_REGISTRIES
+			{
+				auto frozenIter = _frozenLookup.Find(className);
+				return (frozenIter == _frozenLookup.end()) ? nullptr : (*frozenIter).second;
+			}
+		}
+
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		const auto* factory = _factoryLookup.Find(className);
+		return (factory == nullptr) ? nullptr : factory->get();
+#else
 		auto factoryIter = _factoryLookup.Find(className);
 		return (factoryIter == _factoryLookup.end()) ? nullptr : factoryIter->second.get();
+#endif // USE_THREAD_SAFE_REGISTRIES
 	}
 	
 	template<typename ProductType>
-	inline gsl::owner<ProductType*> Factory<ProductType>::Create(const std::string& className) {
+	inline gsl::owner<ProductType*> Factory<ProductType>::Create(std::string_view className) {
 		const Factory<ProductType>* concreteFactory = Find(className);
 
 		if (!concreteFactory) return nullptr;
@@ -26,20 +42,70 @@ namespace FIEAGameEngine {
 		return _factoryLookup.Size();
 	}
 
+#ifdef USE_HASHMAP_STATISTICS
+	template<typename ProductType>
+	inline HashMapStatistics Factory<ProductType>::GetStatistics() {
+		return _factoryLookup.GetStatistics();
+	}
+#endif // USE_HASHMAP_STATISTICS
+
 	template<typename ProductType>
 	inline void Factory<ProductType>::Add(std::unique_ptr<Factory<ProductType>> factory) {
-		auto[ iter, inserted ] = _factoryLookup.Insert({ factory->ClassName(), std::move(factory) });
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		std::unique_lock<std::shared_mutex> lock(_frozenMutex);
+#endif // USE_THREAD_SAFE_REGISTRIES
+		Thaw();
+		std::string className(factory->ClassName());
+		auto[ iter, inserted ] = _factoryLookup.TryEmplace(std::move(className), std::move(factory));
 		UNREFERENCED_LOCAL(iter);
 		assert(inserted);
 	}
 
 	template<typename ProductType>
-	inline void Factory<ProductType>::Remove(const std::string& className) {
-		_factoryLookup.Remove(_factoryLookup.Find(className));
+	inline void Factory<ProductType>::Remove(std::string_view className) {
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		std::unique_lock<std::shared_mutex> lock(_frozenMutex);
+#endif // USE_THREAD_SAFE_REGISTRIES
+		Thaw();
+		_factoryLookup.Remove(className);
 	}
 	
 	template<typename ProductType>
 	inline void Factory<ProductType>::Clear() {
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		std::unique_lock<std::shared_mutex> lock(_frozenMutex);
+#endif // USE_THREAD_SAFE_REGISTRIES
+		Thaw();
 		_factoryLookup.Clear();
 	}
+
+	template<typename ProductType>
+	void Factory<ProductType>::Freeze() {
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		std::unique_lock<std::shared_mutex> lock(_frozenMutex);
+#endif // USE_THREAD_SAFE_REGISTRIES
+		Vector<std::pair<const std::string, const Factory*>> entries(_factoryLookup.Size());
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		_factoryLookup.ForEach([&entries](const auto& entry) { entries.PushBack({ entry.first, entry.second.get() }); });
+#else
+		for (const auto& entry : _factoryLookup) {
+			entries.PushBack({ entry.first, entry.second.get() });
+		}
+#endif // USE_THREAD_SAFE_REGISTRIES
+
+		_frozenLookup = FrozenHashMap<std::string, const Factory*>(entries.begin(), entries.end());
+		_isFrozen.store(true, std::memory_order_release);
+	}
+
+	template<typename ProductType>
+	inline bool Factory<ProductType>::IsFrozen() {
+		return _isFrozen;
+	}
+
+	template<typename ProductType>
+	inline void Factory<ProductType>::Thaw() {
+		if (!_isFrozen) return;
+		_isFrozen.store(false, std::memory_order_release);
+		_frozenLookup = FrozenHashMap<std::string, const Factory*>();
+	}
 }
\ No newline at end of file
@@ -0,0 +1,753 @@
+/// <summary>
+/// The declaration of the templated class FlatHashMap, as well as its enveloped classes Iterator and ConstIterator.
+/// </summary>
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <tuple>
+#include <utility>
+#include "gsl/gsl"
+#include "DefaultHash.h"
+#include "DefaultEquality.h"
+#include "HashMapStatistics.h"
+
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FLATHASHMAP_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace FIEAGameEngine {
+	/// <summary>
+	/// A templated container class for an open addressing hashmap.
+	/// Entries are stored contiguously in a single slot array alongside a parallel array of one byte control codes. Lookups hash the key once and then
+	/// compare 16 control bytes at a time (with SSE2 where available) to find candidate slots, so a successful Find usually costs a single cache miss.
+	/// The public interface mirrors HashMap, except that the table grows automatically once it is 7/8 full and growing invalidates Iterators, pointers, and references.
+	/// </summary>
+	/// <typeparam name="TKey">The type of object used as a key.</typeparam>
+	/// <typeparam name="TData">The type of object stored at a key.</typeparam>
+	/// <typeparam name="THashFunctor">The functor used to hash a key type.</typeparam>
+	/// <typeparam name="TEqualityFunctor">The functor used to compare two keys. Stateless policies are inlined into every lookup; a std::function can still be supplied when the comparison must be chosen at runtime.</typeparam>
+	template <typename TKey, typename TData, typename THashFunctor = DefaultHash<TKey>, typename TEqualityFunctor = DefaultEquality<const TKey>>
+	class FlatHashMap final {
+	public:
+		using PairType = std::pair<const TKey, TData>;
+
+		using key_type = const TKey;
+		using mapped_type = TData;
+		using value_type = PairType;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using hasher = THashFunctor;
+		using reference = value_type&;
+		using rvalue_reference = value_type&&;
+		using const_reference = const value_type&;
+		using iterator = class Iterator;
+		using const_iterator = class ConstIterator;
+		using key_equal = TEqualityFunctor;
+		using EqualityFunctor = TEqualityFunctor;
+
+		/// <summary>
+		/// Whether TLookup can be used to search the FlatHashMap without constructing a key: the hash functor must be transparent and TLookup must not already be the key type.
+		/// Heterogeneous lookups compare stored keys against the lookup value with operator== instead of the equality functor.
+		/// </summary>
+		template <typename TLookup>
+		static constexpr bool IsLookupType = IsTransparentHash<THashFunctor>::value && !std::is_same_v<std::decay_t<TLookup>, std::remove_const_t<TKey>>;
+
+		/// <summary>
+		/// The number of control bytes inspected per probe. Capacities are always a power of two multiple of this.
+		/// </summary>
+		static constexpr size_type GroupWidth = 16;
+
+		/// <summary>
+		/// Iterator class allows traversal of FlatHashMap objects. Iterators function as Forward Iterators and have all related functionaliy.
+		/// Dereferencing an Iterator equal to end or trying to increment an Iterator that is not assigned to a FlatHashMap will result in a runtime error.
+		/// </summary>
+		class Iterator final {
+			friend FlatHashMap;
+			friend class ConstIterator;
+
+		public:
+			//difference_type, pointer, and iterator_category choices are taken from information on https://en.cppreference.com/w/cpp/iterator/iterator_traits
+			//This allows usage of std:: functions requiring iterator types with this custom Iterator, i.e. std::equal
+			using size_type = FlatHashMap::size_type;
+			using value_type = FlatHashMap::value_type;
+			using reference = FlatHashMap::reference;
+			using const_reference = FlatHashMap::const_reference;
+			using rvalue_reference = FlatHashMap::rvalue_reference;
+			using difference_type = std::ptrdiff_t;
+			using pointer = value_type*;
+			using const_pointer = const value_type*;
+			using iterator_category = std::forward_iterator_tag;
+
+			/// <summary>
+			/// Default constructor for an Iterator. Using the compiler provided default behavior.
+			/// </summary>
+			Iterator() = default;
+			/// <summary>
+			/// Copy constructor for an Iterator. Using the compiler provided default behavior.
+			/// </summary>
+			/// <param name="rhs">The Iterator to copy</param>
+			Iterator(const Iterator& rhs) = default;
+			/// <summary>
+			/// Move constructor for an Iterator. Using the compiler provided default behavior.
+			/// </summary>
+			/// <param name="rhs">The Iterator to move data from</param>
+			Iterator(Iterator&& rhs) noexcept = default;
+			/// <summary>
+			/// The copy assignment operator for an Iterator. Using the compiler provided default behavior.
+			/// </summary>
+			/// <param name="rhs">The Iterator to copy</param>
+			/// <returns>An Iterator reference to the copy</returns>
+			Iterator& operator=(const Iterator& rhs) = default;
+			/// <summary>
+			/// The move assignment operator for an Iterator. Using the compiler provided default behavior.
+			/// </summary>
+			/// <param name="rhs">The Iterator to move data from</param>
+			/// <returns>An Iterator reference to the copy</returns>
+			Iterator& operator=(Iterator&& rhs) noexcept = default;
+			/// <summary>
+			/// The destructor for an Iterator. Using the compiler provided default behavior.
+			/// </summary>
+			~Iterator() = default;
+
+			/// <summary>
+			/// Dereference an Iterator.
+			/// </summary>
+			/// <returns>A reference to the PairType the Iterator points to</returns>
+			/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Iterator's data is equal to end()</exception>
+			[[nodiscard]] reference operator*() const;
+			/// <summary>
+			/// Allow access to the PairType the Iterator points to.
+			/// </summary>
+			/// <returns>A pointer to the PairType the Iterator points to</returns>
+			/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Iterator's data is equal to end()</exception>
+			[[nodiscard]] pointer operator->() const;
+			/// <summary>
+			/// Pre-increment an Iterator, skipping over empty and deleted slots.
+			/// </summary>
+			/// <returns>A reference to an Iterator, now pointing to the next item in the FlatHashMap</returns>
+			/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Iterator is not associted with a FlatHashMap</exception>
+			Iterator& operator++();
+			/// <summary>
+			/// Post-increment an Iterator. Calls the pre-fixed increment as part of it.
+			/// </summary>
+			/// <param name="">Unused parameter to disambiguate between post and pre increment overloads</param>
+			/// <returns>An Iterator pointing to the item that the incremented Iterator used to be pointing to</returns>
+			Iterator operator++(int);
+			/// <summary>
+			/// Test if two Iterators are not equal to each other. Iterators are not equal to each other if they either do not belong to the same FlatHashMap or if they do not point to the same slot.
+			/// </summary>
+			/// <param name="rhs">The Iterator being compared to</param>
+			/// <returns>A boolean indicating if the Iterators are not equal to each other</returns>
+			[[nodiscard]] bool operator!=(const Iterator& rhs) const;
+			/// <summary>
+			/// Test if two Iterators are equal to each other. Iterators are equal to each other if they both belong to the same FlatHashMap and point to the same slot.
+			/// </summary>
+			/// <param name="rhs">The Iterator being compared to</param>
+			/// <returns>A boolean indicating if the Iterators are equal to each other</returns>
+			[[nodiscard]] bool operator==(const Iterator& rhs) const;
+		private:
+			/// <summary>
+			/// Private constructor for an Iterator that sets its container and slot with parameterized input.
+			/// </summary>
+			/// <param name="container">The FlatHashMap this Iterator belongs to</param>
+			/// <param name="slotIndex">The slot this Iterator is pointing at</param>
+			Iterator(FlatHashMap& container, size_type slotIndex);
+
+			/// <summary>
+			/// The slot this Iterator is pointing at.
+			/// </summary>
+			size_type _slotIndex{ 0 };
+			/// <summary>
+			/// The FlatHashMap this Iterator belongs to.
+			/// </summary>
+			FlatHashMap* _container{ nullptr };
+		};
+
+		/// <summary>
+		/// ConstIterator class allows traversal of FlatHashMap objects. Functionally almost identical to Iterator class, except that dereferencing a ConstIterator returns a const reference.
+		/// Dereferencing a ConstIterator equal to end or trying to increment a ConstIterator that is not assigned to a FlatHashMap will result in a runtime error.
+		/// </summary>
+		class ConstIterator final {
+			friend FlatHashMap;
+
+		public:
+			//difference_type, pointer, and iterator_category choices are taken from information on https://en.cppreference.com/w/cpp/iterator/iterator_traits
+			//This allows usage of std:: functions requiring iterator types with this custom Iterator, i.e. std::equal
+			using size_type = FlatHashMap::size_type;
+			using value_type = FlatHashMap::value_type;
+			using reference = FlatHashMap::reference;
+			using const_reference = FlatHashMap::const_reference;
+			using rvalue_reference = FlatHashMap::rvalue_reference;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const value_type*;
+			using iterator_category = std::forward_iterator_tag;
+
+			/// <summary>
+			/// Default constructor for a ConstIterator. Using the compiler provided default behavior.
+			/// </summary>
+			ConstIterator() = default;
+			/// <summary>
+			/// A type-cast constructor for a ConstIterator that takes in an Iterator and copies its information to create a ConstIterator pointing at the same slot in the same FlatHashMap.
+			/// </summary>
+			/// <param name="other">The Iterator to copy information from</param>
+			ConstIterator(const Iterator& other);
+			/// <summary>
+			/// Copy constructor for a ConstIterator. Using the compiler provided default behavior.
+			/// </summary>
+			/// <param name="rhs">The ConstIterator to copy</param>
+			ConstIterator(const ConstIterator& rhs) = default;
+			/// <summary>
+			/// Move constructor for a ConstIterator. Using the compiler provided default behavior.
+			/// </summary>
+			/// <param name="rhs">The ConstIterator to move data from</param>
+			ConstIterator(ConstIterator&& rhs) noexcept = default;
+			/// <summary>
+			/// The copy assignment operator for a ConstIterator. Using the compiler provided default behavior.
+			/// </summary>
+			/// <param name="rhs">The ConstIterator to copy</param>
+			/// <returns>A ConstIterator reference to the copy</returns>
+			ConstIterator& operator=(const ConstIterator& rhs) = default;
+			/// <summary>
+			/// The move assignment operator for a ConstIterator. Using the compiler provided default behavior.
+			/// </summary>
+			/// <param name="rhs">The ConstIterator to move data from</param>
+			/// <returns>A ConstIterator reference to the copy</returns>
+			ConstIterator& operator=(ConstIterator&& rhs) noexcept = default;
+			/// <summary>
+			/// The destructor for a ConstIterator. Using the compiler provided default behavior.
+			/// </summary>
+			~ConstIterator() = default;
+
+			/// <summary>
+			/// Dereference a ConstIterator.
+			/// </summary>
+			/// <returns>A constant reference to the PairType the ConstIterator points to</returns>
+			/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the ConstIterator's data is equal to end()</exception>
+			[[nodiscard]] const_reference operator*() const;
+			/// <summary>
+			/// Allow access to the PairType the ConstIterator points to.
+			/// </summary>
+			/// <returns>A pointer to the PairType the ConstIterator points to</returns>
+			/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the ConstIterator's data is equal to end()</exception>
+			[[nodiscard]] pointer operator->() const;
+			/// <summary>
+			/// Pre-increment a ConstIterator, skipping over empty and deleted slots.
+			/// </summary>
+			/// <returns>A reference to a ConstIterator, now pointing to the next item in the FlatHashMap</returns>
+			/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the ConstIterator is not associted with a FlatHashMap</exception>
+			ConstIterator& operator++();
+			/// <summary>
+			/// Post-increment a ConstIterator. Calls the pre-fixed increment as part of it.
+			/// </summary>
+			/// <param name="">Unused parameter to disambiguate between post and pre increment overloads</param>
+			/// <returns>A ConstIterator pointing to the item that the incremented ConstIterator used to be pointing to</returns>
+			ConstIterator operator++(int);
+			/// <summary>
+			/// Test if two ConstIterators are not equal to each other. ConstIterators are not equal to each other if they either do not belong to the same FlatHashMap or if they do not point to the same slot.
+			/// </summary>
+			/// <param name="rhs">The ConstIterator being compared to</param>
+			/// <returns>A boolean indicating if the ConstIterators are not equal to each other</returns>
+			[[nodiscard]] bool operator!=(const ConstIterator& rhs) const;
+			/// <summary>
+			/// Test if two ConstIterators are equal to each other. ConstIterators are equal to each other if they both belong to the same FlatHashMap and point to the same slot.
+			/// </summary>
+			/// <param name="rhs">The ConstIterator being compared to</param>
+			/// <returns>A boolean indicating if the ConstIterators are equal to each other</returns>
+			[[nodiscard]] bool operator==(const ConstIterator& rhs) const;
+		private:
+			/// <summary>
+			/// Private constructor for a ConstIterator that sets its container and slot with parameterized input.
+			/// </summary>
+			/// <param name="container">The FlatHashMap this ConstIterator belongs to</param>
+			/// <param name="slotIndex">The slot this ConstIterator is pointing at</param>
+			ConstIterator(const FlatHashMap& container, size_type slotIndex);
+
+			/// <summary>
+			/// The slot this ConstIterator is pointing at.
+			/// </summary>
+			size_type _slotIndex{ 0 };
+			/// <summary>
+			/// The FlatHashMap this ConstIterator belongs to.
+			/// </summary>
+			const FlatHashMap* _container{ nullptr };
+		};
+
+		/// <summary>
+		/// The main constructor for a FlatHashMap.
+		/// </summary>
+		/// <param name="capacity">The number of slots to start with, defaulted to 16. Rounded up to a power of two that is at least GroupWidth.</param>
+		/// <param name="equalityFunctor">A method used to determine relevant equality between two PairTypes; i.e. key equality</param>
+		explicit FlatHashMap(size_type capacity = GroupWidth, EqualityFunctor equalityFunctor = EqualityFunctor{});
+		/// <summary>
+		/// An Initializer list constructor for FlatHashMap.
+		/// </summary>
+		/// <param name="list">A set of items to add to the FlatHashMap as it's being constructed</param>
+		/// <param name="capacity">The number of slots to start with, defaulted to 16. Rounded up to a power of two that is at least GroupWidth.</param>
+		/// <param name="equalityFunctor">A method used to determine relevant equality between two PairTypes; i.e. key equality</param>
+		FlatHashMap(std::initializer_list<PairType> list, size_type capacity = GroupWidth, EqualityFunctor equalityFunctor = EqualityFunctor{});
+		/// <summary>
+		/// A copy constructor for a FlatHashMap that performs a deep copy, preserving the slot layout of the original.
+		/// </summary>
+		/// <param name="rhs">The FlatHashMap to copy</param>
+		FlatHashMap(const FlatHashMap& rhs);
+		/// <summary>
+		/// The move constructor for a FlatHashMap. The moved from FlatHashMap is left empty with no storage, but remains usable.
+		/// </summary>
+		/// <param name="rhs">The FlatHashMap to move data from</param>
+		FlatHashMap(FlatHashMap&& rhs) noexcept;
+		/// <summary>
+		/// The copy assignment operator for a FlatHashMap that first releases the existing storage and then performs a deep copy.
+		/// </summary>
+		/// <param name="rhs">The FlatHashMap to copy</param>
+		/// <returns>A reference to the updated FlatHashMap</returns>
+		FlatHashMap& operator=(const FlatHashMap& rhs);
+		/// <summary>
+		/// The move assignment operator for a FlatHashMap that first releases the existing storage and then takes ownership of the other FlatHashMap's storage.
+		/// </summary>
+		/// <param name="rhs">The FlatHashMap to move data from</param>
+		/// <returns>A reference to the updated FlatHashMap</returns>
+		FlatHashMap& operator=(FlatHashMap&& rhs) noexcept;
+		/// <summary>
+		/// The destructor for a FlatHashMap, which destroys all entries and frees its storage.
+		/// </summary>
+		~FlatHashMap();
+
+		/// <summary>
+		/// Get the current population.
+		/// </summary>
+		/// <returns>The current population of the FlatHashMap</returns>
+		[[nodiscard]] size_type Size() const;
+		/// <summary>
+		/// Get the current number of slots.
+		/// </summary>
+		/// <returns>The current number of slots in the FlatHashMap</returns>
+		[[nodiscard]] size_type Capacity() const;
+		/// <summary>
+		/// Get the current load factor, the proportion of occupied slots / total slots.
+		/// </summary>
+		/// <returns>The current load factor of the FlatHashMap</returns>
+		[[nodiscard]] double GetLoadFactor() const;
+		/// <summary>
+		/// Check if the FlatHashMap contains a given key.
+		/// </summary>
+		/// <param name="key">The key to look for</param>
+		/// <returns>A boolean determining if the FlatHashMap contains the given key</returns>
+		[[nodiscard]] bool ContainsKey(const TKey& key) const;
+		/// <summary>
+		/// Check if the FlatHashMap contains a key equal to the given lookup value (i.e. a std::string_view or const char* for a std::string key), without constructing a key.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>A boolean determining if the FlatHashMap contains the given key</returns>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		[[nodiscard]] bool ContainsKey(const TLookup& key) const;
+		/// <summary>
+		/// Check if the FlatHashMap contains a given key, and return an Iterator pointing to it, or end() if it does not exist in the FlatHashMap.
+		/// </summary>
+		/// <param name="key">The key to look for</param>
+		/// <returns>An Iterator pointing to the PairType with the given key, or end() if none exists.</returns>
+		[[nodiscard]] Iterator Find(const TKey& key);
+		/// <summary>
+		/// Check if the FlatHashMap contains a given key, and return a ConstIterator pointing to it, or end() if it does not exist in the FlatHashMap.
+		/// </summary>
+		/// <param name="key">The key to look for</param>
+		/// <returns>A ConstIterator pointing to the PairType with the given key, or end() if none exists.</returns>
+		[[nodiscard]] ConstIterator Find(const TKey& key) const;
+		/// <summary>
+		/// Check if the FlatHashMap contains a key equal to the given lookup value, without constructing a key, and return an Iterator pointing to it, or end() if it does not exist in the FlatHashMap.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>An Iterator pointing to the PairType with the matching key, or end() if none exists.</returns>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		[[nodiscard]] Iterator Find(const TLookup& key);
+		/// <summary>
+		/// Check if the FlatHashMap contains a key equal to the given lookup value, without constructing a key, and return a ConstIterator pointing to it, or end() if it does not exist in the FlatHashMap.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>A ConstIterator pointing to the PairType with the matching key, or end() if none exists.</returns>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		[[nodiscard]] ConstIterator Find(const TLookup& key) const;
+		/// <summary>
+		/// Check if the FlatHashMap contains a given key, return the data stored there.
+		/// </summary>
+		/// <param name="key">The key to look for</param>
+		/// <returns>A reference to the data stored at key.</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the key does not exist in the FlatHashMap</exception>
+		[[nodiscard]] TData& At(const TKey& key);
+		/// <summary>
+		/// Check if the FlatHashMap contains a given key, return the data stored there.
+		/// </summary>
+		/// <param name="key">The key to look for</param>
+		/// <returns>A constant reference to the data stored at key.</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the key does not exist in the FlatHashMap</exception>
+		[[nodiscard]] const TData& At(const TKey& key) const;
+		/// <summary>
+		/// Check if the FlatHashMap contains a key equal to the given lookup value, without constructing a key, and return the data stored there.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>A reference to the data stored at the matching key.</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the key does not exist in the FlatHashMap</exception>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		[[nodiscard]] TData& At(const TLookup& key);
+		/// <summary>
+		/// Check if the FlatHashMap contains a key equal to the given lookup value, without constructing a key, and return the data stored there.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>A constant reference to the data stored at the matching key.</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the key does not exist in the FlatHashMap</exception>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		[[nodiscard]] const TData& At(const TLookup& key) const;
+		/// <summary>
+		/// Returns a reference to the data stored at the given key. If the given key does not exist in the FlatHashMap, it is inserted with a default constructed TData.
+		/// </summary>
+		/// <param name="key">The key to lookup</param>
+		/// <returns>A reference to the data stored at that key</returns>
+		TData& operator[](const TKey& key);
+		/// <summary>
+		/// Returns a reference to the data stored at a key equal to the given lookup value. If no such key exists, one is constructed from the lookup value and inserted with a default constructed TData.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>A reference to the data stored at that key</returns>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		TData& operator[](const TLookup& key);
+
+		/// <summary>
+		/// Insert a given PairType into the FlatHashMap, if the key does not already exist. May grow the FlatHashMap, invalidating existing Iterators.
+		/// </summary>
+		/// <param name="entry">The PairType to insert</param>
+		/// <returns>A pair of an Iterator pointing to the inserted object (or the preexisting object with the same key) and a bool indicating if something new was inserted</returns>
+		std::pair<Iterator, bool> Insert(const PairType& entry);
+		/// <summary>
+		/// Insert a given PairType into the FlatHashMap, if the key does not already exist, using move semantics. May grow the FlatHashMap, invalidating existing Iterators.
+		/// </summary>
+		/// <param name="entry">The PairType to insert</param>
+		/// <returns>A pair of an Iterator pointing to the inserted object (or the preexisting object with the same key) and a bool indicating if something new was inserted</returns>
+		std::pair<Iterator, bool> Insert(PairType&& entry);
+		/// <summary>
+		/// Construct a PairType from the given arguments and insert it, if its key does not already exist. May grow the FlatHashMap, invalidating existing Iterators.
+		/// The PairType has to be built before its key can be looked up, so prefer TryEmplace when the key is at hand.
+		/// </summary>
+		/// <param name="args">The arguments to construct a PairType from</param>
+		/// <returns>A pair of an Iterator pointing to the inserted object (or the preexisting object with the same key) and a bool indicating if something new was inserted</returns>
+		template <typename... Args>
+		std::pair<Iterator, bool> Emplace(Args&&... args);
+		/// <summary>
+		/// Insert the given key with data constructed in place from the given arguments, if the key does not already exist. Nothing is constructed, copied, or moved from if it does.
+		/// </summary>
+		/// <param name="key">The key to insert</param>
+		/// <param name="args">The arguments to construct the TData from</param>
+		/// <returns>A pair of an Iterator pointing to the inserted object (or the preexisting object with the same key) and a bool indicating if something new was inserted</returns>
+		template <typename... Args>
+		std::pair<Iterator, bool> TryEmplace(const TKey& key, Args&&... args);
+		/// <summary>
+		/// Insert the given key with data constructed in place from the given arguments, if the key does not already exist. Nothing is constructed, copied, or moved from if it does.
+		/// </summary>
+		/// <param name="key">The key to move into the FlatHashMap</param>
+		/// <param name="args">The arguments to construct the TData from</param>
+		/// <returns>A pair of an Iterator pointing to the inserted object (or the preexisting object with the same key) and a bool indicating if something new was inserted</returns>
+		template <typename... Args>
+		std::pair<Iterator, bool> TryEmplace(TKey&& key, Args&&... args);
+		/// <summary>
+		/// Insert a key constructed from the given lookup value with data constructed in place from the given arguments, if no equal key already exists. Neither the key nor the data is constructed if one does.
+		/// </summary>
+		/// <param name="key">The lookup value to look for and construct the key from</param>
+		/// <param name="args">The arguments to construct the TData from</param>
+		/// <returns>A pair of an Iterator pointing to the inserted object (or the preexisting object with the same key) and a bool indicating if something new was inserted</returns>
+		template <typename TLookup, typename... Args, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		std::pair<Iterator, bool> TryEmplace(const TLookup& key, Args&&... args);
+		/// <summary>
+		/// Assign the given data to the given key, inserting the key if it does not already exist.
+		/// </summary>
+		/// <param name="key">The key to assign to</param>
+		/// <param name="data">The data to assign</param>
+		/// <returns>A pair of an Iterator pointing to the assigned object and a bool indicating if it was newly inserted</returns>
+		template <typename TValue>
+		std::pair<Iterator, bool> InsertOrAssign(const TKey& key, TValue&& data);
+		/// <summary>
+		/// Assign the given data to the given key, moving the key into the FlatHashMap if it does not already exist.
+		/// </summary>
+		/// <param name="key">The key to assign to</param>
+		/// <param name="data">The data to assign</param>
+		/// <returns>A pair of an Iterator pointing to the assigned object and a bool indicating if it was newly inserted</returns>
+		template <typename TValue>
+		std::pair<Iterator, bool> InsertOrAssign(TKey&& key, TValue&& data);
+		/// <summary>
+		/// Assign the given data to the key equal to the given lookup value, constructing and inserting that key if it does not already exist.
+		/// </summary>
+		/// <param name="key">The lookup value to look for and construct the key from</param>
+		/// <param name="data">The data to assign</param>
+		/// <returns>A pair of an Iterator pointing to the assigned object and a bool indicating if it was newly inserted</returns>
+		template <typename TLookup, typename TValue, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		std::pair<Iterator, bool> InsertOrAssign(const TLookup& key, TValue&& data);
+		/// <summary>
+		/// Remove a PairType with the given key if it exists in the FlatHashMap.
+		/// </summary>
+		/// <param name="key">The key to look for removal</param>
+		void Remove(const TKey& key);
+		/// <summary>
+		/// Remove a PairType with a key equal to the given lookup value if it exists in the FlatHashMap, without constructing a key.
+		/// </summary>
+		/// <param name="key">The lookup value to look for removal</param>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		void Remove(const TLookup& key);
+		/// <summary>
+		/// Remove a PairType with the given iterator if it isn't equal to end().
+		/// </summary>
+		/// <param name="iter">The iterator to look for removal</param>
+		void Remove(const Iterator& iter);
+		/// <summary>
+		/// Empty the FlatHashMap. The current capacity is retained.
+		/// </summary>
+		void Clear();
+		/// <summary>
+		/// Grow the FlatHashMap so that it can hold at least the given number of entries without growing again. Does nothing if it already can.
+		/// </summary>
+		/// <param name="count">The number of entries to make room for</param>
+		void Reserve(size_type count);
+#ifdef USE_HASHMAP_STATISTICS
+		/// <summary>
+		/// Measure the current probe lengths and memory footprint of the FlatHashMap, alongside its cumulative lookup counters. Rehashes every stored key, so the cost is linear in the size of the FlatHashMap.
+		/// </summary>
+		/// <returns>A snapshot of the FlatHashMap's statistics</returns>
+		[[nodiscard]] HashMapStatistics GetStatistics() const;
+		/// <summary>
+		/// Zero the cumulative find, insert, and probe counters.
+		/// </summary>
+		void ResetStatistics();
+#endif // USE_HASHMAP_STATISTICS
+
+		/// <summary>
+		/// Get an Iterator pointing to the start of the FlatHashMap.
+		/// </summary>
+		/// <returns>An Iterator pointing to the first element in the FlatHashMap</returns>
+		[[nodiscard]] Iterator begin();
+		/// <summary>
+		/// Get an Iterator pointing past the end of the FlatHashMap.
+		/// </summary>
+		/// <returns>An Iterator representing the element past the last element in the FlatHashMap</returns>
+		[[nodiscard]] Iterator end();
+		/// <summary>
+		/// Get a ConstIterator pointing to the start of the FlatHashMap.
+		/// </summary>
+		/// <returns>A ConstIterator pointing to the first element in the FlatHashMap</returns>
+		[[nodiscard]] ConstIterator begin() const;
+		/// <summary>
+		/// Get a ConstIterator pointing past the end of the FlatHashMap.
+		/// </summary>
+		/// <returns>A ConstIterator representing the element past the last element in the FlatHashMap</returns>
+		[[nodiscard]] ConstIterator end() const;
+		/// <summary>
+		/// Get a ConstIterator pointing to the start of the FlatHashMap. Can be used to force retrieval of a ConstIterator from non-const FlatHashMaps.
+		/// </summary>
+		/// <returns>A ConstIterator pointing to the first element in the FlatHashMap</returns>
+		[[nodiscard]] ConstIterator cbegin() const;
+		/// <summary>
+		/// Get a ConstIterator pointing past the end of the FlatHashMap. Can be used to force retrieval of a ConstIterator from non-const FlatHashMaps.
+		/// </summary>
+		/// <returns>A ConstIterator representing the element past the last element in the FlatHashMap</returns>
+		[[nodiscard]] ConstIterator cend() const;
+
+	private:
+		/// <summary>
+		/// A control byte describes the state of the slot with the same index: the low 7 bits of the key's hash if it is full, or one of the negative sentinels below.
+		/// </summary>
+		using ControlByte = std::int8_t;
+		/// <summary>
+		/// Control byte marking a slot that has never held an entry. Probing stops at any group containing one of these.
+		/// </summary>
+		static constexpr ControlByte EmptyControl = ControlByte(-128);
+		/// <summary>
+		/// Control byte marking a slot whose entry was removed, so that probing continues past it.
+		/// </summary>
+		static constexpr ControlByte DeletedControl = ControlByte(-2);
+
+		/// <summary>
+		/// Where FindOrPrepareInsert found or reserved a key, and the control byte that marks the slot full once its PairType has been constructed.
+		/// </summary>
+		struct InsertPosition final {
+			/// <summary>
+			/// The slot index holding or reserved for the key.
+			/// </summary>
+			size_type Slot;
+			/// <summary>
+			/// The control byte to store for the slot when committing the insertion.
+			/// </summary>
+			ControlByte Control;
+			/// <summary>
+			/// Whether the key was absent, so the caller must construct the PairType and then call CommitInsert.
+			/// </summary>
+			bool Inserted;
+		};
+
+		/// <summary>
+		/// A view of GroupWidth consecutive control bytes that produces bitmasks of matching slots, bit i representing the ith slot of the group.
+		/// </summary>
+		class Group final {
+		public:
+			/// <summary>
+			/// Load a group of control bytes.
+			/// </summary>
+			/// <param name="control">The first of the GroupWidth control bytes to load</param>
+			explicit Group(const ControlByte* control);
+
+			/// <summary>
+			/// Find the full slots in this group whose stored hash bits equal the given ones.
+			/// </summary>
+			/// <param name="hashBits">The low 7 bits of a key's hash</param>
+			/// <returns>A bitmask of candidate slots</returns>
+			[[nodiscard]] std::uint32_t Match(ControlByte hashBits) const;
+			/// <summary>
+			/// Find the empty slots in this group.
+			/// </summary>
+			/// <returns>A bitmask of empty slots</returns>
+			[[nodiscard]] std::uint32_t MatchEmpty() const;
+			/// <summary>
+			/// Find the slots in this group that can accept a new entry.
+			/// </summary>
+			/// <returns>A bitmask of empty and deleted slots</returns>
+			[[nodiscard]] std::uint32_t MatchEmptyOrDeleted() const;
+
+		private:
+#ifdef FLATHASHMAP_USE_SSE2
+			/// <summary>
+			/// The loaded control bytes.
+			/// </summary>
+			__m128i _control;
+#else
+			/// <summary>
+			/// The first control byte of the group.
+			/// </summary>
+			const ControlByte* _control;
+#endif // FLATHASHMAP_USE_SSE2
+		};
+
+		/// <summary>
+		/// The control bytes, one per slot.
+		/// </summary>
+		ControlByte* _control{ nullptr };
+		/// <summary>
+		/// The slot storage. Only slots whose control byte is non-negative hold a constructed PairType.
+		/// </summary>
+		PairType* _slots{ nullptr };
+		/// <summary>
+		/// The current number of slots.
+		/// </summary>
+		size_type _capacity{ 0 };
+		/// <summary>
+		/// The current population of the FlatHashMap.
+		/// </summary>
+		size_type _population{ 0 };
+		/// <summary>
+		/// The current number of deleted slots, which still count against the load limit until the next rehash.
+		/// </summary>
+		size_type _deletedCount{ 0 };
+		/// <summary>
+		/// The functor indicating how to find eqaulity between two keys.
+		/// </summary>
+		EqualityFunctor _equalityFunctor;
+#ifdef USE_HASHMAP_STATISTICS
+		/// <summary>
+		/// The number of key lookups performed since construction or the last ResetStatistics.
+		/// </summary>
+		mutable size_type _findCount{ 0 };
+		/// <summary>
+		/// The number of entries inserted since construction or the last ResetStatistics.
+		/// </summary>
+		size_type _insertCount{ 0 };
+		/// <summary>
+		/// The number of stored keys compared by lookups since construction or the last ResetStatistics.
+		/// </summary>
+		mutable size_type _probeCount{ 0 };
+#endif // USE_HASHMAP_STATISTICS
+
+		/// <summary>
+		/// Helper function to hash a key and scramble the result so that both the group index and the 7 stored hash bits are well distributed.
+		/// </summary>
+		/// <param name="key">The key or lookup value to hash</param>
+		/// <returns>The scrambled hash</returns>
+		template <typename TLookup>
+		[[nodiscard]] static size_type GetHash(const TLookup& key);
+		/// <summary>
+		/// Helper function to get the index of the lowest set bit in a group bitmask.
+		/// </summary>
+		/// <param name="mask">A non-zero bitmask</param>
+		/// <returns>The index of its lowest set bit</returns>
+		[[nodiscard]] static size_type LowestSetBit(std::uint32_t mask);
+		/// <summary>
+		/// Helper function to round a requested capacity up to a power of two that is at least GroupWidth.
+		/// </summary>
+		/// <param name="capacity">The requested capacity</param>
+		/// <returns>The capacity that will actually be used</returns>
+		[[nodiscard]] static size_type NormalizeCapacity(size_type capacity);
+		/// <summary>
+		/// Helper function to get the number of entries (including deleted slots) a given capacity may hold before it must grow.
+		/// </summary>
+		/// <param name="capacity">The capacity to check</param>
+		/// <returns>7/8 of the capacity</returns>
+		[[nodiscard]] static size_type MaxLoad(size_type capacity);
+		/// <summary>
+		/// Helper function that finds the slot holding a key using a precomputed hash.
+		/// </summary>
+		/// <param name="key">The key to look for</param>
+		/// <param name="hash">The precomputed hash of the key</param>
+		/// <returns>The slot index holding the key, or the capacity if the key is not present</returns>
+		template <typename TLookup>
+		[[nodiscard]] size_type FindSlot(const TLookup& key, size_type hash) const;
+		/// <summary>
+		/// Helper function that compares a stored key against a key or lookup value.
+		/// </summary>
+		/// <param name="storedKey">The key stored in the FlatHashMap</param>
+		/// <param name="key">The key or lookup value being searched for</param>
+		/// <returns>A boolean indicating if the two are equal</returns>
+		template <typename TLookup>
+		[[nodiscard]] bool KeyEquals(const TKey& storedKey, const TLookup& key) const;
+		/// <summary>
+		/// Helper function that finds the first empty or deleted slot along a hash's probe sequence. Assumes there is at least one.
+		/// </summary>
+		/// <param name="hash">The precomputed hash of the key being inserted</param>
+		/// <returns>The slot index that should receive the entry</returns>
+		[[nodiscard]] size_type FindInsertSlot(size_type hash) const;
+		/// <summary>
+		/// Helper function that looks for a key and, if it is absent, makes room for it (growing if needed) and picks the slot it will go in.
+		/// The slot is left unmarked: the caller constructs the PairType in it and only then calls CommitInsert, so a throwing constructor leaves the FlatHashMap unchanged.
+		/// </summary>
+		/// <param name="key">The key or lookup value to look for or insert</param>
+		/// <returns>The slot holding or reserved for the key, its control byte, and a boolean indicating if the slot was newly reserved</returns>
+		template <typename TLookup>
+		InsertPosition FindOrPrepareInsert(const TLookup& key);
+		/// <summary>
+		/// Helper function that marks a slot reserved by FindOrPrepareInsert as full once its PairType has been constructed.
+		/// </summary>
+		/// <param name="position">The position returned by FindOrPrepareInsert</param>
+		void CommitInsert(const InsertPosition& position);
+		/// <summary>
+		/// Helper function that moves every entry into freshly allocated storage of the given capacity, dropping all deleted slots.
+		/// Entries are only moved when that cannot throw and copied otherwise, so if an entry fails to transfer the FlatHashMap is left as it was.
+		/// </summary>
+		/// <param name="capacity">The new capacity, already normalized</param>
+		void Rehash(size_type capacity);
+		/// <summary>
+		/// Helper function that allocates empty control and slot storage of the given capacity.
+		/// </summary>
+		/// <param name="capacity">The capacity to allocate, already normalized</param>
+		void Allocate(size_type capacity);
+		/// <summary>
+		/// Helper function that destroys every entry and frees all storage, leaving the FlatHashMap with no capacity.
+		/// </summary>
+		void Release();
+		/// <summary>
+		/// Helper function that deep copies another FlatHashMap into this one, which must have no storage.
+		/// </summary>
+		/// <param name="rhs">The FlatHashMap to copy</param>
+		void CopyFrom(const FlatHashMap& rhs);
+	};
+}
+
+#include "FlatHashMap.inl"
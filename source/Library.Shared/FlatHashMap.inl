@@ -0,0 +1,781 @@
+/// <summary>
+/// The fully specified implementation of the tempated class FlatHashMap and its enveloped classes Iterator and ConstIterator.
+/// </summary>
+
+#pragma once
+
+#include "FlatHashMap.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif // _MSC_VER
+
+namespace FIEAGameEngine {
+#pragma region FlatHashMap
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::FlatHashMap(size_type capacity, EqualityFunctor equalityFunctor) :
+		_equalityFunctor{ std::move(equalityFunctor) }
+	{
+		Allocate(NormalizeCapacity(capacity));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::FlatHashMap(std::initializer_list<PairType> list, size_type capacity, EqualityFunctor equalityFunctor) :
+		_equalityFunctor{ std::move(equalityFunctor) }
+	{
+		Allocate(NormalizeCapacity(capacity));
+		Reserve(list.size());
+		for (const_reference value : list) {
+			Insert(value);
+		}
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::FlatHashMap(const FlatHashMap& rhs) :
+		_equalityFunctor{ rhs._equalityFunctor }
+	{
+		CopyFrom(rhs);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::FlatHashMap(FlatHashMap&& rhs) noexcept :
+		_control{ rhs._control }, _slots{ rhs._slots }, _capacity{ rhs._capacity }, _population{ rhs._population }, _deletedCount{ rhs._deletedCount }, _equalityFunctor{ rhs._equalityFunctor }
+	{
+		rhs._control = nullptr;
+		rhs._slots = nullptr;
+		rhs._capacity = rhs._population = rhs._deletedCount = 0;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>& FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::operator=(const FlatHashMap& rhs) {
+		if (this != &rhs) {
+			Release();
+			_equalityFunctor = rhs._equalityFunctor;
+			CopyFrom(rhs);
+		}
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>& FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::operator=(FlatHashMap&& rhs) noexcept {
+		if (this != &rhs) {
+			Release();
+			_control = rhs._control;
+			_slots = rhs._slots;
+			_capacity = rhs._capacity;
+			_population = rhs._population;
+			_deletedCount = rhs._deletedCount;
+			_equalityFunctor = rhs._equalityFunctor;
+
+			rhs._control = nullptr;
+			rhs._slots = nullptr;
+			rhs._capacity = rhs._population = rhs._deletedCount = 0;
+		}
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::~FlatHashMap() {
+		Release();
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Size() const {
+		return _population;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Capacity() const {
+		return _capacity;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline double FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GetLoadFactor() const {
+		return (_capacity == 0) ? 0.0 : _population / gsl::narrow_cast<double>(_capacity);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline bool FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ContainsKey(const TKey& key) const {
+		return (FindSlot(key, GetHash(key)) != _capacity);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Find(const TKey& key) {
+		return Iterator(*this, FindSlot(key, GetHash(key)));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Find(const TKey& key) const {
+		return ConstIterator(*this, FindSlot(key, GetHash(key)));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline TData& FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::At(const TKey& key) {
+		size_type slot = FindSlot(key, GetHash(key));
+
+#ifdef USE_EXCEPTIONS
+		if (slot == _capacity) throw std::runtime_error("Out of bounds - key does not exist in container.");
+#endif // USE_EXCEPTIONS
+		return _slots[slot].second;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline const TData& FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::At(const TKey& key) const {
+		size_type slot = FindSlot(key, GetHash(key));
+
+#ifdef USE_EXCEPTIONS
+		if (slot == _capacity) throw std::runtime_error("Out of bounds - key does not exist in container.");
+#endif // USE_EXCEPTIONS
+		return _slots[slot].second;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename>
+	inline bool FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ContainsKey(const TLookup& key) const {
+		return (FindSlot(key, GetHash(key)) != _capacity);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Find(const TLookup& key) {
+		return Iterator(*this, FindSlot(key, GetHash(key)));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Find(const TLookup& key) const {
+		return ConstIterator(*this, FindSlot(key, GetHash(key)));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename>
+	inline TData& FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::At(const TLookup& key) {
+		size_type slot = FindSlot(key, GetHash(key));
+
+#ifdef USE_EXCEPTIONS
+		if (slot == _capacity) throw std::runtime_error("Out of bounds - key does not exist in container.");
+#endif // USE_EXCEPTIONS
+		return _slots[slot].second;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename>
+	inline const TData& FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::At(const TLookup& key) const {
+		size_type slot = FindSlot(key, GetHash(key));
+
+#ifdef USE_EXCEPTIONS
+		if (slot == _capacity) throw std::runtime_error("Out of bounds - key does not exist in container.");
+#endif // USE_EXCEPTIONS
+		return _slots[slot].second;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline TData& FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::operator[](const TKey& key) {
+		return TryEmplace(key).first->second;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename>
+	inline TData& FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::operator[](const TLookup& key) {
+		return TryEmplace(key).first->second;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	std::pair<typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Insert(const PairType& entry) {
+		InsertPosition position = FindOrPrepareInsert(entry.first);
+		if (position.Inserted) {
+			new(_slots + position.Slot) PairType(entry);
+			CommitInsert(position);
+		}
+		return std::pair<Iterator, bool>(Iterator(*this, position.Slot), position.Inserted);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	std::pair<typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Insert(PairType&& entry) {
+		InsertPosition position = FindOrPrepareInsert(entry.first);
+		if (position.Inserted) {
+			new(_slots + position.Slot) PairType(std::forward<value_type>(entry));
+			CommitInsert(position);
+		}
+		return std::pair<Iterator, bool>(Iterator(*this, position.Slot), position.Inserted);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename... Args>
+	inline std::pair<typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Emplace(Args&&... args) {
+		return Insert(PairType(std::forward<Args>(args)...));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename... Args>
+	std::pair<typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::TryEmplace(const TKey& key, Args&&... args) {
+		InsertPosition position = FindOrPrepareInsert(key);
+		if (position.Inserted) {
+			new(_slots + position.Slot) PairType(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+			CommitInsert(position);
+		}
+		return std::pair<Iterator, bool>(Iterator(*this, position.Slot), position.Inserted);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename... Args>
+	std::pair<typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::TryEmplace(TKey&& key, Args&&... args) {
+		InsertPosition position = FindOrPrepareInsert(key);
+		if (position.Inserted) {
+			new(_slots + position.Slot) PairType(std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+			CommitInsert(position);
+		}
+		return std::pair<Iterator, bool>(Iterator(*this, position.Slot), position.Inserted);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename... Args, typename>
+	std::pair<typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::TryEmplace(const TLookup& key, Args&&... args) {
+		InsertPosition position = FindOrPrepareInsert(key);
+		if (position.Inserted) {
+			new(_slots + position.Slot) PairType(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+			CommitInsert(position);
+		}
+		return std::pair<Iterator, bool>(Iterator(*this, position.Slot), position.Inserted);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TValue>
+	inline std::pair<typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::InsertOrAssign(const TKey& key, TValue&& data) {
+		auto result = TryEmplace(key, std::forward<TValue>(data));
+		if (!result.second) result.first->second = std::forward<TValue>(data);
+		return result;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TValue>
+	inline std::pair<typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::InsertOrAssign(TKey&& key, TValue&& data) {
+		auto result = TryEmplace(std::move(key), std::forward<TValue>(data));
+		if (!result.second) result.first->second = std::forward<TValue>(data);
+		return result;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename TValue, typename>
+	inline std::pair<typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::InsertOrAssign(const TLookup& key, TValue&& data) {
+		auto result = TryEmplace(key, std::forward<TValue>(data));
+		if (!result.second) result.first->second = std::forward<TValue>(data);
+		return result;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline void FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Remove(const TKey& key) {
+		Remove(Find(key));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename>
+	inline void FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Remove(const TLookup& key) {
+		Remove(Find(key));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	void FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Remove(const Iterator& iter) {
+		if (iter._container == this && iter._slotIndex < _capacity) {
+			size_type slot = iter._slotIndex;
+			_slots[slot].~PairType();
+			--_population;
+
+			//if this slot's group still has an empty slot, no probe sequence ever continued past it, so the slot can go straight back to empty
+			Group group(_control + (slot & ~(GroupWidth - 1)));
+			if (group.MatchEmpty() != 0) {
+				_control[slot] = EmptyControl;
+			}
+			else {
+				_control[slot] = DeletedControl;
+				++_deletedCount;
+			}
+		}
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	void FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Clear() {
+		for (size_type i = 0; i < _capacity; ++i) {
+			if (_control[i] >= 0) {
+				_slots[i].~PairType();
+			}
+			_control[i] = EmptyControl;
+		}
+		_population = _deletedCount = 0;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	void FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Reserve(size_type count) {
+		size_type capacity = NormalizeCapacity(_capacity);
+		while (MaxLoad(capacity) < count) {
+			capacity *= 2;
+		}
+		if (capacity > _capacity) {
+			Rehash(capacity);
+		}
+	}
+
+#ifdef USE_HASHMAP_STATISTICS
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	HashMapStatistics FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GetStatistics() const {
+		HashMapStatistics statistics;
+		statistics.BucketCount = _capacity;
+		statistics.Population = _population;
+		statistics.FindCount = _findCount;
+		statistics.InsertCount = _insertCount;
+		statistics.ProbeCount = _probeCount;
+		statistics.MemoryFootprint = sizeof(*this) + _capacity * (sizeof(ControlByte) + sizeof(PairType));
+
+		size_type totalLength = 0;
+		const size_type groupMask = (_capacity == 0) ? 0 : (_capacity / GroupWidth) - 1;
+		for (size_type slot = 0; slot < _capacity; ++slot) {
+			if (_control[slot] < 0) continue;
+
+			//replay the probe sequence FindSlot would follow to count how many groups it visits before this slot
+			size_type groupIndex = (GetHash(_slots[slot].first) >> 7) & groupMask;
+			size_type chainLength = 1;
+			while (groupIndex != slot / GroupWidth) {
+				groupIndex = (groupIndex + chainLength) & groupMask;
+				++chainLength;
+			}
+
+			while (statistics.ChainLengthHistogram.Size() <= chainLength) {
+				statistics.ChainLengthHistogram.PushBack(0);
+			}
+			++statistics.ChainLengthHistogram[chainLength];
+			statistics.LongestChain = std::max(statistics.LongestChain, chainLength);
+			totalLength += chainLength;
+		}
+		statistics.MeanChainLength = (_population == 0) ? 0.0 : static_cast<double>(totalLength) / _population;
+
+		return statistics;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline void FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ResetStatistics() {
+		_findCount = 0;
+		_insertCount = 0;
+		_probeCount = 0;
+	}
+#endif // USE_HASHMAP_STATISTICS
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::begin() {
+		if (_population == 0) return end();
+
+		Iterator beginIter(*this, size_type(0));
+		if (_control[0] < 0) {
+			++beginIter;
+		}
+		return beginIter;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::end() {
+		return Iterator(*this, _capacity);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::begin() const {
+		return cbegin();
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::end() const {
+		return cend();
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::cbegin() const {
+		if (_population == 0) return cend();
+
+		ConstIterator beginIter(*this, size_type(0));
+		if (_control[0] < 0) {
+			++beginIter;
+		}
+		return beginIter;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::cend() const {
+		return ConstIterator(*this, _capacity);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GetHash(const TLookup& key) {
+		THashFunctor hashFunctor;
+		size_type hash = hashFunctor(key);
+
+		//DefaultHash is already well mixed, but specializations such as key.Data() * prime leave their entropy in the low bits, so fold it across the whole word with a multiplicative (Fibonacci) scramble
+		if constexpr (sizeof(size_type) == sizeof(std::uint64_t)) {
+			hash *= size_type(0x9E3779B97F4A7C15ull);
+		}
+		else {
+			hash *= size_type(0x9E3779B9u);
+		}
+		return hash ^ (hash >> (sizeof(size_type) * 4));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::LowestSetBit(std::uint32_t mask) {
+		assert(mask != 0);
+#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return size_type(index);
+#else
+		return size_type(__builtin_ctz(mask));
+#endif // _MSC_VER
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::NormalizeCapacity(size_type capacity) {
+		size_type normalized = GroupWidth;
+		while (normalized < capacity) {
+			normalized *= 2;
+		}
+		return normalized;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::MaxLoad(size_type capacity) {
+		return capacity - capacity / 8;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup>
+	typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::FindSlot(const TLookup& key, size_type hash) const {
+#ifdef USE_HASHMAP_STATISTICS
+		++_findCount;
+#endif // USE_HASHMAP_STATISTICS
+		if (_population == 0) return _capacity;
+
+		const ControlByte hashBits = ControlByte(hash & 0x7F);
+		const size_type groupMask = (_capacity / GroupWidth) - 1;
+		size_type groupIndex = (hash >> 7) & groupMask;
+
+		//triangular probing over a power of two number of groups visits every group exactly once
+		for (size_type probe = 1; probe <= groupMask + 1; ++probe) {
+			const size_type groupStart = groupIndex * GroupWidth;
+			Group group(_control + groupStart);
+
+			for (std::uint32_t matches = group.Match(hashBits); matches != 0; matches &= (matches - 1)) {
+				size_type slot = groupStart + LowestSetBit(matches);
+#ifdef USE_HASHMAP_STATISTICS
+				++_probeCount;
+#endif // USE_HASHMAP_STATISTICS
+				if (KeyEquals(_slots[slot].first, key)) {
+					return slot;
+				}
+			}
+			if (group.MatchEmpty() != 0) break;
+
+			groupIndex = (groupIndex + probe) & groupMask;
+		}
+		return _capacity;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup>
+	inline bool FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::KeyEquals(const TKey& storedKey, const TLookup& key) const {
+		if constexpr (std::is_same_v<TLookup, TKey>) {
+			return _equalityFunctor(storedKey, key);
+		}
+		else {
+			return storedKey == key;
+		}
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::FindInsertSlot(size_type hash) const {
+		const size_type groupMask = (_capacity / GroupWidth) - 1;
+		size_type groupIndex = (hash >> 7) & groupMask;
+
+		for (size_type probe = 1; ; ++probe) {
+			const size_type groupStart = groupIndex * GroupWidth;
+			std::uint32_t available = Group(_control + groupStart).MatchEmptyOrDeleted();
+			if (available != 0) {
+				return groupStart + LowestSetBit(available);
+			}
+
+			assert(probe <= groupMask + 1);
+			groupIndex = (groupIndex + probe) & groupMask;
+		}
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup>
+	typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::InsertPosition FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::FindOrPrepareInsert(const TLookup& key) {
+		size_type hash = GetHash(key);
+		size_type slot = FindSlot(key, hash);
+		if (slot != _capacity) {
+			return InsertPosition{ slot, _control[slot], false };
+		}
+
+		if (_capacity == 0) {
+			Rehash(GroupWidth);
+		}
+		else if (_population + _deletedCount + 1 > MaxLoad(_capacity)) {
+			//mostly tombstones means the same capacity is enough once they're cleared out, otherwise double
+			Rehash((_population + 1 > MaxLoad(_capacity) / 2) ? _capacity * 2 : _capacity);
+		}
+
+		return InsertPosition{ FindInsertSlot(hash), ControlByte(hash & 0x7F), true };
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline void FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::CommitInsert(const InsertPosition& position) {
+		assert(position.Inserted && _control[position.Slot] < 0);
+		if (_control[position.Slot] == DeletedControl) --_deletedCount;
+		_control[position.Slot] = position.Control;
+		++_population;
+#ifdef USE_HASHMAP_STATISTICS
+		++_insertCount;
+#endif // USE_HASHMAP_STATISTICS
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	void FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Rehash(size_type capacity) {
+		ControlByte* oldControl = _control;
+		PairType* oldSlots = _slots;
+		size_type oldCapacity = _capacity;
+		size_type oldPopulation = _population;
+		size_type oldDeletedCount = _deletedCount;
+
+		Allocate(capacity);
+		try {
+			for (size_type i = 0; i < oldCapacity; ++i) {
+				if (oldControl[i] >= 0) {
+					size_type hash = GetHash(oldSlots[i].first);
+					size_type slot = FindInsertSlot(hash);
+					new(_slots + slot) PairType(std::move_if_noexcept(oldSlots[i]));
+					_control[slot] = ControlByte(hash & 0x7F);
+				}
+			}
+		}
+		catch (...) {
+			Release();
+			_control = oldControl;
+			_slots = oldSlots;
+			_capacity = oldCapacity;
+			_population = oldPopulation;
+			_deletedCount = oldDeletedCount;
+			throw;
+		}
+
+		for (size_type i = 0; i < oldCapacity; ++i) {
+			if (oldControl[i] >= 0) {
+				oldSlots[i].~PairType();
+			}
+		}
+		delete[] oldControl;
+		free(oldSlots);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	void FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Allocate(size_type capacity) {
+		assert(capacity >= GroupWidth && (capacity & (capacity - 1)) == 0);
+		_control = new ControlByte[capacity];
+		std::fill(_control, _control + capacity, EmptyControl);
+		_slots = reinterpret_cast<PairType*>(malloc(capacity * sizeof(PairType)));
+		_capacity = capacity;
+		_deletedCount = 0;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	void FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Release() {
+		for (size_type i = 0; i < _capacity; ++i) {
+			if (_control[i] >= 0) {
+				_slots[i].~PairType();
+			}
+		}
+		delete[] _control;
+		free(_slots);
+
+		_control = nullptr;
+		_slots = nullptr;
+		_capacity = _population = _deletedCount = 0;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	void FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::CopyFrom(const FlatHashMap& rhs) {
+		assert(_control == nullptr && _slots == nullptr);
+		if (rhs._capacity == 0) return;
+
+		Allocate(rhs._capacity);
+		for (size_type i = 0; i < _capacity; ++i) {
+			_control[i] = rhs._control[i];
+			if (_control[i] >= 0) {
+				new(_slots + i) PairType(rhs._slots[i]);
+			}
+		}
+		_population = rhs._population;
+		_deletedCount = rhs._deletedCount;
+	}
+#pragma endregion FlatHashMap
+
+#pragma region Group
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Group::Group(const ControlByte* control) :
+#ifdef FLATHASHMAP_USE_SSE2
+		_control{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(control)) }
+#else
+		_control{ control }
+#endif // FLATHASHMAP_USE_SSE2
+	{
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline std::uint32_t FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Group::Match(ControlByte hashBits) const {
+#ifdef FLATHASHMAP_USE_SSE2
+		return std::uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(hashBits), _control)));
+#else
+		std::uint32_t mask = 0;
+		for (size_type i = 0; i < GroupWidth; ++i) {
+			if (_control[i] == hashBits) mask |= (std::uint32_t(1) << i);
+		}
+		return mask;
+#endif // FLATHASHMAP_USE_SSE2
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline std::uint32_t FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Group::MatchEmpty() const {
+		return Match(EmptyControl);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline std::uint32_t FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Group::MatchEmptyOrDeleted() const {
+#ifdef FLATHASHMAP_USE_SSE2
+		//empty and deleted are the only negative control bytes, so their sign bits are exactly the mask
+		return std::uint32_t(_mm_movemask_epi8(_control));
+#else
+		std::uint32_t mask = 0;
+		for (size_type i = 0; i < GroupWidth; ++i) {
+			if (_control[i] < 0) mask |= (std::uint32_t(1) << i);
+		}
+		return mask;
+#endif // FLATHASHMAP_USE_SSE2
+	}
+#pragma endregion Group
+
+#pragma region Iterator
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator::Iterator(FlatHashMap& container, size_type slotIndex) :
+		_slotIndex{ slotIndex }, _container{ &container }
+	{
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::reference FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator::operator*() const {
+#ifdef USE_EXCEPTIONS
+		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
+		if (_slotIndex >= _container->_capacity) throw std::runtime_error("Iterator's data is equal to end, cannot be dereferenced.");
+#endif // USE_EXCEPTIONS
+		return _container->_slots[_slotIndex];
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator::pointer FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator::operator->() const {
+#ifdef USE_EXCEPTIONS
+		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
+		if (_slotIndex >= _container->_capacity) throw std::runtime_error("Iterator's data is equal to end, cannot be dereferenced.");
+#endif // USE_EXCEPTIONS
+		return _container->_slots + _slotIndex;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator& FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator::operator++() {
+#ifdef USE_EXCEPTIONS
+		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
+#endif // USE_EXCEPTIONS
+
+		if (_slotIndex < _container->_capacity) {
+			do {
+				++_slotIndex;
+			} while (_slotIndex < _container->_capacity && _container->_control[_slotIndex] < 0);
+		}
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator::operator++(int) {
+		Iterator it = *this;
+		operator++();
+		return it;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline bool FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator::operator!=(const Iterator& rhs) const {
+		return (_container != rhs._container || _slotIndex != rhs._slotIndex);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline bool FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator::operator==(const Iterator& rhs) const {
+		return !(operator!=(rhs));
+	}
+#pragma endregion Iterator
+
+#pragma region ConstIterator
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator::ConstIterator(const FlatHashMap& container, size_type slotIndex) :
+		_slotIndex{ slotIndex }, _container{ &container }
+	{
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator::ConstIterator(const Iterator& other) :
+		_slotIndex{ other._slotIndex }, _container{ other._container }
+	{
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::const_reference FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator::operator*() const {
+#ifdef USE_EXCEPTIONS
+		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
+		if (_slotIndex >= _container->_capacity) throw std::runtime_error("Iterator's data is equal to end, cannot be dereferenced.");
+#endif // USE_EXCEPTIONS
+		return _container->_slots[_slotIndex];
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator::pointer FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator::operator->() const {
+#ifdef USE_EXCEPTIONS
+		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
+		if (_slotIndex >= _container->_capacity) throw std::runtime_error("Iterator's data is equal to end, cannot be dereferenced.");
+#endif // USE_EXCEPTIONS
+		return _container->_slots + _slotIndex;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator& FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator::operator++() {
+#ifdef USE_EXCEPTIONS
+		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
+#endif // USE_EXCEPTIONS
+
+		if (_slotIndex < _container->_capacity) {
+			do {
+				++_slotIndex;
+			} while (_slotIndex < _container->_capacity && _container->_control[_slotIndex] < 0);
+		}
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator::operator++(int) {
+		ConstIterator it = *this;
+		operator++();
+		return it;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline bool FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator::operator!=(const ConstIterator& rhs) const {
+		return (_container != rhs._container || _slotIndex != rhs._slotIndex);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline bool FlatHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator::operator==(const ConstIterator& rhs) const {
+		return !(operator!=(rhs));
+	}
+#pragma endregion ConstIterator
+}
@@ -0,0 +1,274 @@
+/// <summary>
+/// The declaration of the templated class FrozenHashMap, an immutable map over a fixed key set with a collision-free hash.
+/// </summary>
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "Vector.h"
+#include "Hashing.h"
+#include "DefaultHash.h"
+#include "DefaultEquality.h"
+
+namespace FIEAGameEngine {
+	/// <summary>
+	/// A templated, read-only hash map for lookup tables that are built once and then only searched, such as the Datum type names or a registry that has finished registering.
+	/// Construction finds a perfect hash over the given keys by hash and displace: keys are grouped into small buckets by their hash, and each bucket is given a seed that scatters all of its keys onto slots no other key uses.
+	/// A lookup is then one hash of the key, one multiply to find its slot, and one key comparison, with no chains or probe sequences to walk.
+	/// Entries are kept in the order they were given, and ConstIterators visit them in that order. Duplicate keys keep the first entry, like HashMap::Insert.
+	/// If no perfect hash can be found, as when two different keys share a hash code, the FrozenHashMap has no slots and lookups compare against each entry in order instead.
+	/// </summary>
+	/// <typeparam name="TKey">The type of object used as a key.</typeparam>
+	/// <typeparam name="TData">The type of object stored at a key.</typeparam>
+	/// <typeparam name="THashFunctor">The functor used to hash a key type. Distinct keys should have distinct hash codes.</typeparam>
+	/// <typeparam name="TEqualityFunctor">The functor used to compare two keys.</typeparam>
+	template <typename TKey, typename TData, typename THashFunctor = DefaultHash<TKey>, typename TEqualityFunctor = DefaultEquality<const TKey>>
+	class FrozenHashMap final {
+	public:
+		using PairType = std::pair<const TKey, TData>;
+		using key_type = const TKey;
+		using mapped_type = TData;
+		using value_type = PairType;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using hasher = THashFunctor;
+		using key_equal = TEqualityFunctor;
+		using EqualityFunctor = TEqualityFunctor;
+		using const_reference = const value_type&;
+		using ConstIterator = typename Vector<PairType>::ConstIterator;
+		using const_iterator = ConstIterator;
+
+		/// <summary>
+		/// Whether TLookup can be used to search the FrozenHashMap without constructing a key: the hash functor must be transparent and TLookup must not already be the key type.
+		/// Heterogeneous lookups compare stored keys against the lookup value with operator== instead of the equality functor.
+		/// </summary>
+		template <typename TLookup>
+		static constexpr bool IsLookupType = IsTransparentHash<THashFunctor>::value && !std::is_same_v<std::decay_t<TLookup>, std::remove_const_t<TKey>>;
+
+		/// <summary>
+		/// The default constructor for an empty FrozenHashMap. Allocates nothing.
+		/// </summary>
+		/// <param name="equalityFunctor">A method used to determine relevant equality between two keys</param>
+		explicit FrozenHashMap(EqualityFunctor equalityFunctor = EqualityFunctor{});
+		/// <summary>
+		/// An Initializer list constructor for FrozenHashMap, building the perfect hash over the given entries.
+		/// </summary>
+		/// <param name="list">The entries of the FrozenHashMap</param>
+		/// <param name="equalityFunctor">A method used to determine relevant equality between two keys</param>
+		FrozenHashMap(std::initializer_list<PairType> list, EqualityFunctor equalityFunctor = EqualityFunctor{});
+		/// <summary>
+		/// A range constructor for FrozenHashMap, building the perfect hash over the entries between two iterators, i.e. to freeze the current contents of a HashMap.
+		/// </summary>
+		/// <param name="first">An iterator to the first entry</param>
+		/// <param name="last">An iterator one past the last entry</param>
+		/// <param name="equalityFunctor">A method used to determine relevant equality between two keys</param>
+		template <typename TIterator>
+		FrozenHashMap(TIterator first, TIterator last, EqualityFunctor equalityFunctor = EqualityFunctor{});
+		/// <summary>
+		/// A copy constructor for a FrozenHashMap. Using the compiler provided default implementation.
+		/// </summary>
+		/// <param name="rhs">The FrozenHashMap to copy</param>
+		FrozenHashMap(const FrozenHashMap& rhs) = default;
+		/// <summary>
+		/// The move constructor for a FrozenHashMap. Using the compiler provided default implementation.
+		/// </summary>
+		/// <param name="rhs">The FrozenHashMap to move data from</param>
+		FrozenHashMap(FrozenHashMap&& rhs) noexcept = default;
+		/// <summary>
+		/// The copy assignment operator for a FrozenHashMap. Using the compiler provided default implementation.
+		/// </summary>
+		/// <param name="rhs">The FrozenHashMap to copy</param>
+		/// <returns>A reference to the updated FrozenHashMap</returns>
+		FrozenHashMap& operator=(const FrozenHashMap& rhs) = default;
+		/// <summary>
+		/// The move assignment operator for a FrozenHashMap. Using the compiler provided default implementation.
+		/// </summary>
+		/// <param name="rhs">The FrozenHashMap to move data from</param>
+		/// <returns>A reference to the updated FrozenHashMap</returns>
+		FrozenHashMap& operator=(FrozenHashMap&& rhs) noexcept = default;
+		/// <summary>
+		/// The destructor for a FrozenHashMap. Using the compiler provided default implementation.
+		/// </summary>
+		~FrozenHashMap() = default;
+
+		/// <summary>
+		/// Get the number of entries.
+		/// </summary>
+		/// <returns>The population of the FrozenHashMap</returns>
+		[[nodiscard]] size_type Size() const;
+		/// <summary>
+		/// Check if the FrozenHashMap has no entries.
+		/// </summary>
+		/// <returns>A boolean indicating if the FrozenHashMap is empty</returns>
+		[[nodiscard]] bool IsEmpty() const;
+		/// <summary>
+		/// Get the number of slots the perfect hash maps keys onto.
+		/// </summary>
+		/// <returns>The number of slots, zero if no perfect hash was found</returns>
+		[[nodiscard]] size_type SlotCount() const;
+
+		/// <summary>
+		/// Check if the FrozenHashMap contains a given key.
+		/// </summary>
+		/// <param name="key">The key to look for</param>
+		/// <returns>A boolean determining if the FrozenHashMap contains the given key</returns>
+		[[nodiscard]] bool ContainsKey(const TKey& key) const;
+		/// <summary>
+		/// Check if the FrozenHashMap contains a key equal to the given lookup value (i.e. a std::string_view or const char* for a std::string key), without constructing a key.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>A boolean determining if the FrozenHashMap contains an equal key</returns>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		[[nodiscard]] bool ContainsKey(const TLookup& key) const;
+		/// <summary>
+		/// Find the entry with a given key.
+		/// </summary>
+		/// <param name="key">The key to look for</param>
+		/// <returns>A ConstIterator to the entry, or end() if the key is not present</returns>
+		[[nodiscard]] ConstIterator Find(const TKey& key) const;
+		/// <summary>
+		/// Find the entry with a key equal to the given lookup value, without constructing a key.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>A ConstIterator to the entry, or end() if no equal key is present</returns>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		[[nodiscard]] ConstIterator Find(const TLookup& key) const;
+		/// <summary>
+		/// Get the data stored at a given key.
+		/// </summary>
+		/// <param name="key">The key to look for</param>
+		/// <returns>A const reference to the data</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the key is not present</exception>
+		[[nodiscard]] const TData& At(const TKey& key) const;
+		/// <summary>
+		/// Get the data stored at a key equal to the given lookup value, without constructing a key.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>A const reference to the data</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and no equal key is present</exception>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		[[nodiscard]] const TData& At(const TLookup& key) const;
+
+		/// <summary>
+		/// Get a ConstIterator to the first entry.
+		/// </summary>
+		/// <returns>A ConstIterator to the first entry in the order they were given</returns>
+		[[nodiscard]] ConstIterator begin() const;
+		/// <summary>
+		/// Get a ConstIterator one past the last entry.
+		/// </summary>
+		/// <returns>A ConstIterator one past the last entry</returns>
+		[[nodiscard]] ConstIterator end() const;
+		/// <summary>
+		/// Get a ConstIterator to the first entry.
+		/// </summary>
+		/// <returns>A ConstIterator to the first entry in the order they were given</returns>
+		[[nodiscard]] ConstIterator cbegin() const;
+		/// <summary>
+		/// Get a ConstIterator one past the last entry.
+		/// </summary>
+		/// <returns>A ConstIterator one past the last entry</returns>
+		[[nodiscard]] ConstIterator cend() const;
+
+	private:
+		/// <summary>
+		/// Marks a slot that no key maps to.
+		/// </summary>
+		static constexpr std::uint32_t EmptySlot = ~std::uint32_t(0);
+		/// <summary>
+		/// The number of seeds tried for a bucket before the slot table is doubled and the search starts over.
+		/// </summary>
+		static constexpr std::uint32_t MaxSeedAttempts = 1u << 16;
+		/// <summary>
+		/// The most slots per entry the slot table may grow to before the search gives up.
+		/// </summary>
+		static constexpr std::size_t MaxSlotsPerEntry = 16;
+
+		/// <summary>
+		/// Hash a key or lookup value with the hash functor.
+		/// </summary>
+		/// <param name="key">The key or lookup value</param>
+		/// <returns>The full hash code</returns>
+		template <typename TLookup>
+		[[nodiscard]] static size_type GetHash(const TLookup& key);
+		/// <summary>
+		/// Get the bucket a hash code belongs to, from the top bits of its Fibonacci-scrambled value.
+		/// </summary>
+		/// <param name="hash">The hash code</param>
+		/// <param name="bucketBits">The base two logarithm of the bucket count</param>
+		/// <returns>The bucket index</returns>
+		[[nodiscard]] static size_type GetBucket(size_type hash, std::uint32_t bucketBits);
+		/// <summary>
+		/// Get the slot a hash code lands on under its bucket's seed.
+		/// </summary>
+		/// <param name="hash">The hash code</param>
+		/// <param name="seed">The seed of the hash code's bucket</param>
+		/// <param name="slotMask">The slot count minus one</param>
+		/// <returns>The slot index</returns>
+		[[nodiscard]] static size_type GetSlot(size_type hash, std::uint32_t seed, size_type slotMask);
+		/// <summary>
+		/// Compare a stored key against a key or lookup value.
+		/// </summary>
+		/// <param name="storedKey">The key of an entry</param>
+		/// <param name="key">The key or lookup value being searched for</param>
+		/// <returns>A boolean indicating if they are equal</returns>
+		template <typename TLookup>
+		[[nodiscard]] bool KeyMatches(const TKey& storedKey, const TLookup& key) const;
+		/// <summary>
+		/// Find the index into _entries of the entry with the given key.
+		/// </summary>
+		/// <param name="key">The key or lookup value</param>
+		/// <returns>The entry index, or Size() if the key is not present</returns>
+		template <typename TLookup>
+		[[nodiscard]] size_type FindIndex(const TLookup& key) const;
+		/// <summary>
+		/// Add an entry unless its key is already present, recording its hash code.
+		/// </summary>
+		/// <param name="entry">The entry to add</param>
+		/// <param name="hashes">The hash codes of the entries added so far</param>
+		void AddEntry(const PairType& entry, Vector<size_type>& hashes);
+		/// <summary>
+		/// Search for a seed per bucket that places every key on its own slot, growing the slot table until one is found or MaxSlotsPerEntry is passed.
+		/// Leaves no slots if two different keys have the same hash code or no placement is found.
+		/// </summary>
+		/// <param name="hashes">The hash code of every entry, by entry index</param>
+		void Build(const Vector<size_type>& hashes);
+		/// <summary>
+		/// Try to place every bucket with the current slot count.
+		/// </summary>
+		/// <param name="hashes">The hash code of every entry, by entry index</param>
+		/// <param name="buckets">The entry indices in each bucket</param>
+		/// <param name="order">The bucket indices, largest bucket first</param>
+		/// <returns>A boolean indicating if every bucket found a seed</returns>
+		bool TryPlace(const Vector<size_type>& hashes, const Vector<Vector<size_type>>& buckets, const Vector<size_type>& order);
+
+		/// <summary>
+		/// The entries, in the order they were given.
+		/// </summary>
+		Vector<PairType> _entries;
+		/// <summary>
+		/// For each slot, the index of the entry that maps to it, or EmptySlot.
+		/// </summary>
+		Vector<std::uint32_t> _slots;
+		/// <summary>
+		/// For each bucket, the seed that scatters its keys onto free slots.
+		/// </summary>
+		Vector<std::uint32_t> _seeds;
+		/// <summary>
+		/// The slot count minus one. The slot count is always a power of two.
+		/// </summary>
+		size_type _slotMask{ 0 };
+		/// <summary>
+		/// The base two logarithm of the bucket count.
+		/// </summary>
+		std::uint32_t _bucketBits{ 0 };
+		/// <summary>
+		/// A method used to determine relevant equality between two keys.
+		/// </summary>
+		EqualityFunctor _equalityFunctor;
+	};
+}
+
+#include "FrozenHashMap.inl"
@@ -0,0 +1,251 @@
+/// <summary>
+/// The fully specified implementation of the templated class FrozenHashMap.
+/// </summary>
+
+#pragma once
+
+#include <iterator>
+#include "FrozenHashMap.h"
+
+namespace FIEAGameEngine {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::FrozenHashMap(EqualityFunctor equalityFunctor) :
+		_equalityFunctor{ std::move(equalityFunctor) }
+	{
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::FrozenHashMap(std::initializer_list<PairType> list, EqualityFunctor equalityFunctor) :
+		FrozenHashMap(list.begin(), list.end(), std::move(equalityFunctor))
+	{
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TIterator>
+	FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::FrozenHashMap(TIterator first, TIterator last, EqualityFunctor equalityFunctor) :
+		_equalityFunctor{ std::move(equalityFunctor) }
+	{
+		const size_type count = static_cast<size_type>(std::distance(first, last));
+		Vector<size_type> hashes(count);
+		_entries.Reserve(count);
+		for (; first != last; ++first) {
+			AddEntry(*first, hashes);
+		}
+		Build(hashes);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Size() const {
+		return _entries.Size();
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline bool FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::IsEmpty() const {
+		return _entries.IsEmpty();
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::SlotCount() const {
+		return _slots.Size();
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline bool FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ContainsKey(const TKey& key) const {
+		return FindIndex(key) != Size();
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename>
+	inline bool FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ContainsKey(const TLookup& key) const {
+		return FindIndex(key) != Size();
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Find(const TKey& key) const {
+		return cbegin() + static_cast<difference_type>(FindIndex(key));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename>
+	inline typename FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Find(const TLookup& key) const {
+		return cbegin() + static_cast<difference_type>(FindIndex(key));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline const TData& FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::At(const TKey& key) const {
+		size_type index = FindIndex(key);
+#ifdef USE_EXCEPTIONS
+		if (index == Size()) throw std::runtime_error("Out of bounds - key does not exist in container.");
+#endif // USE_EXCEPTIONS
+		return _entries[index].second;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename>
+	inline const TData& FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::At(const TLookup& key) const {
+		size_type index = FindIndex(key);
+#ifdef USE_EXCEPTIONS
+		if (index == Size()) throw std::runtime_error("Out of bounds - key does not exist in container.");
+#endif // USE_EXCEPTIONS
+		return _entries[index].second;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::begin() const {
+		return _entries.cbegin();
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::end() const {
+		return _entries.cend();
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::cbegin() const {
+		return _entries.cbegin();
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::cend() const {
+		return _entries.cend();
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup>
+	inline typename FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GetHash(const TLookup& key) {
+		return static_cast<size_type>(THashFunctor{}(key));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GetBucket(size_type hash, std::uint32_t bucketBits) {
+		if (bucketBits == 0) return 0;
+		return static_cast<size_type>((static_cast<std::uint64_t>(hash) * Hashing::DefaultSeed) >> (64 - bucketBits));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GetSlot(size_type hash, std::uint32_t seed, size_type slotMask) {
+		return static_cast<size_type>(Hashing::Mix(static_cast<std::uint64_t>(hash) ^ Hashing::Secret[0], seed ^ Hashing::Secret[1])) & slotMask;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup>
+	inline bool FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::KeyMatches(const TKey& storedKey, const TLookup& key) const {
+		if constexpr (std::is_same_v<std::decay_t<TLookup>, std::remove_const_t<TKey>>) {
+			return _equalityFunctor(storedKey, key);
+		}
+		else {
+			return storedKey == key;
+		}
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup>
+	inline typename FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::FindIndex(const TLookup& key) const {
+		if (_slots.IsEmpty()) {
+			size_type index = 0;
+			while (index < Size() && !KeyMatches(_entries[index].first, key)) ++index;
+			return index;
+		}
+
+		size_type hash = GetHash(key);
+		std::uint32_t index = _slots[GetSlot(hash, _seeds[GetBucket(hash, _bucketBits)], _slotMask)];
+		return (index != EmptySlot && KeyMatches(_entries[index].first, key)) ? index : Size();
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	void FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::AddEntry(const PairType& entry, Vector<size_type>& hashes) {
+		size_type hash = GetHash(entry.first);
+		for (size_type i = 0; i < hashes.Size(); ++i) {
+			if (hashes[i] == hash && _equalityFunctor(_entries[i].first, entry.first)) return;
+		}
+		_entries.PushBack(entry);
+		hashes.PushBack(hash);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	void FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Build(const Vector<size_type>& hashes) {
+		const size_type count = _entries.Size();
+		if (count == 0) return;
+		assert(count < EmptySlot);
+
+		while ((size_type(1) << _bucketBits) * 2 < count) ++_bucketBits;
+		const size_type bucketCount = size_type(1) << _bucketBits;
+
+		Vector<Vector<size_type>> buckets(bucketCount);
+		for (size_type i = 0; i < bucketCount; ++i) {
+			buckets.PushBack(Vector<size_type>());
+		}
+		size_type largestBucket = 0;
+		for (size_type i = 0; i < count; ++i) {
+			Vector<size_type>& bucket = buckets[GetBucket(hashes[i], _bucketBits)];
+			for (size_type other : bucket) {
+				//no seed can separate two keys with the same hash code
+				if (hashes[other] == hashes[i]) {
+					_bucketBits = 0;
+					return;
+				}
+			}
+			bucket.PushBack(i);
+			largestBucket = std::max(largestBucket, bucket.Size());
+		}
+
+		Vector<size_type> order(bucketCount);
+		for (size_type size = largestBucket; size > 0; --size) {
+			for (size_type i = 0; i < bucketCount; ++i) {
+				if (buckets[i].Size() == size) order.PushBack(i);
+			}
+		}
+
+		size_type slotCount = 1;
+		while (slotCount < count + count / 4 + 1) slotCount <<= 1;
+		for (; slotCount <= count * MaxSlotsPerEntry; slotCount <<= 1) {
+			_slotMask = slotCount - 1;
+			if (TryPlace(hashes, buckets, order)) return;
+		}
+
+		_slots = Vector<std::uint32_t>();
+		_seeds = Vector<std::uint32_t>();
+		_slotMask = 0;
+		_bucketBits = 0;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	bool FrozenHashMap<TKey, TData, THashFunctor, TEqualityFunctor>::TryPlace(const Vector<size_type>& hashes, const Vector<Vector<size_type>>& buckets, const Vector<size_type>& order) {
+		const size_type slotCount = _slotMask + 1;
+		_slots = Vector<std::uint32_t>(slotCount);
+		for (size_type i = 0; i < slotCount; ++i) {
+			_slots.PushBack(EmptySlot);
+		}
+		_seeds = Vector<std::uint32_t>(buckets.Size());
+		for (size_type i = 0; i < buckets.Size(); ++i) {
+			_seeds.PushBack(0);
+		}
+
+		Vector<size_type> placed(buckets[order[0]].Size());
+		for (size_type bucketIndex : order) {
+			const Vector<size_type>& bucket = buckets[bucketIndex];
+			bool found = false;
+			for (std::uint32_t seed = 0; seed < MaxSeedAttempts && !found; ++seed) {
+				placed.Clear();
+				found = true;
+				for (size_type entryIndex : bucket) {
+					size_type slot = GetSlot(hashes[entryIndex], seed, _slotMask);
+					if (_slots[slot] != EmptySlot || std::find(placed.begin(), placed.end(), slot) != placed.end()) {
+						found = false;
+						break;
+					}
+					placed.PushBack(slot);
+				}
+
+				if (found) {
+					for (size_type i = 0; i < bucket.Size(); ++i) {
+						_slots[placed[i]] = static_cast<std::uint32_t>(bucket[i]);
+					}
+					_seeds[bucketIndex] = seed;
+				}
+			}
+			if (!found) return false;
+		}
+		return true;
+	}
+}
@@ -40,7 +40,7 @@ namespace FIEAGameEngine {
 		UpdateChildren(gameTime);
 	}
 
-	void GameObject::CreateChild(const std::string& childClassName, const std::string& childName)
+	void GameObject::CreateChild(std::string_view childClassName, const std::string& childName)
 	{
 		Scope* newChild = Factory<Scope>::Create(childClassName);
 
@@ -51,10 +51,10 @@ namespace FIEAGameEngine {
 		assert(newChild->Is(GameObject::TypeIdClass()));
 		GameObject* newGameObject = static_cast<GameObject*>(newChild);
 		newGameObject->name = childName;
-		Adopt(*newGameObject, "children"s);
+		Adopt(*newGameObject, "children");
 	}
 
-	void GameObject::CreateAction(const std::string& actionClassName, const std::string& actionName)
+	void GameObject::CreateAction(std::string_view actionClassName, const std::string& actionName)
 	{
 		Scope* newAction = Factory<Scope>::Create(actionClassName);
 
@@ -65,7 +65,7 @@ namespace FIEAGameEngine {
 		assert(newAction->Is(Action::TypeIdClass()));
 		Action* newGameObject = static_cast<Action*>(newAction);
 		newGameObject->SetName(actionName);
-		Adopt(*newGameObject, "actions"s);
+		Adopt(*newGameObject, "actions");
 	}
 
 	bool GameObject::Equals(const RTTI* rhs) const {
@@ -66,13 +66,13 @@ namespace FIEAGameEngine {
 		/// </summary>
 		/// <param name="childClassName">The class name of the child to create.</param>
 		/// <param name="childName">The name of the child to create.</param>
-		void CreateChild(const std::string& childClassName, const std::string& childName);
+		void CreateChild(std::string_view childClassName, const std::string& childName);
 		/// <summary>
 		/// Convenience function to create a default instance of the given type and adopt it as an action.
 		/// </summary>
 		/// <param name="childClassName">The class name of the action to create.</param>
 		/// <param name="childName">The name of the action to create.</param>
-		void CreateAction(const std::string& actionClassName, const std::string& actionName);
+		void CreateAction(std::string_view actionClassName, const std::string& actionName);
 
 		/// <summary>
 		/// Overriden RTTI functionality - Compare the equality of this GameObject with another object.
@@ -0,0 +1,185 @@
+/// <summary>
+/// The declarations of the growth policies containers use to pick their next capacity, and of the holder that stores a policy inside a container.
+/// A growth policy is a callable that takes a container's current capacity and returns how many elements to add to it, like DefaultGrowth.
+/// A policy may instead take the current capacity and the size in bytes of one element, when it needs to reason about the size of the allocation.
+/// Containers take their policy as a template parameter, so stateless policies take up no space and their call is resolved at compile time.
+/// </summary>
+
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include "DefaultGrowth.h"
+
+namespace FIEAGameEngine {
+	/// <summary>
+	/// Grows the capacity by a constant ratio of Numerator / Denominator, adding at least one element.
+	/// </summary>
+	/// <typeparam name="Numerator">The numerator of the growth ratio.</typeparam>
+	/// <typeparam name="Denominator">The denominator of the growth ratio.</typeparam>
+	template <std::size_t Numerator, std::size_t Denominator>
+	struct GeometricGrowth final {
+		static_assert(Denominator > 0 && Numerator > Denominator, "A geometric growth ratio must be greater than one.");
+
+		/// <summary>
+		/// Compute how many elements to add to the given capacity.
+		/// </summary>
+		/// <param name="currentCapacity">The container's current capacity.</param>
+		/// <returns>The number of elements to add, which is at least one.</returns>
+		[[nodiscard]] constexpr std::size_t operator()(std::size_t currentCapacity) const;
+	};
+
+	/// <summary>
+	/// Grows the capacity by half of itself. Equivalent to DefaultGrowth.
+	/// </summary>
+	using HalfAgainGrowth = GeometricGrowth<3, 2>;
+	/// <summary>
+	/// Doubles the capacity.
+	/// </summary>
+	using DoublingGrowth = GeometricGrowth<2, 1>;
+
+	/// <summary>
+	/// Grows the capacity by a constant number of elements. Wastes little memory, but makes filling a container quadratic, so it suits containers with a known, modest upper bound.
+	/// </summary>
+	/// <typeparam name="ChunkSize">The number of elements to add on each growth.</typeparam>
+	template <std::size_t ChunkSize>
+	struct FixedGrowth final {
+		static_assert(ChunkSize > 0, "A fixed growth chunk must add at least one element.");
+
+		/// <summary>
+		/// Compute how many elements to add to the given capacity.
+		/// </summary>
+		/// <param name="currentCapacity">The container's current capacity.</param>
+		/// <returns>ChunkSize.</returns>
+		[[nodiscard]] constexpr std::size_t operator()(std::size_t currentCapacity) const;
+	};
+
+	/// <summary>
+	/// Grows the capacity by half of itself and then rounds the allocation up to a whole number of pages, so the bytes the allocator would round up anyway hold elements.
+	/// </summary>
+	/// <typeparam name="PageSize">The page size, in bytes.</typeparam>
+	template <std::size_t PageSize = 4096>
+	struct PageRoundedGrowth final {
+		static_assert(PageSize > 0, "A page must hold at least one byte.");
+
+		/// <summary>
+		/// Compute how many elements to add to the given capacity.
+		/// </summary>
+		/// <param name="currentCapacity">The container's current capacity.</param>
+		/// <param name="elementSize">The size in bytes of one element.</param>
+		/// <returns>The number of elements to add, which is at least one.</returns>
+		[[nodiscard]] constexpr std::size_t operator()(std::size_t currentCapacity, std::size_t elementSize) const;
+	};
+
+	/// <summary>
+	/// Grows the capacity with a functor chosen at runtime. Kept for code that passed a std::function increment functor to a container before growth policies existed; it costs the size of a std::function and an indirect call per growth.
+	/// </summary>
+	struct RuntimeGrowth final {
+		/// <summary>
+		/// The type of functor a RuntimeGrowth calls.
+		/// </summary>
+		using IncrementFunctor = std::function<std::size_t(std::size_t)>;
+
+		/// <summary>
+		/// Construct a RuntimeGrowth calling DefaultGrowth.
+		/// </summary>
+		RuntimeGrowth();
+		/// <summary>
+		/// Construct a RuntimeGrowth calling the given functor. Implicit, so a functor can be passed wherever a RuntimeGrowth is expected.
+		/// </summary>
+		/// <typeparam name="TFunctor">The type of the functor.</typeparam>
+		/// <param name="incrementFunctor">A functor that will return how much to increment a capacity by when called on that capacity.</param>
+		template <typename TFunctor, typename = std::enable_if_t<!std::is_same_v<std::decay_t<TFunctor>, RuntimeGrowth> && std::is_invocable_r_v<std::size_t, TFunctor&, std::size_t>>>
+		RuntimeGrowth(TFunctor incrementFunctor);
+
+		/// <summary>
+		/// Compute how many elements to add to the given capacity.
+		/// </summary>
+		/// <param name="currentCapacity">The container's current capacity.</param>
+		/// <returns>The result of the functor.</returns>
+		[[nodiscard]] std::size_t operator()(std::size_t currentCapacity) const;
+
+		/// <summary>
+		/// The functor this RuntimeGrowth calls.
+		/// </summary>
+		IncrementFunctor incrementFunctor;
+	};
+
+	/// <summary>
+	/// Compute the capacity a container should grow to with the given policy, whether the policy looks at the element size or not.
+	/// </summary>
+	/// <typeparam name="TGrowth">The type of the growth policy.</typeparam>
+	/// <param name="growthPolicy">The growth policy.</param>
+	/// <param name="currentCapacity">The container's current capacity.</param>
+	/// <param name="elementSize">The size in bytes of one element.</param>
+	/// <returns>The new capacity, which is greater than currentCapacity.</returns>
+	template <typename TGrowth>
+	[[nodiscard]] constexpr std::size_t NextCapacity(const TGrowth& growthPolicy, std::size_t currentCapacity, std::size_t elementSize);
+
+	/// <summary>
+	/// Stores the growth policy of a container. Containers derive from it privately, so a stateless policy adds nothing to the container's size.
+	/// </summary>
+	/// <typeparam name="TGrowth">The type of the growth policy.</typeparam>
+	template <typename TGrowth, bool IsStateless = std::is_empty_v<TGrowth>>
+	class GrowthPolicyHolder {
+	public:
+		/// <summary>
+		/// Retrieve the growth policy.
+		/// </summary>
+		/// <returns>A constant reference to the growth policy.</returns>
+		[[nodiscard]] const TGrowth& GetGrowthPolicy() const;
+
+	protected:
+		/// <summary>
+		/// Construct a GrowthPolicyHolder storing the given policy.
+		/// </summary>
+		/// <param name="growthPolicy">The policy to store.</param>
+		explicit GrowthPolicyHolder(TGrowth growthPolicy = TGrowth{});
+
+		/// <summary>
+		/// Compute the capacity to grow to from the given capacity with the stored policy.
+		/// </summary>
+		/// <param name="currentCapacity">The container's current capacity.</param>
+		/// <param name="elementSize">The size in bytes of one element.</param>
+		/// <returns>The new capacity, which is greater than currentCapacity.</returns>
+		[[nodiscard]] std::size_t GrowCapacity(std::size_t currentCapacity, std::size_t elementSize) const;
+
+	private:
+		/// <summary>
+		/// The stored growth policy.
+		/// </summary>
+		TGrowth _growthPolicy;
+	};
+
+	/// <summary>
+	/// Specialization of GrowthPolicyHolder for stateless policies, which are default constructed wherever they are needed instead of being stored.
+	/// </summary>
+	/// <typeparam name="TGrowth">The type of the growth policy.</typeparam>
+	template <typename TGrowth>
+	class GrowthPolicyHolder<TGrowth, true> {
+	public:
+		/// <summary>
+		/// Retrieve the growth policy.
+		/// </summary>
+		/// <returns>A default constructed growth policy.</returns>
+		[[nodiscard]] TGrowth GetGrowthPolicy() const;
+
+	protected:
+		/// <summary>
+		/// Construct a GrowthPolicyHolder. The policy is stateless, so nothing is stored.
+		/// </summary>
+		explicit GrowthPolicyHolder(TGrowth = TGrowth{});
+
+		/// <summary>
+		/// Compute the capacity to grow to from the given capacity with the policy.
+		/// </summary>
+		/// <param name="currentCapacity">The container's current capacity.</param>
+		/// <param name="elementSize">The size in bytes of one element.</param>
+		/// <returns>The new capacity, which is greater than currentCapacity.</returns>
+		[[nodiscard]] std::size_t GrowCapacity(std::size_t currentCapacity, std::size_t elementSize) const;
+	};
+}
+
+#include "GrowthPolicy.inl"
@@ -0,0 +1,82 @@
+/// <summary>
+/// The implementation of the growth policies and of GrowthPolicyHolder.
+/// </summary>
+
+#pragma once
+#include "GrowthPolicy.h"
+
+namespace FIEAGameEngine {
+	template <std::size_t Numerator, std::size_t Denominator>
+	inline constexpr std::size_t GeometricGrowth<Numerator, Denominator>::operator()(std::size_t currentCapacity) const {
+		return std::max(currentCapacity * (Numerator - Denominator) / Denominator, std::size_t(1));
+	}
+
+	template <std::size_t ChunkSize>
+	inline constexpr std::size_t FixedGrowth<ChunkSize>::operator()(std::size_t) const {
+		return ChunkSize;
+	}
+
+	template <std::size_t PageSize>
+	inline constexpr std::size_t PageRoundedGrowth<PageSize>::operator()(std::size_t currentCapacity, std::size_t elementSize) const {
+		std::size_t minimumCapacity = currentCapacity + std::max(currentCapacity / std::size_t(2), std::size_t(1));
+		std::size_t pages = (minimumCapacity * elementSize + PageSize - 1) / PageSize;
+		return (pages * PageSize) / elementSize - currentCapacity;
+	}
+
+	inline RuntimeGrowth::RuntimeGrowth() :
+		incrementFunctor{ DefaultGrowth{} }
+	{
+	}
+
+	template <typename TFunctor, typename>
+	inline RuntimeGrowth::RuntimeGrowth(TFunctor incrementFunctor) :
+		incrementFunctor{ std::move(incrementFunctor) }
+	{
+	}
+
+	inline std::size_t RuntimeGrowth::operator()(std::size_t currentCapacity) const {
+		return incrementFunctor(currentCapacity);
+	}
+
+	template <typename TGrowth>
+	inline constexpr std::size_t NextCapacity(const TGrowth& growthPolicy, std::size_t currentCapacity, std::size_t elementSize) {
+		std::size_t increment = 0;
+		if constexpr (std::is_invocable_r_v<std::size_t, const TGrowth&, std::size_t, std::size_t>) {
+			increment = growthPolicy(currentCapacity, elementSize);
+		}
+		else {
+			increment = growthPolicy(currentCapacity);
+		}
+		return currentCapacity + std::max(increment, std::size_t(1));
+	}
+
+	template <typename TGrowth, bool IsStateless>
+	inline GrowthPolicyHolder<TGrowth, IsStateless>::GrowthPolicyHolder(TGrowth growthPolicy) :
+		_growthPolicy{ std::move(growthPolicy) }
+	{
+	}
+
+	template <typename TGrowth, bool IsStateless>
+	inline const TGrowth& GrowthPolicyHolder<TGrowth, IsStateless>::GetGrowthPolicy() const {
+		return _growthPolicy;
+	}
+
+	template <typename TGrowth, bool IsStateless>
+	inline std::size_t GrowthPolicyHolder<TGrowth, IsStateless>::GrowCapacity(std::size_t currentCapacity, std::size_t elementSize) const {
+		return NextCapacity(_growthPolicy, currentCapacity, elementSize);
+	}
+
+	template <typename TGrowth>
+	inline GrowthPolicyHolder<TGrowth, true>::GrowthPolicyHolder(TGrowth) {
+	}
+
+	template <typename TGrowth>
+	inline TGrowth GrowthPolicyHolder<TGrowth, true>::GetGrowthPolicy() const {
+		return TGrowth{};
+	}
+
+	template <typename TGrowth>
+	inline std::size_t GrowthPolicyHolder<TGrowth, true>::GrowCapacity(std::size_t currentCapacity, std::size_t elementSize) const {
+		return NextCapacity(TGrowth{}, currentCapacity, elementSize);
+	}
+}
@@ -5,27 +5,63 @@
 
 #include <cstddef>
 #include <cassert>
+#include <cmath>
+#include <memory>
+#include <type_traits>
+#include <tuple>
+#include <utility>
 #include "gsl/gsl"
 #include "Vector.h"
 #include "SList.h"
+#include "NodePool.h"
 #include "HashMap.h"
 #include "DefaultHash.h"
 #include "DefaultEquality.h"
+#include "HashMapStatistics.h"
 
 namespace FIEAGameEngine {
 	/// <summary>
 	/// A templated container class for a hashmap. 
 	/// HashMaps have Iterators and ConstIterators and move semantics are implemented in assignments, copy constructors, and inserts. 
-	/// The load factor can be retrieved but there is no automatic rehashing.
+	/// When the average number of entries per chain exceeds the max load factor, an insert grows the chain count; the migration can either happen all at once or be spread across subsequent operations.
+	/// Growing relinks the existing chain nodes rather than copying them, so pointers and references to stored PairTypes remain valid. Iterators are invalidated by any operation that grows or migrates chains.
+	/// Wrapping the hash functor in StoredHash stores each entry's full hash code next to it, trading a size_t per entry for skipping most key comparisons and never hashing a key twice.
 	/// </summary>
 	/// <typeparam name="TKey">The type of object used as a key.</typeparam>
 	/// <typeparam name="TData">The type of object stored at a key.</typeparam>
 	/// <typeparam name="THashFunctor">The functor used to hash a key type.</typeparam>
-	template <typename TKey, typename TData, typename THashFunctor = DefaultHash<TKey>>
+	/// <typeparam name="TEqualityFunctor">The functor used to compare two keys. Stateless policies are inlined into every lookup; a std::function can still be supplied when the comparison must be chosen at runtime.</typeparam>
+	template <typename TKey, typename TData, typename THashFunctor = DefaultHash<TKey>, typename TEqualityFunctor = DefaultEquality<const TKey>>
 	class HashMap final {
 	public:
 		using PairType = std::pair<const TKey, TData>;
-		using ChainType = SList<PairType>;
+		/// <summary>
+		/// Whether each entry stores its full hash code, opted into by wrapping the hash functor in StoredHash.
+		/// </summary>
+		static constexpr bool StoresHashes = IsStoredHash<THashFunctor>::value;
+		/// <summary>
+		/// A PairType stored together with the full hash code of its key.
+		/// </summary>
+		struct HashedPairType final {
+			/// <summary>
+			/// Constructs the PairType in place from the given arguments alongside its hash code.
+			/// </summary>
+			/// <param name="hash">The full hash code of the key</param>
+			/// <param name="args">The arguments to construct the PairType from</param>
+			template <typename... Args>
+			HashedPairType(std::size_t hash, Args&&... args);
+
+			/// <summary>
+			/// The key-data pair itself.
+			/// </summary>
+			PairType Pair;
+			/// <summary>
+			/// The full (not modulo'd) hash code of the key.
+			/// </summary>
+			std::size_t Hash;
+		};
+		using EntryType = std::conditional_t<StoresHashes, HashedPairType, PairType>;
+		using ChainType = SList<EntryType>;
 
 		using key_type = const TKey;
 		using mapped_type = TData;
@@ -38,7 +74,15 @@ namespace FIEAGameEngine {
 		using const_reference = const value_type&;
 		using iterator = class Iterator;
 		using const_iterator = class ConstIterator;
-		using EqualityFunctor = std::function<bool(key_type&, key_type&)>;
+		using key_equal = TEqualityFunctor;
+		using EqualityFunctor = TEqualityFunctor;
+
+		/// <summary>
+		/// Whether TLookup can be used to search the HashMap without constructing a key: the hash functor must be transparent and TLookup must not already be the key type.
+		/// Heterogeneous lookups compare stored keys against the lookup value with operator== instead of the equality functor.
+		/// </summary>
+		template <typename TLookup>
+		static constexpr bool IsLookupType = IsTransparentHash<THashFunctor>::value && !std::is_same_v<std::decay_t<TLookup>, std::remove_const_t<TKey>>;
 		
 		/// <summary>
 		/// Iterator class allows traversal of HashMap objects. Iterators function as Forward Iterators and have all related functionaliy.
@@ -135,7 +179,7 @@ namespace FIEAGameEngine {
 			/// <param name="container">The HashMap this Iterator belongs to</param>
 			/// <param name="chainNum">The chain index this Iterator is pointing into</param>
 			/// <param name="chainIter">The iterator for the chain we're inside of that points to the PairType itself</param>
-			Iterator(HashMap& container, size_type chainNum, typename SList<PairType>::Iterator chainIter);
+			Iterator(HashMap& container, size_type chainNum, typename ChainType::Iterator chainIter);
 
 			/// <summary>
 			/// The chain this Iterator is inside of.
@@ -144,11 +188,11 @@ namespace FIEAGameEngine {
 			/// <summary>
 			/// The chain (SList) iterator pointing to a specific PairType
 			/// </summary>
-			typename SList<PairType>::Iterator _chainIterator;
+			typename ChainType::Iterator _chainIterator;
 			/// <summary>
 			/// The HashMap this Iterator belongs to.
 			/// </summary>
-			HashMap<TKey, TData, THashFunctor>* _container{ nullptr };
+			HashMap<TKey, TData, THashFunctor, TEqualityFunctor>* _container{ nullptr };
 		};
 
 		/// <summary>
@@ -249,7 +293,7 @@ namespace FIEAGameEngine {
 			/// <param name="container">The HashMap this ConstIterator belongs to</param>
 			/// <param name="chainNum">The chain this ConstIterator is inside of</param>
 			/// <param name="chainIter">The chain iterator this ConstIterator is using to point at a PairType</param>
-			ConstIterator(const HashMap& container, size_type chainNum, typename SList<PairType>::ConstIterator chainIter);
+			ConstIterator(const HashMap& container, size_type chainNum, typename ChainType::ConstIterator chainIter);
 
 			/// <summary>
 			/// The chain number this ConstIterator is inside of
@@ -258,11 +302,11 @@ namespace FIEAGameEngine {
 			/// <summary>
 			/// The chain iterator this ConstIterator is using to point to a specific PairType
 			/// </summary>
-			typename SList<PairType>::ConstIterator _chainIterator;
+			typename ChainType::ConstIterator _chainIterator;
 			/// <summary>
 			/// The HashMap this ConstIterator belongs to.
 			/// </summary>
-			const HashMap<TKey, TData, THashFunctor>* _container{ nullptr };
+			const HashMap<TKey, TData, THashFunctor, TEqualityFunctor>* _container{ nullptr };
 		};
 
 		/// <summary>
@@ -270,36 +314,40 @@ namespace FIEAGameEngine {
 		/// </summary>
 		/// <param name="chainCount">The number of chains this HashMap should have, defaulted to 13. Must be greater than 1.</param>
 		/// <param name="equalityFunctor">A method used to determine relevant equality between two PairTypes; i.e. key equality</param>
-		explicit HashMap(size_type chainCount = 13, EqualityFunctor equalityFunctor = DefaultEquality<key_type>{});
+		/// <param name="resource">The resource to allocate chains and entry slabs from, or nullptr for the default resource.</param>
+		explicit HashMap(size_type chainCount = 13, EqualityFunctor equalityFunctor = EqualityFunctor{}, MemoryResource* resource = nullptr);
 		/// <summary>
 		/// An Initializer list constructor for HashMap.
 		/// </summary>
 		/// <param name="list">A set of items to add to the HashMap as it's being constructed</param>
 		/// <param name="chainCount">The number of chains this HashMap should have, defaulted to 13. Must be greater than 1.</param>
 		/// <param name="equalityFunctor">A method used to determine relevant equality between two PairTypes; i.e. key equality</param>
-		HashMap(std::initializer_list<PairType> list, size_type chainCount = 13, EqualityFunctor equalityFunctor = DefaultEquality<key_type>{});
+		/// <param name="resource">The resource to allocate chains and entry slabs from, or nullptr for the default resource.</param>
+		HashMap(std::initializer_list<PairType> list, size_type chainCount = 13, EqualityFunctor equalityFunctor = EqualityFunctor{}, MemoryResource* resource = nullptr);
 		/// <summary>
-		/// A copy constructor for a HashMap. Using the compiler provided default implementation.
+		/// A copy constructor for a HashMap. The copy keeps the chain layout of the original, and allocates from the default resource through a node pool of its own.
 		/// </summary>
 		/// <param name="other">The HashMap to copy</param>
-		HashMap(const HashMap& rhs) = default;
+		HashMap(const HashMap& rhs);
 		/// <summary>
-		/// The move constructor for a HashMap. Using the compiler provided default implementation.
+		/// The move constructor for a HashMap. Using the compiler provided default implementation, which takes over the chains along with the node pool their entries live in.
 		/// </summary>
 		/// <param name="rhs">The HashMap to move data from</param>
 		HashMap(HashMap&& rhs) noexcept = default;
 		/// <summary>
-		/// The copy assignment operator for a HashMap. Using the compiler provided default implementation.
+		/// The copy assignment operator for a HashMap. Copies the entries and settings of the given HashMap into this one, which keeps its resource.
 		/// </summary>
 		/// <param name="rhs">The HashMap to copy</param>
 		/// <returns>A reference to the updated HashMap</returns>
-		HashMap& operator=(const HashMap& rhs) = default;
+		HashMap& operator=(const HashMap& rhs);
 		/// <summary>
-		/// The move assignment operator for a HashMap. Using the compiler provided default implementation.
+		/// The move assignment operator for a HashMap. Takes over the chains and node pool of the given HashMap if both allocate from equal resources,
+		/// and moves its entries one by one into this HashMap's own node pool otherwise. Only the first case is guaranteed not to throw: across resources new chains and nodes
+		/// must be allocated, so running out of memory or an entry's move constructor throwing calls std::terminate.
 		/// </summary>
 		/// <param name="rhs">The HashMap to move data from</param>
 		/// <returns>A reference to the updated HashMap</returns>
-		HashMap& operator=(HashMap&& rhs) noexcept = default;
+		HashMap& operator=(HashMap&& rhs) noexcept;
 		/// <summary>
 		/// The destructor for a HashMap. Using the compiler provided default implementation.
 		/// </summary>
@@ -315,6 +363,63 @@ namespace FIEAGameEngine {
 		/// </summary>
 		/// <returns>The current load factor of the HashMap</returns>
 		[[nodiscard]] double GetLoadFactor() const;
+		/// <summary>
+		/// Get the number of chains keys are currently hashed into. During an incremental rehash this is the chain count being migrated to.
+		/// </summary>
+		/// <returns>The number of chains in the HashMap</returns>
+		[[nodiscard]] size_type ChainCount() const;
+		/// <summary>
+		/// Retrieve the resource the HashMap allocates its chains and entries from.
+		/// </summary>
+		/// <returns>A pointer to the HashMap's resource.</returns>
+		[[nodiscard]] MemoryResource* GetResource() const;
+		/// <summary>
+		/// Get the max load factor, the average number of entries per chain (population / chain count) an insert is allowed to reach before the HashMap grows.
+		/// </summary>
+		/// <returns>The current max load factor of the HashMap</returns>
+		[[nodiscard]] double GetMaxLoadFactor() const;
+		/// <summary>
+		/// Set the max load factor, the average number of entries per chain (population / chain count) an insert is allowed to reach before the HashMap grows.
+		/// </summary>
+		/// <param name="maxLoadFactor">The new max load factor. A value of 0 disables automatic growth.</param>
+		void SetMaxLoadFactor(double maxLoadFactor);
+		/// <summary>
+		/// Get the number of old chains migrated per operation during an incremental rehash.
+		/// </summary>
+		/// <returns>The number of chains migrated per operation, or 0 if rehashes happen all at once</returns>
+		[[nodiscard]] size_type GetIncrementalRehash() const;
+		/// <summary>
+		/// Set the number of old chains migrated by each Insert, operator[], and Remove by key while an automatic growth is in progress, bounding the cost of any single operation.
+		/// Setting this to 0 makes growth happen all at once, and finishes any migration currently in progress.
+		/// </summary>
+		/// <param name="chainsPerOperation">The number of chains to migrate per operation</param>
+		void SetIncrementalRehash(size_type chainsPerOperation);
+		/// <summary>
+		/// Check if an incremental rehash is currently in progress.
+		/// </summary>
+		/// <returns>A boolean indicating if old chains are still waiting to be migrated</returns>
+		[[nodiscard]] bool IsRehashing() const;
+		/// <summary>
+		/// Grow the HashMap so that it can hold the given number of entries without exceeding the max load factor. Never shrinks the HashMap.
+		/// </summary>
+		/// <param name="count">The number of entries to make room for</param>
+		void Reserve(size_type count);
+		/// <summary>
+		/// Redistribute every entry over the given number of chains, finishing any incremental rehash in progress.
+		/// </summary>
+		/// <param name="chainCount">The new number of chains. Must be greater than 1.</param>
+		void Rehash(size_type chainCount);
+#ifdef USE_HASHMAP_STATISTICS
+		/// <summary>
+		/// Measure the current chain lengths and memory footprint of the HashMap, alongside its cumulative lookup counters. Walks every chain, so the cost is linear in the size of the HashMap.
+		/// </summary>
+		/// <returns>A snapshot of the HashMap's statistics</returns>
+		[[nodiscard]] HashMapStatistics GetStatistics() const;
+		/// <summary>
+		/// Zero the cumulative find, insert, and probe counters.
+		/// </summary>
+		void ResetStatistics();
+#endif // USE_HASHMAP_STATISTICS
 		/// <summary>
 		/// Check if the HashMap contains a given key.
 		/// </summary>
@@ -322,6 +427,13 @@ namespace FIEAGameEngine {
 		/// <returns>A boolean determining if the HashMap contains the given key</returns>
 		[[nodiscard]] bool ContainsKey(const TKey& key) const;
 		/// <summary>
+		/// Check if the HashMap contains a key equal to the given lookup value (i.e. a std::string_view or const char* for a std::string key), without constructing a key.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>A boolean determining if the HashMap contains the given key</returns>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		[[nodiscard]] bool ContainsKey(const TLookup& key) const;
+		/// <summary>
 		/// Check if the HashMap contains a given key, and return an Iterator pointing to it, or end() if it does not exist in the HashMap.
 		/// </summary>
 		/// <param name="key">The key to look for</param>
@@ -334,6 +446,20 @@ namespace FIEAGameEngine {
 		/// <returns>A ConstIterator pointing to the PairType with the given key, or end() if none exists.</returns>
 		[[nodiscard]] ConstIterator Find(const TKey& key) const;
 		/// <summary>
+		/// Check if the HashMap contains a key equal to the given lookup value, without constructing a key, and return an Iterator pointing to it, or end() if it does not exist in the HashMap.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>An Iterator pointing to the PairType with the matching key, or end() if none exists.</returns>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		[[nodiscard]] Iterator Find(const TLookup& key);
+		/// <summary>
+		/// Check if the HashMap contains a key equal to the given lookup value, without constructing a key, and return a ConstIterator pointing to it, or end() if it does not exist in the HashMap.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>A ConstIterator pointing to the PairType with the matching key, or end() if none exists.</returns>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		[[nodiscard]] ConstIterator Find(const TLookup& key) const;
+		/// <summary>
 		/// Check if the HashMap contains a given key, return the data stored there.
 		/// </summary>
 		/// <param name="key">The key to look for</param>
@@ -348,11 +474,34 @@ namespace FIEAGameEngine {
 		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the key does not exist in the HashMap</exception>
 		[[nodiscard]] const TData& At(const TKey& key) const;
 		/// <summary>
+		/// Check if the HashMap contains a key equal to the given lookup value, without constructing a key, and return the data stored there.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>A reference to the data stored at the matching key.</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the key does not exist in the HashMap</exception>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		[[nodiscard]] TData& At(const TLookup& key);
+		/// <summary>
+		/// Check if the HashMap contains a key equal to the given lookup value, without constructing a key, and return the data stored there.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>A constant reference to the data stored at the matching key.</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the key does not exist in the HashMap</exception>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		[[nodiscard]] const TData& At(const TLookup& key) const;
+		/// <summary>
 		/// Returns a reference to the data stored at the given key. If the given key does not exist in the HashMap, it is inserted with a default constructed TData.
 		/// </summary>
 		/// <param name="rhs">The key to lookup</param>
 		/// <returns>A reference to the data stored at that key</returns>
 		TData& operator[](const TKey& key);
+		/// <summary>
+		/// Returns a reference to the data stored at a key equal to the given lookup value. If no such key exists, one is constructed from the lookup value and inserted with a default constructed TData.
+		/// </summary>
+		/// <param name="key">The lookup value to look for</param>
+		/// <returns>A reference to the data stored at that key</returns>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		TData& operator[](const TLookup& key);
 
 		/// <summary>
 		/// Insert a given PairType into the HashMap, if the key does not already exist.
@@ -367,17 +516,79 @@ namespace FIEAGameEngine {
 		/// <returns>A pair of an Iterator pointing to the inserted object (or the preexisting object with the same key) and a bool indicating if something new was inserted</returns>
 		std::pair<Iterator, bool> Insert(PairType&& entry);
 		/// <summary>
+		/// Construct a PairType from the given arguments and insert it, if its key does not already exist.
+		/// The PairType has to be built before its key can be looked up, so prefer TryEmplace when the key is at hand.
+		/// </summary>
+		/// <param name="args">The arguments to construct a PairType from</param>
+		/// <returns>A pair of an Iterator pointing to the inserted object (or the preexisting object with the same key) and a bool indicating if something new was inserted</returns>
+		template <typename... Args>
+		std::pair<Iterator, bool> Emplace(Args&&... args);
+		/// <summary>
+		/// Insert the given key with data constructed in place from the given arguments, if the key does not already exist. Nothing is constructed, copied, or moved from if it does.
+		/// </summary>
+		/// <param name="key">The key to insert</param>
+		/// <param name="args">The arguments to construct the TData from</param>
+		/// <returns>A pair of an Iterator pointing to the inserted object (or the preexisting object with the same key) and a bool indicating if something new was inserted</returns>
+		template <typename... Args>
+		std::pair<Iterator, bool> TryEmplace(const TKey& key, Args&&... args);
+		/// <summary>
+		/// Insert the given key with data constructed in place from the given arguments, if the key does not already exist. Nothing is constructed, copied, or moved from if it does.
+		/// </summary>
+		/// <param name="key">The key to move into the HashMap</param>
+		/// <param name="args">The arguments to construct the TData from</param>
+		/// <returns>A pair of an Iterator pointing to the inserted object (or the preexisting object with the same key) and a bool indicating if something new was inserted</returns>
+		template <typename... Args>
+		std::pair<Iterator, bool> TryEmplace(TKey&& key, Args&&... args);
+		/// <summary>
+		/// Insert a key constructed from the given lookup value with data constructed in place from the given arguments, if no equal key already exists. Neither the key nor the data is constructed if one does.
+		/// </summary>
+		/// <param name="key">The lookup value to look for and construct the key from</param>
+		/// <param name="args">The arguments to construct the TData from</param>
+		/// <returns>A pair of an Iterator pointing to the inserted object (or the preexisting object with the same key) and a bool indicating if something new was inserted</returns>
+		template <typename TLookup, typename... Args, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		std::pair<Iterator, bool> TryEmplace(const TLookup& key, Args&&... args);
+		/// <summary>
+		/// Assign the given data to the given key, inserting the key if it does not already exist.
+		/// </summary>
+		/// <param name="key">The key to assign to</param>
+		/// <param name="data">The data to assign</param>
+		/// <returns>A pair of an Iterator pointing to the assigned object and a bool indicating if it was newly inserted</returns>
+		template <typename TValue>
+		std::pair<Iterator, bool> InsertOrAssign(const TKey& key, TValue&& data);
+		/// <summary>
+		/// Assign the given data to the given key, moving the key into the HashMap if it does not already exist.
+		/// </summary>
+		/// <param name="key">The key to assign to</param>
+		/// <param name="data">The data to assign</param>
+		/// <returns>A pair of an Iterator pointing to the assigned object and a bool indicating if it was newly inserted</returns>
+		template <typename TValue>
+		std::pair<Iterator, bool> InsertOrAssign(TKey&& key, TValue&& data);
+		/// <summary>
+		/// Assign the given data to the key equal to the given lookup value, constructing and inserting that key if it does not already exist.
+		/// </summary>
+		/// <param name="key">The lookup value to look for and construct the key from</param>
+		/// <param name="data">The data to assign</param>
+		/// <returns>A pair of an Iterator pointing to the assigned object and a bool indicating if it was newly inserted</returns>
+		template <typename TLookup, typename TValue, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		std::pair<Iterator, bool> InsertOrAssign(const TLookup& key, TValue&& data);
+		/// <summary>
 		/// Remove a PairType with the given key if it exists in the HashMap.
 		/// </summary>
 		/// <param name="key">The key to look for removal</param>
 		void Remove(const TKey& key);
 		/// <summary>
+		/// Remove a PairType with a key equal to the given lookup value if it exists in the HashMap, without constructing a key.
+		/// </summary>
+		/// <param name="key">The lookup value to look for removal</param>
+		template <typename TLookup, typename = std::enable_if_t<IsLookupType<TLookup>>>
+		void Remove(const TLookup& key);
+		/// <summary>
 		/// Remove a PairType with the given iterator if it isn't equal to end().
 		/// </summary>
 		/// <param name="key">The iterator to look for removal</param>
 		void Remove(const Iterator& iter);
 		/// <summary>
-		/// Empty the HashMap.
+		/// Empty the HashMap, returning every slab of its node pool at once.
 		/// </summary>
 		void Clear();
 
@@ -413,11 +624,33 @@ namespace FIEAGameEngine {
 		[[nodiscard]] ConstIterator cend() const;
 
 	private:
+		/// <summary>
+		/// The pool every chain allocates its nodes from, so entries of the HashMap sit together in slabs and can be relinked between chains during a rehash.
+		/// It is allocated from the HashMap's resource so its address survives the HashMap being moved, and is declared first so it outlives the chains.
+		/// </summary>
+		NodePool::Pointer _nodePool;
 		/// <summary>
 		/// The HashMap itself.
 		/// </summary>
 		Vector<ChainType> _hashMap;
 		/// <summary>
+		/// The old chains still being migrated during an incremental rehash; empty otherwise.
+		/// While migrating, chain indices below its size refer to these chains and the rest refer to _hashMap.
+		/// </summary>
+		Vector<ChainType> _migratingChains;
+		/// <summary>
+		/// The index of the next old chain to migrate during an incremental rehash. Every old chain below it is already empty.
+		/// </summary>
+		size_type _migrationIndex{ 0 };
+		/// <summary>
+		/// The number of old chains to migrate per operation, or 0 to rehash all at once.
+		/// </summary>
+		size_type _incrementalRehash{ 0 };
+		/// <summary>
+		/// The average number of entries per chain allowed before the HashMap grows, or 0 to never grow automatically.
+		/// </summary>
+		double _maxLoadFactor{ 1.0 };
+		/// <summary>
 		/// The current population of the HashMap.
 		/// </summary>
 		size_type _population{ 0 };
@@ -426,49 +659,160 @@ namespace FIEAGameEngine {
 		/// </summary>
 		size_type _populatedChains{ 0 };
 		/// <summary>
-		/// A function indicating how to find eqaulity between two keys.
+		/// The functor indicating how to find eqaulity between two keys.
 		/// </summary>
 		EqualityFunctor _equalityFunctor;
+#ifdef USE_HASHMAP_STATISTICS
+		/// <summary>
+		/// The number of key lookups performed since construction or the last ResetStatistics.
+		/// </summary>
+		mutable size_type _findCount{ 0 };
+		/// <summary>
+		/// The number of entries inserted since construction or the last ResetStatistics.
+		/// </summary>
+		size_type _insertCount{ 0 };
+		/// <summary>
+		/// The number of stored entries examined by lookups since construction or the last ResetStatistics.
+		/// </summary>
+		mutable size_type _probeCount{ 0 };
+#endif // USE_HASHMAP_STATISTICS
 
 		/// <summary>
-		/// Helper function to get the hashed and modulo'd index of a key.
+		/// Helper function to get the full hash code of a key or lookup value.
 		/// </summary>
 		/// <param name="key">The key to hash</param>
-		/// <returns>The chain index for the key</returns>
-		[[nodiscard]] size_type GetHashedIndex(const TKey& key) const;
+		/// <returns>The hash code for the key</returns>
+		template <typename TLookup>
+		[[nodiscard]] static size_type GetHash(const TLookup& key);
 		/// <summary>
-		/// Helper function that performs a find call wih a precomputed chain Index.
+		/// Helper function to get the chain index a hash code currently maps to, taking an incremental rehash in progress into account.
+		/// </summary>
+		/// <param name="hash">The full hash code of a key</param>
+		/// <returns>The chain index for the hash code</returns>
+		[[nodiscard]] size_type GetChainIndex(size_type hash) const;
+		/// <summary>
+		/// Helper function to get the full hash code of a stored entry, reusing the stored code when StoresHashes is set.
+		/// </summary>
+		/// <param name="entry">The stored entry</param>
+		/// <returns>The hash code of the entry's key</returns>
+		[[nodiscard]] static size_type GetEntryHash(const EntryType& entry);
+		/// <summary>
+		/// Helper function to get the PairType out of a stored entry.
+		/// </summary>
+		/// <param name="entry">The stored entry</param>
+		/// <returns>A reference to the entry's PairType</returns>
+		[[nodiscard]] static PairType& GetPair(EntryType& entry);
+		/// <summary>
+		/// Helper function to get the PairType out of a stored entry.
+		/// </summary>
+		/// <param name="entry">The stored entry</param>
+		/// <returns>A constant reference to the entry's PairType</returns>
+		[[nodiscard]] static const PairType& GetPair(const EntryType& entry);
+		/// <summary>
+		/// Helper function that checks if a stored entry matches a key or lookup value. When StoresHashes is set, the stored hash code is compared first and the keys only if it matches.
+		/// </summary>
+		/// <param name="entry">The stored entry</param>
+		/// <param name="key">The key or lookup value being searched for</param>
+		/// <param name="hash">The full hash code of the key being searched for</param>
+		/// <returns>A boolean indicating if the entry holds the key</returns>
+		template <typename TLookup>
+		[[nodiscard]] bool EntryMatches(const EntryType& entry, const TLookup& key, size_type hash) const;
+		/// <summary>
+		/// Helper function that appends a new entry to the end of a chain, constructing its PairType in place.
+		/// </summary>
+		/// <param name="chain">The chain to append to</param>
+		/// <param name="hash">The full hash code of the new PairType's key</param>
+		/// <param name="args">The arguments to construct the PairType from</param>
+		/// <returns>The chain iterator pointing to the new entry</returns>
+		template <typename... Args>
+		static typename ChainType::Iterator AppendToChain(ChainType& chain, size_type hash, Args&&... args);
+		/// <summary>
+		/// Helper function that compares a stored key against a key or lookup value.
+		/// </summary>
+		/// <param name="storedKey">The key stored in the HashMap</param>
+		/// <param name="key">The key or lookup value being searched for</param>
+		/// <returns>A boolean indicating if the two are equal</returns>
+		template <typename TLookup>
+		[[nodiscard]] bool KeyEquals(const TKey& storedKey, const TLookup& key) const;
+		/// <summary>
+		/// Helper function to get the total number of chains an Iterator can walk over, including old chains still being migrated.
+		/// </summary>
+		/// <returns>The total number of chains</returns>
+		[[nodiscard]] size_type TotalChains() const;
+		/// <summary>
+		/// Helper function to get a chain by its index, including old chains still being migrated.
+		/// </summary>
+		/// <param name="chainIndex">The index of the chain</param>
+		/// <returns>A reference to the chain</returns>
+		[[nodiscard]] ChainType& GetChain(size_type chainIndex);
+		/// <summary>
+		/// Helper function to get a chain by its index, including old chains still being migrated.
+		/// </summary>
+		/// <param name="chainIndex">The index of the chain</param>
+		/// <returns>A constant reference to the chain</returns>
+		[[nodiscard]] const ChainType& GetChain(size_type chainIndex) const;
+		/// <summary>
+		/// Helper function that grows the HashMap if inserting one more entry would exceed the max load factor.
+		/// </summary>
+		/// <returns>A boolean indicating if the HashMap grew, in which case precomputed chain indices are stale</returns>
+		bool GrowForInsert();
+		/// <summary>
+		/// Helper function that migrates the next batch of old chains if an incremental rehash is in progress.
+		/// </summary>
+		void StepRehash();
+		/// <summary>
+		/// Helper function that relinks every node of a chain into the current chains.
+		/// </summary>
+		/// <param name="chain">The chain to empty out</param>
+		void MigrateChain(ChainType& chain);
+		/// <summary>
+		/// Helper function that performs a find call wih a precomputed hash code.
 		/// </summary>
 		/// <param name="key">The key to look for</param>
-		/// <param name="chainIndex">The precomputed chain index</param>
+		/// <param name="hash">The precomputed hash code</param>
 		/// <returns>An Iterator pointing to the found PairType</returns>
-		[[nodiscard]] Iterator Find(const TKey& key, size_type chainIndex);
+		template <typename TLookup>
+		[[nodiscard]] Iterator Find(const TLookup& key, size_type hash);
 		/// <summary>
-		/// Helper function that performs a find call wih a precomputed chain Index.
+		/// Helper function that performs a find call wih a precomputed hash code.
 		/// </summary>
 		/// <param name="key">The key to look for</param>
-		/// <param name="chainIndex">The precomputed chain index</param>
+		/// <param name="hash">The precomputed hash code</param>
 		/// <returns>A ConstIterator pointing to the found PairType</returns>
-		[[nodiscard]] ConstIterator Find(const TKey& key, size_type chainIndex) const;
+		template <typename TLookup>
+		[[nodiscard]] ConstIterator Find(const TLookup& key, size_type hash) const;
 		/// <summary>
-		/// Helper function that performs an insert call wih a precomputed chain Index.
+		/// Helper function that every insert funnels through: looks the key up with a precomputed hash code, and only if it is missing constructs a PairType in place from the given arguments.
 		/// </summary>
-		/// <param name="key">The PairType to insert</param>
-		/// <param name="chainIndex">The precomputed chain index</param>
+		/// <param name="key">The key or lookup value to look for</param>
+		/// <param name="hash">The precomputed hash code</param>
+		/// <param name="args">The arguments to construct the PairType from</param>
 		/// <returns>An Iterator pointing to the inserted/found PairType and a boolean indicating if something was actually inserted</returns>
-		std::pair<Iterator, bool> Insert(const PairType& entry, size_type chainIndex);
-		/// <summary>
-		/// Helper function that performs an insert call wih a precomputed chain Index.
-		/// </summary>
-		/// <param name="key">The PairType to insert</param>
-		/// <param name="chainIndex">The precomputed chain index</param>
-		/// <returns>An Iterator pointing to the inserted/found PairType and a boolean indicating if something was actually inserted</returns>
-		std::pair<Iterator, bool> Insert(PairType&& entry, size_type chainIndex);
+		template <typename TLookup, typename... Args>
+		std::pair<Iterator, bool> EmplaceUnique(const TLookup& key, size_type hash, Args&&... args);
 		/// <summary>
 		/// Helper function that creates the chains (SLists) for the HashMap.
 		/// </summary>
 		/// <param name="key">The number of chains to create.</param>
-		void CreateEmptyChains(size_type chainNumber);
+		/// <param name="resource">The resource the Vector of chains allocates from.</param>
+		/// <param name="nodePool">The pool the chains allocate their entries from.</param>
+		/// <returns>A Vector of empty chains</returns>
+		[[nodiscard]] static Vector<ChainType> CreateEmptyChains(size_type chainNumber, MemoryResource* resource, NodePool* nodePool);
+		/// <summary>
+		/// Helper function that copies or moves every chain of another HashMap, keeping each entry in the chain of the same index.
+		/// </summary>
+		/// <param name="chains">The chains to copy, or to move from if given as an rvalue.</param>
+		/// <param name="resource">The resource the new Vector of chains allocates from.</param>
+		/// <param name="nodePool">The pool the new chains allocate their entries from.</param>
+		/// <returns>A Vector of chains holding the same entries</returns>
+		template <typename TChains>
+		[[nodiscard]] static Vector<ChainType> TransferChains(TChains&& chains, MemoryResource* resource, NodePool* nodePool);
+		/// <summary>
+		/// Helper function that creates a pool for the HashMap's entries.
+		/// </summary>
+		/// <param name="resource">The resource the pool itself and its slabs are obtained from.</param>
+		/// <returns>A pointer to the new pool</returns>
+		[[nodiscard]] static NodePool::Pointer CreateNodePool(MemoryResource* resource);
 	};
 }
 
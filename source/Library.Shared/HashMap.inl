@@ -8,50 +8,232 @@
 
 namespace FIEAGameEngine {
 #pragma region HashMap
-	template <typename TKey, typename TData, typename THashFunctor>
-	HashMap <TKey, TData, THashFunctor>::HashMap(size_type chainCount, EqualityFunctor equalityFunctor) :
-		_hashMap{ Vector<ChainType>(chainCount) }, _equalityFunctor{ equalityFunctor }
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename... Args>
+	inline HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::HashedPairType::HashedPairType(std::size_t hash, Args&&... args) :
+		Pair(std::forward<Args>(args)...), Hash{ hash }
 	{
-		CreateEmptyChains(chainCount);
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	HashMap <TKey, TData, THashFunctor>::HashMap(std::initializer_list<PairType> list, size_type chainCount, EqualityFunctor equalityFunctor) :
-		_hashMap{Vector<ChainType>(chainCount)}, _equalityFunctor{ equalityFunctor }
+	template <typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::HashMap(size_type chainCount, EqualityFunctor equalityFunctor, MemoryResource* resource) :
+		_nodePool{ CreateNodePool(resource) }, _hashMap{ CreateEmptyChains(chainCount, resource, _nodePool.get()) }, _migratingChains(0, DefaultGrowth{}, _hashMap.GetResource()),
+		_equalityFunctor{ std::move(equalityFunctor) }
+	{
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::HashMap(std::initializer_list<PairType> list, size_type chainCount, EqualityFunctor equalityFunctor, MemoryResource* resource) :
+		_nodePool{ CreateNodePool(resource) }, _hashMap{ CreateEmptyChains(chainCount, resource, _nodePool.get()) }, _migratingChains(0, DefaultGrowth{}, _hashMap.GetResource()),
+		_equalityFunctor{ std::move(equalityFunctor) }
 	{
-		CreateEmptyChains(chainCount);
 		for (const_reference value : list) {
 			Insert(value);
 		}
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline typename HashMap<TKey, TData, THashFunctor>::size_type HashMap<TKey, TData, THashFunctor>::Size() const {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::HashMap(const HashMap& rhs) :
+		_nodePool{ CreateNodePool(nullptr) }, _hashMap{ TransferChains(rhs._hashMap, nullptr, _nodePool.get()) }, _migratingChains{ TransferChains(rhs._migratingChains, nullptr, _nodePool.get()) },
+		_migrationIndex{ rhs._migrationIndex }, _incrementalRehash{ rhs._incrementalRehash }, _maxLoadFactor{ rhs._maxLoadFactor }, _population{ rhs._population },
+		_populatedChains{ rhs._populatedChains }, _equalityFunctor{ rhs._equalityFunctor }
+#ifdef USE_HASHMAP_STATISTICS
+		, _findCount{ rhs._findCount }, _insertCount{ rhs._insertCount }, _probeCount{ rhs._probeCount }
+#endif // USE_HASHMAP_STATISTICS
+	{
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	HashMap<TKey, TData, THashFunctor, TEqualityFunctor>& HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::operator=(const HashMap& rhs) {
+		if (this != &rhs) {
+			HashMap copy(rhs);
+			*this = std::move(copy);
+		}
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	HashMap<TKey, TData, THashFunctor, TEqualityFunctor>& HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::operator=(HashMap&& rhs) noexcept {
+		if (this != &rhs) {
+			MemoryResource* resource = GetResource();
+			const bool sameResource = resource->IsEqual(*rhs.GetResource());
+			_migratingChains.Clear();
+			_hashMap.Clear();
+
+			if (sameResource) {
+				_nodePool = std::move(rhs._nodePool);
+				_hashMap = std::move(rhs._hashMap);
+				_migratingChains = std::move(rhs._migratingChains);
+			}
+			else {
+				if (_nodePool == nullptr) _nodePool = CreateNodePool(resource);
+				_hashMap = TransferChains(std::move(rhs._hashMap), resource, _nodePool.get());
+				_migratingChains = TransferChains(std::move(rhs._migratingChains), resource, _nodePool.get());
+			}
+
+			_migrationIndex = rhs._migrationIndex;
+			_incrementalRehash = rhs._incrementalRehash;
+			_maxLoadFactor = rhs._maxLoadFactor;
+			_population = rhs._population;
+			_populatedChains = rhs._populatedChains;
+			_equalityFunctor = std::move(rhs._equalityFunctor);
+#ifdef USE_HASHMAP_STATISTICS
+			_findCount = rhs._findCount;
+			_insertCount = rhs._insertCount;
+			_probeCount = rhs._probeCount;
+#endif // USE_HASHMAP_STATISTICS
+			if (!sameResource) rhs.Clear();
+			rhs._migrationIndex = rhs._population = rhs._populatedChains = 0;
+		}
+		return *this;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Size() const {
 		return _population;
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline double HashMap<TKey, TData, THashFunctor>::GetLoadFactor() const {
-		return _populatedChains / gsl::narrow_cast<double>(_hashMap.Size());
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline double HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GetLoadFactor() const {
+		return _populatedChains / gsl::narrow_cast<double>(TotalChains());
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ChainCount() const {
+		return _hashMap.Size();
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline MemoryResource* HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GetResource() const {
+		return _hashMap.GetResource();
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline double HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GetMaxLoadFactor() const {
+		return _maxLoadFactor;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline void HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::SetMaxLoadFactor(double maxLoadFactor) {
+		assert(maxLoadFactor >= 0.0);
+		_maxLoadFactor = maxLoadFactor;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GetIncrementalRehash() const {
+		return _incrementalRehash;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	void HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::SetIncrementalRehash(size_type chainsPerOperation) {
+		_incrementalRehash = chainsPerOperation;
+		if (_incrementalRehash == 0 && IsRehashing()) {
+			Rehash(_hashMap.Size());
+		}
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline bool HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::IsRehashing() const {
+		return !_migratingChains.IsEmpty();
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	void HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Reserve(size_type count) {
+		double maxLoadFactor = (_maxLoadFactor > 0.0) ? _maxLoadFactor : 1.0;
+		size_type chainCount = gsl::narrow_cast<size_type>(std::ceil(count / maxLoadFactor));
+		if (chainCount > _hashMap.Size()) {
+			Rehash(chainCount);
+		}
 	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	void HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Rehash(size_type chainCount) {
+		assert(chainCount > 1);
+		Vector<ChainType> oldChains = std::move(_hashMap);
+		_hashMap = CreateEmptyChains(chainCount, _hashMap.GetResource(), _nodePool.get());
+
+		for (auto& chain : _migratingChains) {
+			MigrateChain(chain);
+		}
+		for (auto& chain : oldChains) {
+			MigrateChain(chain);
+		}
+
+		_migratingChains = Vector<ChainType>();
+		_migrationIndex = 0;
+	}
+
+#ifdef USE_HASHMAP_STATISTICS
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	HashMapStatistics HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GetStatistics() const {
+		HashMapStatistics statistics;
+		statistics.BucketCount = TotalChains();
+		statistics.Population = _population;
+		statistics.FindCount = _findCount;
+		statistics.InsertCount = _insertCount;
+		statistics.ProbeCount = _probeCount;
+		statistics.MemoryFootprint = sizeof(*this) + (_hashMap.Capacity() + _migratingChains.Capacity()) * sizeof(ChainType) + ((_nodePool != nullptr) ? sizeof(NodePool) + _nodePool->BytesReserved() : 0);
+
+		size_type weightedLength = 0;
+		for (size_type i = 0; i < TotalChains(); ++i) {
+			size_type chainLength = GetChain(i).Size();
+			while (statistics.ChainLengthHistogram.Size() <= chainLength) {
+				statistics.ChainLengthHistogram.PushBack(0);
+			}
+			++statistics.ChainLengthHistogram[chainLength];
+			statistics.LongestChain = std::max(statistics.LongestChain, chainLength);
+			weightedLength += chainLength * chainLength;
+		}
+		statistics.MeanChainLength = (_population == 0) ? 0.0 : static_cast<double>(weightedLength) / _population;
+
+		return statistics;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline void HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ResetStatistics() {
+		_findCount = 0;
+		_insertCount = 0;
+		_probeCount = 0;
+	}
+#endif // USE_HASHMAP_STATISTICS
 	
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline bool HashMap<TKey, TData, THashFunctor>::ContainsKey(const TKey& key) const {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline bool HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ContainsKey(const TKey& key) const {
 		return (Find(key) != end());
 	}
 	
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline typename HashMap<TKey, TData, THashFunctor>::Iterator HashMap<TKey, TData, THashFunctor>::Find(const TKey& key) {
-		size_type chainIndex = GetHashedIndex(key);
-		return Find(key, chainIndex);
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename>
+	inline bool HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ContainsKey(const TLookup& key) const {
+		return (Find(key) != end());
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Find(const TKey& key) {
+		return Find(key, GetHash(key));
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	typename HashMap<TKey, TData, THashFunctor>::Iterator HashMap<TKey, TData, THashFunctor>::Find(const TKey& key, size_type chainIndex) {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Find(const TLookup& key) {
+		return Find(key, GetHash(key));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup>
+	typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Find(const TLookup& key, size_type hash) {
 		Iterator foundIter = end();
 
-		for (typename SList<PairType>::Iterator chainIter = _hashMap[chainIndex].begin(); chainIter != _hashMap[chainIndex].end(); ++chainIter) {
-			if(_equalityFunctor((*chainIter).first, key)) {
+		size_type chainIndex = GetChainIndex(hash);
+		ChainType& chain = GetChain(chainIndex);
+#ifdef USE_HASHMAP_STATISTICS
+		++_findCount;
+#endif // USE_HASHMAP_STATISTICS
+		for (typename ChainType::Iterator chainIter = chain.begin(); chainIter != chain.end(); ++chainIter) {
+#ifdef USE_HASHMAP_STATISTICS
+			++_probeCount;
+#endif // USE_HASHMAP_STATISTICS
+			if (EntryMatches(*chainIter, key, hash)) {
 				foundIter = Iterator(*this, chainIndex, chainIter);
 				break;
 			}
@@ -59,18 +241,32 @@ namespace FIEAGameEngine {
 		return foundIter;
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline typename HashMap<TKey, TData, THashFunctor>::ConstIterator HashMap<TKey, TData, THashFunctor>::Find(const TKey& key) const {
-		size_type chainIndex = GetHashedIndex(key);
-		return Find(key, chainIndex);
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Find(const TKey& key) const {
+		return Find(key, GetHash(key));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Find(const TLookup& key) const {
+		return Find(key, GetHash(key));
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	typename HashMap<TKey, TData, THashFunctor>::ConstIterator HashMap<TKey, TData, THashFunctor>::Find(const TKey& key, size_type chainIndex) const {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup>
+	typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Find(const TLookup& key, size_type hash) const {
 		ConstIterator foundIter = end();
 
-		for (typename SList<PairType>::ConstIterator chainIter = _hashMap[chainIndex].begin(); chainIter != _hashMap[chainIndex].end(); ++chainIter) {
-			if (_equalityFunctor((*chainIter).first, key)) {
+		size_type chainIndex = GetChainIndex(hash);
+		const ChainType& chain = GetChain(chainIndex);
+#ifdef USE_HASHMAP_STATISTICS
+		++_findCount;
+#endif // USE_HASHMAP_STATISTICS
+		for (typename ChainType::ConstIterator chainIter = chain.begin(); chainIter != chain.end(); ++chainIter) {
+#ifdef USE_HASHMAP_STATISTICS
+			++_probeCount;
+#endif // USE_HASHMAP_STATISTICS
+			if (EntryMatches(*chainIter, key, hash)) {
 				foundIter = ConstIterator(*this, chainIndex, chainIter);
 				break;
 			}
@@ -78,8 +274,8 @@ namespace FIEAGameEngine {
 		return foundIter;
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline TData& HashMap<TKey, TData, THashFunctor>::At(const TKey& key) {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline TData& HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::At(const TKey& key) {
 		Iterator foundIter = Find(key);
 
 #ifdef USE_EXCEPTIONS
@@ -88,8 +284,8 @@ namespace FIEAGameEngine {
 		return foundIter->second;
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline const TData& HashMap<TKey, TData, THashFunctor>::At(const TKey& key) const {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline const TData& HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::At(const TKey& key) const {
 		ConstIterator foundIter = Find(key);
 
 #ifdef USE_EXCEPTIONS
@@ -99,265 +295,494 @@ namespace FIEAGameEngine {
 		return foundIter->second;
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	TData& HashMap<TKey, TData, THashFunctor>::operator[](const TKey& key) {
-		size_type chainIndex = GetHashedIndex(key);
-		auto[foundIter, inserted] = Insert(PairType(key, TData()), chainIndex);
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename>
+	inline TData& HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::At(const TLookup& key) {
+		Iterator foundIter = Find(key);
+
+#ifdef USE_EXCEPTIONS
+		if (foundIter == end()) throw std::runtime_error("Out of bounds - key does not exist in container.");
+#endif // USE_EXCEPTIONS
 		return foundIter->second;
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline std::pair<typename HashMap<TKey, TData, THashFunctor>::Iterator, bool> HashMap<TKey, TData, THashFunctor>::Insert(const PairType& entry) {
-		size_type chainIndex = GetHashedIndex(entry.first);
-		return Insert(entry, chainIndex);
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename>
+	inline const TData& HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::At(const TLookup& key) const {
+		ConstIterator foundIter = Find(key);
+
+#ifdef USE_EXCEPTIONS
+		if (foundIter == cend()) throw std::runtime_error("Out of bounds - key does not exist in container.");
+#endif // USE_EXCEPTIONS
+
+		return foundIter->second;
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline std::pair<typename HashMap<TKey, TData, THashFunctor>::Iterator, bool> HashMap<TKey, TData, THashFunctor>::Insert(PairType&& entry) {
-		size_type chainIndex = GetHashedIndex(entry.first);
-		return Insert(std::forward<value_type>(entry), chainIndex);
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline TData& HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::operator[](const TKey& key) {
+		return TryEmplace(key).first->second;
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	std::pair<typename HashMap<TKey, TData, THashFunctor>::Iterator, bool> HashMap<TKey, TData, THashFunctor>::Insert(const PairType& entry, size_type chainIndex) {
-		HashMap<TKey, TData, THashFunctor>::Iterator iter = Find(entry.first, chainIndex);
-		bool inserted = (iter == end());
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename>
+	inline TData& HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::operator[](const TLookup& key) {
+		return TryEmplace(key).first->second;
+	}
 
-		if (inserted) {
-			if (_hashMap[chainIndex].IsEmpty()) ++_populatedChains;
-			++_population;
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline std::pair<typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Insert(const PairType& entry) {
+		StepRehash();
+		return EmplaceUnique(entry.first, GetHash(entry.first), entry);
+	}
 
-			typename SList<PairType>::Iterator chainIter = _hashMap[chainIndex].PushBack(entry);
-			iter = Iterator(*this, chainIndex, chainIter);
-		}
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline std::pair<typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Insert(PairType&& entry) {
+		StepRehash();
+		return EmplaceUnique(entry.first, GetHash(entry.first), std::forward<value_type>(entry));
+	}
 
-		return std::pair<Iterator, bool>(iter, inserted);
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename... Args>
+	inline std::pair<typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Emplace(Args&&... args) {
+		return Insert(PairType(std::forward<Args>(args)...));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename... Args>
+	inline std::pair<typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::TryEmplace(const TKey& key, Args&&... args) {
+		StepRehash();
+		return EmplaceUnique(key, GetHash(key), std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename... Args>
+	inline std::pair<typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::TryEmplace(TKey&& key, Args&&... args) {
+		StepRehash();
+		return EmplaceUnique(key, GetHash(key), std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename... Args, typename>
+	inline std::pair<typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::TryEmplace(const TLookup& key, Args&&... args) {
+		StepRehash();
+		return EmplaceUnique(key, GetHash(key), std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TValue>
+	inline std::pair<typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::InsertOrAssign(const TKey& key, TValue&& data) {
+		auto result = TryEmplace(key, std::forward<TValue>(data));
+		if (!result.second) result.first->second = std::forward<TValue>(data);
+		return result;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TValue>
+	inline std::pair<typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::InsertOrAssign(TKey&& key, TValue&& data) {
+		auto result = TryEmplace(std::move(key), std::forward<TValue>(data));
+		if (!result.second) result.first->second = std::forward<TValue>(data);
+		return result;
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	std::pair<typename HashMap<TKey, TData, THashFunctor>::Iterator, bool> HashMap<TKey, TData, THashFunctor>::Insert(PairType&& entry, size_type chainIndex) {
-		HashMap<TKey, TData, THashFunctor>::Iterator iter = Find(entry.first, chainIndex);
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename TValue, typename>
+	inline std::pair<typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::InsertOrAssign(const TLookup& key, TValue&& data) {
+		auto result = TryEmplace(key, std::forward<TValue>(data));
+		if (!result.second) result.first->second = std::forward<TValue>(data);
+		return result;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename... Args>
+	std::pair<typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator, bool> HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::EmplaceUnique(const TLookup& key, size_type hash, Args&&... args) {
+		Iterator iter = Find(key, hash);
 		bool inserted = (iter == end());
 
 		if (inserted) {
-			if (_hashMap[chainIndex].IsEmpty()) ++_populatedChains;
+			GrowForInsert();
+			size_type chainIndex = GetChainIndex(hash);
+			ChainType& chain = GetChain(chainIndex);
+			if (chain.IsEmpty()) ++_populatedChains;
 			++_population;
+#ifdef USE_HASHMAP_STATISTICS
+			++_insertCount;
+#endif // USE_HASHMAP_STATISTICS
 
-			typename SList<PairType>::Iterator chainIter = _hashMap[chainIndex].PushBack(std::forward<value_type>(entry));
+			typename ChainType::Iterator chainIter = AppendToChain(chain, hash, std::forward<Args>(args)...);
 			iter = Iterator(*this, chainIndex, chainIter);
 		}
 
 		return std::pair<Iterator, bool>(iter, inserted);
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	void HashMap<TKey, TData, THashFunctor>::Remove(const TKey& key) {
-		size_type chainIndex = GetHashedIndex(key);
-		Remove(Find(key, chainIndex));
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	void HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Remove(const TKey& key) {
+		StepRehash();
+		Remove(Find(key, GetHash(key)));
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup, typename>
+	void HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Remove(const TLookup& key) {
+		StepRehash();
+		Remove(Find(key, GetHash(key)));
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	void HashMap<TKey, TData, THashFunctor>::Remove(const Iterator& iter) {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	void HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Remove(const Iterator& iter) {
 		if (iter != end()) {
-			_hashMap[iter._chainNumber].Remove(iter._chainIterator);
-			if (_hashMap[iter._chainNumber].IsEmpty()) --_populatedChains;
+			ChainType& chain = GetChain(iter._chainNumber);
+			chain.Remove(iter._chainIterator);
+			if (chain.IsEmpty()) --_populatedChains;
 			--_population;
 		}
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	void HashMap<TKey, TData, THashFunctor>::Clear() {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	void HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Clear() {
 		for (auto& chain : _hashMap) { 
 			chain.Clear(); 
 		} 
+		_migratingChains = Vector<ChainType>();
+		_migrationIndex = 0;
 		_population = _populatedChains = 0;
+		if (_nodePool != nullptr) _nodePool->Release();
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	typename HashMap<TKey, TData, THashFunctor>::Iterator HashMap<TKey, TData, THashFunctor>::begin() {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::begin() {
 		if (_populatedChains == 0) return end();
 
-		Iterator beginIter( *this, size_type(0), _hashMap[size_type(0)].begin() );
-		if (beginIter._chainIterator == _hashMap[beginIter._chainNumber].end()) { 
+		Iterator beginIter( *this, size_type(0), GetChain(size_type(0)).begin() );
+		if (beginIter._chainIterator == GetChain(beginIter._chainNumber).end()) { 
 			++beginIter;
 		}
 
 		return beginIter;
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline typename HashMap<TKey, TData, THashFunctor>::Iterator HashMap<TKey, TData, THashFunctor>::end() {
-		return Iterator(*this, _hashMap.Size(), typename SList<PairType>::Iterator());
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::end() {
+		return Iterator(*this, TotalChains(), typename ChainType::Iterator());
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	typename HashMap<TKey, TData, THashFunctor>::ConstIterator HashMap<TKey, TData, THashFunctor>::begin() const {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::begin() const {
 		return cbegin();
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline typename HashMap<TKey, TData, THashFunctor>::ConstIterator HashMap<TKey, TData, THashFunctor>::end() const {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::end() const {
 		return cend();
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	typename HashMap<TKey, TData, THashFunctor>::ConstIterator HashMap<TKey, TData, THashFunctor>::cbegin() const {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::cbegin() const {
 		if (_populatedChains == 0) return end();
 
-		ConstIterator beginIter(*this, size_type(0), _hashMap[size_type(0)].cbegin());
-		if (beginIter._chainIterator == _hashMap[beginIter._chainNumber].cend()) {
+		ConstIterator beginIter(*this, size_type(0), GetChain(size_type(0)).cbegin());
+		if (beginIter._chainIterator == GetChain(beginIter._chainNumber).cend()) {
 			++beginIter;
 		}
 
 		return beginIter;
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline typename HashMap<TKey, TData, THashFunctor>::ConstIterator HashMap<TKey, TData, THashFunctor>::cend() const {
-		return ConstIterator(*this, _hashMap.Size(), typename SList<PairType>::ConstIterator());
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::cend() const {
+		return ConstIterator(*this, TotalChains(), typename ChainType::ConstIterator());
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline void HashMap <TKey, TData, THashFunctor>::CreateEmptyChains(size_type chainNumber) {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline Vector<typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ChainType> HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::CreateEmptyChains(size_type chainNumber, MemoryResource* resource, NodePool* nodePool) {
 		assert(chainNumber > 1);
+		Vector<ChainType> chains(chainNumber, DefaultGrowth{}, resource);
 		for (size_type i = size_type(0); i < chainNumber; ++i) {
-			_hashMap.PushBack(ChainType());
+			chains.EmplaceBack(nodePool);
 		}
+		return chains;
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline typename HashMap<TKey, TData, THashFunctor>::size_type HashMap<TKey, TData, THashFunctor>::GetHashedIndex(const TKey& key) const {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TChains>
+	inline Vector<typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ChainType> HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::TransferChains(TChains&& chains, MemoryResource* resource, NodePool* nodePool) {
+		Vector<ChainType> newChains(chains.Size(), DefaultGrowth{}, resource);
+		for (auto& chain : chains) {
+			if constexpr (std::is_rvalue_reference_v<TChains&&>) newChains.EmplaceBack(std::move(chain), nodePool);
+			else newChains.EmplaceBack(chain, nodePool);
+		}
+		return newChains;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline NodePool::Pointer HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::CreateNodePool(MemoryResource* resource) {
+		return NodePool::Create(ChainType::NodeSize, ChainType::NodeAlignment, resource);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GetHash(const TLookup& key) {
 		THashFunctor hashFunctor;
-		return hashFunctor(key) % _hashMap.Size();
+		return hashFunctor(key);
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GetChainIndex(size_type hash) const {
+		if (IsRehashing()) {
+			size_type oldChainIndex = hash % _migratingChains.Size();
+			if (oldChainIndex >= _migrationIndex) return oldChainIndex;
+			return _migratingChains.Size() + hash % _hashMap.Size();
+		}
+		return hash % _hashMap.Size();
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup>
+	inline bool HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::KeyEquals(const TKey& storedKey, const TLookup& key) const {
+		if constexpr (std::is_same_v<TLookup, TKey>) {
+			return _equalityFunctor(storedKey, key);
+		}
+		else {
+			return storedKey == key;
+		}
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GetEntryHash(const EntryType& entry) {
+		if constexpr (StoresHashes) {
+			return entry.Hash;
+		}
+		else {
+			return GetHash(entry.first);
+		}
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::PairType& HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GetPair(EntryType& entry) {
+		if constexpr (StoresHashes) {
+			return entry.Pair;
+		}
+		else {
+			return entry;
+		}
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline const typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::PairType& HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GetPair(const EntryType& entry) {
+		if constexpr (StoresHashes) {
+			return entry.Pair;
+		}
+		else {
+			return entry;
+		}
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename TLookup>
+	inline bool HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::EntryMatches(const EntryType& entry, const TLookup& key, [[maybe_unused]] size_type hash) const {
+		if constexpr (StoresHashes) {
+			return entry.Hash == hash && KeyEquals(entry.Pair.first, key);
+		}
+		else {
+			return KeyEquals(entry.first, key);
+		}
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	template<typename... Args>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ChainType::Iterator HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::AppendToChain(ChainType& chain, [[maybe_unused]] size_type hash, Args&&... args) {
+		if constexpr (StoresHashes) {
+			return chain.EmplaceBack(hash, std::forward<Args>(args)...);
+		}
+		else {
+			return chain.EmplaceBack(std::forward<Args>(args)...);
+		}
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::size_type HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::TotalChains() const {
+		return _migratingChains.Size() + _hashMap.Size();
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ChainType& HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GetChain(size_type chainIndex) {
+		return (chainIndex < _migratingChains.Size()) ? _migratingChains[chainIndex] : _hashMap[chainIndex - _migratingChains.Size()];
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline const typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ChainType& HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GetChain(size_type chainIndex) const {
+		return (chainIndex < _migratingChains.Size()) ? _migratingChains[chainIndex] : _hashMap[chainIndex - _migratingChains.Size()];
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	bool HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::GrowForInsert() {
+		if (_maxLoadFactor <= 0.0 || IsRehashing() || _population + 1 <= _maxLoadFactor * _hashMap.Size()) return false;
+
+		size_type chainCount = _hashMap.Size() * 2 + 1;
+		if (_incrementalRehash == 0) {
+			Rehash(chainCount);
+		}
+		else {
+			_migratingChains = std::move(_hashMap);
+			_hashMap = CreateEmptyChains(chainCount, _hashMap.GetResource(), _nodePool.get());
+			_migrationIndex = 0;
+		}
+		return true;
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	void HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::StepRehash() {
+		if (!IsRehashing()) return;
+
+		for (size_type migrated = size_type(0); migrated < _incrementalRehash && _migrationIndex < _migratingChains.Size(); ++migrated, ++_migrationIndex) {
+			MigrateChain(_migratingChains[_migrationIndex]);
+		}
+
+		if (_migrationIndex == _migratingChains.Size()) {
+			_migratingChains = Vector<ChainType>();
+			_migrationIndex = 0;
+		}
+	}
+
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	void HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::MigrateChain(ChainType& chain) {
+		if (chain.IsEmpty()) return;
+		--_populatedChains;
+
+		while (!chain.IsEmpty()) {
+			ChainType& newChain = _hashMap[GetEntryHash(chain.Front()) % _hashMap.Size()];
+			if (newChain.IsEmpty()) ++_populatedChains;
+			newChain.SpliceFrontToBack(chain);
+		}
 	}
 #pragma endregion HashMap
 
 #pragma region Iterator
-	template<typename TKey, typename TData, typename THashFunctor>
-	HashMap<TKey, TData, THashFunctor>::Iterator::Iterator(HashMap<TKey, TData, THashFunctor>& container, size_type chainNum, typename SList<PairType>::Iterator chainIter) :
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator::Iterator(HashMap<TKey, TData, THashFunctor, TEqualityFunctor>& container, size_type chainNum, typename ChainType::Iterator chainIter) :
 		_container{ &container }, _chainNumber{ chainNum }, _chainIterator{ chainIter }
 	{
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline typename HashMap<TKey, TData, THashFunctor>::reference HashMap <TKey, TData, THashFunctor>::Iterator::operator*() const {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::reference HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::Iterator::operator*() const {
 #ifdef USE_EXCEPTIONS
 		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
-		if (_chainNumber >= _container->_hashMap.Size()) throw std::runtime_error("Iterator's data is equal to end, cannot be dereferenced.");
+		if (_chainNumber >= _container->TotalChains()) throw std::runtime_error("Iterator's data is equal to end, cannot be dereferenced.");
 #endif // USE_EXCEPTIONS
-		return *_chainIterator;
+		return GetPair(*_chainIterator);
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline typename HashMap<TKey, TData, THashFunctor>::Iterator::pointer HashMap <TKey, TData, THashFunctor>::Iterator::operator->() const {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator::pointer HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::Iterator::operator->() const {
 #ifdef USE_EXCEPTIONS
 		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
-		if (_chainNumber >= _container->_hashMap.Size()) throw std::runtime_error("Iterator's data is equal to end, cannot be dereferenced.");
+		if (_chainNumber >= _container->TotalChains()) throw std::runtime_error("Iterator's data is equal to end, cannot be dereferenced.");
 #endif // USE_EXCEPTIONS
-		return &(*_chainIterator);
+		return &GetPair(*_chainIterator);
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	typename HashMap<TKey, TData, THashFunctor>::Iterator& HashMap <TKey, TData, THashFunctor>::Iterator::operator++() {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::Iterator& HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::Iterator::operator++() {
 #ifdef USE_EXCEPTIONS
 		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
 #endif // USE_EXCEPTIONS
 
 		++_chainIterator;
-		while (_chainNumber < _container->_hashMap.Size() && _chainIterator == _container->_hashMap[_chainNumber].end()) {
+		while (_chainNumber < _container->TotalChains() && _chainIterator == _container->GetChain(_chainNumber).end()) {
 #ifdef USE_CLAMPS
 			_chainNumber = (_chainNumber == std::numeric_limits<std::size_t>::max()) ? std::numeric_limits<std::size_t>::max() : ++_chainNumber;
 #else
 			++_chainNumber;
 #endif // USE_CLAMPS
-			_chainIterator = (_chainNumber < _container->_hashMap.Size()) ? _container->_hashMap[_chainNumber].begin() : SList<PairType>::Iterator();
+			_chainIterator = (_chainNumber < _container->TotalChains()) ? _container->GetChain(_chainNumber).begin() : typename ChainType::Iterator();
 		}
 
 		return *this;
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline typename HashMap <TKey, TData, THashFunctor>::Iterator HashMap <TKey, TData, THashFunctor>::Iterator::operator++(int) {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::Iterator HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::Iterator::operator++(int) {
 		Iterator it = *this;
 		operator++();
 		return it;
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline bool HashMap <TKey, TData, THashFunctor>::Iterator::operator!=(const Iterator& rhs) const {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline bool HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::Iterator::operator!=(const Iterator& rhs) const {
 		return (_container != rhs._container || _chainNumber != rhs._chainNumber || _chainIterator != rhs._chainIterator);
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline bool HashMap <TKey, TData, THashFunctor>::Iterator::operator==(const Iterator& rhs) const {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline bool HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::Iterator::operator==(const Iterator& rhs) const {
 		return !(operator!=(rhs));
 	}
 #pragma endregion Iterator
 
 #pragma region ConstIterator
-	template<typename TKey, typename TData, typename THashFunctor>
-	HashMap<TKey, TData, THashFunctor>::ConstIterator::ConstIterator(const HashMap<TKey, TData, THashFunctor>& container, size_type chainNum, typename SList<PairType>::ConstIterator chainIter) :
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator::ConstIterator(const HashMap<TKey, TData, THashFunctor, TEqualityFunctor>& container, size_type chainNum, typename ChainType::ConstIterator chainIter) :
 		_container{ &container }, _chainNumber{ chainNum }, _chainIterator{ chainIter }
 	{
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	HashMap<TKey, TData, THashFunctor>::ConstIterator::ConstIterator(const Iterator& other) :
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator::ConstIterator(const Iterator& other) :
 		_container{ other._container }, _chainNumber{ other._chainNumber }, _chainIterator{ other._chainIterator }
 	{
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline typename HashMap<TKey, TData, THashFunctor>::const_reference HashMap<TKey, TData, THashFunctor>::ConstIterator::operator*() const {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::const_reference HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator::operator*() const {
 #ifdef USE_EXCEPTIONS
 		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
-		if (_chainNumber >= _container->_hashMap.Size()) throw std::runtime_error("Iterator's data is equal to end, cannot be dereferenced.");
+		if (_chainNumber >= _container->TotalChains()) throw std::runtime_error("Iterator's data is equal to end, cannot be dereferenced.");
 #endif // USE_EXCEPTIONS
-		return *_chainIterator;
+		return GetPair(*_chainIterator);
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline typename HashMap<TKey, TData, THashFunctor>::ConstIterator::pointer HashMap <TKey, TData, THashFunctor>::ConstIterator::operator->() const {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator::pointer HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator::operator->() const {
 #ifdef USE_EXCEPTIONS
 		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
-		if (_chainNumber >= _container->_hashMap.Size()) throw std::runtime_error("Iterator's data is equal to end, cannot be dereferenced.");
+		if (_chainNumber >= _container->TotalChains()) throw std::runtime_error("Iterator's data is equal to end, cannot be dereferenced.");
 #endif // USE_EXCEPTIONS
-		return &(*_chainIterator);
+		return &GetPair(*_chainIterator);
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	typename HashMap<TKey, TData, THashFunctor>::ConstIterator& HashMap <TKey, TData, THashFunctor>::ConstIterator::operator++() {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	typename HashMap<TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator& HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator::operator++() {
 #ifdef USE_EXCEPTIONS
 		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
 #endif // USE_EXCEPTIONS
 
 		++_chainIterator;
-		while (_chainNumber < _container->_hashMap.Size() && _chainIterator == _container->_hashMap[_chainNumber].end()) {
+		while (_chainNumber < _container->TotalChains() && _chainIterator == _container->GetChain(_chainNumber).end()) {
 #ifdef USE_CLAMPS
 			_chainNumber = (_chainNumber == std::numeric_limits<std::size_t>::max()) ? std::numeric_limits<std::size_t>::max() : ++_chainNumber;
 #else
 			++_chainNumber;
 #endif // USE_CLAMPS
-			_chainIterator = (_chainNumber < _container->_hashMap.Size()) ? _container->_hashMap[_chainNumber].begin() : SList<PairType>::ConstIterator();
+			_chainIterator = (_chainNumber < _container->TotalChains()) ? _container->GetChain(_chainNumber).begin() : typename ChainType::ConstIterator();
 		}
 
 		return *this;
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline typename HashMap <TKey, TData, THashFunctor>::ConstIterator HashMap <TKey, TData, THashFunctor>::ConstIterator::operator++(int) {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline typename HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator::operator++(int) {
 		ConstIterator it = *this;
 		operator++();
 		return it;
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline bool HashMap <TKey, TData, THashFunctor>::ConstIterator::operator!=(const ConstIterator& rhs) const {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline bool HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator::operator!=(const ConstIterator& rhs) const {
 		return (_container != rhs._container || _chainNumber != rhs._chainNumber || _chainIterator != rhs._chainIterator);
 	}
 
-	template<typename TKey, typename TData, typename THashFunctor>
-	inline bool HashMap <TKey, TData, THashFunctor>::ConstIterator::operator==(const ConstIterator& rhs) const {
+	template<typename TKey, typename TData, typename THashFunctor, typename TEqualityFunctor>
+	inline bool HashMap <TKey, TData, THashFunctor, TEqualityFunctor>::ConstIterator::operator==(const ConstIterator& rhs) const {
 		return !(operator!=(rhs));
 	}
 #pragma endregion ConstIterator
@@ -0,0 +1,35 @@
+#include "pch.h"
+#include "HashMapStatistics.h"
+
+#ifdef USE_HASHMAP_STATISTICS
+namespace FIEAGameEngine {
+	double HashMapStatistics::ProbesPerFind() const {
+		return (FindCount == 0) ? 0.0 : static_cast<double>(ProbeCount) / FindCount;
+	}
+
+	void HashMapStatistics::Merge(const HashMapStatistics& other) {
+		std::size_t population = Population + other.Population;
+		MeanChainLength = (population == 0) ? 0.0 : (MeanChainLength * Population + other.MeanChainLength * other.Population) / population;
+		Population = population;
+		BucketCount += other.BucketCount;
+		LongestChain = std::max(LongestChain, other.LongestChain);
+		while (ChainLengthHistogram.Size() < other.ChainLengthHistogram.Size()) {
+			ChainLengthHistogram.PushBack(0);
+		}
+		for (std::size_t i = 0; i < other.ChainLengthHistogram.Size(); ++i) {
+			ChainLengthHistogram[i] += other.ChainLengthHistogram[i];
+		}
+		FindCount += other.FindCount;
+		InsertCount += other.InsertCount;
+		ProbeCount += other.ProbeCount;
+		MemoryFootprint += other.MemoryFootprint;
+	}
+
+	std::string HashMapStatistics::ToString() const {
+		std::ostringstream stream;
+		stream << Population << " entries in " << BucketCount << " buckets, longest chain " << LongestChain << ", mean chain " << MeanChainLength
+			<< ", " << FindCount << " finds, " << InsertCount << " inserts, " << ProbesPerFind() << " probes per find, " << MemoryFootprint << " bytes";
+		return stream.str();
+	}
+}
+#endif // USE_HASHMAP_STATISTICS
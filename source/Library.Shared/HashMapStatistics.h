@@ -0,0 +1,76 @@
+/// <summary>
+/// The declaration of the struct HashMapStatistics, the snapshot reported by HashMap and FlatHashMap when USE_HASHMAP_STATISTICS is defined.
+/// </summary>
+
+#pragma once
+
+#ifdef USE_HASHMAP_STATISTICS
+#include <cstddef>
+#include <string>
+#include "Vector.h"
+
+namespace FIEAGameEngine {
+	/// <summary>
+	/// A snapshot of how a hash map's entries are distributed and how much work its lookups have done.
+	/// For HashMap a chain is one bucket's linked list; for FlatHashMap an entry's chain length is the number of groups probed before reaching it.
+	/// The counters accumulate from construction or the last ResetStatistics call; everything else is measured when the snapshot is taken.
+	/// Only exists when USE_HASHMAP_STATISTICS is defined, so that the counters and their upkeep compile out of builds that don't want them.
+	/// </summary>
+	struct HashMapStatistics final {
+		/// <summary>
+		/// The number of chains (HashMap) or slots (FlatHashMap).
+		/// </summary>
+		std::size_t BucketCount{ 0 };
+		/// <summary>
+		/// The number of entries stored.
+		/// </summary>
+		std::size_t Population{ 0 };
+		/// <summary>
+		/// The length of the longest chain, the worst case number of keys a single lookup has to compare.
+		/// </summary>
+		std::size_t LongestChain{ 0 };
+		/// <summary>
+		/// The average chain length an entry sits in, weighted by entry, i.e. the expected number of keys compared by a successful lookup.
+		/// </summary>
+		double MeanChainLength{ 0.0 };
+		/// <summary>
+		/// How many chains have each length: ChainLengthHistogram[n] is the number of chains (HashMap) or entries (FlatHashMap) with chain length n.
+		/// </summary>
+		Vector<std::size_t> ChainLengthHistogram;
+		/// <summary>
+		/// The number of key lookups performed, including the ones made by inserts and removes.
+		/// </summary>
+		std::size_t FindCount{ 0 };
+		/// <summary>
+		/// The number of entries inserted.
+		/// </summary>
+		std::size_t InsertCount{ 0 };
+		/// <summary>
+		/// The number of stored entries examined across every lookup.
+		/// </summary>
+		std::size_t ProbeCount{ 0 };
+		/// <summary>
+		/// The number of bytes owned by the map itself: the object, its bucket storage, and the storage of every entry. Memory owned by the keys and data themselves is not included.
+		/// </summary>
+		std::size_t MemoryFootprint{ 0 };
+
+		/// <summary>
+		/// The average number of entries examined per lookup.
+		/// </summary>
+		/// <returns>ProbeCount / FindCount, or 0 if nothing has been looked up</returns>
+		[[nodiscard]] double ProbesPerFind() const;
+
+		/// <summary>
+		/// Fold another map's statistics into these, as if both maps were one: counts and sizes add, the longest chain is the longer of the two, and the mean chain length is weighted by population.
+		/// </summary>
+		/// <param name="other">The statistics to fold in</param>
+		void Merge(const HashMapStatistics& other);
+
+		/// <summary>
+		/// Produce a one line human readable summary, suitable for logging.
+		/// </summary>
+		/// <returns>The summary</returns>
+		[[nodiscard]] std::string ToString() const;
+	};
+}
+#endif // USE_HASHMAP_STATISTICS
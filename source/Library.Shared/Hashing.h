@@ -0,0 +1,55 @@
+/// <summary>
+/// The declaration of the byte hashing functions every DefaultHash specialization is built on.
+/// </summary>
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace FIEAGameEngine::Hashing {
+	/// <summary>
+	/// The seed used by DefaultHash. Changing it changes every hash value (and therefore HashMap iteration order), but never which keys are equal.
+	/// </summary>
+	inline constexpr std::uint64_t DefaultSeed = 0x9E3779B97F4A7C15ull;
+
+	/// <summary>
+	/// The four odd 64-bit constants mixed into every hash, chosen so that each has exactly half of its bits set in every byte.
+	/// </summary>
+	inline constexpr std::uint64_t Secret[4] = { 0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull };
+
+	/// <summary>
+	/// Multiplies two 64-bit values into a 128-bit product and folds the high half into the low half with an exclusive or.
+	/// This single multiply is what spreads every input bit across every output bit.
+	/// </summary>
+	/// <param name="lhs">The first factor</param>
+	/// <param name="rhs">The second factor</param>
+	/// <returns>The low 64 bits of the product xor'd with the high 64 bits</returns>
+	[[nodiscard]] std::uint64_t Mix(std::uint64_t lhs, std::uint64_t rhs);
+
+	/// <summary>
+	/// Hashes an arbitrary run of bytes into a well distributed 64-bit value, in the style of wyhash.
+	/// Inputs of up to 16 bytes are read with at most four overlapping loads; longer inputs are consumed eight bytes at a time in three independent
+	/// lanes of 48 bytes, so that long keys are hashed word-at-a-time without any per-byte work.
+	/// </summary>
+	/// <param name="data">The first byte to hash. May be null if length is zero.</param>
+	/// <param name="length">The number of bytes to hash</param>
+	/// <param name="seed">The seed to start from</param>
+	/// <returns>The 64-bit hash of the bytes</returns>
+	[[nodiscard]] std::uint64_t HashBytes(const void* data, std::size_t length, std::uint64_t seed = DefaultSeed);
+
+	/// <summary>
+	/// Hashes a single 64-bit word. Equivalent in quality to HashBytes on the same eight bytes, but without any length dispatch.
+	/// </summary>
+	/// <param name="value">The word to hash</param>
+	/// <param name="seed">The seed to start from</param>
+	/// <returns>The 64-bit hash of the word</returns>
+	[[nodiscard]] std::uint64_t HashWord(std::uint64_t value, std::uint64_t seed = DefaultSeed);
+}
+
+#include "Hashing.inl"
@@ -0,0 +1,111 @@
+/// <summary>
+/// The inline implementation of the byte hashing functions every DefaultHash specialization is built on.
+/// </summary>
+
+#pragma once
+#include "Hashing.h"
+
+namespace FIEAGameEngine::Hashing {
+	namespace Detail {
+		/// <summary>
+		/// Reads eight unaligned bytes.
+		/// </summary>
+		inline std::uint64_t Read8(const std::uint8_t* bytes) {
+			std::uint64_t value;
+			std::memcpy(&value, bytes, sizeof(value));
+			return value;
+		}
+
+		/// <summary>
+		/// Reads four unaligned bytes.
+		/// </summary>
+		inline std::uint64_t Read4(const std::uint8_t* bytes) {
+			std::uint32_t value;
+			std::memcpy(&value, bytes, sizeof(value));
+			return value;
+		}
+
+		/// <summary>
+		/// Packs one to three bytes into a word, reading the first, middle, and last byte so that no length needs a loop.
+		/// </summary>
+		inline std::uint64_t Read3(const std::uint8_t* bytes, std::size_t length) {
+			return (static_cast<std::uint64_t>(bytes[0]) << 16) | (static_cast<std::uint64_t>(bytes[length >> 1]) << 8) | bytes[length - 1];
+		}
+
+		/// <summary>
+		/// Multiplies two 64-bit values into a 128-bit product, leaving the low half in lhs and the high half in rhs.
+		/// </summary>
+		inline void Multiply(std::uint64_t& lhs, std::uint64_t& rhs) {
+#if defined(__SIZEOF_INT128__)
+			__uint128_t product = static_cast<__uint128_t>(lhs) * rhs;
+			lhs = static_cast<std::uint64_t>(product);
+			rhs = static_cast<std::uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+			lhs = _umul128(lhs, rhs, &rhs);
+#else
+			const std::uint64_t lhsHigh = lhs >> 32, lhsLow = static_cast<std::uint32_t>(lhs);
+			const std::uint64_t rhsHigh = rhs >> 32, rhsLow = static_cast<std::uint32_t>(rhs);
+			const std::uint64_t highHigh = lhsHigh * rhsHigh, highLow = lhsHigh * rhsLow, lowHigh = lhsLow * rhsHigh, lowLow = lhsLow * rhsLow;
+			const std::uint64_t cross = (lowLow >> 32) + static_cast<std::uint32_t>(highLow) + lowHigh;
+			lhs = (cross << 32) | static_cast<std::uint32_t>(lowLow);
+			rhs = highHigh + (highLow >> 32) + (cross >> 32);
+#endif
+		}
+	}
+
+	inline std::uint64_t Mix(std::uint64_t lhs, std::uint64_t rhs) {
+		Detail::Multiply(lhs, rhs);
+		return lhs ^ rhs;
+	}
+
+	inline std::uint64_t HashBytes(const void* data, std::size_t length, std::uint64_t seed) {
+		const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+		seed ^= Mix(seed ^ Secret[0], Secret[1]);
+
+		std::uint64_t first, second;
+		if (length <= 16) {
+			if (length >= 4) {
+				const std::size_t offset = (length >> 3) << 2;
+				first = (Detail::Read4(bytes) << 32) | Detail::Read4(bytes + offset);
+				second = (Detail::Read4(bytes + length - 4) << 32) | Detail::Read4(bytes + length - 4 - offset);
+			}
+			else if (length > 0) {
+				first = Detail::Read3(bytes, length);
+				second = 0;
+			}
+			else {
+				first = second = 0;
+			}
+		}
+		else {
+			std::size_t remaining = length;
+			if (remaining > 48) {
+				std::uint64_t secondLane = seed, thirdLane = seed;
+				do {
+					seed = Mix(Detail::Read8(bytes) ^ Secret[1], Detail::Read8(bytes + 8) ^ seed);
+					secondLane = Mix(Detail::Read8(bytes + 16) ^ Secret[2], Detail::Read8(bytes + 24) ^ secondLane);
+					thirdLane = Mix(Detail::Read8(bytes + 32) ^ Secret[3], Detail::Read8(bytes + 40) ^ thirdLane);
+					bytes += 48;
+					remaining -= 48;
+				} while (remaining > 48);
+				seed ^= secondLane ^ thirdLane;
+			}
+			while (remaining > 16) {
+				seed = Mix(Detail::Read8(bytes) ^ Secret[1], Detail::Read8(bytes + 8) ^ seed);
+				bytes += 16;
+				remaining -= 16;
+			}
+			first = Detail::Read8(bytes + remaining - 16);
+			second = Detail::Read8(bytes + remaining - 8);
+		}
+
+		first ^= Secret[1];
+		second ^= seed;
+		Detail::Multiply(first, second);
+		return Mix(first ^ Secret[0] ^ length, second ^ Secret[1]);
+	}
+
+	inline std::uint64_t HashWord(std::uint64_t value, std::uint64_t seed) {
+		return Mix(Mix(value ^ Secret[0], seed ^ Secret[1]) ^ Secret[2], Secret[3]);
+	}
+}
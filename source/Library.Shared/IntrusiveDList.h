@@ -0,0 +1,442 @@
+/// <summary>
+/// The declaration of the templated class IntrusiveDList, a doubly linked list whose links live inside its elements, as well as its hook IntrusiveDListHook and its enveloped classes Iterator and ConstIterator.
+/// </summary>
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <iterator>
+
+namespace FIEAGameEngine {
+	/// <summary>
+	/// The links an element carries to be a member of an IntrusiveDList. A hook knows the list it is linked into, so membership can be tested and the element unlinked in constant time.
+	/// Copying or moving an element never copies its membership: the new hook starts unlinked, and assigning to a hook leaves it as it was.
+	/// </summary>
+	class IntrusiveDListHook final {
+		template <typename T, IntrusiveDListHook T::* Hook>
+		friend class IntrusiveDList;
+
+	public:
+		/// <summary>
+		/// Default constructor for an unlinked hook.
+		/// </summary>
+		IntrusiveDListHook() = default;
+		/// <summary>
+		/// The copy constructor for a hook creates an unlinked hook, since the copied element is not a member of any list.
+		/// </summary>
+		IntrusiveDListHook(const IntrusiveDListHook&) noexcept {};
+		/// <summary>
+		/// The move constructor for a hook creates an unlinked hook, and leaves the given hook where it was.
+		/// </summary>
+		IntrusiveDListHook(IntrusiveDListHook&&) noexcept {};
+		/// <summary>
+		/// The copy assignment operator for a hook leaves this hook linked where it was.
+		/// </summary>
+		/// <returns>A reference to this hook</returns>
+		IntrusiveDListHook& operator=(const IntrusiveDListHook&) noexcept { return *this; };
+		/// <summary>
+		/// The move assignment operator for a hook leaves this hook linked where it was.
+		/// </summary>
+		/// <returns>A reference to this hook</returns>
+		IntrusiveDListHook& operator=(IntrusiveDListHook&&) noexcept { return *this; };
+		/// <summary>
+		/// The destructor for a hook. The element must have been removed from its list beforehand.
+		/// </summary>
+		~IntrusiveDListHook() { assert(_list == nullptr); };
+
+		/// <summary>
+		/// Determine whether the element is linked into a list through this hook.
+		/// </summary>
+		/// <returns>A boolean indicating whether the hook is linked</returns>
+		[[nodiscard]] bool IsLinked() const { return _list != nullptr; };
+
+	private:
+		/// <summary>
+		/// The hook of the previous element in the list, or the list's own sentinel hook.
+		/// </summary>
+		IntrusiveDListHook* _previous{ nullptr };
+		/// <summary>
+		/// The hook of the next element in the list, or the list's own sentinel hook.
+		/// </summary>
+		IntrusiveDListHook* _next{ nullptr };
+		/// <summary>
+		/// The list this hook is linked into.
+		/// </summary>
+		const void* _list{ nullptr };
+	};
+
+	/// <summary>
+	/// A templated doubly linked list of elements it does not own. Each element carries its links in an IntrusiveDListHook member named by Hook,
+	/// so linking never allocates, and an element can be unlinked from wherever it is in constant time without searching for it.
+	/// The list only stores references: elements must outlive their membership, and can be in one list per hook they have.
+	/// </summary>
+	/// <typeparam name="T">The type of the elements</typeparam>
+	/// <typeparam name="Hook">The member of T linking it into the list</typeparam>
+	template <typename T, IntrusiveDListHook T::* Hook>
+	class IntrusiveDList final {
+	public:
+		using size_type = std::size_t;
+		using value_type = T;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+
+		/// <summary>
+		/// Iterator class allows traversal of the elements of an IntrusiveDList in either direction. Dereferencing end() or moving an Iterator not associated with a list will result in a runtime error.
+		/// </summary>
+		class Iterator final {
+			friend IntrusiveDList;
+			friend class ConstIterator;
+
+		public:
+			using size_type = IntrusiveDList::size_type;
+			using value_type = IntrusiveDList::value_type;
+			using reference = IntrusiveDList::reference;
+			using const_reference = IntrusiveDList::const_reference;
+			using difference_type = std::ptrdiff_t;
+			using pointer = value_type*;
+			using iterator_category = std::bidirectional_iterator_tag;
+
+			/// <summary>
+			/// Default constructor for an Iterator not associated with any list.
+			/// </summary>
+			Iterator() = default;
+
+			/// <summary>
+			/// Dereference an Iterator.
+			/// </summary>
+			/// <returns>A reference to the element the Iterator points to</returns>
+			/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Iterator is equal to end()</exception>
+			[[nodiscard]] reference operator*() const;
+			/// <summary>
+			/// Pre-increment an Iterator. Incrementing end() wraps around to begin().
+			/// </summary>
+			/// <returns>A reference to the Iterator, now pointing to the next element</returns>
+			/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Iterator is not associated with a list</exception>
+			Iterator& operator++();
+			/// <summary>
+			/// Post-increment an Iterator.
+			/// </summary>
+			/// <returns>An Iterator pointing to the element this Iterator pointed to before being incremented</returns>
+			Iterator operator++(int);
+			/// <summary>
+			/// Pre-decrement an Iterator. Decrementing end() moves to the last element.
+			/// </summary>
+			/// <returns>A reference to the Iterator, now pointing to the previous element</returns>
+			/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Iterator is not associated with a list</exception>
+			Iterator& operator--();
+			/// <summary>
+			/// Post-decrement an Iterator.
+			/// </summary>
+			/// <returns>An Iterator pointing to the element this Iterator pointed to before being decremented</returns>
+			Iterator operator--(int);
+			/// <summary>
+			/// Test if two Iterators are equal, meaning they point to the same element.
+			/// </summary>
+			/// <param name="rhs">The Iterator being compared to</param>
+			/// <returns>A boolean indicating if the Iterators are equal</returns>
+			[[nodiscard]] bool operator==(const Iterator& rhs) const;
+			/// <summary>
+			/// Test if two Iterators are not equal.
+			/// </summary>
+			/// <param name="rhs">The Iterator being compared to</param>
+			/// <returns>A boolean indicating if the Iterators are not equal</returns>
+			[[nodiscard]] bool operator!=(const Iterator& rhs) const;
+
+		private:
+			/// <summary>
+			/// Private constructor for an Iterator pointing at the given hook of the given list.
+			/// </summary>
+			/// <param name="container">The list this Iterator belongs to</param>
+			/// <param name="hook">The hook of the element this Iterator points to, or the list's sentinel for end()</param>
+			Iterator(const IntrusiveDList& container, IntrusiveDListHook* hook);
+
+			/// <summary>
+			/// The hook of the element this Iterator points to.
+			/// </summary>
+			IntrusiveDListHook* _hook{ nullptr };
+			/// <summary>
+			/// The list this Iterator belongs to.
+			/// </summary>
+			const IntrusiveDList* _container{ nullptr };
+		};
+
+		/// <summary>
+		/// ConstIterator class allows traversal of the elements of an IntrusiveDList in either direction without modifying them.
+		/// </summary>
+		class ConstIterator final {
+			friend IntrusiveDList;
+
+		public:
+			using size_type = IntrusiveDList::size_type;
+			using value_type = IntrusiveDList::value_type;
+			using reference = IntrusiveDList::const_reference;
+			using const_reference = IntrusiveDList::const_reference;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const value_type*;
+			using iterator_category = std::bidirectional_iterator_tag;
+
+			/// <summary>
+			/// Default constructor for a ConstIterator not associated with any list.
+			/// </summary>
+			ConstIterator() = default;
+			/// <summary>
+			/// A type-cast constructor creating a ConstIterator pointing to the same element of the same list as the given Iterator.
+			/// </summary>
+			/// <param name="other">The Iterator to copy information from</param>
+			ConstIterator(const Iterator& other);
+
+			/// <summary>
+			/// Dereference a ConstIterator.
+			/// </summary>
+			/// <returns>A constant reference to the element the ConstIterator points to</returns>
+			/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the ConstIterator is equal to end()</exception>
+			[[nodiscard]] const_reference operator*() const;
+			/// <summary>
+			/// Pre-increment a ConstIterator. Incrementing end() wraps around to begin().
+			/// </summary>
+			/// <returns>A reference to the ConstIterator, now pointing to the next element</returns>
+			/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the ConstIterator is not associated with a list</exception>
+			ConstIterator& operator++();
+			/// <summary>
+			/// Post-increment a ConstIterator.
+			/// </summary>
+			/// <returns>A ConstIterator pointing to the element this ConstIterator pointed to before being incremented</returns>
+			ConstIterator operator++(int);
+			/// <summary>
+			/// Pre-decrement a ConstIterator. Decrementing end() moves to the last element.
+			/// </summary>
+			/// <returns>A reference to the ConstIterator, now pointing to the previous element</returns>
+			/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the ConstIterator is not associated with a list</exception>
+			ConstIterator& operator--();
+			/// <summary>
+			/// Post-decrement a ConstIterator.
+			/// </summary>
+			/// <returns>A ConstIterator pointing to the element this ConstIterator pointed to before being decremented</returns>
+			ConstIterator operator--(int);
+			/// <summary>
+			/// Test if two ConstIterators are equal, meaning they point to the same element.
+			/// </summary>
+			/// <param name="rhs">The ConstIterator being compared to</param>
+			/// <returns>A boolean indicating if the ConstIterators are equal</returns>
+			[[nodiscard]] bool operator==(const ConstIterator& rhs) const;
+			/// <summary>
+			/// Test if two ConstIterators are not equal.
+			/// </summary>
+			/// <param name="rhs">The ConstIterator being compared to</param>
+			/// <returns>A boolean indicating if the ConstIterators are not equal</returns>
+			[[nodiscard]] bool operator!=(const ConstIterator& rhs) const;
+
+		private:
+			/// <summary>
+			/// Private constructor for a ConstIterator pointing at the given hook of the given list.
+			/// </summary>
+			/// <param name="container">The list this ConstIterator belongs to</param>
+			/// <param name="hook">The hook of the element this ConstIterator points to, or the list's sentinel for end()</param>
+			ConstIterator(const IntrusiveDList& container, const IntrusiveDListHook* hook);
+
+			/// <summary>
+			/// The hook of the element this ConstIterator points to.
+			/// </summary>
+			const IntrusiveDListHook* _hook{ nullptr };
+			/// <summary>
+			/// The list this ConstIterator belongs to.
+			/// </summary>
+			const IntrusiveDList* _container{ nullptr };
+		};
+
+		/// <summary>
+		/// Default constructor for an empty IntrusiveDList.
+		/// </summary>
+		IntrusiveDList();
+		IntrusiveDList(const IntrusiveDList&) = delete;
+		IntrusiveDList(IntrusiveDList&&) noexcept = delete;
+		IntrusiveDList& operator=(const IntrusiveDList&) = delete;
+		IntrusiveDList& operator=(IntrusiveDList&&) noexcept = delete;
+		/// <summary>
+		/// The destructor for an IntrusiveDList unlinks every element. The elements themselves are not destroyed.
+		/// </summary>
+		~IntrusiveDList();
+
+		/// <summary>
+		/// Get a reference to the first element.
+		/// </summary>
+		/// <returns>A reference to the first element</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the list is empty</exception>
+		[[nodiscard]] reference Front();
+		/// <summary>
+		/// Get a constant reference to the first element.
+		/// </summary>
+		/// <returns>A constant reference to the first element</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the list is empty</exception>
+		[[nodiscard]] const_reference Front() const;
+		/// <summary>
+		/// Get a reference to the last element.
+		/// </summary>
+		/// <returns>A reference to the last element</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the list is empty</exception>
+		[[nodiscard]] reference Back();
+		/// <summary>
+		/// Get a constant reference to the last element.
+		/// </summary>
+		/// <returns>A constant reference to the last element</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the list is empty</exception>
+		[[nodiscard]] const_reference Back() const;
+		/// <summary>
+		/// Get the element after the given one.
+		/// </summary>
+		/// <param name="element">An element of this list</param>
+		/// <returns>A pointer to the next element, or nullptr if the given element is the last one</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the element is not in this list</exception>
+		[[nodiscard]] value_type* Next(const_reference element) const;
+		/// <summary>
+		/// Get the element before the given one.
+		/// </summary>
+		/// <param name="element">An element of this list</param>
+		/// <returns>A pointer to the previous element, or nullptr if the given element is the first one</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the element is not in this list</exception>
+		[[nodiscard]] value_type* Previous(const_reference element) const;
+		/// <summary>
+		/// Get the number of elements in the list.
+		/// </summary>
+		/// <returns>The number of elements</returns>
+		[[nodiscard]] size_type Size() const;
+		/// <summary>
+		/// Determine whether the list is empty.
+		/// </summary>
+		/// <returns>A boolean indicating whether the list is empty</returns>
+		[[nodiscard]] bool IsEmpty() const;
+		/// <summary>
+		/// Determine whether an element is linked into this list, in constant time.
+		/// </summary>
+		/// <param name="element">The element to look for</param>
+		/// <returns>A boolean indicating whether the element is in this list</returns>
+		[[nodiscard]] bool Contains(const_reference element) const;
+
+		/// <summary>
+		/// Link an element in at the front of the list.
+		/// </summary>
+		/// <param name="element">The element to link in</param>
+		/// <returns>An Iterator pointing to the element</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the element is already linked through this hook</exception>
+		Iterator PushFront(reference element);
+		/// <summary>
+		/// Link an element in at the back of the list.
+		/// </summary>
+		/// <param name="element">The element to link in</param>
+		/// <returns>An Iterator pointing to the element</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the element is already linked through this hook</exception>
+		Iterator PushBack(reference element);
+		/// <summary>
+		/// Link an element in directly before the element the given Iterator points to, or at the back if it is end().
+		/// </summary>
+		/// <param name="element">The element to link in</param>
+		/// <param name="iter">An Iterator pointing to the element to insert before</param>
+		/// <returns>An Iterator pointing to the inserted element</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the element is already linked through this hook, or the Iterator does not belong to this list</exception>
+		Iterator InsertBefore(reference element, const Iterator& iter);
+		/// <summary>
+		/// Unlink the first element.
+		/// </summary>
+		/// <returns>A reference to the unlinked element</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the list is empty</exception>
+		reference PopFront();
+		/// <summary>
+		/// Unlink the last element.
+		/// </summary>
+		/// <returns>A reference to the unlinked element</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the list is empty</exception>
+		reference PopBack();
+		/// <summary>
+		/// Unlink the given element in constant time.
+		/// </summary>
+		/// <param name="element">The element to unlink</param>
+		/// <returns>A boolean indicating whether the element was in this list</returns>
+		bool Remove(reference element);
+		/// <summary>
+		/// Unlink the element the given Iterator points to.
+		/// </summary>
+		/// <param name="iter">An Iterator pointing to the element to unlink</param>
+		/// <returns>An Iterator pointing to the element after the unlinked one</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Iterator does not belong to this list</exception>
+		Iterator Remove(const Iterator& iter);
+		/// <summary>
+		/// Unlink every element. The elements themselves are not destroyed.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Get an Iterator pointing to the first element.
+		/// </summary>
+		/// <returns>An Iterator pointing to the first element</returns>
+		[[nodiscard]] Iterator begin();
+		/// <summary>
+		/// Get an Iterator pointing past the last element.
+		/// </summary>
+		/// <returns>An Iterator pointing past the last element</returns>
+		[[nodiscard]] Iterator end();
+		/// <summary>
+		/// Get a ConstIterator pointing to the first element.
+		/// </summary>
+		/// <returns>A ConstIterator pointing to the first element</returns>
+		[[nodiscard]] ConstIterator begin() const;
+		/// <summary>
+		/// Get a ConstIterator pointing past the last element.
+		/// </summary>
+		/// <returns>A ConstIterator pointing past the last element</returns>
+		[[nodiscard]] ConstIterator end() const;
+		/// <summary>
+		/// Get a ConstIterator pointing to the first element, even from a non-const list.
+		/// </summary>
+		/// <returns>A ConstIterator pointing to the first element</returns>
+		[[nodiscard]] ConstIterator cbegin() const;
+		/// <summary>
+		/// Get a ConstIterator pointing past the last element, even from a non-const list.
+		/// </summary>
+		/// <returns>A ConstIterator pointing past the last element</returns>
+		[[nodiscard]] ConstIterator cend() const;
+
+	private:
+		/// <summary>
+		/// Link a hook in directly before another hook of this list.
+		/// </summary>
+		/// <param name="hook">The hook to link in</param>
+		/// <param name="position">The hook to link before, which may be the sentinel</param>
+		void LinkBefore(IntrusiveDListHook* hook, IntrusiveDListHook* position);
+		/// <summary>
+		/// Unlink a hook of this list.
+		/// </summary>
+		/// <param name="hook">The hook to unlink</param>
+		void Unlink(IntrusiveDListHook* hook);
+		/// <summary>
+		/// Get the hook of an element.
+		/// </summary>
+		/// <param name="element">The element</param>
+		/// <returns>A pointer to the element's hook</returns>
+		[[nodiscard]] static IntrusiveDListHook* HookOf(reference element);
+		/// <summary>
+		/// Get the hook of an element.
+		/// </summary>
+		/// <param name="element">The element</param>
+		/// <returns>A constant pointer to the element's hook</returns>
+		[[nodiscard]] static const IntrusiveDListHook* HookOf(const_reference element);
+		/// <summary>
+		/// Get the element a hook is a member of.
+		/// </summary>
+		/// <param name="hook">The hook</param>
+		/// <returns>A reference to the element containing the hook</returns>
+		[[nodiscard]] static reference ElementOf(const IntrusiveDListHook* hook);
+
+		/// <summary>
+		/// The sentinel hook the list is closed into a ring around. Its next hook is the first element and its previous hook the last.
+		/// </summary>
+		IntrusiveDListHook _sentinel;
+		/// <summary>
+		/// The number of elements.
+		/// </summary>
+		size_type _size{ 0 };
+	};
+}
+
+#include "IntrusiveDList.inl"
@@ -0,0 +1,356 @@
+/// <summary>
+/// The fully specified implementation of the templated class IntrusiveDList and its enveloped classes Iterator and ConstIterator.
+/// </summary>
+
+#include "IntrusiveDList.h"
+
+namespace FIEAGameEngine {
+#pragma region IntrusiveDList
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline IntrusiveDList<value_type, Hook>::IntrusiveDList() {
+		_sentinel._previous = &_sentinel;
+		_sentinel._next = &_sentinel;
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline IntrusiveDList<value_type, Hook>::~IntrusiveDList() {
+		Clear();
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::reference IntrusiveDList<value_type, Hook>::Front() {
+#ifdef USE_EXCEPTIONS
+		if (_size == size_type(0)) throw std::runtime_error("List is empty.");
+#endif // USE_EXCEPTIONS
+		return ElementOf(_sentinel._next);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::const_reference IntrusiveDList<value_type, Hook>::Front() const {
+#ifdef USE_EXCEPTIONS
+		if (_size == size_type(0)) throw std::runtime_error("List is empty.");
+#endif // USE_EXCEPTIONS
+		return ElementOf(_sentinel._next);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::reference IntrusiveDList<value_type, Hook>::Back() {
+#ifdef USE_EXCEPTIONS
+		if (_size == size_type(0)) throw std::runtime_error("List is empty.");
+#endif // USE_EXCEPTIONS
+		return ElementOf(_sentinel._previous);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::const_reference IntrusiveDList<value_type, Hook>::Back() const {
+#ifdef USE_EXCEPTIONS
+		if (_size == size_type(0)) throw std::runtime_error("List is empty.");
+#endif // USE_EXCEPTIONS
+		return ElementOf(_sentinel._previous);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline value_type* IntrusiveDList<value_type, Hook>::Next(const_reference element) const {
+#ifdef USE_EXCEPTIONS
+		if (!Contains(element)) throw std::runtime_error("Element is not in this list.");
+#endif // USE_EXCEPTIONS
+		const IntrusiveDListHook* next = HookOf(element)->_next;
+		return next == &_sentinel ? nullptr : &ElementOf(next);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline value_type* IntrusiveDList<value_type, Hook>::Previous(const_reference element) const {
+#ifdef USE_EXCEPTIONS
+		if (!Contains(element)) throw std::runtime_error("Element is not in this list.");
+#endif // USE_EXCEPTIONS
+		const IntrusiveDListHook* previous = HookOf(element)->_previous;
+		return previous == &_sentinel ? nullptr : &ElementOf(previous);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::size_type IntrusiveDList<value_type, Hook>::Size() const {
+		return _size;
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline bool IntrusiveDList<value_type, Hook>::IsEmpty() const {
+		return _size == size_type(0);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline bool IntrusiveDList<value_type, Hook>::Contains(const_reference element) const {
+		return HookOf(element)->_list == this;
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::Iterator IntrusiveDList<value_type, Hook>::PushFront(reference element) {
+		IntrusiveDListHook* hook = HookOf(element);
+		LinkBefore(hook, _sentinel._next);
+		return Iterator(*this, hook);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::Iterator IntrusiveDList<value_type, Hook>::PushBack(reference element) {
+		IntrusiveDListHook* hook = HookOf(element);
+		LinkBefore(hook, &_sentinel);
+		return Iterator(*this, hook);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::Iterator IntrusiveDList<value_type, Hook>::InsertBefore(reference element, const Iterator& iter) {
+#ifdef USE_EXCEPTIONS
+		if (iter._container != this) throw std::runtime_error("Given iterator is not associated with this list.");
+#endif // USE_EXCEPTIONS
+		IntrusiveDListHook* hook = HookOf(element);
+		LinkBefore(hook, iter._hook);
+		return Iterator(*this, hook);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::reference IntrusiveDList<value_type, Hook>::PopFront() {
+#ifdef USE_EXCEPTIONS
+		if (_size == size_type(0)) throw std::runtime_error("List is empty.");
+#endif // USE_EXCEPTIONS
+		IntrusiveDListHook* hook = _sentinel._next;
+		Unlink(hook);
+		return ElementOf(hook);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::reference IntrusiveDList<value_type, Hook>::PopBack() {
+#ifdef USE_EXCEPTIONS
+		if (_size == size_type(0)) throw std::runtime_error("List is empty.");
+#endif // USE_EXCEPTIONS
+		IntrusiveDListHook* hook = _sentinel._previous;
+		Unlink(hook);
+		return ElementOf(hook);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline bool IntrusiveDList<value_type, Hook>::Remove(reference element) {
+		if (!Contains(element)) return false;
+		Unlink(HookOf(element));
+		return true;
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::Iterator IntrusiveDList<value_type, Hook>::Remove(const Iterator& iter) {
+#ifdef USE_EXCEPTIONS
+		if (iter._container != this) throw std::runtime_error("Given iterator is not associated with this list.");
+#endif // USE_EXCEPTIONS
+		if (iter._hook == &_sentinel) return end();
+
+		IntrusiveDListHook* next = iter._hook->_next;
+		Unlink(iter._hook);
+		return Iterator(*this, next);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline void IntrusiveDList<value_type, Hook>::Clear() {
+		IntrusiveDListHook* hook = _sentinel._next;
+		while (hook != &_sentinel) {
+			IntrusiveDListHook* next = hook->_next;
+			hook->_previous = nullptr;
+			hook->_next = nullptr;
+			hook->_list = nullptr;
+			hook = next;
+		}
+		_sentinel._previous = &_sentinel;
+		_sentinel._next = &_sentinel;
+		_size = 0;
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::Iterator IntrusiveDList<value_type, Hook>::begin() {
+		return Iterator(*this, _sentinel._next);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::Iterator IntrusiveDList<value_type, Hook>::end() {
+		return Iterator(*this, &_sentinel);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::ConstIterator IntrusiveDList<value_type, Hook>::begin() const {
+		return ConstIterator(*this, _sentinel._next);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::ConstIterator IntrusiveDList<value_type, Hook>::end() const {
+		return ConstIterator(*this, &_sentinel);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::ConstIterator IntrusiveDList<value_type, Hook>::cbegin() const {
+		return ConstIterator(*this, _sentinel._next);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::ConstIterator IntrusiveDList<value_type, Hook>::cend() const {
+		return ConstIterator(*this, &_sentinel);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline void IntrusiveDList<value_type, Hook>::LinkBefore(IntrusiveDListHook* hook, IntrusiveDListHook* position) {
+#ifdef USE_EXCEPTIONS
+		if (hook->_list != nullptr) throw std::runtime_error("Element is already linked into a list.");
+#endif // USE_EXCEPTIONS
+		hook->_previous = position->_previous;
+		hook->_next = position;
+		hook->_list = this;
+		position->_previous->_next = hook;
+		position->_previous = hook;
+		++_size;
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline void IntrusiveDList<value_type, Hook>::Unlink(IntrusiveDListHook* hook) {
+		hook->_previous->_next = hook->_next;
+		hook->_next->_previous = hook->_previous;
+		hook->_previous = nullptr;
+		hook->_next = nullptr;
+		hook->_list = nullptr;
+		--_size;
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline IntrusiveDListHook* IntrusiveDList<value_type, Hook>::HookOf(reference element) {
+		return &(element.*Hook);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline const IntrusiveDListHook* IntrusiveDList<value_type, Hook>::HookOf(const_reference element) {
+		return &(element.*Hook);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::reference IntrusiveDList<value_type, Hook>::ElementOf(const IntrusiveDListHook* hook) {
+		//The offset of the hook inside an element is measured on a fake element address rather than on nullptr, and is a constant the compiler folds
+		const value_type* fakeElement = reinterpret_cast<const value_type*>(alignof(value_type) * 16);
+		const std::ptrdiff_t offset = reinterpret_cast<const std::byte*>(&(fakeElement->*Hook)) - reinterpret_cast<const std::byte*>(fakeElement);
+		return *reinterpret_cast<value_type*>(const_cast<std::byte*>(reinterpret_cast<const std::byte*>(hook)) - offset);
+	}
+#pragma endregion IntrusiveDList
+
+#pragma region Iterator
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline IntrusiveDList<value_type, Hook>::Iterator::Iterator(const IntrusiveDList& container, IntrusiveDListHook* hook) :
+		_hook{ hook }, _container{ &container }
+	{
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::reference IntrusiveDList<value_type, Hook>::Iterator::operator*() const {
+#ifdef USE_EXCEPTIONS
+		if (_container == nullptr || _hook == &_container->_sentinel) throw std::runtime_error("Iterator's data is equal to end, cannot be dereferenced.");
+#endif // USE_EXCEPTIONS
+		return ElementOf(_hook);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::Iterator& IntrusiveDList<value_type, Hook>::Iterator::operator++() {
+#ifdef USE_EXCEPTIONS
+		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
+#endif // USE_EXCEPTIONS
+		_hook = _hook->_next;
+		return *this;
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::Iterator IntrusiveDList<value_type, Hook>::Iterator::operator++(int) {
+		Iterator it = *this;
+		operator++();
+		return it;
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::Iterator& IntrusiveDList<value_type, Hook>::Iterator::operator--() {
+#ifdef USE_EXCEPTIONS
+		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
+#endif // USE_EXCEPTIONS
+		_hook = _hook->_previous;
+		return *this;
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::Iterator IntrusiveDList<value_type, Hook>::Iterator::operator--(int) {
+		Iterator it = *this;
+		operator--();
+		return it;
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline bool IntrusiveDList<value_type, Hook>::Iterator::operator==(const Iterator& rhs) const {
+		return _container == rhs._container && _hook == rhs._hook;
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline bool IntrusiveDList<value_type, Hook>::Iterator::operator!=(const Iterator& rhs) const {
+		return !operator==(rhs);
+	}
+#pragma endregion Iterator
+
+#pragma region ConstIterator
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline IntrusiveDList<value_type, Hook>::ConstIterator::ConstIterator(const Iterator& other) :
+		_hook{ other._hook }, _container{ other._container }
+	{
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline IntrusiveDList<value_type, Hook>::ConstIterator::ConstIterator(const IntrusiveDList& container, const IntrusiveDListHook* hook) :
+		_hook{ hook }, _container{ &container }
+	{
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::const_reference IntrusiveDList<value_type, Hook>::ConstIterator::operator*() const {
+#ifdef USE_EXCEPTIONS
+		if (_container == nullptr || _hook == &_container->_sentinel) throw std::runtime_error("Iterator's data is equal to end, cannot be dereferenced.");
+#endif // USE_EXCEPTIONS
+		return ElementOf(_hook);
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::ConstIterator& IntrusiveDList<value_type, Hook>::ConstIterator::operator++() {
+#ifdef USE_EXCEPTIONS
+		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
+#endif // USE_EXCEPTIONS
+		_hook = _hook->_next;
+		return *this;
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::ConstIterator IntrusiveDList<value_type, Hook>::ConstIterator::operator++(int) {
+		ConstIterator it = *this;
+		operator++();
+		return it;
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::ConstIterator& IntrusiveDList<value_type, Hook>::ConstIterator::operator--() {
+#ifdef USE_EXCEPTIONS
+		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
+#endif // USE_EXCEPTIONS
+		_hook = _hook->_previous;
+		return *this;
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline typename IntrusiveDList<value_type, Hook>::ConstIterator IntrusiveDList<value_type, Hook>::ConstIterator::operator--(int) {
+		ConstIterator it = *this;
+		operator--();
+		return it;
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline bool IntrusiveDList<value_type, Hook>::ConstIterator::operator==(const ConstIterator& rhs) const {
+		return _container == rhs._container && _hook == rhs._hook;
+	}
+
+	template<typename value_type, IntrusiveDListHook value_type::* Hook>
+	inline bool IntrusiveDList<value_type, Hook>::ConstIterator::operator!=(const ConstIterator& rhs) const {
+		return !operator==(rhs);
+	}
+#pragma endregion ConstIterator
+}
@@ -0,0 +1,378 @@
+/// <summary>
+/// The declaration of the templated class IntrusiveSList, a singly linked list whose links live inside its elements, as well as its hook IntrusiveSListHook and its enveloped classes Iterator and ConstIterator.
+/// </summary>
+
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <iterator>
+
+namespace FIEAGameEngine {
+	/// <summary>
+	/// The link an element carries to be a member of an IntrusiveSList. An element can be in one IntrusiveSList per hook it has.
+	/// Copying or moving an element never copies its membership: the new hook starts unlinked, and assigning to a hook leaves it as it was.
+	/// </summary>
+	class IntrusiveSListHook final {
+		template <typename T, IntrusiveSListHook T::* Hook>
+		friend class IntrusiveSList;
+
+	public:
+		/// <summary>
+		/// Default constructor for an unlinked hook.
+		/// </summary>
+		IntrusiveSListHook() = default;
+		/// <summary>
+		/// The copy constructor for a hook creates an unlinked hook, since the copied element is not a member of any list.
+		/// </summary>
+		IntrusiveSListHook(const IntrusiveSListHook&) noexcept {};
+		/// <summary>
+		/// The move constructor for a hook creates an unlinked hook, and leaves the given hook where it was.
+		/// </summary>
+		IntrusiveSListHook(IntrusiveSListHook&&) noexcept {};
+		/// <summary>
+		/// The copy assignment operator for a hook leaves this hook linked where it was.
+		/// </summary>
+		/// <returns>A reference to this hook</returns>
+		IntrusiveSListHook& operator=(const IntrusiveSListHook&) noexcept { return *this; };
+		/// <summary>
+		/// The move assignment operator for a hook leaves this hook linked where it was.
+		/// </summary>
+		/// <returns>A reference to this hook</returns>
+		IntrusiveSListHook& operator=(IntrusiveSListHook&&) noexcept { return *this; };
+		/// <summary>
+		/// The destructor for a hook. The element must have been removed from its list beforehand.
+		/// </summary>
+		~IntrusiveSListHook() = default;
+
+	private:
+		/// <summary>
+		/// The hook of the next element in the list.
+		/// </summary>
+		IntrusiveSListHook* _next{ nullptr };
+	};
+
+	/// <summary>
+	/// A templated singly linked list of elements it does not own. Each element carries the link to the next one in an IntrusiveSListHook member named by Hook,
+	/// so adding and removing elements never allocates, and an element can be handed from one list to another in constant time.
+	/// The list only stores references: elements must outlive their membership, and must not be in another list through the same hook.
+	/// Pushing to either end and popping from the front are constant time; removing an arbitrary element is linear, so prefer IntrusiveDList when elements leave from the middle.
+	/// </summary>
+	/// <typeparam name="T">The type of the elements</typeparam>
+	/// <typeparam name="Hook">The member of T linking it into the list</typeparam>
+	template <typename T, IntrusiveSListHook T::* Hook>
+	class IntrusiveSList final {
+	public:
+		using size_type = std::size_t;
+		using value_type = T;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+
+		/// <summary>
+		/// Iterator class allows traversal of the elements of an IntrusiveSList. Dereferencing end() or incrementing an Iterator not associated with a list will result in a runtime error.
+		/// </summary>
+		class Iterator final {
+			friend IntrusiveSList;
+			friend class ConstIterator;
+
+		public:
+			using size_type = IntrusiveSList::size_type;
+			using value_type = IntrusiveSList::value_type;
+			using reference = IntrusiveSList::reference;
+			using const_reference = IntrusiveSList::const_reference;
+			using difference_type = std::ptrdiff_t;
+			using pointer = value_type*;
+			using iterator_category = std::forward_iterator_tag;
+
+			/// <summary>
+			/// Default constructor for an Iterator not associated with any list.
+			/// </summary>
+			Iterator() = default;
+
+			/// <summary>
+			/// Dereference an Iterator.
+			/// </summary>
+			/// <returns>A reference to the element the Iterator points to</returns>
+			/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Iterator is equal to end()</exception>
+			[[nodiscard]] reference operator*() const;
+			/// <summary>
+			/// Pre-increment an Iterator.
+			/// </summary>
+			/// <returns>A reference to the Iterator, now pointing to the next element</returns>
+			/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Iterator is not associated with a list</exception>
+			Iterator& operator++();
+			/// <summary>
+			/// Post-increment an Iterator.
+			/// </summary>
+			/// <returns>An Iterator pointing to the element this Iterator pointed to before being incremented</returns>
+			Iterator operator++(int);
+			/// <summary>
+			/// Test if two Iterators are equal, meaning they belong to the same list and point to the same element.
+			/// </summary>
+			/// <param name="rhs">The Iterator being compared to</param>
+			/// <returns>A boolean indicating if the Iterators are equal</returns>
+			[[nodiscard]] bool operator==(const Iterator& rhs) const;
+			/// <summary>
+			/// Test if two Iterators are not equal.
+			/// </summary>
+			/// <param name="rhs">The Iterator being compared to</param>
+			/// <returns>A boolean indicating if the Iterators are not equal</returns>
+			[[nodiscard]] bool operator!=(const Iterator& rhs) const;
+
+		private:
+			/// <summary>
+			/// Private constructor for an Iterator pointing at the given hook of the given list.
+			/// </summary>
+			/// <param name="container">The list this Iterator belongs to</param>
+			/// <param name="hook">The hook of the element this Iterator points to, or nullptr for end()</param>
+			Iterator(const IntrusiveSList& container, IntrusiveSListHook* hook = nullptr);
+
+			/// <summary>
+			/// The hook of the element this Iterator points to.
+			/// </summary>
+			IntrusiveSListHook* _hook{ nullptr };
+			/// <summary>
+			/// The list this Iterator belongs to.
+			/// </summary>
+			const IntrusiveSList* _container{ nullptr };
+		};
+
+		/// <summary>
+		/// ConstIterator class allows traversal of the elements of an IntrusiveSList without modifying them.
+		/// </summary>
+		class ConstIterator final {
+			friend IntrusiveSList;
+
+		public:
+			using size_type = IntrusiveSList::size_type;
+			using value_type = IntrusiveSList::value_type;
+			using reference = IntrusiveSList::const_reference;
+			using const_reference = IntrusiveSList::const_reference;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const value_type*;
+			using iterator_category = std::forward_iterator_tag;
+
+			/// <summary>
+			/// Default constructor for a ConstIterator not associated with any list.
+			/// </summary>
+			ConstIterator() = default;
+			/// <summary>
+			/// A type-cast constructor creating a ConstIterator pointing to the same element of the same list as the given Iterator.
+			/// </summary>
+			/// <param name="other">The Iterator to copy information from</param>
+			ConstIterator(const Iterator& other);
+
+			/// <summary>
+			/// Dereference a ConstIterator.
+			/// </summary>
+			/// <returns>A constant reference to the element the ConstIterator points to</returns>
+			/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the ConstIterator is equal to end()</exception>
+			[[nodiscard]] const_reference operator*() const;
+			/// <summary>
+			/// Pre-increment a ConstIterator.
+			/// </summary>
+			/// <returns>A reference to the ConstIterator, now pointing to the next element</returns>
+			/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the ConstIterator is not associated with a list</exception>
+			ConstIterator& operator++();
+			/// <summary>
+			/// Post-increment a ConstIterator.
+			/// </summary>
+			/// <returns>A ConstIterator pointing to the element this ConstIterator pointed to before being incremented</returns>
+			ConstIterator operator++(int);
+			/// <summary>
+			/// Test if two ConstIterators are equal, meaning they belong to the same list and point to the same element.
+			/// </summary>
+			/// <param name="rhs">The ConstIterator being compared to</param>
+			/// <returns>A boolean indicating if the ConstIterators are equal</returns>
+			[[nodiscard]] bool operator==(const ConstIterator& rhs) const;
+			/// <summary>
+			/// Test if two ConstIterators are not equal.
+			/// </summary>
+			/// <param name="rhs">The ConstIterator being compared to</param>
+			/// <returns>A boolean indicating if the ConstIterators are not equal</returns>
+			[[nodiscard]] bool operator!=(const ConstIterator& rhs) const;
+
+		private:
+			/// <summary>
+			/// Private constructor for a ConstIterator pointing at the given hook of the given list.
+			/// </summary>
+			/// <param name="container">The list this ConstIterator belongs to</param>
+			/// <param name="hook">The hook of the element this ConstIterator points to, or nullptr for end()</param>
+			ConstIterator(const IntrusiveSList& container, const IntrusiveSListHook* hook = nullptr);
+
+			/// <summary>
+			/// The hook of the element this ConstIterator points to.
+			/// </summary>
+			const IntrusiveSListHook* _hook{ nullptr };
+			/// <summary>
+			/// The list this ConstIterator belongs to.
+			/// </summary>
+			const IntrusiveSList* _container{ nullptr };
+		};
+
+		/// <summary>
+		/// Default constructor for an empty IntrusiveSList.
+		/// </summary>
+		IntrusiveSList() = default;
+		IntrusiveSList(const IntrusiveSList&) = delete;
+		/// <summary>
+		/// The move constructor for an IntrusiveSList takes over every element of the given list, leaving it empty.
+		/// </summary>
+		/// <param name="rhs">The IntrusiveSList to move elements from</param>
+		IntrusiveSList(IntrusiveSList&& rhs) noexcept;
+		IntrusiveSList& operator=(const IntrusiveSList&) = delete;
+		/// <summary>
+		/// The move assignment operator for an IntrusiveSList unlinks every element of this list, then takes over every element of the given list, leaving it empty.
+		/// </summary>
+		/// <param name="rhs">The IntrusiveSList to move elements from</param>
+		/// <returns>A reference to the updated IntrusiveSList</returns>
+		IntrusiveSList& operator=(IntrusiveSList&& rhs) noexcept;
+		/// <summary>
+		/// The destructor for an IntrusiveSList unlinks every element. The elements themselves are not destroyed.
+		/// </summary>
+		~IntrusiveSList();
+
+		/// <summary>
+		/// Get a reference to the first element.
+		/// </summary>
+		/// <returns>A reference to the first element</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the list is empty</exception>
+		[[nodiscard]] reference Front();
+		/// <summary>
+		/// Get a constant reference to the first element.
+		/// </summary>
+		/// <returns>A constant reference to the first element</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the list is empty</exception>
+		[[nodiscard]] const_reference Front() const;
+		/// <summary>
+		/// Get a reference to the last element.
+		/// </summary>
+		/// <returns>A reference to the last element</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the list is empty</exception>
+		[[nodiscard]] reference Back();
+		/// <summary>
+		/// Get a constant reference to the last element.
+		/// </summary>
+		/// <returns>A constant reference to the last element</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the list is empty</exception>
+		[[nodiscard]] const_reference Back() const;
+		/// <summary>
+		/// Get the number of elements in the list.
+		/// </summary>
+		/// <returns>The number of elements</returns>
+		[[nodiscard]] size_type Size() const;
+		/// <summary>
+		/// Determine whether the list is empty.
+		/// </summary>
+		/// <returns>A boolean indicating whether the list is empty</returns>
+		[[nodiscard]] bool IsEmpty() const;
+
+		/// <summary>
+		/// Link an element in at the front of the list.
+		/// </summary>
+		/// <param name="element">The element to link in, which must not be in another list through the same hook</param>
+		/// <returns>An Iterator pointing to the element</returns>
+		Iterator PushFront(reference element);
+		/// <summary>
+		/// Link an element in at the back of the list.
+		/// </summary>
+		/// <param name="element">The element to link in, which must not be in another list through the same hook</param>
+		/// <returns>An Iterator pointing to the element</returns>
+		Iterator PushBack(reference element);
+		/// <summary>
+		/// Link an element in directly after the element the given Iterator points to, or at the back if it is end().
+		/// </summary>
+		/// <param name="element">The element to link in, which must not be in another list through the same hook</param>
+		/// <param name="iter">An Iterator pointing to the element to insert after</param>
+		/// <returns>An Iterator pointing to the inserted element</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Iterator does not belong to this list</exception>
+		Iterator InsertAfter(reference element, const Iterator& iter);
+		/// <summary>
+		/// Unlink the first element.
+		/// </summary>
+		/// <returns>A reference to the unlinked element</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the list is empty</exception>
+		reference PopFront();
+		/// <summary>
+		/// Unlink the given element, searching the list for it.
+		/// </summary>
+		/// <param name="element">The element to unlink</param>
+		/// <returns>A boolean indicating whether the element was found in the list</returns>
+		bool Remove(reference element);
+		/// <summary>
+		/// Unlink every element of another list and append them, in order, to the back of this list in constant time.
+		/// </summary>
+		/// <param name="other">The list to take the elements of, left empty</param>
+		void SpliceBack(IntrusiveSList& other);
+		/// <summary>
+		/// Unlink every element. The elements themselves are not destroyed.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Get an Iterator pointing to the first element.
+		/// </summary>
+		/// <returns>An Iterator pointing to the first element</returns>
+		[[nodiscard]] Iterator begin();
+		/// <summary>
+		/// Get an Iterator pointing past the last element.
+		/// </summary>
+		/// <returns>An Iterator pointing past the last element</returns>
+		[[nodiscard]] Iterator end();
+		/// <summary>
+		/// Get a ConstIterator pointing to the first element.
+		/// </summary>
+		/// <returns>A ConstIterator pointing to the first element</returns>
+		[[nodiscard]] ConstIterator begin() const;
+		/// <summary>
+		/// Get a ConstIterator pointing past the last element.
+		/// </summary>
+		/// <returns>A ConstIterator pointing past the last element</returns>
+		[[nodiscard]] ConstIterator end() const;
+		/// <summary>
+		/// Get a ConstIterator pointing to the first element, even from a non-const list.
+		/// </summary>
+		/// <returns>A ConstIterator pointing to the first element</returns>
+		[[nodiscard]] ConstIterator cbegin() const;
+		/// <summary>
+		/// Get a ConstIterator pointing past the last element, even from a non-const list.
+		/// </summary>
+		/// <returns>A ConstIterator pointing past the last element</returns>
+		[[nodiscard]] ConstIterator cend() const;
+
+	private:
+		/// <summary>
+		/// Get the hook of an element.
+		/// </summary>
+		/// <param name="element">The element</param>
+		/// <returns>A pointer to the element's hook</returns>
+		[[nodiscard]] static IntrusiveSListHook* HookOf(reference element);
+		/// <summary>
+		/// Get the element a hook is a member of.
+		/// </summary>
+		/// <param name="hook">The hook</param>
+		/// <returns>A reference to the element containing the hook</returns>
+		[[nodiscard]] static reference ElementOf(IntrusiveSListHook* hook);
+		/// <summary>
+		/// Get the element a hook is a member of.
+		/// </summary>
+		/// <param name="hook">The hook</param>
+		/// <returns>A constant reference to the element containing the hook</returns>
+		[[nodiscard]] static const_reference ElementOf(const IntrusiveSListHook* hook);
+
+		/// <summary>
+		/// The hook of the first element.
+		/// </summary>
+		IntrusiveSListHook* _front{ nullptr };
+		/// <summary>
+		/// The hook of the last element.
+		/// </summary>
+		IntrusiveSListHook* _back{ nullptr };
+		/// <summary>
+		/// The number of elements.
+		/// </summary>
+		size_type _size{ 0 };
+	};
+}
+
+#include "IntrusiveSList.inl"
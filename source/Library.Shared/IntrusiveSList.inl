@@ -0,0 +1,302 @@
+/// <summary>
+/// The fully specified implementation of the templated class IntrusiveSList and its enveloped classes Iterator and ConstIterator.
+/// </summary>
+
+#include "IntrusiveSList.h"
+
+namespace FIEAGameEngine {
+#pragma region IntrusiveSList
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline IntrusiveSList<value_type, Hook>::IntrusiveSList(IntrusiveSList&& rhs) noexcept :
+		_front{ rhs._front }, _back{ rhs._back }, _size{ rhs._size }
+	{
+		rhs._front = nullptr;
+		rhs._back = nullptr;
+		rhs._size = 0;
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline IntrusiveSList<value_type, Hook>& IntrusiveSList<value_type, Hook>::operator=(IntrusiveSList&& rhs) noexcept {
+		if (this != &rhs) {
+			Clear();
+			SpliceBack(rhs);
+		}
+		return *this;
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline IntrusiveSList<value_type, Hook>::~IntrusiveSList() {
+		Clear();
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::reference IntrusiveSList<value_type, Hook>::Front() {
+#ifdef USE_EXCEPTIONS
+		if (_front == nullptr) throw std::runtime_error("List is empty.");
+#endif // USE_EXCEPTIONS
+		return ElementOf(_front);
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::const_reference IntrusiveSList<value_type, Hook>::Front() const {
+#ifdef USE_EXCEPTIONS
+		if (_front == nullptr) throw std::runtime_error("List is empty.");
+#endif // USE_EXCEPTIONS
+		return ElementOf(static_cast<const IntrusiveSListHook*>(_front));
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::reference IntrusiveSList<value_type, Hook>::Back() {
+#ifdef USE_EXCEPTIONS
+		if (_back == nullptr) throw std::runtime_error("List is empty.");
+#endif // USE_EXCEPTIONS
+		return ElementOf(_back);
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::const_reference IntrusiveSList<value_type, Hook>::Back() const {
+#ifdef USE_EXCEPTIONS
+		if (_back == nullptr) throw std::runtime_error("List is empty.");
+#endif // USE_EXCEPTIONS
+		return ElementOf(static_cast<const IntrusiveSListHook*>(_back));
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::size_type IntrusiveSList<value_type, Hook>::Size() const {
+		return _size;
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline bool IntrusiveSList<value_type, Hook>::IsEmpty() const {
+		return _size == size_type(0);
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::Iterator IntrusiveSList<value_type, Hook>::PushFront(reference element) {
+		IntrusiveSListHook* hook = HookOf(element);
+		hook->_next = _front;
+		_front = hook;
+		if (_back == nullptr) _back = hook;
+		++_size;
+		return Iterator(*this, hook);
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::Iterator IntrusiveSList<value_type, Hook>::PushBack(reference element) {
+		IntrusiveSListHook* hook = HookOf(element);
+		hook->_next = nullptr;
+		if (_back != nullptr) _back->_next = hook;
+		else _front = hook;
+		_back = hook;
+		++_size;
+		return Iterator(*this, hook);
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::Iterator IntrusiveSList<value_type, Hook>::InsertAfter(reference element, const Iterator& iter) {
+#ifdef USE_EXCEPTIONS
+		if (iter._container != this) throw std::runtime_error("Given iterator is not associated with this list.");
+#endif // USE_EXCEPTIONS
+		if (iter._hook == nullptr || iter._hook == _back) return PushBack(element);
+
+		IntrusiveSListHook* hook = HookOf(element);
+		hook->_next = iter._hook->_next;
+		iter._hook->_next = hook;
+		++_size;
+		return Iterator(*this, hook);
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::reference IntrusiveSList<value_type, Hook>::PopFront() {
+#ifdef USE_EXCEPTIONS
+		if (_front == nullptr) throw std::runtime_error("List is empty.");
+#endif // USE_EXCEPTIONS
+		IntrusiveSListHook* hook = _front;
+		_front = hook->_next;
+		if (_front == nullptr) _back = nullptr;
+		hook->_next = nullptr;
+		--_size;
+		return ElementOf(hook);
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	bool IntrusiveSList<value_type, Hook>::Remove(reference element) {
+		IntrusiveSListHook* hook = HookOf(element);
+		IntrusiveSListHook* previous = nullptr;
+		for (IntrusiveSListHook* current = _front; current != nullptr; previous = current, current = current->_next) {
+			if (current == hook) {
+				if (previous != nullptr) previous->_next = hook->_next;
+				else _front = hook->_next;
+				if (_back == hook) _back = previous;
+				hook->_next = nullptr;
+				--_size;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline void IntrusiveSList<value_type, Hook>::SpliceBack(IntrusiveSList& other) {
+		if (this == &other || other._front == nullptr) return;
+
+		if (_back != nullptr) _back->_next = other._front;
+		else _front = other._front;
+		_back = other._back;
+		_size += other._size;
+
+		other._front = nullptr;
+		other._back = nullptr;
+		other._size = 0;
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline void IntrusiveSList<value_type, Hook>::Clear() {
+		while (_front != nullptr) {
+			IntrusiveSListHook* next = _front->_next;
+			_front->_next = nullptr;
+			_front = next;
+		}
+		_back = nullptr;
+		_size = 0;
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::Iterator IntrusiveSList<value_type, Hook>::begin() {
+		return Iterator(*this, _front);
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::Iterator IntrusiveSList<value_type, Hook>::end() {
+		return Iterator(*this);
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::ConstIterator IntrusiveSList<value_type, Hook>::begin() const {
+		return ConstIterator(*this, _front);
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::ConstIterator IntrusiveSList<value_type, Hook>::end() const {
+		return ConstIterator(*this);
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::ConstIterator IntrusiveSList<value_type, Hook>::cbegin() const {
+		return ConstIterator(*this, _front);
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::ConstIterator IntrusiveSList<value_type, Hook>::cend() const {
+		return ConstIterator(*this);
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline IntrusiveSListHook* IntrusiveSList<value_type, Hook>::HookOf(reference element) {
+		return &(element.*Hook);
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::reference IntrusiveSList<value_type, Hook>::ElementOf(IntrusiveSListHook* hook) {
+		return const_cast<reference>(ElementOf(static_cast<const IntrusiveSListHook*>(hook)));
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::const_reference IntrusiveSList<value_type, Hook>::ElementOf(const IntrusiveSListHook* hook) {
+		//The offset of the hook inside an element is measured on a fake element address rather than on nullptr, and is a constant the compiler folds
+		const value_type* fakeElement = reinterpret_cast<const value_type*>(alignof(value_type) * 16);
+		const std::ptrdiff_t offset = reinterpret_cast<const std::byte*>(&(fakeElement->*Hook)) - reinterpret_cast<const std::byte*>(fakeElement);
+		return *reinterpret_cast<const value_type*>(reinterpret_cast<const std::byte*>(hook) - offset);
+	}
+#pragma endregion IntrusiveSList
+
+#pragma region Iterator
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline IntrusiveSList<value_type, Hook>::Iterator::Iterator(const IntrusiveSList& container, IntrusiveSListHook* hook) :
+		_hook{ hook }, _container{ &container }
+	{
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::reference IntrusiveSList<value_type, Hook>::Iterator::operator*() const {
+#ifdef USE_EXCEPTIONS
+		if (_hook == nullptr) throw std::runtime_error("Iterator's data is equal to end, cannot be dereferenced.");
+#endif // USE_EXCEPTIONS
+		return ElementOf(_hook);
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::Iterator& IntrusiveSList<value_type, Hook>::Iterator::operator++() {
+#ifdef USE_EXCEPTIONS
+		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
+#endif // USE_EXCEPTIONS
+		if (_hook != nullptr) _hook = _hook->_next;
+		return *this;
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::Iterator IntrusiveSList<value_type, Hook>::Iterator::operator++(int) {
+		Iterator it = *this;
+		operator++();
+		return it;
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline bool IntrusiveSList<value_type, Hook>::Iterator::operator==(const Iterator& rhs) const {
+		return _container == rhs._container && _hook == rhs._hook;
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline bool IntrusiveSList<value_type, Hook>::Iterator::operator!=(const Iterator& rhs) const {
+		return !operator==(rhs);
+	}
+#pragma endregion Iterator
+
+#pragma region ConstIterator
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline IntrusiveSList<value_type, Hook>::ConstIterator::ConstIterator(const Iterator& other) :
+		_hook{ other._hook }, _container{ other._container }
+	{
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline IntrusiveSList<value_type, Hook>::ConstIterator::ConstIterator(const IntrusiveSList& container, const IntrusiveSListHook* hook) :
+		_hook{ hook }, _container{ &container }
+	{
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::const_reference IntrusiveSList<value_type, Hook>::ConstIterator::operator*() const {
+#ifdef USE_EXCEPTIONS
+		if (_hook == nullptr) throw std::runtime_error("Iterator's data is equal to end, cannot be dereferenced.");
+#endif // USE_EXCEPTIONS
+		return ElementOf(_hook);
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::ConstIterator& IntrusiveSList<value_type, Hook>::ConstIterator::operator++() {
+#ifdef USE_EXCEPTIONS
+		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
+#endif // USE_EXCEPTIONS
+		if (_hook != nullptr) _hook = _hook->_next;
+		return *this;
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline typename IntrusiveSList<value_type, Hook>::ConstIterator IntrusiveSList<value_type, Hook>::ConstIterator::operator++(int) {
+		ConstIterator it = *this;
+		operator++();
+		return it;
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline bool IntrusiveSList<value_type, Hook>::ConstIterator::operator==(const ConstIterator& rhs) const {
+		return _container == rhs._container && _hook == rhs._hook;
+	}
+
+	template<typename value_type, IntrusiveSListHook value_type::* Hook>
+	inline bool IntrusiveSList<value_type, Hook>::ConstIterator::operator!=(const ConstIterator& rhs) const {
+		return !operator==(rhs);
+	}
+#pragma endregion ConstIterator
+}
@@ -46,11 +46,11 @@ namespace FIEAGameEngine
 		return toReturn;
 	}
 
-	Vector<std::shared_ptr<IJsonParseHelper>>& JsonParseCoordinator::GetHelpers() {
+	JsonParseCoordinator::HelperList& JsonParseCoordinator::GetHelpers() {
 		return _helpers;
 	}
 
-	const Vector<std::shared_ptr<IJsonParseHelper>>& JsonParseCoordinator::GetHelpers() const {
+	const JsonParseCoordinator::HelperList& JsonParseCoordinator::GetHelpers() const {
 		return _helpers;
 	}
 
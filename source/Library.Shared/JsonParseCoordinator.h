@@ -7,6 +7,7 @@
 #include <fstream>
 #include <stack>
 #include "Vector.h"
+#include "SmallVector.h"
 #include "RTTI.h"
 #include "IJsonParseHelper.h"
 
@@ -86,6 +87,11 @@ namespace FIEAGameEngine
 		RTTI_DECLARATIONS(JsonParseCoordinator, RTTI);
 
 	public:
+		/// <summary>
+		/// The list of helpers a JsonParseCoordinator owns. Coordinators rarely hold more than a handful of helpers, so they are kept inline.
+		/// </summary>
+		using HelperList = SmallVector<std::shared_ptr<IJsonParseHelper>, 4>;
+
 		/// <summary>
 		/// The default constructor for the JsonParseCoordinator has been deleted.
 		/// </summary>
@@ -131,12 +137,12 @@ namespace FIEAGameEngine
 		/// Get the list of helpers from this ParseCoordinator.
 		/// </summary>
 		/// <returns>A vector of shared_ptrs to helpers.</returns>
-		Vector<std::shared_ptr<IJsonParseHelper>>& GetHelpers();
+		HelperList& GetHelpers();
 		/// <summary>
 		/// Get the list of helpers from this ParseCoordinator.
 		/// </summary>
 		/// <returns>A const vector of shared_ptrs to helpers.</returns>
-		const Vector<std::shared_ptr<IJsonParseHelper>>& GetHelpers() const;
+		const HelperList& GetHelpers() const;
 		/// <summary>
 		/// Get the wrapper associated with this Parse Coordinator.
 		/// </summary>
@@ -208,7 +214,7 @@ namespace FIEAGameEngine
 		/// <summary>
 		/// The list of helpers for this Parse Coordinator.
 		/// </summary>
-		Vector<std::shared_ptr<IJsonParseHelper>> _helpers;
+		HelperList _helpers;
 		
 		/// <summary>
 		/// Initialize this parser and all its data members
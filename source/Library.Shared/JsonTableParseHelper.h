@@ -7,6 +7,7 @@
 #include "JsonParseCoordinator.h"
 #include "Factory.h"
 #include "Scope.h"
+#include "SmallVector.h"
 
 namespace FIEAGameEngine
 {
@@ -129,9 +130,10 @@ namespace FIEAGameEngine
 			/// </summary>
 			Datum::DatumTypes type;
 			/// <summary>
-			/// The data of this context frame, stored as references so it can be handled only later in the process
+			/// The data of this context frame, stored as references so it can be handled only later in the process.
+			/// Most frames hold a single value or a short array, so the first few references are kept inline in the frame.
 			/// </summary>
-			Vector<std::reference_wrapper<const Json::Value>> jsonData;
+			SmallVector<std::reference_wrapper<const Json::Value>, 4> jsonData;
 			/// <summary>
 			/// The root scope of this context frame
 			/// </summary>
@@ -186,9 +188,9 @@ namespace FIEAGameEngine
 		/// </summary>
 		const std::string valueKey{ "value" };
 		/// <summary>
-		/// The stack tracking which part of the deserialization process the helper is in.
+		/// The stack tracking which part of the deserialization process the helper is in. Its frames are pooled, since every nested key pushes and pops one.
 		/// </summary>
-		SList<ContextFrame> _stack;
+		SList<ContextFrame> _stack{ nullptr, NodeStorage::Pooled };
 
 		/// <summary>
 		/// A helper function that sets a datum's data after decoding it from the json value according to the datum's type.
@@ -0,0 +1,95 @@
+/// <summary>
+/// The definitions of the class MemoryResource, the heap resource, and the default resource.
+/// </summary>
+
+#include "pch.h"
+#include "MemoryResource.h"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace FIEAGameEngine {
+	namespace {
+		/// <summary>
+		/// The resource backed by malloc, realloc and free. Blocks aligned more strictly than malloc guarantees go through the aligned operator new instead, and are resized by copying.
+		/// </summary>
+		class HeapMemoryResource final : public MemoryResource {
+		private:
+			void* DoAllocate(std::size_t bytes, std::size_t alignment) override {
+				if (alignment > DefaultAlignment) return ::operator new(bytes, std::align_val_t(alignment), std::nothrow);
+				return malloc(bytes);
+			}
+
+			void DoDeallocate(void* block, std::size_t bytes, std::size_t alignment) override {
+				UNREFERENCED_LOCAL(bytes);
+				if (alignment > DefaultAlignment) ::operator delete(block, std::align_val_t(alignment));
+				else free(block);
+			}
+
+			void* DoReallocate(void* block, std::size_t oldBytes, std::size_t newBytes, std::size_t alignment) override {
+				if (alignment > DefaultAlignment) return MemoryResource::DoReallocate(block, oldBytes, newBytes, alignment);
+				return realloc(block, newBytes);
+			}
+		};
+
+		/// <summary>
+		/// Retrieve the single heap resource.
+		/// </summary>
+		/// <returns>A reference to the heap resource.</returns>
+		HeapMemoryResource& HeapInstance() noexcept {
+			static HeapMemoryResource heapResource;
+			return heapResource;
+		}
+
+		/// <summary>
+		/// The current default resource, or nullptr while it is the heap resource.
+		/// </summary>
+		std::atomic<MemoryResource*> defaultResource{ nullptr };
+	}
+
+	void* MemoryResource::Allocate(std::size_t bytes, std::size_t alignment) {
+		assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+		return DoAllocate(bytes, alignment);
+	}
+
+	void MemoryResource::Deallocate(void* block, std::size_t bytes, std::size_t alignment) {
+		if (block != nullptr) DoDeallocate(block, bytes, alignment);
+	}
+
+	void* MemoryResource::Reallocate(void* block, std::size_t oldBytes, std::size_t newBytes, std::size_t alignment) {
+		if (block == nullptr) return Allocate(newBytes, alignment);
+		return DoReallocate(block, oldBytes, newBytes, alignment);
+	}
+
+	bool MemoryResource::IsEqual(const MemoryResource& other) const noexcept {
+		return (this == &other) || DoIsEqual(other);
+	}
+
+	void* MemoryResource::DoReallocate(void* block, std::size_t oldBytes, std::size_t newBytes, std::size_t alignment) {
+		void* newBlock = DoAllocate(newBytes, alignment);
+		if (newBlock != nullptr) {
+			memcpy(newBlock, block, std::min(oldBytes, newBytes));
+			DoDeallocate(block, oldBytes, alignment);
+		}
+		return newBlock;
+	}
+
+	bool MemoryResource::DoIsEqual(const MemoryResource& other) const noexcept {
+		return (this == &other);
+	}
+
+	MemoryResource* HeapResource() noexcept {
+		return &HeapInstance();
+	}
+
+	MemoryResource* GetDefaultResource() noexcept {
+		MemoryResource* resource = defaultResource.load(std::memory_order_acquire);
+		return (resource != nullptr) ? resource : HeapResource();
+	}
+
+	MemoryResource* SetDefaultResource(MemoryResource* resource) noexcept {
+		MemoryResource* previous = defaultResource.exchange(resource, std::memory_order_acq_rel);
+		return (previous != nullptr) ? previous : HeapResource();
+	}
+}
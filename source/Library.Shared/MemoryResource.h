@@ -0,0 +1,116 @@
+/// <summary>
+/// The declaration of the abstract class MemoryResource, the interface engine containers allocate their storage through, and of the process wide default resource.
+/// </summary>
+
+#pragma once
+
+#include <cstddef>
+
+namespace FIEAGameEngine {
+	/// <summary>
+	/// An interface for a source of memory, modeled on std::pmr::memory_resource. Vector, SList, HashMap, Datum and Scope each hold a pointer to the MemoryResource
+	/// they allocate from, so a level, a frame or a parse job can give its containers an arena of their own (see MonotonicArena and PoolResource).
+	/// Containers take the default resource unless given one. Copy construction uses the default resource, as std::pmr does, so that a copy never outlives the arena it was copied from;
+	/// move construction keeps the source's resource, and assignment keeps the target's.
+	/// A MemoryResource must outlive every container allocating from it.
+	/// </summary>
+	class MemoryResource {
+	public:
+		/// <summary>
+		/// The alignment used when none is given, which suits any scalar type.
+		/// </summary>
+		static constexpr std::size_t DefaultAlignment = alignof(std::max_align_t);
+
+		/// <summary>
+		/// Default constructor for a MemoryResource.
+		/// </summary>
+		MemoryResource() = default;
+		MemoryResource(const MemoryResource&) = default;
+		MemoryResource(MemoryResource&&) noexcept = default;
+		MemoryResource& operator=(const MemoryResource&) = default;
+		MemoryResource& operator=(MemoryResource&&) noexcept = default;
+		/// <summary>
+		/// Virtual destructor for a MemoryResource.
+		/// </summary>
+		virtual ~MemoryResource() = default;
+
+		/// <summary>
+		/// Allocate a block of memory.
+		/// </summary>
+		/// <param name="bytes">The size of the block, in bytes.</param>
+		/// <param name="alignment">The alignment of the block, which must be a power of two.</param>
+		/// <returns>A pointer to the block, or nullptr if the memory could not be obtained.</returns>
+		[[nodiscard]] void* Allocate(std::size_t bytes, std::size_t alignment = DefaultAlignment);
+		/// <summary>
+		/// Return a block of memory obtained from Allocate or Reallocate on this resource, or on one that compares equal to it.
+		/// </summary>
+		/// <param name="block">The block to return. May be nullptr, in which case nothing happens.</param>
+		/// <param name="bytes">The size the block was allocated with, in bytes.</param>
+		/// <param name="alignment">The alignment the block was allocated with.</param>
+		void Deallocate(void* block, std::size_t bytes, std::size_t alignment = DefaultAlignment);
+		/// <summary>
+		/// Grow or shrink a block of memory, keeping its contents up to the smaller of the two sizes. The contents may be copied byte by byte,
+		/// so this is only suitable for blocks holding trivially relocatable objects (see IsTriviallyRelocatable).
+		/// </summary>
+		/// <param name="block">The block to resize. If nullptr, this behaves like Allocate.</param>
+		/// <param name="oldBytes">The size the block was allocated with, in bytes.</param>
+		/// <param name="newBytes">The new size of the block, in bytes.</param>
+		/// <param name="alignment">The alignment the block was allocated with.</param>
+		/// <returns>A pointer to the resized block, which may differ from the given one, or nullptr if the memory could not be obtained, in which case the given block is left untouched.</returns>
+		[[nodiscard]] void* Reallocate(void* block, std::size_t oldBytes, std::size_t newBytes, std::size_t alignment = DefaultAlignment);
+		/// <summary>
+		/// Determine whether memory allocated from this resource can be deallocated through the given one, and vice versa.
+		/// </summary>
+		/// <param name="other">The resource to compare against.</param>
+		/// <returns>A boolean indicating whether the two resources are interchangeable.</returns>
+		[[nodiscard]] bool IsEqual(const MemoryResource& other) const noexcept;
+
+	protected:
+		/// <summary>
+		/// Allocate a block of memory. Implemented by each resource.
+		/// </summary>
+		/// <param name="bytes">The size of the block, in bytes.</param>
+		/// <param name="alignment">The alignment of the block.</param>
+		/// <returns>A pointer to the block, or nullptr if the memory could not be obtained.</returns>
+		virtual void* DoAllocate(std::size_t bytes, std::size_t alignment) = 0;
+		/// <summary>
+		/// Return a block of memory. Implemented by each resource.
+		/// </summary>
+		/// <param name="block">The block to return, which is never nullptr.</param>
+		/// <param name="bytes">The size the block was allocated with, in bytes.</param>
+		/// <param name="alignment">The alignment the block was allocated with.</param>
+		virtual void DoDeallocate(void* block, std::size_t bytes, std::size_t alignment) = 0;
+		/// <summary>
+		/// Resize a block of memory. By default allocates a new block, copies the contents and deallocates the old one; resources that can resize in place override it.
+		/// </summary>
+		/// <param name="block">The block to resize, which is never nullptr.</param>
+		/// <param name="oldBytes">The size the block was allocated with, in bytes.</param>
+		/// <param name="newBytes">The new size of the block, in bytes.</param>
+		/// <param name="alignment">The alignment the block was allocated with.</param>
+		/// <returns>A pointer to the resized block, or nullptr if the memory could not be obtained.</returns>
+		virtual void* DoReallocate(void* block, std::size_t oldBytes, std::size_t newBytes, std::size_t alignment);
+		/// <summary>
+		/// Determine whether memory can be exchanged with the given resource. By default only a resource is equal to itself.
+		/// </summary>
+		/// <param name="other">The resource to compare against.</param>
+		/// <returns>A boolean indicating whether the two resources are interchangeable.</returns>
+		virtual bool DoIsEqual(const MemoryResource& other) const noexcept;
+	};
+
+	/// <summary>
+	/// Retrieve the resource backed by the C heap (malloc, realloc and free). It is the default resource unless SetDefaultResource is called, and resizes blocks with realloc.
+	/// </summary>
+	/// <returns>A pointer to the heap resource, which lives for the whole program.</returns>
+	[[nodiscard]] MemoryResource* HeapResource() noexcept;
+	/// <summary>
+	/// Retrieve the resource containers allocate from when they are not given one.
+	/// </summary>
+	/// <returns>A pointer to the current default resource.</returns>
+	[[nodiscard]] MemoryResource* GetDefaultResource() noexcept;
+	/// <summary>
+	/// Replace the resource containers allocate from when they are not given one. Containers already constructed keep the resource they were constructed with.
+	/// </summary>
+	/// <param name="resource">The new default resource, or nullptr to restore HeapResource.</param>
+	/// <returns>The previous default resource.</returns>
+	MemoryResource* SetDefaultResource(MemoryResource* resource) noexcept;
+}
@@ -0,0 +1,106 @@
+/// <summary>
+/// The definitions of the class MonotonicArena, a MemoryResource that hands out memory by bumping a pointer and frees it all at once.
+/// </summary>
+
+#include "pch.h"
+#include "MonotonicArena.h"
+#include <cstring>
+
+namespace FIEAGameEngine {
+	MonotonicArena::MonotonicArena(std::size_t initialChunkSize, MemoryResource* upstream) :
+		_upstream{ upstream != nullptr ? upstream : GetDefaultResource() }, _nextChunkSize{ std::max(initialChunkSize, sizeof(ChunkHeader)) },
+		_initialChunkSize{ _nextChunkSize }
+	{
+	}
+
+	MonotonicArena::MonotonicArena(void* buffer, std::size_t bufferSize, MemoryResource* upstream) :
+		_upstream{ upstream != nullptr ? upstream : GetDefaultResource() }, _initialBuffer{ static_cast<std::byte*>(buffer) }, _initialBufferSize{ bufferSize },
+		_current{ _initialBuffer }, _end{ _initialBuffer + bufferSize }, _nextChunkSize{ std::max(bufferSize, sizeof(ChunkHeader)) }, _initialChunkSize{ _nextChunkSize }
+	{
+	}
+
+	MonotonicArena::~MonotonicArena() {
+		Release();
+	}
+
+	void MonotonicArena::Release() {
+		while (_chunks != nullptr) {
+			ChunkHeader* previous = _chunks->Previous;
+			_upstream->Deallocate(_chunks, _chunks->Size, DefaultAlignment);
+			_chunks = previous;
+		}
+		_current = _initialBuffer;
+		_end = _initialBuffer + _initialBufferSize;
+		_lastBlock = nullptr;
+		_nextChunkSize = _initialChunkSize;
+		_bytesUsed = _bytesReserved = _chunkCount = 0;
+	}
+
+	MemoryResource* MonotonicArena::Upstream() const {
+		return _upstream;
+	}
+
+	std::size_t MonotonicArena::BytesUsed() const {
+		return _bytesUsed;
+	}
+
+	std::size_t MonotonicArena::BytesReserved() const {
+		return _bytesReserved;
+	}
+
+	std::size_t MonotonicArena::ChunkCount() const {
+		return _chunkCount;
+	}
+
+	void* MonotonicArena::DoAllocate(std::size_t bytes, std::size_t alignment) {
+		std::size_t padding = (_current != nullptr) ? (alignment - reinterpret_cast<std::uintptr_t>(_current) % alignment) % alignment : 0;
+		if (_current == nullptr || static_cast<std::size_t>(_end - _current) < padding + bytes) {
+			if (!AddChunk(bytes, alignment)) return nullptr;
+			padding = (alignment - reinterpret_cast<std::uintptr_t>(_current) % alignment) % alignment;
+		}
+
+		_lastBlock = _current + padding;
+		_current = _lastBlock + bytes;
+		_bytesUsed += padding + bytes;
+		return _lastBlock;
+	}
+
+	void MonotonicArena::DoDeallocate(void* block, std::size_t bytes, std::size_t) {
+		if (block == _lastBlock && _lastBlock + bytes == _current) {
+			_current = _lastBlock;
+			_bytesUsed -= bytes;
+			_lastBlock = nullptr;
+		}
+	}
+
+	void* MonotonicArena::DoReallocate(void* block, std::size_t oldBytes, std::size_t newBytes, std::size_t alignment) {
+		if (block == _lastBlock && _lastBlock + oldBytes == _current && static_cast<std::size_t>(_end - _lastBlock) >= newBytes) {
+			_current = _lastBlock + newBytes;
+			_bytesUsed = _bytesUsed - oldBytes + newBytes;
+			return block;
+		}
+
+		void* newBlock = DoAllocate(newBytes, alignment);
+		if (newBlock != nullptr) {
+			memcpy(newBlock, block, std::min(oldBytes, newBytes));
+		}
+		return newBlock;
+	}
+
+	bool MonotonicArena::AddChunk(std::size_t bytes, std::size_t alignment) {
+		std::size_t usableSize = std::max(_nextChunkSize, bytes + alignment);
+		std::size_t chunkSize = sizeof(ChunkHeader) + usableSize;
+		void* memory = _upstream->Allocate(chunkSize, DefaultAlignment);
+		if (memory == nullptr) return false;
+
+		ChunkHeader* chunk = new (memory) ChunkHeader{ _chunks, chunkSize };
+		_chunks = chunk;
+		_current = reinterpret_cast<std::byte*>(chunk + 1);
+		_end = reinterpret_cast<std::byte*>(chunk) + chunkSize;
+		_lastBlock = nullptr;
+		_bytesReserved += chunkSize;
+		++_chunkCount;
+		_nextChunkSize = usableSize * 2;
+		return true;
+	}
+}
@@ -0,0 +1,143 @@
+/// <summary>
+/// The declaration of the class MonotonicArena, a MemoryResource that hands out memory by bumping a pointer and frees it all at once.
+/// </summary>
+
+#pragma once
+
+#include <cstddef>
+#include "MemoryResource.h"
+
+namespace FIEAGameEngine {
+	/// <summary>
+	/// A MemoryResource that carves blocks out of large chunks obtained from an upstream resource, and only gives memory back when it is released or destroyed.
+	/// Allocation is a pointer bump, Deallocate does nothing (except roll back the most recent block), and Release returns every chunk in time proportional to the number of chunks,
+	/// which makes it suited to memory that lives and dies together: a level, a frame, or a Scope tree loaded by a JsonParseCoordinator.
+	/// Each chunk is twice the size of the one before it. A MonotonicArena is not thread safe.
+	/// </summary>
+	class MonotonicArena final : public MemoryResource {
+	public:
+		/// <summary>
+		/// Construct a MonotonicArena that obtains its first chunk from the upstream resource on its first allocation.
+		/// </summary>
+		/// <param name="initialChunkSize">The usable size of the first chunk, in bytes.</param>
+		/// <param name="upstream">The resource chunks are obtained from.</param>
+		explicit MonotonicArena(std::size_t initialChunkSize = std::size_t(4096), MemoryResource* upstream = GetDefaultResource());
+		/// <summary>
+		/// Construct a MonotonicArena that hands out the given buffer before obtaining any chunks from the upstream resource.
+		/// </summary>
+		/// <param name="buffer">A buffer the arena may use. It is never freed by the arena, and must outlive it.</param>
+		/// <param name="bufferSize">The size of the buffer, in bytes.</param>
+		/// <param name="upstream">The resource further chunks are obtained from.</param>
+		MonotonicArena(void* buffer, std::size_t bufferSize, MemoryResource* upstream = GetDefaultResource());
+		MonotonicArena(const MonotonicArena&) = delete;
+		MonotonicArena(MonotonicArena&&) noexcept = delete;
+		MonotonicArena& operator=(const MonotonicArena&) = delete;
+		MonotonicArena& operator=(MonotonicArena&&) noexcept = delete;
+		/// <summary>
+		/// The destructor for a MonotonicArena returns every chunk to the upstream resource.
+		/// </summary>
+		~MonotonicArena();
+
+		/// <summary>
+		/// Return every chunk to the upstream resource and start over from the initial buffer, if one was given. Every block handed out so far becomes invalid, and no destructors are run.
+		/// </summary>
+		void Release();
+
+		/// <summary>
+		/// Retrieve the resource chunks are obtained from.
+		/// </summary>
+		/// <returns>A pointer to the upstream resource.</returns>
+		[[nodiscard]] MemoryResource* Upstream() const;
+		/// <summary>
+		/// Retrieve the number of bytes handed out since construction or the last Release, including alignment padding.
+		/// </summary>
+		/// <returns>The number of bytes in use.</returns>
+		[[nodiscard]] std::size_t BytesUsed() const;
+		/// <summary>
+		/// Retrieve the number of bytes currently held from the upstream resource.
+		/// </summary>
+		/// <returns>The number of bytes held in chunks.</returns>
+		[[nodiscard]] std::size_t BytesReserved() const;
+		/// <summary>
+		/// Retrieve the number of chunks currently held from the upstream resource.
+		/// </summary>
+		/// <returns>The number of chunks.</returns>
+		[[nodiscard]] std::size_t ChunkCount() const;
+
+	private:
+		/// <summary>
+		/// The header at the start of every chunk, linking it to the chunk obtained before it.
+		/// </summary>
+		struct ChunkHeader final {
+			/// <summary>
+			/// The chunk obtained before this one.
+			/// </summary>
+			ChunkHeader* Previous;
+			/// <summary>
+			/// The size of this chunk, including this header, in bytes.
+			/// </summary>
+			std::size_t Size;
+		};
+
+		void* DoAllocate(std::size_t bytes, std::size_t alignment) override;
+		void DoDeallocate(void* block, std::size_t bytes, std::size_t alignment) override;
+		void* DoReallocate(void* block, std::size_t oldBytes, std::size_t newBytes, std::size_t alignment) override;
+
+		/// <summary>
+		/// Obtain a chunk from the upstream resource large enough for a block of the given size and alignment, and start handing out memory from it.
+		/// </summary>
+		/// <param name="bytes">The size of the block that did not fit, in bytes.</param>
+		/// <param name="alignment">The alignment of the block that did not fit.</param>
+		/// <returns>A boolean indicating whether the chunk could be obtained.</returns>
+		bool AddChunk(std::size_t bytes, std::size_t alignment);
+
+		/// <summary>
+		/// The resource chunks are obtained from.
+		/// </summary>
+		MemoryResource* _upstream;
+		/// <summary>
+		/// The buffer given at construction, if any.
+		/// </summary>
+		std::byte* _initialBuffer{ nullptr };
+		/// <summary>
+		/// The size of the buffer given at construction, in bytes.
+		/// </summary>
+		std::size_t _initialBufferSize{ 0 };
+		/// <summary>
+		/// The most recently obtained chunk.
+		/// </summary>
+		ChunkHeader* _chunks{ nullptr };
+		/// <summary>
+		/// The next byte to hand out.
+		/// </summary>
+		std::byte* _current{ nullptr };
+		/// <summary>
+		/// One past the last byte of the memory currently being handed out.
+		/// </summary>
+		std::byte* _end{ nullptr };
+		/// <summary>
+		/// The most recently handed out block, which may still be grown in place or rolled back.
+		/// </summary>
+		std::byte* _lastBlock{ nullptr };
+		/// <summary>
+		/// The usable size of the next chunk to obtain, in bytes.
+		/// </summary>
+		std::size_t _nextChunkSize;
+		/// <summary>
+		/// The usable size of the first chunk, restored by Release.
+		/// </summary>
+		std::size_t _initialChunkSize;
+		/// <summary>
+		/// The number of bytes handed out, including alignment padding.
+		/// </summary>
+		std::size_t _bytesUsed{ 0 };
+		/// <summary>
+		/// The number of bytes held from the upstream resource.
+		/// </summary>
+		std::size_t _bytesReserved{ 0 };
+		/// <summary>
+		/// The number of chunks held from the upstream resource.
+		/// </summary>
+		std::size_t _chunkCount{ 0 };
+	};
+}
@@ -0,0 +1,159 @@
+/// <summary>
+/// The declaration of the templated class MpscQueue, a lock-free queue any number of threads can push to and one thread pops from.
+/// </summary>
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <atomic>
+#include <new>
+#include <optional>
+#include <utility>
+#include "MemoryResource.h"
+
+namespace FIEAGameEngine {
+	/// <summary>
+	/// A templated first-in first-out queue that any number of producer threads push to without locking, and a single consumer thread pops from.
+	/// Every element lives in its own node, linked like an SList, with a stub node at the head so producers and the consumer never touch the same pointer:
+	/// a push is one atomic exchange on the tail and a release store into the node before it, and a pop only reads the node after the head.
+	/// Elements pushed by one producer are popped in the order they were pushed. A producer interrupted between its exchange and its store hides
+	/// the elements behind it until it finishes, so an empty pop only means nothing could be popped yet, not that nothing was pushed.
+	/// Nodes are obtained from the given MemoryResource on the producer threads, so it must be safe to allocate from several threads at once; the heap resource is.
+	/// </summary>
+	/// <typeparam name="T">The type of the elements</typeparam>
+	template <typename T>
+	class MpscQueue final {
+	public:
+		using size_type = std::size_t;
+		using value_type = T;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using rvalue_reference = value_type&&;
+
+		/// <summary>
+		/// Construct an empty MpscQueue, obtaining its stub node from the given resource.
+		/// </summary>
+		/// <param name="resource">The resource nodes are obtained from, which must be safe to allocate from several threads at once.</param>
+		explicit MpscQueue(MemoryResource* resource = GetDefaultResource());
+		MpscQueue(const MpscQueue&) = delete;
+		MpscQueue(MpscQueue&&) noexcept = delete;
+		MpscQueue& operator=(const MpscQueue&) = delete;
+		MpscQueue& operator=(MpscQueue&&) noexcept = delete;
+		/// <summary>
+		/// The destructor for an MpscQueue destroys every element still queued. No thread may be pushing to it.
+		/// </summary>
+		~MpscQueue();
+
+		/// <summary>
+		/// Push a copy of an element onto the back of the queue. Safe to call from any thread.
+		/// </summary>
+		/// <param name="value">The element to copy</param>
+		void Push(const_reference value);
+		/// <summary>
+		/// Push an element onto the back of the queue by moving it. Safe to call from any thread.
+		/// </summary>
+		/// <param name="value">The element to move</param>
+		void Push(rvalue_reference value);
+		/// <summary>
+		/// Construct an element in place at the back of the queue. Safe to call from any thread.
+		/// </summary>
+		/// <param name="...args">The arguments to construct the element from</param>
+		template <typename... Args>
+		void Emplace(Args&&... args);
+
+		/// <summary>
+		/// Pop the element at the front of the queue. Only the consumer thread may call this.
+		/// </summary>
+		/// <param name="value">The element to move the popped element into</param>
+		/// <returns>A boolean indicating whether an element was popped</returns>
+		[[nodiscard]] bool TryPop(reference value);
+		/// <summary>
+		/// Pop every element that can be popped, in order, handing each to the given functor. Only the consumer thread may call this.
+		/// Elements pushed while draining may or may not be handed over.
+		/// </summary>
+		/// <param name="consume">A functor taking an rvalue reference to each popped element</param>
+		/// <returns>The number of elements popped</returns>
+		template <typename TFunctor>
+		size_type Drain(TFunctor&& consume);
+		/// <summary>
+		/// Determine whether the queue has no element that can be popped. Only meaningful on the consumer thread, since producers may push at any time.
+		/// </summary>
+		/// <returns>A boolean indicating whether nothing can be popped</returns>
+		[[nodiscard]] bool IsEmpty() const;
+		/// <summary>
+		/// Exchange the elements and resources of two queues. Not thread safe: no thread may be pushing to or popping from either queue.
+		/// </summary>
+		/// <param name="other">The queue to exchange with</param>
+		void Swap(MpscQueue& other) noexcept;
+		/// <summary>
+		/// Retrieve the resource nodes are obtained from.
+		/// </summary>
+		/// <returns>A pointer to the MemoryResource</returns>
+		[[nodiscard]] MemoryResource* Resource() const;
+
+	private:
+		/// <summary>
+		/// The size of a cache line, which the producer and consumer ends of the queue are kept apart by.
+		/// </summary>
+		static constexpr size_type CacheLineSize = 64;
+
+		/// <summary>
+		/// A node in the queue, holding an element unless it is the stub at the head.
+		/// </summary>
+		struct Node final {
+			/// <summary>
+			/// Construct a stub node, holding no element.
+			/// </summary>
+			Node() = default;
+			/// <summary>
+			/// Construct a node holding an element constructed from the given arguments.
+			/// </summary>
+			/// <param name="...args">The arguments to construct the element from</param>
+			template <typename... Args>
+			explicit Node(std::in_place_t, Args&&... args);
+
+			/// <summary>
+			/// The node pushed after this one, published by the producer that pushed it.
+			/// </summary>
+			std::atomic<Node*> Next{ nullptr };
+			/// <summary>
+			/// The element this node holds, empty once popped.
+			/// </summary>
+			std::optional<value_type> Value;
+		};
+
+		/// <summary>
+		/// Obtain and construct a node from the resource.
+		/// </summary>
+		/// <param name="...args">The arguments to construct the node from</param>
+		/// <returns>A pointer to the new node</returns>
+		template <typename... Args>
+		[[nodiscard]] Node* CreateNode(Args&&... args);
+		/// <summary>
+		/// Destroy a node and return it to the resource.
+		/// </summary>
+		/// <param name="node">The node to destroy</param>
+		void DestroyNode(Node* node);
+		/// <summary>
+		/// Link a node in at the back of the queue.
+		/// </summary>
+		/// <param name="node">The node to link, whose Next is nullptr</param>
+		void LinkNode(Node* node);
+
+		/// <summary>
+		/// The node pushed last, exchanged by every producer.
+		/// </summary>
+		alignas(CacheLineSize) std::atomic<Node*> _tail{ nullptr };
+		/// <summary>
+		/// The stub node, whose Next is the front of the queue. Owned by the consumer.
+		/// </summary>
+		alignas(CacheLineSize) Node* _head{ nullptr };
+		/// <summary>
+		/// The resource nodes are obtained from.
+		/// </summary>
+		MemoryResource* _resource;
+	};
+}
+
+#include "MpscQueue.inl"
@@ -0,0 +1,112 @@
+/// <summary>
+/// The fully specified implementation of the templated class MpscQueue.
+/// </summary>
+
+#include "MpscQueue.h"
+
+namespace FIEAGameEngine {
+	template<typename value_type>
+	inline MpscQueue<value_type>::MpscQueue(MemoryResource* resource) :
+		_resource{ resource }
+	{
+		_head = CreateNode();
+		_tail.store(_head, std::memory_order_relaxed);
+	}
+
+	template<typename value_type>
+	inline MpscQueue<value_type>::~MpscQueue() {
+		Drain([](rvalue_reference) {});
+		DestroyNode(_head);
+	}
+
+	template<typename value_type>
+	inline void MpscQueue<value_type>::Push(const_reference value) {
+		LinkNode(CreateNode(std::in_place, value));
+	}
+
+	template<typename value_type>
+	inline void MpscQueue<value_type>::Push(rvalue_reference value) {
+		LinkNode(CreateNode(std::in_place, std::move(value)));
+	}
+
+	template<typename value_type>
+	template<typename... Args>
+	inline void MpscQueue<value_type>::Emplace(Args&&... args) {
+		LinkNode(CreateNode(std::in_place, std::forward<Args>(args)...));
+	}
+
+	template<typename value_type>
+	inline bool MpscQueue<value_type>::TryPop(reference value) {
+		Node* next = _head->Next.load(std::memory_order_acquire);
+		if (next == nullptr) return false;
+
+		Node* stub = _head;
+		_head = next;
+		value = std::move(*next->Value);
+		next->Value.reset();
+		DestroyNode(stub);
+		return true;
+	}
+
+	template<typename value_type>
+	template<typename TFunctor>
+	inline typename MpscQueue<value_type>::size_type MpscQueue<value_type>::Drain(TFunctor&& consume) {
+		size_type popped = 0;
+		for (Node* next = _head->Next.load(std::memory_order_acquire); next != nullptr; next = _head->Next.load(std::memory_order_acquire)) {
+			//The popped node becomes the new stub, so the element is consumed in place and the old stub is the node freed
+			Node* stub = _head;
+			_head = next;
+			consume(std::move(*next->Value));
+			next->Value.reset();
+			DestroyNode(stub);
+			++popped;
+		}
+		return popped;
+	}
+
+	template<typename value_type>
+	inline bool MpscQueue<value_type>::IsEmpty() const {
+		return _head->Next.load(std::memory_order_acquire) == nullptr;
+	}
+
+	template<typename value_type>
+	inline void MpscQueue<value_type>::Swap(MpscQueue& other) noexcept {
+		Node* tail = _tail.load(std::memory_order_relaxed);
+		_tail.store(other._tail.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		other._tail.store(tail, std::memory_order_relaxed);
+		std::swap(_head, other._head);
+		std::swap(_resource, other._resource);
+	}
+
+	template<typename value_type>
+	inline MemoryResource* MpscQueue<value_type>::Resource() const {
+		return _resource;
+	}
+
+	template<typename value_type>
+	template<typename... Args>
+	inline typename MpscQueue<value_type>::Node* MpscQueue<value_type>::CreateNode(Args&&... args) {
+		void* memory = _resource->Allocate(sizeof(Node), alignof(Node));
+		assert(memory != nullptr);
+		return new (memory) Node(std::forward<Args>(args)...);
+	}
+
+	template<typename value_type>
+	inline void MpscQueue<value_type>::DestroyNode(Node* node) {
+		node->~Node();
+		_resource->Deallocate(node, sizeof(Node), alignof(Node));
+	}
+
+	template<typename value_type>
+	inline void MpscQueue<value_type>::LinkNode(Node* node) {
+		Node* previous = _tail.exchange(node, std::memory_order_acq_rel);
+		previous->Next.store(node, std::memory_order_release);
+	}
+
+	template<typename value_type>
+	template<typename... Args>
+	inline MpscQueue<value_type>::Node::Node(std::in_place_t, Args&&... args) :
+		Value{ std::in_place, std::forward<Args>(args)... }
+	{
+	}
+}
@@ -0,0 +1,156 @@
+/// <summary>
+/// The definitions of the classes NodeSlabs and NodePool, which recycle equally sized blocks carved out of slabs.
+/// </summary>
+
+#include "pch.h"
+#include "NodePool.h"
+
+namespace FIEAGameEngine {
+#pragma region NodeSlabs
+	NodeSlabs::NodeSlabs(NodeSlabs&& rhs) noexcept :
+		_freeList{ rhs._freeList }, _slabs{ rhs._slabs }
+	{
+		rhs._freeList = nullptr;
+		rhs._slabs = nullptr;
+	}
+
+	NodeSlabs& NodeSlabs::operator=(NodeSlabs&& rhs) noexcept {
+		if (this != &rhs) {
+			assert(_slabs == nullptr);
+			_freeList = rhs._freeList;
+			_slabs = rhs._slabs;
+			rhs._freeList = nullptr;
+			rhs._slabs = nullptr;
+		}
+		return *this;
+	}
+
+	NodeSlabs::~NodeSlabs() {
+		assert(_slabs == nullptr);
+	}
+
+	void NodeSlabs::Release(MemoryResource& upstream) {
+		while (_slabs != nullptr) {
+			SlabHeader* previous = _slabs->Previous;
+			upstream.Deallocate(_slabs, _slabs->Size, _slabs->Alignment);
+			_slabs = previous;
+		}
+		_freeList = nullptr;
+	}
+
+	std::size_t NodeSlabs::SlabCount() const {
+		std::size_t count = 0;
+		for (const SlabHeader* slab = _slabs; slab != nullptr; slab = slab->Previous) {
+			++count;
+		}
+		return count;
+	}
+
+	std::size_t NodeSlabs::BytesReserved() const {
+		std::size_t bytes = 0;
+		for (const SlabHeader* slab = _slabs; slab != nullptr; slab = slab->Previous) {
+			bytes += slab->Size;
+		}
+		return bytes;
+	}
+
+	bool NodeSlabs::AddSlab(std::size_t blockSize, std::size_t blockAlignment, MemoryResource& upstream) {
+		const std::size_t alignment = std::max({ blockAlignment, alignof(FreeBlock), alignof(SlabHeader) });
+		const std::size_t stride = (std::max(blockSize, sizeof(FreeBlock)) + alignment - 1) / alignment * alignment;
+		const std::size_t headerSize = (sizeof(SlabHeader) + alignment - 1) / alignment * alignment;
+		const std::size_t blockCount = (_slabs == nullptr) ? FirstSlabBlocks : std::min(_slabs->BlockCount * 2, MaxSlabBlocks);
+		const std::size_t slabSize = headerSize + blockCount * stride;
+
+		void* memory = upstream.Allocate(slabSize, alignment);
+		if (memory == nullptr) return false;
+
+		_slabs = new (memory) SlabHeader{ _slabs, slabSize, alignment, blockCount };
+
+		std::byte* blocks = static_cast<std::byte*>(memory) + headerSize;
+		for (std::size_t i = blockCount; i > 0; --i) {
+			_freeList = new (blocks + (i - 1) * stride) FreeBlock{ _freeList };
+		}
+		return true;
+	}
+#pragma endregion NodeSlabs
+
+#pragma region NodePool
+	NodePool::NodePool(std::size_t blockSize, std::size_t blockAlignment, MemoryResource* upstream) :
+		_upstream{ upstream != nullptr ? upstream : GetDefaultResource() }, _blockAlignment{ std::max(blockAlignment, std::size_t(1)) },
+		_blockSize{ (std::max(blockSize, std::size_t(1)) + _blockAlignment - 1) / _blockAlignment * _blockAlignment }
+	{
+	}
+
+	NodePool::~NodePool() {
+		Release();
+	}
+
+	NodePool::Pointer NodePool::Create(std::size_t blockSize, std::size_t blockAlignment, MemoryResource* upstream) {
+		if (upstream == nullptr) upstream = GetDefaultResource();
+		void* memory = upstream->Allocate(sizeof(NodePool), alignof(NodePool));
+		assert(memory != nullptr);
+		return Pointer(new (memory) NodePool(blockSize, blockAlignment, upstream));
+	}
+
+	void NodePool::Deleter::operator()(NodePool* pool) const {
+		MemoryResource* upstream = pool->_upstream;
+		pool->~NodePool();
+		upstream->Deallocate(pool, sizeof(NodePool), alignof(NodePool));
+	}
+
+	void NodePool::Release() {
+		_slabs.Release(*_upstream);
+		_blocksInUse = 0;
+	}
+
+	MemoryResource* NodePool::Upstream() const {
+		return _upstream;
+	}
+
+	std::size_t NodePool::BlockSize() const {
+		return _blockSize;
+	}
+
+	std::size_t NodePool::BlocksInUse() const {
+		return _blocksInUse;
+	}
+
+	std::size_t NodePool::SlabCount() const {
+		return _slabs.SlabCount();
+	}
+
+	std::size_t NodePool::BytesReserved() const {
+		return _slabs.BytesReserved();
+	}
+
+	void* NodePool::DoAllocate(std::size_t bytes, std::size_t alignment) {
+		if (!IsPooled(bytes, alignment)) return _upstream->Allocate(bytes, alignment);
+
+		void* block = _slabs.Acquire(_blockSize, _blockAlignment, *_upstream);
+		if (block != nullptr) ++_blocksInUse;
+		return block;
+	}
+
+	void NodePool::DoDeallocate(void* block, std::size_t bytes, std::size_t alignment) {
+		if (!IsPooled(bytes, alignment)) {
+			_upstream->Deallocate(block, bytes, alignment);
+			return;
+		}
+
+		_slabs.Recycle(block);
+		--_blocksInUse;
+	}
+
+	void* NodePool::DoReallocate(void* block, std::size_t oldBytes, std::size_t newBytes, std::size_t alignment) {
+		const bool oldPooled = IsPooled(oldBytes, alignment);
+		const bool newPooled = IsPooled(newBytes, alignment);
+		if (oldPooled && newPooled) return block;
+		if (!oldPooled && !newPooled) return _upstream->Reallocate(block, oldBytes, newBytes, alignment);
+		return MemoryResource::DoReallocate(block, oldBytes, newBytes, alignment);
+	}
+
+	bool NodePool::IsPooled(std::size_t bytes, std::size_t alignment) const {
+		return bytes <= _blockSize && alignment <= _blockAlignment;
+	}
+#pragma endregion NodePool
+}
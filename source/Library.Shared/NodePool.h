@@ -0,0 +1,247 @@
+/// <summary>
+/// The declarations of the class NodeSlabs, a free list of equally sized blocks carved out of slabs, and of the class NodePool, a MemoryResource built on it.
+/// </summary>
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include "MemoryResource.h"
+
+namespace FIEAGameEngine {
+	/// <summary>
+	/// A chain of slabs of equally sized blocks, with an intrusive free list threaded through the blocks not in use. The first slab holds FirstSlabBlocks blocks
+	/// and each further slab twice as many as the one before it, up to MaxSlabBlocks, so blocks handed out one after another sit next to each other in memory.
+	/// Blocks are recycled onto the free list rather than returned, and Release gives every slab back at once.
+	/// NodeSlabs does not remember the upstream resource or block size, which the owner passes in; SList embeds one so each list pools its own nodes, and NodePool wraps one as a MemoryResource.
+	/// </summary>
+	class NodeSlabs final {
+	public:
+		/// <summary>
+		/// The number of blocks in the first slab.
+		/// </summary>
+		static constexpr std::size_t FirstSlabBlocks = 4;
+		/// <summary>
+		/// The largest number of blocks in a single slab.
+		/// </summary>
+		static constexpr std::size_t MaxSlabBlocks = 256;
+
+		/// <summary>
+		/// Default constructor for NodeSlabs. No slabs are obtained until the first block is acquired.
+		/// </summary>
+		NodeSlabs() = default;
+		NodeSlabs(const NodeSlabs&) = delete;
+		/// <summary>
+		/// The move constructor for NodeSlabs takes over every slab of the given NodeSlabs, leaving it empty.
+		/// </summary>
+		/// <param name="rhs">The NodeSlabs to move slabs from</param>
+		NodeSlabs(NodeSlabs&& rhs) noexcept;
+		NodeSlabs& operator=(const NodeSlabs&) = delete;
+		/// <summary>
+		/// The move assignment operator for NodeSlabs takes over every slab of the given NodeSlabs, leaving it empty. These NodeSlabs must have been released beforehand.
+		/// </summary>
+		/// <param name="rhs">The NodeSlabs to move slabs from</param>
+		/// <returns>A reference to the updated NodeSlabs</returns>
+		NodeSlabs& operator=(NodeSlabs&& rhs) noexcept;
+		/// <summary>
+		/// The destructor for NodeSlabs. Every slab must have been released beforehand, since the upstream resource is not known here.
+		/// </summary>
+		~NodeSlabs();
+
+		/// <summary>
+		/// Take a block off the free list, obtaining a new slab from the upstream resource if the free list is empty.
+		/// </summary>
+		/// <param name="blockSize">The size of every block, in bytes. Must be the same for every call until the next Release.</param>
+		/// <param name="blockAlignment">The alignment of every block. Must be the same for every call until the next Release.</param>
+		/// <param name="upstream">The resource slabs are obtained from.</param>
+		/// <returns>A pointer to an uninitialized block, or nullptr if a slab could not be obtained.</returns>
+		[[nodiscard]] void* Acquire(std::size_t blockSize, std::size_t blockAlignment, MemoryResource& upstream);
+		/// <summary>
+		/// Put a block back onto the free list. Its memory stays in its slab until the next Release.
+		/// </summary>
+		/// <param name="block">A block acquired from these NodeSlabs, with its contents already destroyed.</param>
+		void Recycle(void* block);
+		/// <summary>
+		/// Return every slab to the upstream resource. Every block acquired so far becomes invalid, and no destructors are run.
+		/// </summary>
+		/// <param name="upstream">The resource the slabs were obtained from.</param>
+		void Release(MemoryResource& upstream);
+
+		/// <summary>
+		/// Retrieve the number of slabs currently held.
+		/// </summary>
+		/// <returns>The number of slabs.</returns>
+		[[nodiscard]] std::size_t SlabCount() const;
+		/// <summary>
+		/// Retrieve the number of bytes currently held in slabs, including their headers.
+		/// </summary>
+		/// <returns>The number of bytes held in slabs.</returns>
+		[[nodiscard]] std::size_t BytesReserved() const;
+
+	private:
+		/// <summary>
+		/// A free block, linked to the next free block.
+		/// </summary>
+		struct FreeBlock final {
+			/// <summary>
+			/// The next free block.
+			/// </summary>
+			FreeBlock* Next;
+		};
+
+		/// <summary>
+		/// The header at the start of every slab, linking it to the slab obtained before it.
+		/// </summary>
+		struct SlabHeader final {
+			/// <summary>
+			/// The slab obtained before this one.
+			/// </summary>
+			SlabHeader* Previous;
+			/// <summary>
+			/// The size of this slab, including this header, in bytes.
+			/// </summary>
+			std::size_t Size;
+			/// <summary>
+			/// The alignment this slab was obtained with.
+			/// </summary>
+			std::size_t Alignment;
+			/// <summary>
+			/// The number of blocks in this slab.
+			/// </summary>
+			std::size_t BlockCount;
+		};
+
+		/// <summary>
+		/// Obtain a slab from the upstream resource and thread its blocks onto the free list in address order.
+		/// </summary>
+		/// <param name="blockSize">The size of every block, in bytes.</param>
+		/// <param name="blockAlignment">The alignment of every block.</param>
+		/// <param name="upstream">The resource to obtain the slab from.</param>
+		/// <returns>A boolean indicating whether the slab could be obtained.</returns>
+		bool AddSlab(std::size_t blockSize, std::size_t blockAlignment, MemoryResource& upstream);
+
+		/// <summary>
+		/// The first free block.
+		/// </summary>
+		FreeBlock* _freeList{ nullptr };
+		/// <summary>
+		/// The most recently obtained slab.
+		/// </summary>
+		SlabHeader* _slabs{ nullptr };
+	};
+
+	/// <summary>
+	/// A MemoryResource that serves blocks of one fixed size out of NodeSlabs, so every block fits its node exactly and nodes allocated together sit next to each other.
+	/// Meant to be shared by node based containers that relink nodes between each other, like the chains of a HashMap. Blocks that are larger or more strictly aligned
+	/// than the pool's block go straight to the upstream resource. Release returns every slab at once. A NodePool is not thread safe.
+	/// </summary>
+	class NodePool final : public MemoryResource {
+	public:
+		/// <summary>
+		/// Destroys a NodePool made by Create and returns its storage to the NodePool's upstream resource.
+		/// </summary>
+		struct Deleter final {
+			/// <summary>
+			/// Destroy the given NodePool and deallocate it from its upstream resource.
+			/// </summary>
+			/// <param name="pool">The NodePool to destroy.</param>
+			void operator()(NodePool* pool) const;
+		};
+		/// <summary>
+		/// An owning pointer to a NodePool made by Create.
+		/// </summary>
+		using Pointer = std::unique_ptr<NodePool, Deleter>;
+
+		/// <summary>
+		/// Construct a NodePool in storage obtained from its own upstream resource, so a container built on an arena does not touch the global heap for its pool.
+		/// </summary>
+		/// <param name="blockSize">The size of the blocks to pool, in bytes.</param>
+		/// <param name="blockAlignment">The alignment of the blocks to pool.</param>
+		/// <param name="upstream">The resource the NodePool itself, its slabs, and other blocks are obtained from. Null means the default resource.</param>
+		/// <returns>An owning pointer to the new NodePool.</returns>
+		[[nodiscard]] static Pointer Create(std::size_t blockSize, std::size_t blockAlignment = DefaultAlignment, MemoryResource* upstream = GetDefaultResource());
+
+		/// <summary>
+		/// Construct a NodePool. No slabs are obtained until the first allocation.
+		/// </summary>
+		/// <param name="blockSize">The size of the blocks to pool, in bytes.</param>
+		/// <param name="blockAlignment">The alignment of the blocks to pool.</param>
+		/// <param name="upstream">The resource slabs and other blocks are obtained from.</param>
+		explicit NodePool(std::size_t blockSize, std::size_t blockAlignment = DefaultAlignment, MemoryResource* upstream = GetDefaultResource());
+		NodePool(const NodePool&) = delete;
+		NodePool(NodePool&&) noexcept = delete;
+		NodePool& operator=(const NodePool&) = delete;
+		NodePool& operator=(NodePool&&) noexcept = delete;
+		/// <summary>
+		/// The destructor for a NodePool returns every slab to the upstream resource.
+		/// </summary>
+		~NodePool();
+
+		/// <summary>
+		/// Return every slab to the upstream resource. Every pooled block handed out so far becomes invalid, and no destructors are run.
+		/// </summary>
+		void Release();
+
+		/// <summary>
+		/// Retrieve the resource slabs and other blocks are obtained from.
+		/// </summary>
+		/// <returns>A pointer to the upstream resource.</returns>
+		[[nodiscard]] MemoryResource* Upstream() const;
+		/// <summary>
+		/// Retrieve the size of the pooled blocks, rounded up to their alignment.
+		/// </summary>
+		/// <returns>The size of a pooled block, in bytes.</returns>
+		[[nodiscard]] std::size_t BlockSize() const;
+		/// <summary>
+		/// Retrieve the number of pooled blocks currently handed out.
+		/// </summary>
+		/// <returns>The number of pooled blocks in use.</returns>
+		[[nodiscard]] std::size_t BlocksInUse() const;
+		/// <summary>
+		/// Retrieve the number of slabs currently held from the upstream resource.
+		/// </summary>
+		/// <returns>The number of slabs.</returns>
+		[[nodiscard]] std::size_t SlabCount() const;
+		/// <summary>
+		/// Retrieve the number of bytes currently held in slabs from the upstream resource.
+		/// </summary>
+		/// <returns>The number of bytes held in slabs.</returns>
+		[[nodiscard]] std::size_t BytesReserved() const;
+
+	private:
+		void* DoAllocate(std::size_t bytes, std::size_t alignment) override;
+		void DoDeallocate(void* block, std::size_t bytes, std::size_t alignment) override;
+		void* DoReallocate(void* block, std::size_t oldBytes, std::size_t newBytes, std::size_t alignment) override;
+
+		/// <summary>
+		/// Determine whether a block of the given size and alignment is served from the slabs.
+		/// </summary>
+		/// <param name="bytes">The size of the block, in bytes.</param>
+		/// <param name="alignment">The alignment of the block.</param>
+		/// <returns>A boolean indicating whether the block is pooled.</returns>
+		[[nodiscard]] bool IsPooled(std::size_t bytes, std::size_t alignment) const;
+
+		/// <summary>
+		/// The resource slabs and other blocks are obtained from.
+		/// </summary>
+		MemoryResource* _upstream;
+		/// <summary>
+		/// The alignment of the pooled blocks.
+		/// </summary>
+		std::size_t _blockAlignment;
+		/// <summary>
+		/// The size of the pooled blocks, rounded up to their alignment.
+		/// </summary>
+		std::size_t _blockSize;
+		/// <summary>
+		/// The slabs the pooled blocks are carved out of.
+		/// </summary>
+		NodeSlabs _slabs;
+		/// <summary>
+		/// The number of pooled blocks handed out.
+		/// </summary>
+		std::size_t _blocksInUse{ 0 };
+	};
+}
+
+#include "NodePool.inl"
@@ -0,0 +1,19 @@
+/// <summary>
+/// The inline implementation of the hot paths of the class NodeSlabs.
+/// </summary>
+
+#include "NodePool.h"
+
+namespace FIEAGameEngine {
+	inline void* NodeSlabs::Acquire(std::size_t blockSize, std::size_t blockAlignment, MemoryResource& upstream) {
+		if (_freeList == nullptr && !AddSlab(blockSize, blockAlignment, upstream)) return nullptr;
+
+		FreeBlock* block = _freeList;
+		_freeList = block->Next;
+		return block;
+	}
+
+	inline void NodeSlabs::Recycle(void* block) {
+		_freeList = new (block) FreeBlock{ _freeList };
+	}
+}
@@ -0,0 +1,108 @@
+/// <summary>
+/// The definitions of the class PoolResource, a MemoryResource that recycles small blocks through per-size free lists.
+/// </summary>
+
+#include "pch.h"
+#include "PoolResource.h"
+#include <cstring>
+
+namespace FIEAGameEngine {
+	PoolResource::PoolResource(std::size_t blocksPerChunk, MemoryResource* upstream) :
+		_upstream{ upstream != nullptr ? upstream : GetDefaultResource() }, _blocksPerChunk{ std::max(blocksPerChunk, std::size_t(1)) }
+	{
+	}
+
+	PoolResource::~PoolResource() {
+		Release();
+	}
+
+	void PoolResource::Release() {
+		while (_chunks != nullptr) {
+			ChunkHeader* previous = _chunks->Previous;
+			_upstream->Deallocate(_chunks, _chunks->Size, DefaultAlignment);
+			_chunks = previous;
+		}
+		for (Pool& pool : _pools) {
+			pool = Pool{};
+		}
+		_blocksInUse = _bytesReserved = 0;
+	}
+
+	MemoryResource* PoolResource::Upstream() const {
+		return _upstream;
+	}
+
+	std::size_t PoolResource::BlocksInUse() const {
+		return _blocksInUse;
+	}
+
+	std::size_t PoolResource::BytesReserved() const {
+		return _bytesReserved;
+	}
+
+	void* PoolResource::DoAllocate(std::size_t bytes, std::size_t alignment) {
+		std::size_t poolIndex = PoolIndex(bytes, alignment);
+		if (poolIndex == PoolCount) return _upstream->Allocate(bytes, alignment);
+
+		Pool& pool = _pools[poolIndex];
+		if (pool.FreeList == nullptr && !AddChunk(poolIndex)) return nullptr;
+
+		FreeBlock* block = pool.FreeList;
+		pool.FreeList = block->Next;
+		++_blocksInUse;
+		return block;
+	}
+
+	void PoolResource::DoDeallocate(void* block, std::size_t bytes, std::size_t alignment) {
+		std::size_t poolIndex = PoolIndex(bytes, alignment);
+		if (poolIndex == PoolCount) {
+			_upstream->Deallocate(block, bytes, alignment);
+			return;
+		}
+
+		Pool& pool = _pools[poolIndex];
+		pool.FreeList = new (block) FreeBlock{ pool.FreeList };
+		--_blocksInUse;
+	}
+
+	void* PoolResource::DoReallocate(void* block, std::size_t oldBytes, std::size_t newBytes, std::size_t alignment) {
+		std::size_t oldPool = PoolIndex(oldBytes, alignment);
+		std::size_t newPool = PoolIndex(newBytes, alignment);
+		if (oldPool == newPool && oldPool != PoolCount) return block;
+		if (oldPool == PoolCount && newPool == PoolCount) return _upstream->Reallocate(block, oldBytes, newBytes, alignment);
+		return MemoryResource::DoReallocate(block, oldBytes, newBytes, alignment);
+	}
+
+	std::size_t PoolResource::PoolIndex(std::size_t bytes, std::size_t alignment) {
+		if (bytes > LargestPooledBlock || alignment > DefaultAlignment) return PoolCount;
+
+		std::size_t poolIndex = 0;
+		std::size_t blockSize = SmallestPooledBlock;
+		while (blockSize < bytes || blockSize < alignment) {
+			blockSize <<= 1;
+			++poolIndex;
+		}
+		return poolIndex;
+	}
+
+	bool PoolResource::AddChunk(std::size_t poolIndex) {
+		Pool& pool = _pools[poolIndex];
+		const std::size_t blockSize = SmallestPooledBlock << poolIndex;
+		const std::size_t blockCount = std::max(pool.NextChunkBlocks, _blocksPerChunk);
+		const std::size_t headerSize = (sizeof(ChunkHeader) + DefaultAlignment - 1) / DefaultAlignment * DefaultAlignment;
+		const std::size_t chunkSize = headerSize + blockCount * blockSize;
+
+		void* memory = _upstream->Allocate(chunkSize, DefaultAlignment);
+		if (memory == nullptr) return false;
+
+		_chunks = new (memory) ChunkHeader{ _chunks, chunkSize };
+		_bytesReserved += chunkSize;
+		pool.NextChunkBlocks = blockCount * 2;
+
+		std::byte* blocks = static_cast<std::byte*>(memory) + headerSize;
+		for (std::size_t i = blockCount; i > 0; --i) {
+			pool.FreeList = new (blocks + (i - 1) * blockSize) FreeBlock{ pool.FreeList };
+		}
+		return true;
+	}
+}
@@ -0,0 +1,154 @@
+/// <summary>
+/// The declaration of the class PoolResource, a MemoryResource that recycles small blocks through per-size free lists.
+/// </summary>
+
+#pragma once
+
+#include <cstddef>
+#include "MemoryResource.h"
+
+namespace FIEAGameEngine {
+	/// <summary>
+	/// A MemoryResource that sorts small blocks into size classes of 8 to LargestPooledBlock bytes, each a power of two, and keeps a free list per class.
+	/// Blocks are carved out of chunks obtained from an upstream resource and are recycled rather than returned, so allocating and freeing many same sized objects,
+	/// like SList nodes or small Datum arrays, never reaches the upstream resource once the pools are warm. Larger or more strictly aligned blocks go straight to the upstream resource.
+	/// Release returns every chunk at once. A PoolResource is not thread safe.
+	/// </summary>
+	class PoolResource final : public MemoryResource {
+	public:
+		/// <summary>
+		/// The largest block, in bytes, that is served from a pool rather than from the upstream resource.
+		/// </summary>
+		static constexpr std::size_t LargestPooledBlock = 512;
+
+		/// <summary>
+		/// Construct a PoolResource. No chunks are obtained until the first allocation.
+		/// </summary>
+		/// <param name="blocksPerChunk">The number of blocks in the first chunk of each pool. Each further chunk holds twice as many as the one before it.</param>
+		/// <param name="upstream">The resource chunks and large blocks are obtained from.</param>
+		explicit PoolResource(std::size_t blocksPerChunk = std::size_t(32), MemoryResource* upstream = GetDefaultResource());
+		PoolResource(const PoolResource&) = delete;
+		PoolResource(PoolResource&&) noexcept = delete;
+		PoolResource& operator=(const PoolResource&) = delete;
+		PoolResource& operator=(PoolResource&&) noexcept = delete;
+		/// <summary>
+		/// The destructor for a PoolResource returns every chunk to the upstream resource.
+		/// </summary>
+		~PoolResource();
+
+		/// <summary>
+		/// Return every chunk to the upstream resource. Every pooled block handed out so far becomes invalid, and no destructors are run.
+		/// Large blocks were obtained from the upstream resource directly and are not affected.
+		/// </summary>
+		void Release();
+
+		/// <summary>
+		/// Retrieve the resource chunks and large blocks are obtained from.
+		/// </summary>
+		/// <returns>A pointer to the upstream resource.</returns>
+		[[nodiscard]] MemoryResource* Upstream() const;
+		/// <summary>
+		/// Retrieve the number of pooled blocks currently handed out.
+		/// </summary>
+		/// <returns>The number of pooled blocks in use.</returns>
+		[[nodiscard]] std::size_t BlocksInUse() const;
+		/// <summary>
+		/// Retrieve the number of bytes currently held in chunks from the upstream resource.
+		/// </summary>
+		/// <returns>The number of bytes held in chunks.</returns>
+		[[nodiscard]] std::size_t BytesReserved() const;
+
+	private:
+		/// <summary>
+		/// The smallest block size, which must fit a free list link.
+		/// </summary>
+		static constexpr std::size_t SmallestPooledBlock = 8;
+		/// <summary>
+		/// The number of size classes between SmallestPooledBlock and LargestPooledBlock.
+		/// </summary>
+		static constexpr std::size_t PoolCount = 7;
+		static_assert((SmallestPooledBlock << (PoolCount - 1)) == LargestPooledBlock, "The size classes must run from the smallest to the largest pooled block.");
+		static_assert(SmallestPooledBlock >= sizeof(void*), "A pooled block must be large enough to hold a free list link.");
+
+		/// <summary>
+		/// A free block, linked to the next free block of the same size class.
+		/// </summary>
+		struct FreeBlock final {
+			/// <summary>
+			/// The next free block in the pool.
+			/// </summary>
+			FreeBlock* Next;
+		};
+
+		/// <summary>
+		/// The header at the start of every chunk, linking it to the chunk obtained before it.
+		/// </summary>
+		struct ChunkHeader final {
+			/// <summary>
+			/// The chunk obtained before this one, in any pool.
+			/// </summary>
+			ChunkHeader* Previous;
+			/// <summary>
+			/// The size of this chunk, including this header, in bytes.
+			/// </summary>
+			std::size_t Size;
+		};
+
+		/// <summary>
+		/// The free list and growth state of one size class.
+		/// </summary>
+		struct Pool final {
+			/// <summary>
+			/// The first free block.
+			/// </summary>
+			FreeBlock* FreeList{ nullptr };
+			/// <summary>
+			/// The number of blocks to put in the next chunk.
+			/// </summary>
+			std::size_t NextChunkBlocks{ 0 };
+		};
+
+		void* DoAllocate(std::size_t bytes, std::size_t alignment) override;
+		void DoDeallocate(void* block, std::size_t bytes, std::size_t alignment) override;
+		void* DoReallocate(void* block, std::size_t oldBytes, std::size_t newBytes, std::size_t alignment) override;
+
+		/// <summary>
+		/// Find the size class that serves blocks of the given size and alignment.
+		/// </summary>
+		/// <param name="bytes">The size of the block, in bytes.</param>
+		/// <param name="alignment">The alignment of the block.</param>
+		/// <returns>The index of the pool, or PoolCount if the block must come from the upstream resource.</returns>
+		[[nodiscard]] static std::size_t PoolIndex(std::size_t bytes, std::size_t alignment);
+		/// <summary>
+		/// Obtain a chunk from the upstream resource for the given pool and thread its blocks onto the pool's free list.
+		/// </summary>
+		/// <param name="poolIndex">The index of the pool to refill.</param>
+		/// <returns>A boolean indicating whether the chunk could be obtained.</returns>
+		bool AddChunk(std::size_t poolIndex);
+
+		/// <summary>
+		/// The resource chunks and large blocks are obtained from.
+		/// </summary>
+		MemoryResource* _upstream;
+		/// <summary>
+		/// The number of blocks in the first chunk of each pool.
+		/// </summary>
+		std::size_t _blocksPerChunk;
+		/// <summary>
+		/// One pool per size class, from SmallestPooledBlock up to LargestPooledBlock.
+		/// </summary>
+		Pool _pools[PoolCount];
+		/// <summary>
+		/// The most recently obtained chunk, of any pool.
+		/// </summary>
+		ChunkHeader* _chunks{ nullptr };
+		/// <summary>
+		/// The number of pooled blocks handed out.
+		/// </summary>
+		std::size_t _blocksInUse{ 0 };
+		/// <summary>
+		/// The number of bytes held in chunks.
+		/// </summary>
+		std::size_t _bytesReserved{ 0 };
+	};
+}
@@ -13,17 +13,17 @@ namespace FIEAGameEngine {
     ReactionAttributed::ReactionAttributed(const std::string& name, std::string subtype) :
         Reaction(ReactionAttributed::TypeIdClass(), name), _subtype{std::move(subtype)}
     {
-        Event<EventMessageAttributed>::Subscribe(notificationDelegate);
+        Event<EventMessageAttributed>::Link(notificationDelegate);
     }
 
     ReactionAttributed::ReactionAttributed(RTTI::IdType typeID, const std::string& name, std::string subtype) :
         Reaction(typeID, name), _subtype{ std::move(subtype) }
     {
-        Event<EventMessageAttributed>::Subscribe(notificationDelegate);
+        Event<EventMessageAttributed>::Link(notificationDelegate);
     }
 
     ReactionAttributed::~ReactionAttributed() {
-        Event<EventMessageAttributed>::Unsubscribe(notificationDelegate);
+        Event<EventMessageAttributed>::Unlink(notificationDelegate);
     }
 
     gsl::owner<ReactionAttributed*> ReactionAttributed::Clone() const {
@@ -53,9 +53,13 @@ namespace FIEAGameEngine {
 
     void ReactionAttributed::CopyInParameters(const EventMessageAttributed& eventMessage) {
         assert(actionsDatum);
-        eventMessage.ForEachAuxiliaryAttribute([this, &actionsDatum = actionsDatum](const std::string& key, Datum& value) {
+        //Each parameter is written once, exactly, into one reused buffer, rather than once per action into a new string
+        std::string parameterText;
+        eventMessage.ForEachAuxiliaryAttribute([this, &actionsDatum = actionsDatum, &parameterText](const std::string& key, Datum& value) {
+            parameterText.clear();
+            value.AppendToString(parameterText, std::size_t(0), Datum::StringFormat::Exact);
             for (std::size_t i = 0; i < actionsDatum->Size(); ++i) {
-                actionsDatum->GetAsTable(i).Append(key).SetFromString(value.ToString());
+                actionsDatum->GetAsTable(i).Append(key).SetFromString(parameterText);
             }
             return false;
         });
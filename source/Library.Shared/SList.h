@@ -8,13 +8,32 @@
 #include <stdexcept>
 #include <initializer_list>
 #include "DefaultEquality.h"
+#include "MemoryResource.h"
+#include "NodePool.h"
 
 namespace FIEAGameEngine {
+	/// <summary>
+	/// Where an SList obtains the memory for its nodes.
+	/// </summary>
+	enum class NodeStorage {
+		/// <summary>
+		/// Each node is allocated from the SList's resource and returned to it when removed.
+		/// </summary>
+		Individual,
+		/// <summary>
+		/// Nodes are carved out of slabs the SList obtains from its resource, recycled through a free list when removed, and returned a slab at a time by Clear.
+		/// </summary>
+		Pooled
+	};
+
 	/// <summary>
 	/// A templated container class for a singly linked list. Currently, Move Semantics are not implemented. What can be done is: constuct SLists, use copy semantics 
 	/// with SLists, traverse SLists with iterators, add and remove elements from the front and back of SLists, look at the front and back
 	/// elements of SLists, and clear all elements from an SList. Removing an element from the front or back of an SList does not return the removed element.
 	/// Additionally, trying to look at or remove the front or back elements of an empty list will result in a runtime error.
+	/// Nodes are allocated one at a time from the MemoryResource given at construction, or the default resource, so SLists sharing a resource such as a NodePool can relink nodes between each other.
+	/// An SList constructed with NodeStorage::Pooled instead carves its nodes out of slabs of its own and recycles them through a free list, so nodes pushed one after another
+	/// sit next to each other in memory and Clear returns every slab at once; this suits lists that churn through many nodes on their own, like a parser's stack.
 	/// </summary>
 	/// <typeparam name="T"></typeparam>
 	template <typename T>
@@ -55,6 +74,15 @@ namespace FIEAGameEngine {
 		using const_reference = const value_type&;
 		using rvalue_reference = T&&;
 
+		/// <summary>
+		/// The number of bytes each element occupies on the heap, including its link to the next element.
+		/// </summary>
+		static constexpr size_type NodeSize = sizeof(Node);
+		/// <summary>
+		/// The alignment of each element's node.
+		/// </summary>
+		static constexpr size_type NodeAlignment = alignof(Node);
+
 		/// <summary>
 		/// Iterator class allows public traversal of SList objects. Iterators can be dereferenced, incremented, and compared for equality.
 		/// Dereferencing an Iterator with a Node equal to nullptr or trying to increment an Iterator that is not assigned to an SList will result in a runtime error.
@@ -261,28 +289,49 @@ namespace FIEAGameEngine {
 		/// </summary>
 		SList() = default;
 		/// <summary>
+		/// Constructor for an empty SList that allocates its nodes from the given resource.
+		/// </summary>
+		/// <param name="resource">The resource to allocate nodes or slabs from, or nullptr for the default resource.</param>
+		/// <param name="storage">Whether to allocate each node from the resource or to pool nodes in slabs.</param>
+		explicit SList(MemoryResource* resource, NodeStorage storage = NodeStorage::Individual);
+		/// <summary>
 		/// An Initializer list constructor for SList. The items will be pushed back to the constructor SList in the same order as given into this function.
 		/// </summary>
 		/// <param name="list">A set of items to add to an SList as it's being constructed</param>
-		SList(std::initializer_list<value_type> list);
+		/// <param name="resource">The resource to allocate nodes from, or nullptr for the default resource.</param>
+		SList(std::initializer_list<value_type> list, MemoryResource* resource = nullptr);
 		/// <summary>
-		/// A copy constructor for an SList that performs a deep copy during construction.
+		/// A copy constructor for an SList that performs a deep copy during construction. The copy allocates from the default resource, and pools its nodes if the original does.
 		/// </summary>
 		/// <param name="other">The SList to copy</param>
 		SList(const SList& rhs);
 		/// <summary>
+		/// A copy constructor for an SList that performs a deep copy into nodes obtained from the given resource. The copy pools its nodes if the original does.
+		/// </summary>
+		/// <param name="rhs">The SList to copy</param>
+		/// <param name="resource">The resource to allocate nodes or slabs from, or nullptr for the default resource.</param>
+		SList(const SList& rhs, MemoryResource* resource);
+		/// <summary>
 		/// The move constructor for SList is currently not implemented and has been deleted.
 		/// </summary>
 		/// <param name="rhs">The SList to move data from</param>
 		SList(SList&& rhs) noexcept;
 		/// <summary>
+		/// A move constructor for an SList that allocates from the given resource, and pools its nodes if the given SList does. Takes over the nodes of the given SList if its resource is equal,
+		/// and moves its elements one by one otherwise.
+		/// </summary>
+		/// <param name="rhs">The SList to move data from</param>
+		/// <param name="resource">The resource to allocate nodes or slabs from, or nullptr for the default resource.</param>
+		SList(SList&& rhs, MemoryResource* resource);
+		/// <summary>
 		/// The copy assignment operator for an Slist that first clears the existing elements and then performs a deep copy.
 		/// </summary>
 		/// <param name="rhs">The SList to copy</param>
 		/// <returns>A reference to the updated SList</returns>
 		SList& operator=(const SList& rhs);
 		/// <summary>
-		/// The move assignment operator for SList is currently not implemented and has been deleted.
+		/// The move assignment operator for SList. Takes over the nodes of the given SList, along with any slabs, if both store their nodes the same way and allocate from equal resources,
+		/// and moves its elements one by one otherwise.
 		/// </summary>
 		/// <param name="rhs">The Slist to move data from</param>
 		/// <returns></returns>
@@ -327,6 +376,16 @@ namespace FIEAGameEngine {
 		/// </summary>
 		/// <returns>A boolean indicating if the SList is currently empty</returns>
 		[[nodiscard]] bool IsEmpty() const;
+		/// <summary>
+		/// Retrieve the resource the SList allocates its nodes from.
+		/// </summary>
+		/// <returns>A pointer to the SList's resource.</returns>
+		[[nodiscard]] MemoryResource* GetResource() const;
+		/// <summary>
+		/// Determine whether the SList pools its own nodes in slabs, rather than allocating each node from its resource.
+		/// </summary>
+		/// <returns>A boolean indicating whether the SList pools its own nodes</returns>
+		[[nodiscard]] bool PoolsNodes() const;
 
 		/// <summary>
 		/// Add a new element to the beginning of the SList.
@@ -353,6 +412,13 @@ namespace FIEAGameEngine {
 		/// <returns>An Iterator pointing to the item that was just added</returns>
 		Iterator PushBack(rvalue_reference data);
 		/// <summary>
+		/// Construct a new element in place at the end of the SList.
+		/// </summary>
+		/// <param name="args">The arguments to construct the item with</param>
+		/// <returns>An Iterator pointing to the item that was just added</returns>
+		template <typename... Args>
+		Iterator EmplaceBack(Args&&... args);
+		/// <summary>
 		/// Remove the first element in the SList.
 		/// </summary>
 		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the list is empty</exception>
@@ -363,7 +429,15 @@ namespace FIEAGameEngine {
 		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the list is empty</exception>
 		void PopBack();
 		/// <summary>
-		/// Remove all elements in the SList and return it to an empty state.
+		/// Unlink the first element of another SList and append it to the end of this SList. The node itself is relinked, so the data is neither copied nor moved and references to it remain valid.
+		/// If either SList pools its own nodes, or the two allocate from resources that are not equal, the data is moved into a new node instead.
+		/// </summary>
+		/// <param name="other">The SList to take the first element from</param>
+		/// <returns>An Iterator pointing to the relinked element, now owned by this SList</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the other list is empty</exception>
+		Iterator SpliceFrontToBack(SList& other);
+		/// <summary>
+		/// Remove all elements in the SList and return it to an empty state. An SList that pools its own nodes returns every slab at once.
 		/// </summary>
 		void Clear();
 
@@ -448,12 +522,37 @@ namespace FIEAGameEngine {
 		/// The current size of the SList.
 		/// </summary>
 		size_type _size{ 0 };
+		/// <summary>
+		/// The resource the SList allocates its nodes from.
+		/// </summary>
+		MemoryResource* _resource{ GetDefaultResource() };
+		/// <summary>
+		/// The slabs the SList's nodes are carved out of when it pools its own nodes.
+		/// </summary>
+		NodeSlabs _slabs;
+		/// <summary>
+		/// Whether the SList pools its own nodes in _slabs rather than allocating each from _resource.
+		/// </summary>
+		bool _poolsNodes{ false };
 
 		/// <summary>
 		/// A helper function that preforms a deep copy of the given SList into this.
 		/// </summary>
 		/// <param name="rhs">The SList to copy</param>
 		void DeepCopy(const SList& rhs);
+		/// <summary>
+		/// A helper function that allocates a Node from the SList's slabs or resource and constructs it.
+		/// </summary>
+		/// <param name="next">The Node that comes after the new Node</param>
+		/// <param name="args">The arguments to construct the Node's data with</param>
+		/// <returns>A pointer to the new Node</returns>
+		template <typename... Args>
+		[[nodiscard]] Node* CreateNode(Node* next, Args&&... args);
+		/// <summary>
+		/// A helper function that destroys a Node and returns its memory to the SList's slabs or resource.
+		/// </summary>
+		/// <param name="node">The Node to destroy</param>
+		void DestroyNode(Node* node);
 	};
 }
 
@@ -16,26 +16,50 @@ namespace FIEAGameEngine {
 
 #pragma region SList
 	template <typename value_type>
-	inline SList<value_type>::SList(std::initializer_list<value_type> list) {
+	inline SList<value_type>::SList(MemoryResource* resource, NodeStorage storage) :
+		_resource{ resource != nullptr ? resource : GetDefaultResource() }, _poolsNodes{ storage == NodeStorage::Pooled }
+	{
+	}
+
+	template <typename value_type>
+	inline SList<value_type>::SList(std::initializer_list<value_type> list, MemoryResource* resource) :
+		_resource{ resource != nullptr ? resource : GetDefaultResource() }
+	{
 		for (const_reference value : list) {
 			PushBack(value);
 		}
 	}
 
 	template<typename value_type>
-	SList<value_type>::SList(const SList& rhs) {
+	SList<value_type>::SList(const SList& rhs) :
+		_poolsNodes{ rhs._poolsNodes }
+	{
+		DeepCopy(rhs);
+	}
+
+	template<typename value_type>
+	SList<value_type>::SList(const SList& rhs, MemoryResource* resource) :
+		_resource{ resource != nullptr ? resource : GetDefaultResource() }, _poolsNodes{ rhs._poolsNodes }
+	{
 		DeepCopy(rhs);
 	}
 
 	template<typename value_type>
 	SList<value_type>::SList(SList&& rhs) noexcept :
-		_front{ rhs._front }, _back{ rhs._back }, _size{ rhs._size }
+		_front{ rhs._front }, _back{ rhs._back }, _size{ rhs._size }, _resource{ rhs._resource }, _slabs{ std::move(rhs._slabs) }, _poolsNodes{ rhs._poolsNodes }
 	{
 		rhs._front = nullptr;
 		rhs._back = nullptr;
 		rhs._size = 0;
 	}
 
+	template<typename value_type>
+	SList<value_type>::SList(SList&& rhs, MemoryResource* resource) :
+		_resource{ resource != nullptr ? resource : GetDefaultResource() }, _poolsNodes{ rhs._poolsNodes }
+	{
+		*this = std::move(rhs);
+	}
+
 	template<typename value_type>
 	SList<value_type>& SList<value_type>::operator=(const SList& rhs) {
 		if (this != &rhs) {
@@ -49,12 +73,21 @@ namespace FIEAGameEngine {
 	SList<value_type>& SList<value_type>::operator=(SList&& rhs) noexcept {
 		if (this != &rhs) {
 			Clear();
-			_front = rhs._front;
-			_back = rhs._back;
-			_size = rhs._size;
-			rhs._front = nullptr;
-			rhs._back = nullptr;
-			rhs._size = 0;
+			if (_poolsNodes == rhs._poolsNodes && _resource->IsEqual(*rhs._resource)) {
+				_front = rhs._front;
+				_back = rhs._back;
+				_size = rhs._size;
+				_slabs = std::move(rhs._slabs);
+				rhs._front = nullptr;
+				rhs._back = nullptr;
+				rhs._size = 0;
+			}
+			else {
+				for (reference value : rhs) {
+					PushBack(std::move(value));
+				}
+				rhs.Clear();
+			}
 		}
 		return *this;
 	}
@@ -106,9 +139,19 @@ namespace FIEAGameEngine {
 		return (_size == std::size_t(0));
 	}
 
+	template<typename value_type>
+	inline MemoryResource* SList<value_type>::GetResource() const {
+		return _resource;
+	}
+
+	template<typename value_type>
+	inline bool SList<value_type>::PoolsNodes() const {
+		return _poolsNodes;
+	}
+
 	template<typename value_type>
 	typename SList<value_type>::Iterator SList<value_type>::PushFront(const_reference data) {
-		_front = new Node(_front, data);
+		_front = CreateNode(_front, data);
 
 		if (_size == 0) _back = _front;
 		++_size;
@@ -119,7 +162,7 @@ namespace FIEAGameEngine {
 	template<typename value_type>
 	typename SList<value_type>::Iterator SList<value_type>::PushFront(rvalue_reference data)
 	{
-		_front = new Node(_front, std::forward<value_type>(data));
+		_front = CreateNode(_front, std::forward<value_type>(data));
 
 		if (_size == 0) _back = _front;
 		++_size;
@@ -129,7 +172,7 @@ namespace FIEAGameEngine {
 
 	template<typename value_type>
 	typename SList<value_type>::Iterator SList<value_type>::PushBack(const_reference data) {
-		Node* newNode = new Node(nullptr, data);
+		Node* newNode = CreateNode(nullptr, data);
 		if (_back != nullptr) _back->Next = newNode;
 		_back = newNode;
 
@@ -142,7 +185,7 @@ namespace FIEAGameEngine {
 	template<typename value_type>
 	typename SList<value_type>::Iterator SList<value_type>::PushBack(rvalue_reference data)
 	{
-		Node* newNode = new Node(nullptr, std::forward<value_type>(data));
+		Node* newNode = CreateNode(nullptr, std::forward<value_type>(data));
 		if (_back != nullptr) _back->Next = newNode;
 		_back = newNode;
 
@@ -152,6 +195,46 @@ namespace FIEAGameEngine {
 		return Iterator(*this, newNode);
 	}
 
+	template<typename value_type>
+	template<typename... Args>
+	typename SList<value_type>::Iterator SList<value_type>::EmplaceBack(Args&&... args) {
+		Node* newNode = CreateNode(nullptr, std::forward<Args>(args)...);
+		if (_back != nullptr) _back->Next = newNode;
+		_back = newNode;
+
+		if (_size == 0) _front = newNode;
+		++_size;
+
+		return Iterator(*this, newNode);
+	}
+
+	template<typename value_type>
+	typename SList<value_type>::Iterator SList<value_type>::SpliceFrontToBack(SList& other) {
+#ifdef USE_EXCEPTIONS
+		if (other._front == nullptr) throw std::runtime_error("List is empty.");
+#endif // USE_EXCEPTIONS
+
+		if (_poolsNodes || other._poolsNodes || !_resource->IsEqual(*other._resource)) {
+			Iterator movedIter = PushBack(std::move(other._front->Data));
+			other.PopFront();
+			return movedIter;
+		}
+
+		Node* movedNode = other._front;
+		other._front = movedNode->Next;
+		--other._size;
+		if (other._size == 0) other._back = nullptr;
+
+		movedNode->Next = nullptr;
+		if (_back != nullptr) _back->Next = movedNode;
+		_back = movedNode;
+
+		if (_size == 0) _front = movedNode;
+		++_size;
+
+		return Iterator(*this, movedNode);
+	}
+
 	template<typename value_type>
 	void SList<value_type>::PopFront() {
 #ifdef USE_EXCEPTIONS
@@ -160,7 +243,7 @@ namespace FIEAGameEngine {
 
 		Node* removedNode = _front;
 		_front = _front->Next;
-		delete removedNode;
+		DestroyNode(removedNode);
 
 		--_size;
 		if (_size == 0) _back = nullptr;
@@ -185,7 +268,7 @@ namespace FIEAGameEngine {
 				newBackNode = newBackNode->Next;
 			}
 		}		
-		delete removedNode;		
+		DestroyNode(removedNode);		
 	}
 
 	template<typename value_type>
@@ -193,9 +276,11 @@ namespace FIEAGameEngine {
 		Node* currentNode = _front;
 		while (currentNode != nullptr) {
 			Node* nextNode = currentNode->Next;
-			delete currentNode;
+			if (_poolsNodes) currentNode->~Node();
+			else DestroyNode(currentNode);
 			currentNode = nextNode;
 		}
+		if (_poolsNodes) _slabs.Release(*_resource);
 		_size = 0;
 		_front = nullptr;
 		_back = nullptr;
@@ -208,6 +293,21 @@ namespace FIEAGameEngine {
 		}
 	}
 
+	template<typename value_type>
+	template<typename... Args>
+	inline typename SList<value_type>::Node* SList<value_type>::CreateNode(Node* next, Args&&... args) {
+		void* memory = _poolsNodes ? _slabs.Acquire(sizeof(Node), alignof(Node), *_resource) : _resource->Allocate(sizeof(Node), alignof(Node));
+		assert(memory != nullptr);
+		return new (memory) Node(next, std::forward<Args>(args)...);
+	}
+
+	template<typename value_type>
+	inline void SList<value_type>::DestroyNode(Node* node) {
+		node->~Node();
+		if (_poolsNodes) _slabs.Recycle(node);
+		else _resource->Deallocate(node, sizeof(Node), alignof(Node));
+	}
+
 	template<typename value_type>
 	typename SList<value_type>::Iterator SList<value_type>::begin() {
 		return Iterator(*this, _front);
@@ -246,7 +346,7 @@ namespace FIEAGameEngine {
 
 		if (iter._node == nullptr) return PushBack(data);
 		else {
-			Node* newNode = new Node(iter._node->Next, data);
+			Node* newNode = CreateNode(iter._node->Next, data);
 			if (newNode->Next == nullptr) _back = newNode;
 			iter._node->Next = newNode;
 			++_size;
@@ -294,7 +394,7 @@ namespace FIEAGameEngine {
 			_front = currentNode->Next;
 			--_size;
 			if (_size == 0) _back = nullptr;
-			delete currentNode;
+			DestroyNode(currentNode);
 			return true;
 		}
 		
@@ -302,7 +402,7 @@ namespace FIEAGameEngine {
 			if (currentNode->Next == iter._node) {
 				if (currentNode->Next == _back) _back = currentNode;
 				currentNode->Next = iter._node->Next;
-				delete iter._node;
+				DestroyNode(iter._node);
 				--_size;
 				return true;
 			}
@@ -10,8 +10,8 @@ using namespace std::string_literals;
 namespace FIEAGameEngine {
 	RTTI_DEFINITIONS(Scope);
 
-	Scope::Scope(std::size_t size) :
-		_orderVector{size}
+	Scope::Scope(std::size_t size, MemoryResource* resource) :
+		_orderVector(size, DefaultGrowth{}, resource), _attributes(std::size_t(13), {}, _orderVector.GetResource())
 	{
 	}
 	
@@ -37,8 +37,18 @@ namespace FIEAGameEngine {
 		if (this != &rhs) {
 			Clear();
 
-			_attributes = std::move(rhs._attributes);
-			_orderVector = std::move(rhs._orderVector);
+			if (GetResource()->IsEqual(*rhs.GetResource())) {
+				_attributes = std::move(rhs._attributes);
+				_orderVector = std::move(rhs._orderVector);
+			}
+			else {
+				_orderVector.Reserve(rhs._orderVector.Size());
+				for (auto item : rhs._orderVector) {
+					Append(item->first) = std::move(item->second);
+				}
+				rhs._attributes.Clear();
+				rhs._orderVector.Clear();
+			}
 			Reparent(rhs);
 		}
 		return *this;
@@ -50,13 +60,13 @@ namespace FIEAGameEngine {
 		Clear();
 	}
 
-	Datum* Scope::Find(const std::string& key) {
+	Datum* Scope::Find(std::string_view key) {
 		auto findResult = _attributes.Find(key);
 		if (findResult == _attributes.end()) return nullptr;
 		else return &findResult->second;
 	}
 
-	const Datum* Scope::Find(const std::string& key) const {
+	const Datum* Scope::Find(std::string_view key) const {
 		auto findResult = _attributes.Find(key);
 		if (findResult == _attributes.end()) return nullptr;
 		else return &findResult->second;
@@ -78,7 +88,7 @@ namespace FIEAGameEngine {
 		return std::pair<Datum*, std::size_t>(foundDatum, foundIndex);
 	}
 	
-	Datum* Scope::Search(const std::string& key, Scope*& foundScope) {
+	Datum* Scope::Search(std::string_view key, Scope*& foundScope) {
 		foundScope = nullptr;
 		Datum* foundDatum = Find(key);
 		if (foundDatum == nullptr && _parent != nullptr) return _parent->Search(key, foundScope);
@@ -88,24 +98,27 @@ namespace FIEAGameEngine {
 		}
 	}
 	
-	Datum& Scope::Append(const std::string& key) {
+	Datum& Scope::Append(std::string_view key) {
 #ifdef USE_EXCEPTIONS
 		if (key.empty()) throw std::runtime_error("Key cannot be empty.");
 #endif // USE_EXCEPTIONS
 
-		auto [foundIter, inserted] = _attributes.Insert(std::pair<const std::string, Datum>(key, Datum()));
-		if (inserted) _orderVector.PushBack(&*foundIter);
+		auto [foundIter, inserted] = _attributes.TryEmplace(key);
+		if (inserted) {
+			foundIter->second.SetResource(GetResource());
+			_orderVector.PushBack(&*foundIter);
+		}
 		return foundIter->second;
 	}
 	
-	Scope& Scope::AppendScope(const std::string& key) {
+	Scope& Scope::AppendScope(std::string_view key) {
 		Datum& tableDatum = Append(key);
 		 
 #ifdef USE_EXCEPTIONS
 		if (tableDatum.Type() != Datum::DatumTypes::Unknown && tableDatum.Type() != Datum::DatumTypes::Table) throw std::runtime_error("Datum already exists of non table type.");
 #endif // USE_EXCEPTIONS
 
-		Scope* newScope = new Scope();
+		Scope* newScope = new Scope(std::size_t(0), GetResource());
 		tableDatum.PushBack(*newScope);
 		newScope->_parent = this;
 		return *newScope;
@@ -120,7 +133,7 @@ namespace FIEAGameEngine {
 		return this;
 	}
 	
-	void Scope::Adopt(Scope& newChild, const std::string& childName) {
+	void Scope::Adopt(Scope& newChild, std::string_view childName) {
 #ifdef USE_EXCEPTIONS
 		if (this == &newChild) throw std::runtime_error("Cannot adopt self.");
 		if (IsDescendantOf(newChild)) throw std::runtime_error("Cannot adopt an ancestor Scope.");
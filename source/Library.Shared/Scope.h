@@ -6,6 +6,7 @@
 
 #include <cstddef>
 #include <string>
+#include <string_view>
 #include <cassert>
 #include <stdexcept>
 #include "gsl/gsl"
@@ -23,7 +24,8 @@ namespace FIEAGameEngine {
 		/// Default constructor for a Scope. If no size is given, it will default to zero.
 		/// </summary>
 		/// <param name="size">The initial capacity of the scope.</param>
-		explicit Scope(std::size_t size = 0);
+		/// <param name="resource">The resource the Scope's attribute table, its Datums' storage and the children made by AppendScope are allocated from, or nullptr for the default resource.</param>
+		explicit Scope(std::size_t size = 0, MemoryResource* resource = nullptr);
 		/// <summary>
 		/// A copy constructor for a Scope that performs a deep copy during construction.
 		/// </summary>
@@ -42,6 +44,7 @@ namespace FIEAGameEngine {
 		Scope& operator=(const Scope& rhs);
 		/// <summary>
 		/// The move assignment operator for a Scope that first clears the existing elements and then performs a move assignment.
+		/// If the two Scopes allocate from resources that are not equal, the attributes are moved one by one into this Scope's resource.
 		/// </summary>
 		/// <param name="rhs">The Scope to copy</param>
 		/// <returns>A reference to the updated Scope</returns>
@@ -61,32 +64,44 @@ namespace FIEAGameEngine {
 		/// </summary>
 		/// <param name="key">The string key to look for.</param>
 		/// <returns>The address of the Datum associated with the key.</returns>
-		[[nodiscard]] Datum* Find(const std::string& key);
+		[[nodiscard]] Datum* Find(std::string_view key);
 		/// <summary>
 		/// Find the Datum associated with the given key within this Scope. Returns nullptr if not found.
 		/// </summary>
 		/// <param name="key">The string key to look for.</param>
 		/// <returns>The address of the constant Datum associated with the key.</returns>
-		[[nodiscard]] const Datum* Find(const std::string& key) const;
+		[[nodiscard]] const Datum* Find(std::string_view key) const;
 		/// <summary>
 		/// Find the Datum associated with the given key within the closest related Scope, starting with this one and moving up the hierarchy. Returns nullptr if not found.
 		/// </summary>
 		/// <param name="key">The string key to look for.</param>
 		/// <returns>The address of the Datum associated with the key.</returns>
-		[[nodiscard]] Datum* Search(const std::string& key);
+		[[nodiscard]] Datum* Search(std::string_view key);
 		/// <summary>
 		/// Find the Datum associated with the given key within the closest related Scope, starting with this one and moving up the hierarchy. Returns nullptr if not found.
 		/// </summary>
 		/// <param name="key">The string key to look for.</param>
 		/// <param name="foundScope">Output parameter indicating the Scope in which the Datum was found.</param>
 		/// <returns>The address of the Datum associated with the key.</returns>
-		[[nodiscard]] Datum* Search(const std::string& key, Scope*& foundScope);
+		[[nodiscard]] Datum* Search(std::string_view key, Scope*& foundScope);
 
 		/// <summary>
 		/// Get the current size of the Scope.
 		/// </summary>
 		/// <returns>The current size of the Scope.</returns>
 		[[nodiscard]] std::size_t Size() const;
+		/// <summary>
+		/// Retrieve the resource the Scope allocates its attributes from.
+		/// </summary>
+		/// <returns>A pointer to the Scope's resource.</returns>
+		[[nodiscard]] MemoryResource* GetResource() const;
+#ifdef USE_HASHMAP_STATISTICS
+		/// <summary>
+		/// Get the statistics of the map holding this Scope's attributes, to spot Scopes whose lookups have degenerated.
+		/// </summary>
+		/// <returns>A snapshot of the attribute map's statistics.</returns>
+		[[nodiscard]] HashMapStatistics GetAttributeStatistics() const;
+#endif // USE_HASHMAP_STATISTICS
 		/// <summary>
 		/// Check if the Scope is currently empty.
 		/// </summary>
@@ -102,19 +117,19 @@ namespace FIEAGameEngine {
 		/// </summary>
 		/// <param name="key">The string name to append on.</param>
 		/// <returns>The Datum, either newly created or preexisting, associated with the key.</returns>
-		Datum& Append(const std::string& key);
+		Datum& Append(std::string_view key);
 		/// <summary>
 		/// Create a new nested Scope and append it to the Scope, associating it with the given key. The created Scope is owned by the parent Scope.
 		/// </summary>
 		/// <param name="key">The string key to append on.</param>
 		/// <returns>A reference to the newly created Scope.</returns>
-		Scope& AppendScope(const std::string& key);
+		Scope& AppendScope(std::string_view key);
 		/// <summary>
 		/// Transfer ownership of a heap allocated Scope to belong to this Scope.
 		/// </summary>
 		/// <param name="newChild">The heap allocated Scope.</param>
 		/// <param name="childName">The string key to associate with the new child Scope.</param>
-		void Adopt(Scope& newChild, const std::string& childName);
+		void Adopt(Scope& newChild, std::string_view childName);
 		/// <summary>
 		/// Release ownership of this Scope, removing the reference to this scope from its parent if it has one.
 		/// </summary>
@@ -143,19 +158,19 @@ namespace FIEAGameEngine {
 		/// </summary>
 		/// <param name="key">The string name to look up.</param>
 		/// <returns>The Datum associated with the key.</returns>
-		[[nodiscard]] Datum& At(const std::string& key);
+		[[nodiscard]] Datum& At(std::string_view key);
 		/// <summary>
 		/// Accesses the Datum at the given key.
 		/// </summary>
 		/// <param name="key">The string name to look up.</param>
 		/// <returns>The const Datum associated with the key.</returns>
-		[[nodiscard]] const Datum& At(const std::string& key) const;
+		[[nodiscard]] const Datum& At(std::string_view key) const;
 		/// <summary>
 		/// A wrapper for Append - Append an empty Datum with the given name to the Scope. If the given name already exists as an entry in the Scope, it will return the existing Datum and perform no insert.
 		/// </summary>
 		/// <param name="key">The string name to append on</param>
 		/// <returns>The Datum, either newly created or preexisting, associated with the key.</returns>
-		[[nodiscard]] Datum& operator[](const std::string& key);
+		[[nodiscard]] Datum& operator[](std::string_view key);
 		/// <summary>
 		/// Retrieve a Datum given its position in the order vector.
 		/// </summary>
@@ -203,9 +218,9 @@ namespace FIEAGameEngine {
 		/// </summary>
 		Scope* _parent{ nullptr };
 		/// <summary>
-		/// The map of Datums to their string names.
+		/// The map of Datums to their string names. Hash codes are stored per entry so that lookups in large Scopes rarely compare strings.
 		/// </summary>
-		HashMap<std::string, Datum> _attributes;
+		HashMap<std::string, Datum, StoredHash<DefaultHash<std::string>>> _attributes;
 
 		/// <summary>
 		/// A helper function to deep copy a Scope.
@@ -14,7 +14,7 @@ namespace FIEAGameEngine {
 		return _orderVector.IsEmpty();
 	}
 
-	inline Datum* Scope::Search(const std::string& key) {
+	inline Datum* Scope::Search(std::string_view key) {
 		Scope* dummy = nullptr;
 		return Search(key, dummy);
 	}
@@ -23,6 +23,16 @@ namespace FIEAGameEngine {
 		return _orderVector.Size();
 	}
 
+	inline MemoryResource* Scope::GetResource() const {
+		return _orderVector.GetResource();
+	}
+
+#ifdef USE_HASHMAP_STATISTICS
+	inline HashMapStatistics Scope::GetAttributeStatistics() const {
+		return _attributes.GetStatistics();
+	}
+#endif // USE_HASHMAP_STATISTICS
+
 	inline Scope* Scope::GetParent() const {
 		return _parent;
 	}
@@ -31,15 +41,15 @@ namespace FIEAGameEngine {
 		return otherScope.IsAncestorOf(*this);
 	}
 
-	inline Datum& Scope::At(const std::string& key) {
+	inline Datum& Scope::At(std::string_view key) {
 		return _attributes.At(key);
 	}
 
-	inline const Datum& Scope::At(const std::string& key) const {
+	inline const Datum& Scope::At(std::string_view key) const {
 		return _attributes.At(key);
 	}
 
-	inline Datum& Scope::operator[](const std::string& key) {
+	inline Datum& Scope::operator[](std::string_view key) {
 		return Append(key);
 	}
 
@@ -0,0 +1,317 @@
+/// <summary>
+/// The declaration of the templated class SmallVector, a Vector that keeps its first few elements inside the object itself.
+/// </summary>
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <cassert>
+#include <algorithm>
+#include <initializer_list>
+#include <stdexcept>
+#include <DefaultEquality.h>
+#include "GrowthPolicy.h"
+#include "TriviallyRelocatable.h"
+#include "gsl/gsl"
+
+namespace FIEAGameEngine {
+	/// <summary>
+	/// A templated vector container with the same interface as Vector that stores up to N elements in a buffer inside the SmallVector itself.
+	/// Only when a SmallVector grows past N elements does it move its contents to the heap, after which it grows like a Vector. ShrinkToFit moves the elements back inline once they fit again.
+	/// Intended for short, frequently touched lists (pending subscriber lists, parse stacks, helper lists) where a heap allocation would cost more than the work done on the list.
+	/// Iterators are bare pointers into the current storage and are invalidated by anything that changes the SmallVector's capacity, including moving the SmallVector while its elements are inline.
+	/// </summary>
+	/// <typeparam name="T">The type of object the SmallVector contains.</typeparam>
+	/// <typeparam name="N">The number of elements stored inline before the SmallVector allocates.</typeparam>
+	template <typename T, std::size_t N>
+	class SmallVector final {
+		static_assert(N > 0, "A SmallVector must have room for at least one inline element.");
+
+	public:
+		using size_type = std::size_t;
+		using value_type = T;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using rvalue_reference = T&&;
+		using Iterator = value_type*;
+		using ConstIterator = const value_type*;
+
+		/// <summary>
+		/// Default constructor for a SmallVector. Its elements are stored inline, and its size is zero.
+		/// </summary>
+		/// <param name="capacity">The capacity to reserve. A capacity no greater than N does not allocate.</param>
+		explicit SmallVector(size_type capacity = size_type(0));
+		/// <summary>
+		/// An Initializer list constructor for SmallVector. The items will be pushed back in the same order as given into this function.
+		/// </summary>
+		/// <param name="list">A set of items to add to a SmallVector as it's being constructed</param>
+		SmallVector(std::initializer_list<value_type> list);
+		/// <summary>
+		/// A copy constructor for a SmallVector that performs a deep copy during construction.
+		/// </summary>
+		/// <param name="rhs">The SmallVector to copy</param>
+		SmallVector(const SmallVector& rhs);
+		/// <summary>
+		/// The move constructor for SmallVector. Heap storage is taken over as is; inline elements are moved one by one.
+		/// </summary>
+		/// <param name="rhs">The SmallVector to move data from</param>
+		SmallVector(SmallVector&& rhs) noexcept;
+		/// <summary>
+		/// The copy assignment operator for a SmallVector that first clears the existing elements and then performs a deep copy.
+		/// </summary>
+		/// <param name="rhs">The SmallVector to copy</param>
+		/// <returns>A reference to the updated SmallVector</returns>
+		SmallVector& operator=(const SmallVector& rhs);
+		/// <summary>
+		/// The move assignment operator for SmallVector. Heap storage is taken over as is; inline elements are moved one by one.
+		/// </summary>
+		/// <param name="rhs">The SmallVector to move data from</param>
+		/// <returns>A reference to the updated SmallVector</returns>
+		SmallVector& operator=(SmallVector&& rhs) noexcept;
+		/// <summary>
+		/// The destructor for SmallVector destroys each element and frees any heap storage.
+		/// </summary>
+		~SmallVector();
+
+		/// <summary>
+		/// Bracket Access Operator that returns a reference to the item at the specified index.
+		/// </summary>
+		/// <param name="index">The index to retrieve.</param>
+		/// <returns>A reference to the item at the specified index.</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the index is out of bounds of the size of the SmallVector.</exception>
+		[[nodiscard]] reference operator[](size_type index);
+		/// <summary>
+		/// Bracket Access Operator that returns a constant reference to the item at the specified index.
+		/// </summary>
+		/// <param name="index">The index to retrieve.</param>
+		/// <returns>A constant reference to the item at the specified index.</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the index is out of bounds of the size of the SmallVector.</exception>
+		[[nodiscard]] const_reference operator[](size_type index) const;
+		/// <summary>
+		/// At Access Operator that returns a reference to the item at the specified index.
+		/// </summary>
+		/// <param name="index">The index to retrieve.</param>
+		/// <returns>A reference to the item at the specified index.</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the index is out of bounds of the size of the SmallVector.</exception>
+		[[nodiscard]] reference At(size_type index);
+		/// <summary>
+		/// At Access Operator that returns a constant reference to the item at the specified index.
+		/// </summary>
+		/// <param name="index">The index to retrieve.</param>
+		/// <returns>A constant reference to the item at the specified index.</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the index is out of bounds of the size of the SmallVector.</exception>
+		[[nodiscard]] const_reference At(size_type index) const;
+
+		/// <summary>
+		/// Retrieve the size of the SmallVector.
+		/// </summary>
+		/// <returns>A size_type representing the current size of the SmallVector.</returns>
+		[[nodiscard]] size_type Size() const;
+		/// <summary>
+		/// Retrieve the capacity of the SmallVector. This is never less than N.
+		/// </summary>
+		/// <returns>A size_type representing the current capacity of the SmallVector.</returns>
+		[[nodiscard]] size_type Capacity() const;
+		/// <summary>
+		/// Determine if the SmallVector is currently empty.
+		/// </summary>
+		/// <returns>A boolean indicating whether this SmallVector is currently empty or not.</returns>
+		[[nodiscard]] bool IsEmpty() const;
+		/// <summary>
+		/// Determine if the SmallVector's elements are currently stored inside the SmallVector rather than on the heap.
+		/// </summary>
+		/// <returns>A boolean indicating whether this SmallVector is using its inline storage.</returns>
+		[[nodiscard]] bool IsInline() const;
+
+		/// <summary>
+		/// Increase the capacity of the SmallVector up to the specified amount. If the specified amount is not greater than the current capacity, no work is done.
+		/// </summary>
+		/// <param name="capacity">The increased capacity for the SmallVector.</param>
+		void Reserve(size_type capacity);
+		/// <summary>
+		/// Decrease the capacity of the SmallVector to match its size, moving the elements back inline if they fit. If the capacity is not greater than the size, no work is done.
+		/// </summary>
+		void ShrinkToFit();
+		/// <summary>
+		/// Remove all elements from the SmallVector. Does not reduce the SmallVector's capacity.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Get an Iterator pointing to the start of the SmallVector.
+		/// </summary>
+		/// <returns>An Iterator pointing to the first element in the SmallVector</returns>
+		[[nodiscard]] Iterator begin();
+		/// <summary>
+		/// Get an Iterator pointing past the end of the SmallVector.
+		/// </summary>
+		/// <returns>An Iterator pointing past the last element in the SmallVector</returns>
+		[[nodiscard]] Iterator end();
+		/// <summary>
+		/// Get a ConstIterator pointing to the start of the SmallVector.
+		/// </summary>
+		/// <returns>A ConstIterator pointing to the first element in the SmallVector</returns>
+		[[nodiscard]] ConstIterator begin() const;
+		/// <summary>
+		/// Get a ConstIterator pointing past the end of the SmallVector.
+		/// </summary>
+		/// <returns>A ConstIterator pointing past the last element in the SmallVector</returns>
+		[[nodiscard]] ConstIterator end() const;
+		/// <summary>
+		/// Get a ConstIterator pointing to the start of the SmallVector.
+		/// </summary>
+		/// <returns>A ConstIterator pointing to the first element in the SmallVector</returns>
+		[[nodiscard]] ConstIterator cbegin() const;
+		/// <summary>
+		/// Get a ConstIterator pointing past the end of the SmallVector.
+		/// </summary>
+		/// <returns>A ConstIterator pointing past the last element in the SmallVector</returns>
+		[[nodiscard]] ConstIterator cend() const;
+
+		/// <summary>
+		/// Retrieve the first item in the SmallVector.
+		/// </summary>
+		/// <returns>A reference to the first item in the SmallVector.</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the SmallVector is empty.</exception>
+		[[nodiscard]] reference Front();
+		/// <summary>
+		/// Retrieve the first item in the SmallVector.
+		/// </summary>
+		/// <returns>A constant reference to the first item in the SmallVector.</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the SmallVector is empty.</exception>
+		[[nodiscard]] const_reference Front() const;
+		/// <summary>
+		/// Retrieve the last item in the SmallVector.
+		/// </summary>
+		/// <returns>A reference to the last item in the SmallVector.</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the SmallVector is empty.</exception>
+		[[nodiscard]] reference Back();
+		/// <summary>
+		/// Retrieve the last item in the SmallVector.
+		/// </summary>
+		/// <returns>A constant reference to the last item in the SmallVector.</returns>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the SmallVector is empty.</exception>
+		[[nodiscard]] const_reference Back() const;
+
+		/// <summary>
+		/// Retrieve a pointer to the SmallVector's contiguous storage, inline or on the heap.
+		/// </summary>
+		/// <returns>A pointer to the first element of the SmallVector.</returns>
+		[[nodiscard]] value_type* Data();
+		/// <summary>
+		/// Retrieve a pointer to the SmallVector's contiguous storage, inline or on the heap.
+		/// </summary>
+		/// <returns>A constant pointer to the first element of the SmallVector.</returns>
+		[[nodiscard]] const value_type* Data() const;
+		/// <summary>
+		/// View the SmallVector's elements as a span.
+		/// </summary>
+		/// <returns>A span over the SmallVector's elements, invalidated by anything that changes the SmallVector's capacity.</returns>
+		[[nodiscard]] gsl::span<value_type> AsSpan();
+		/// <summary>
+		/// View the SmallVector's elements as a span.
+		/// </summary>
+		/// <returns>A span over the SmallVector's constant elements, invalidated by anything that changes the SmallVector's capacity.</returns>
+		[[nodiscard]] gsl::span<const value_type> AsSpan() const;
+
+		/// <summary>
+		/// Find an item within the SmallVector.
+		/// </summary>
+		/// <param name="data">The item to look for.</param>
+		/// <param name="equalityFunctor">The functor used to compare items.</param>
+		/// <returns>A ConstIterator pointing to the first matching item, or to end() if it was not found.</returns>
+		template <typename EqualityFunctor = DefaultEquality<value_type>>
+		[[nodiscard]] ConstIterator Find(const_reference data, EqualityFunctor equalityFunctor = EqualityFunctor{}) const;
+		/// <summary>
+		/// Find an item within the SmallVector.
+		/// </summary>
+		/// <param name="data">The item to look for.</param>
+		/// <param name="equalityFunctor">The functor used to compare items.</param>
+		/// <returns>An Iterator pointing to the first matching item, or to end() if it was not found.</returns>
+		template <typename EqualityFunctor = DefaultEquality<value_type>>
+		[[nodiscard]] Iterator Find(const_reference data, EqualityFunctor equalityFunctor = EqualityFunctor{});
+
+		/// <summary>
+		/// Add an item to the end of the SmallVector, moving to the heap if the inline storage is full.
+		/// </summary>
+		/// <param name="data">The item to copy into the SmallVector.</param>
+		/// <returns>An Iterator pointing to the added item.</returns>
+		Iterator PushBack(const_reference data);
+		/// <summary>
+		/// Add an item to the end of the SmallVector, moving to the heap if the inline storage is full.
+		/// </summary>
+		/// <param name="data">The item to move into the SmallVector.</param>
+		/// <returns>An Iterator pointing to the added item.</returns>
+		Iterator PushBack(rvalue_reference data);
+
+		/// <summary>
+		/// Remove the first item matching the given data from the SmallVector.
+		/// </summary>
+		/// <param name="data">The item to remove.</param>
+		/// <param name="equalityFunctor">The functor used to compare items.</param>
+		/// <returns>A boolean indicating whether an item was removed.</returns>
+		template <typename EqualityFunctor = DefaultEquality<value_type>>
+		bool Remove(const_reference data, EqualityFunctor equalityFunctor = EqualityFunctor{});
+		/// <summary>
+		/// Remove the item the given Iterator points at from the SmallVector.
+		/// </summary>
+		/// <param name="iter">An Iterator pointing at the item to remove.</param>
+		/// <returns>A boolean indicating whether an item was removed.</returns>
+		bool Remove(const Iterator& iter);
+		/// <summary>
+		/// Remove the items in the range [iterFirst, iterLast) from the SmallVector.
+		/// </summary>
+		/// <param name="iterFirst">An Iterator pointing at the first item to remove.</param>
+		/// <param name="iterLast">An Iterator pointing past the last item to remove.</param>
+		/// <returns>A boolean indicating whether any items were removed.</returns>
+		bool Remove(const Iterator& iterFirst, const Iterator& iterLast);
+		/// <summary>
+		/// Remove the last item in the SmallVector.
+		/// </summary>
+		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the SmallVector is empty.</exception>
+		void PopBack();
+
+	private:
+		/// <summary>
+		/// Retrieve a pointer to the inline storage.
+		/// </summary>
+		/// <returns>A pointer to the first inline element.</returns>
+		[[nodiscard]] value_type* InlineData();
+		/// <summary>
+		/// Move the SmallVector's elements into storage for exactly the given number of elements, inline if it is no greater than N, and on the heap otherwise.
+		/// </summary>
+		/// <param name="capacity">The new capacity, which must be at least the current size.</param>
+		void Reallocate(size_type capacity);
+		/// <summary>
+		/// Move the elements of another SmallVector into this empty, inline SmallVector, taking over its heap storage if it has any.
+		/// </summary>
+		/// <param name="rhs">The SmallVector to move data from. It is left empty and inline.</param>
+		void MoveFrom(SmallVector& rhs) noexcept;
+		/// <summary>
+		/// Destroy every element and release any heap storage, leaving the SmallVector empty and inline.
+		/// </summary>
+		void Release();
+
+		/// <summary>
+		/// The storage for the first N elements.
+		/// </summary>
+		alignas(value_type) std::byte _inlineStorage[N * sizeof(value_type)];
+		/// <summary>
+		/// The storage currently in use, which is either the inline storage or a heap block.
+		/// </summary>
+		value_type* _data{ reinterpret_cast<value_type*>(_inlineStorage) };
+		/// <summary>
+		/// The number of elements in the SmallVector.
+		/// </summary>
+		size_type _size{ 0 };
+		/// <summary>
+		/// The number of elements the current storage can hold.
+		/// </summary>
+		size_type _capacity{ N };
+	};
+}
+
+#include "SmallVector.inl"
@@ -0,0 +1,363 @@
+/// <summary>
+/// The fully specified implementation of the templated class SmallVector.
+/// </summary>
+
+#pragma once
+#include "SmallVector.h"
+
+namespace FIEAGameEngine {
+	template<typename T, std::size_t N>
+	inline SmallVector<T, N>::SmallVector(size_type capacity) {
+		Reserve(capacity);
+	}
+
+	template<typename T, std::size_t N>
+	inline SmallVector<T, N>::SmallVector(std::initializer_list<value_type> list) {
+		Reserve(list.size());
+		for (const_reference value : list) {
+			PushBack(value);
+		}
+	}
+
+	template<typename T, std::size_t N>
+	SmallVector<T, N>::SmallVector(const SmallVector& rhs) {
+		Reserve(rhs._size);
+		for (const_reference value : rhs) {
+			PushBack(value);
+		}
+	}
+
+	template<typename T, std::size_t N>
+	SmallVector<T, N>::SmallVector(SmallVector&& rhs) noexcept {
+		MoveFrom(rhs);
+	}
+
+	template<typename T, std::size_t N>
+	SmallVector<T, N>& SmallVector<T, N>::operator=(const SmallVector& rhs) {
+		if (this != &rhs) {
+			Clear();
+			Reserve(rhs._size);
+			for (const_reference value : rhs) {
+				PushBack(value);
+			}
+		}
+		return *this;
+	}
+
+	template<typename T, std::size_t N>
+	SmallVector<T, N>& SmallVector<T, N>::operator=(SmallVector&& rhs) noexcept {
+		if (this != &rhs) {
+			Release();
+			MoveFrom(rhs);
+		}
+		return *this;
+	}
+
+	template<typename T, std::size_t N>
+	inline SmallVector<T, N>::~SmallVector() {
+		Release();
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::reference SmallVector<T, N>::operator[](size_type index) {
+		return At(index);
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::const_reference SmallVector<T, N>::operator[](size_type index) const {
+		return At(index);
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::reference SmallVector<T, N>::At(size_type index) {
+#ifdef USE_EXCEPTIONS
+		if (index >= _size) throw std::runtime_error("Index is out of bounds.");
+#endif // USE_EXCEPTIONS
+		return _data[index];
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::const_reference SmallVector<T, N>::At(size_type index) const {
+#ifdef USE_EXCEPTIONS
+		if (index >= _size) throw std::runtime_error("Index is out of bounds.");
+#endif // USE_EXCEPTIONS
+		return _data[index];
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::size_type SmallVector<T, N>::Size() const {
+		return _size;
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::size_type SmallVector<T, N>::Capacity() const {
+		return _capacity;
+	}
+
+	template<typename T, std::size_t N>
+	inline bool SmallVector<T, N>::IsEmpty() const {
+		return (_size == size_type(0));
+	}
+
+	template<typename T, std::size_t N>
+	inline bool SmallVector<T, N>::IsInline() const {
+		return (_data == reinterpret_cast<const value_type*>(_inlineStorage));
+	}
+
+	template<typename T, std::size_t N>
+	inline void SmallVector<T, N>::Reserve(size_type capacity) {
+		if (capacity > _capacity) {
+			Reallocate(capacity);
+		}
+	}
+
+	template<typename T, std::size_t N>
+	inline void SmallVector<T, N>::ShrinkToFit() {
+		if (!IsInline() && _capacity > _size) {
+			Reallocate(std::max(_size, N));
+		}
+	}
+
+	template<typename T, std::size_t N>
+	inline void SmallVector<T, N>::Clear() {
+		for (size_type i = 0; i < _size; ++i) {
+			_data[i].~value_type();
+		}
+		_size = 0;
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::Iterator SmallVector<T, N>::begin() {
+		return _data;
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::Iterator SmallVector<T, N>::end() {
+		return _data + _size;
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::ConstIterator SmallVector<T, N>::begin() const {
+		return _data;
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::ConstIterator SmallVector<T, N>::end() const {
+		return _data + _size;
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::ConstIterator SmallVector<T, N>::cbegin() const {
+		return _data;
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::ConstIterator SmallVector<T, N>::cend() const {
+		return _data + _size;
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::reference SmallVector<T, N>::Front() {
+#ifdef USE_EXCEPTIONS
+		if (_size == 0) throw std::runtime_error("SmallVector is empty.");
+#endif // USE_EXCEPTIONS
+		return _data[0];
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::const_reference SmallVector<T, N>::Front() const {
+#ifdef USE_EXCEPTIONS
+		if (_size == 0) throw std::runtime_error("SmallVector is empty.");
+#endif // USE_EXCEPTIONS
+		return _data[0];
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::reference SmallVector<T, N>::Back() {
+#ifdef USE_EXCEPTIONS
+		if (_size == 0) throw std::runtime_error("SmallVector is empty.");
+#endif // USE_EXCEPTIONS
+		return _data[_size - 1];
+	}
+
+	template<typename T, std::size_t N>
+	inline typename SmallVector<T, N>::const_reference SmallVector<T, N>::Back() const {
+#ifdef USE_EXCEPTIONS
+		if (_size == 0) throw std::runtime_error("SmallVector is empty.");
+#endif // USE_EXCEPTIONS
+		return _data[_size - 1];
+	}
+
+	template<typename T, std::size_t N>
+	inline T* SmallVector<T, N>::Data() {
+		return _data;
+	}
+
+	template<typename T, std::size_t N>
+	inline const T* SmallVector<T, N>::Data() const {
+		return _data;
+	}
+
+	template<typename T, std::size_t N>
+	inline gsl::span<T> SmallVector<T, N>::AsSpan() {
+		return gsl::span<value_type>(_data, _size);
+	}
+
+	template<typename T, std::size_t N>
+	inline gsl::span<const T> SmallVector<T, N>::AsSpan() const {
+		return gsl::span<const value_type>(_data, _size);
+	}
+
+	template<typename T, std::size_t N>
+	template<typename EqualityFunctor>
+	inline typename SmallVector<T, N>::ConstIterator SmallVector<T, N>::Find(const_reference data, EqualityFunctor equalityFunctor) const {
+		for (ConstIterator current = begin(); current != end(); ++current) {
+			if (equalityFunctor(*current, data)) return current;
+		}
+		return end();
+	}
+
+	template<typename T, std::size_t N>
+	template<typename EqualityFunctor>
+	inline typename SmallVector<T, N>::Iterator SmallVector<T, N>::Find(const_reference data, EqualityFunctor equalityFunctor) {
+		for (Iterator current = begin(); current != end(); ++current) {
+			if (equalityFunctor(*current, data)) return current;
+		}
+		return end();
+	}
+
+	template<typename T, std::size_t N>
+	typename SmallVector<T, N>::Iterator SmallVector<T, N>::PushBack(const_reference data) {
+		if (_size == _capacity) {
+			Reallocate(NextCapacity(DefaultGrowth{}, _capacity, sizeof(value_type)));
+		}
+		new (_data + _size) value_type(data);
+		return _data + _size++;
+	}
+
+	template<typename T, std::size_t N>
+	typename SmallVector<T, N>::Iterator SmallVector<T, N>::PushBack(rvalue_reference data) {
+		if (_size == _capacity) {
+			Reallocate(NextCapacity(DefaultGrowth{}, _capacity, sizeof(value_type)));
+		}
+		new (_data + _size) value_type(std::forward<value_type>(data));
+		return _data + _size++;
+	}
+
+	template<typename T, std::size_t N>
+	template<typename EqualityFunctor>
+	inline bool SmallVector<T, N>::Remove(const_reference data, EqualityFunctor equalityFunctor) {
+		return Remove(Find(data, equalityFunctor));
+	}
+
+	template<typename T, std::size_t N>
+	inline bool SmallVector<T, N>::Remove(const Iterator& iter) {
+		return Remove(iter, iter + 1);
+	}
+
+	template<typename T, std::size_t N>
+	bool SmallVector<T, N>::Remove(const Iterator& iterFirst, const Iterator& iterLast) {
+		if (iterFirst < _data || iterLast > _data + _size || iterLast <= iterFirst) return false;
+
+		size_type first = static_cast<size_type>(iterFirst - _data);
+		size_type last = static_cast<size_type>(iterLast - _data);
+		size_type shiftAmount = (_size - last);
+		for (size_type i = first; i < last; ++i) {
+			_data[i].~value_type();
+		}
+		_size -= (last - first);
+
+		if constexpr (IsTriviallyRelocatableV<value_type>) {
+			std::memmove(static_cast<void*>(_data + first), static_cast<const void*>(_data + last), shiftAmount * sizeof(value_type));
+		}
+		else {
+			for (size_type i = 0; i < shiftAmount; ++i) {
+				new (_data + first + i) value_type(std::move(_data[last + i]));
+				_data[last + i].~value_type();
+			}
+		}
+
+		return true;
+	}
+
+	template<typename T, std::size_t N>
+	inline void SmallVector<T, N>::PopBack() {
+#ifdef USE_EXCEPTIONS
+		if (_size == 0) throw std::runtime_error("SmallVector is empty.");
+#endif // USE_EXCEPTIONS
+		if (_size > 0) {
+			_data[--_size].~value_type();
+		}
+	}
+
+	template<typename T, std::size_t N>
+	inline T* SmallVector<T, N>::InlineData() {
+		return reinterpret_cast<value_type*>(_inlineStorage);
+	}
+
+	template<typename T, std::size_t N>
+	void SmallVector<T, N>::Reallocate(size_type capacity) {
+		assert(capacity >= _size && capacity >= N);
+		bool wasInline = IsInline();
+		if (capacity == N && wasInline) return;
+
+		if constexpr (IsTriviallyRelocatableV<value_type>) {
+			if (!wasInline && capacity > N) {
+				value_type* data = reinterpret_cast<value_type*>(realloc(_data, capacity * sizeof(value_type)));
+				assert(data != nullptr);
+				_data = data;
+				_capacity = capacity;
+				return;
+			}
+		}
+
+		value_type* data = (capacity > N) ? reinterpret_cast<value_type*>(malloc(capacity * sizeof(value_type))) : InlineData();
+		assert(data != nullptr);
+		if constexpr (IsTriviallyRelocatableV<value_type>) {
+			if (_size > 0) {
+				std::memcpy(static_cast<void*>(data), static_cast<const void*>(_data), _size * sizeof(value_type));
+			}
+		}
+		else {
+			for (size_type i = 0; i < _size; ++i) {
+				new (data + i) value_type(std::move(_data[i]));
+				_data[i].~value_type();
+			}
+		}
+		if (!wasInline) {
+			free(_data);
+		}
+		_data = data;
+		_capacity = capacity;
+	}
+
+	template<typename T, std::size_t N>
+	void SmallVector<T, N>::MoveFrom(SmallVector& rhs) noexcept {
+		assert(IsInline() && _size == 0);
+		if (rhs.IsInline()) {
+			for (size_type i = 0; i < rhs._size; ++i) {
+				new (_data + i) value_type(std::move(rhs._data[i]));
+				rhs._data[i].~value_type();
+			}
+			_size = rhs._size;
+		}
+		else {
+			_data = rhs._data;
+			_size = rhs._size;
+			_capacity = rhs._capacity;
+			rhs._data = rhs.InlineData();
+			rhs._capacity = N;
+		}
+		rhs._size = 0;
+	}
+
+	template<typename T, std::size_t N>
+	void SmallVector<T, N>::Release() {
+		Clear();
+		if (!IsInline()) {
+			free(_data);
+			_data = InlineData();
+			_capacity = N;
+		}
+	}
+}
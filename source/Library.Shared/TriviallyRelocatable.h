@@ -0,0 +1,33 @@
+/// <summary>
+/// The declaration of the IsTriviallyRelocatable trait, which lets containers move elements to new storage with a byte copy.
+/// </summary>
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+
+namespace FIEAGameEngine {
+	/// <summary>
+	/// Trait detecting whether an object can be moved to new storage by copying its bytes and abandoning the old ones, without running a move constructor or destructor.
+	/// Containers that relocate their elements (i.e. Vector growing with realloc or shifting with memmove) only take that fast path for types where this is true, and move-construct and destroy element by element otherwise.
+	/// Defaults to true for trivially copyable types such as integers, pointers and glm vectors and matrices. Types that hold no pointers into themselves may opt in with a specialization.
+	/// Types that point into their own storage, like std::string with a small buffer, must not opt in.
+	/// </summary>
+	/// <typeparam name="T">The type to inspect.</typeparam>
+	template <typename T>
+	struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+	template <typename T>
+	struct IsTriviallyRelocatable<std::unique_ptr<T>> : std::true_type {};
+
+	template <typename T>
+	struct IsTriviallyRelocatable<std::shared_ptr<T>> : std::true_type {};
+
+	/// <summary>
+	/// Shorthand for IsTriviallyRelocatable&lt;T&gt;::value.
+	/// </summary>
+	/// <typeparam name="T">The type to inspect.</typeparam>
+	template <typename T>
+	inline constexpr bool IsTriviallyRelocatableV = IsTriviallyRelocatable<T>::value;
+}
@@ -12,11 +12,19 @@ namespace FIEAGameEngine {
 	}
 
 	bool TypeManager::Add(RTTI::IdType typeID, const Vector<Signature>& signatures) {
-		return _signatures.Insert({ typeID, signatures }).second;
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		std::unique_lock<std::shared_mutex> lock(_frozenMutex);
+#endif // USE_THREAD_SAFE_REGISTRIES
+		Thaw();
+		return _signatures.TryEmplace(typeID, signatures).second;
 	}
 
 	bool TypeManager::Add(RTTI::IdType typeID, Vector<Signature>&& signatures) {
-		return _signatures.Insert({typeID, std::move(signatures) }).second;
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		std::unique_lock<std::shared_mutex> lock(_frozenMutex);
+#endif // USE_THREAD_SAFE_REGISTRIES
+		Thaw();
+		return _signatures.TryEmplace(typeID, std::move(signatures)).second;
 	}
 
 	bool TypeManager::Add(RTTI::IdType typeID, RTTI::IdType parentID, const Vector<Signature>& signatures) {
@@ -24,9 +32,14 @@ namespace FIEAGameEngine {
 		if (!ContainsSignature(parentID)) throw std::runtime_error("Given parent ID is not registered in the Type Manager.");
 #endif // USE_EXCEPTIONS
 
-		bool added = _signatures.Insert({ typeID, signatures }).second;
-		if(added) AddInheritedSignatures(typeID, parentID);
-		return added;
+		if (ContainsSignature(typeID)) return false;
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		std::unique_lock<std::shared_mutex> lock(_frozenMutex);
+#endif // USE_THREAD_SAFE_REGISTRIES
+		Thaw();
+		Vector<Signature> childSignatures(signatures);
+		AddInheritedSignatures(childSignatures, parentID);
+		return _signatures.TryEmplace(typeID, std::move(childSignatures)).second;
 	}
 
 	bool TypeManager::Add(RTTI::IdType typeID, RTTI::IdType parentID, Vector<Signature>&& signatures) {
@@ -34,35 +47,92 @@ namespace FIEAGameEngine {
 		if (!ContainsSignature(parentID)) throw std::runtime_error("Given parent ID is not registered in the Type Manager.");
 #endif // USE_EXCEPTIONS
 
-		bool added = _signatures.Insert({ typeID, std::move(signatures) }).second;
-		if(added) AddInheritedSignatures(typeID, parentID);
-		return added;
+		if (ContainsSignature(typeID)) return false;
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		std::unique_lock<std::shared_mutex> lock(_frozenMutex);
+#endif // USE_THREAD_SAFE_REGISTRIES
+		Thaw();
+		AddInheritedSignatures(signatures, parentID);
+		return _signatures.TryEmplace(typeID, std::move(signatures)).second;
 	}
 
 	void TypeManager::Remove(RTTI::IdType typeID) {
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		std::unique_lock<std::shared_mutex> lock(_frozenMutex);
+#endif // USE_THREAD_SAFE_REGISTRIES
+		Thaw();
 		_signatures.Remove(typeID);
 	}
 
 	void TypeManager::Clear() {
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		std::unique_lock<std::shared_mutex> lock(_frozenMutex);
+#endif // USE_THREAD_SAFE_REGISTRIES
+		Thaw();
 		_signatures.Clear();
 	}
 
+	void TypeManager::Freeze() {
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		std::unique_lock<std::shared_mutex> lock(_frozenMutex);
+#endif // USE_THREAD_SAFE_REGISTRIES
+		Vector<std::pair<const RTTI::IdType, const Vector<Signature>*>> entries(_signatures.Size());
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		_signatures.ForEach([&entries](const auto& entry) { entries.PushBack({ entry.first, &entry.second }); });
+#else
+		for (const auto& entry : _signatures) {
+			entries.PushBack({ entry.first, &entry.second });
+		}
+#endif // USE_THREAD_SAFE_REGISTRIES
+
+		_frozenSignatures = FrozenHashMap<RTTI::IdType, const Vector<Signature>*>(entries.begin(), entries.end());
+		_isFrozen.store(true, std::memory_order_release);
+	}
+
+	bool TypeManager::IsFrozen() {
+		return _isFrozen;
+	}
+
 	bool TypeManager::ContainsSignature(RTTI::IdType typeID) {
+		if (_isFrozen) {
+#ifdef USE_THREAD_SAFE_REGISTRIES
+			std::shared_lock<std::shared_mutex> lock(_frozenMutex);
+			if (_isFrozen)
+#endif // USE_THREAD_SAFE_REGISTRIES
+			{
+				return _frozenSignatures.ContainsKey(typeID);
+			}
+		}
 		return _signatures.ContainsKey(typeID);
 	}
 
 	const Vector<Signature>& TypeManager::GetSignatureByTypeID(RTTI::IdType typeID) {
+		if (_isFrozen) {
+#ifdef USE_THREAD_SAFE_REGISTRIES
+			std::shared_lock<std::shared_mutex> lock(_frozenMutex);
+			if (_isFrozen)
+#endif // USE_THREAD_SAFE_REGISTRIES
+			{
+				return *_frozenSignatures.At(typeID);
+			}
+		}
 		return _signatures.At(typeID);
 	}
 
-	const HashMap<RTTI::IdType, Vector<Signature>>& TypeManager::Types() {
+	const TypeManager::SignatureMap& TypeManager::Types() {
 		return _signatures;
 	}
 
-	void TypeManager::AddInheritedSignatures(RTTI::IdType childID, RTTI::IdType parentID) {
-		auto& signatureVector = _signatures.At(parentID);
+	void TypeManager::Thaw() {
+		if (!_isFrozen) return;
+		_isFrozen.store(false, std::memory_order_release);
+		_frozenSignatures = FrozenHashMap<RTTI::IdType, const Vector<Signature>*>();
+	}
+
+	void TypeManager::AddInheritedSignatures(Vector<Signature>& childSignatures, RTTI::IdType parentID) {
+		const auto& signatureVector = _signatures.At(parentID);
 		for (auto& signature : signatureVector) {
-			_signatures[childID].PushBack(signature);
+			childSignatures.PushBack(signature);
 		}
 	}
 }
@@ -3,7 +3,14 @@
 /// </summary>
 
 #pragma once
-#include "HashMap.h"
+#include <atomic>
+#ifdef USE_THREAD_SAFE_REGISTRIES
+#include <shared_mutex>
+#include "ConcurrentHashMap.h"
+#else
+#include "FlatHashMap.h"
+#endif // USE_THREAD_SAFE_REGISTRIES
+#include "FrozenHashMap.h"
 #include "Vector.h"
 #include "Datum.h"
 #include "RTTI.h"
@@ -86,6 +93,18 @@ namespace FIEAGameEngine {
 
 	class TypeManager final{
 	public:
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		/// <summary>
+		/// The map signatures are registered in. With USE_THREAD_SAFE_REGISTRIES defined it is a ConcurrentHashMap, so types can be registered and their signatures looked up from any thread.
+		/// </summary>
+		using SignatureMap = ConcurrentHashMap<RTTI::IdType, Vector<Signature>>;
+#else
+		/// <summary>
+		/// The map signatures are registered in.
+		/// </summary>
+		using SignatureMap = FlatHashMap<RTTI::IdType, Vector<Signature>>;
+#endif // USE_THREAD_SAFE_REGISTRIES
+
 		/// <summary>
 		/// Add a type's signatures to the TypeManager. If the given typeID already exists in the TypeManager, it will return False.
 		/// </summary>
@@ -125,6 +144,16 @@ namespace FIEAGameEngine {
 		/// Clear the TypeManager of all signatures.
 		/// </summary>
 		static void Clear();
+		/// <summary>
+		/// Build a perfect hash over the types registered so far, and answer ContainsSignature and GetSignatureByTypeID from it until the next Add, Remove, or Clear.
+		/// With USE_THREAD_SAFE_REGISTRIES defined, Freeze, Add, Remove, and Clear are serialized, and lookups never see the table while it is being swapped.
+		/// </summary>
+		static void Freeze();
+		/// <summary>
+		/// Check whether lookups are currently answered from the table built by Freeze.
+		/// </summary>
+		/// <returns>A boolean indicating if the TypeManager is frozen.</returns>
+		[[nodiscard]] static bool IsFrozen();
 
 		/// <summary>
 		/// Check if a typeID maps to a set of signatures in the TypeManager.
@@ -142,19 +171,38 @@ namespace FIEAGameEngine {
 		/// Get all types and their signatures from the TypeManager.
 		/// </summary>
 		/// <returns>The contents of the TypeManager.</returns>
-		[[nodiscard]] static const HashMap<RTTI::IdType, Vector<Signature>>& Types();
+		[[nodiscard]] static const SignatureMap& Types();
 	private:
 		/// <summary>
 		/// The mapping of IDs to sets of signatures.
 		/// </summary>
-		inline static HashMap<RTTI::IdType, Vector<Signature>> _signatures;
+		inline static SignatureMap _signatures;
+		/// <summary>
+		/// A perfect hash from IDs to the registered sets of signatures, built by Freeze.
+		/// </summary>
+		inline static FrozenHashMap<RTTI::IdType, const Vector<Signature>*> _frozenSignatures = FrozenHashMap<RTTI::IdType, const Vector<Signature>*>();
+		/// <summary>
+		/// Whether lookups are answered from _frozenSignatures.
+		/// </summary>
+		inline static std::atomic<bool> _isFrozen{ false };
+#ifdef USE_THREAD_SAFE_REGISTRIES
+		/// <summary>
+		/// Held exclusively while the signatures are changed or _frozenSignatures is built or discarded, and shared while a lookup reads _frozenSignatures.
+		/// </summary>
+		inline static std::shared_mutex _frozenMutex;
+#endif // USE_THREAD_SAFE_REGISTRIES
+
+		/// <summary>
+		/// Discard the table built by Freeze, so that lookups see the registered signatures again. With USE_THREAD_SAFE_REGISTRIES defined, the caller must hold _frozenMutex exclusively.
+		/// </summary>
+		static void Thaw();
 
 		/// <summary>
-		/// A helper function to add all inherited signatures from a parent type to the child.
+		/// A helper function to append all inherited signatures from a parent type to a child's signatures before the child is registered, so that a registered set of signatures is never modified.
 		/// </summary>
-		/// <param name="childID">The typeID of the child.</param>
+		/// <param name="childSignatures">The signatures of the child.</param>
 		/// <param name="parentID">The typeID of the parent.</param>
-		static void AddInheritedSignatures(RTTI::IdType childID, RTTI::IdType parentID);
+		static void AddInheritedSignatures(Vector<Signature>& childSignatures, RTTI::IdType parentID);
 	};
 
 	/// <summary>
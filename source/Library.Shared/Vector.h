@@ -11,28 +11,37 @@
 #include <limits>
 #include <functional>
 #include <stdexcept>
+#include <iterator>
 #include <DefaultEquality.h>
-#include "DefaultGrowth.h"
+#include "GrowthPolicy.h"
+#include "MemoryResource.h"
+#include "TriviallyRelocatable.h"
+#include "gsl/gsl"
 
 namespace FIEAGameEngine {
 	/// <summary>
 	/// A templated container class for a vector. 
 	/// Vectors have Iterators and ConstIterators and move semantics are implemented in assignments, copy constructors, and pushbacks. 
 	/// Capacity of a Vector can only be decreased with a call to ShrinkToFit.
+	/// Growing, shrinking, and removing relocate elements with MemoryResource::Reallocate and memmove when T is trivially relocatable (see IsTriviallyRelocatable), and by moving and destroying each element otherwise.
+	/// Storage comes from the MemoryResource given at construction, or the default resource. Elements copied or moved in from another Vector that accept a MemoryResource as a last constructor argument, like SList, are given the Vector's resource too.
 	/// </summary>
 	/// <typeparam name="T">The type of object the Vector contains.</typeparam>
-	template <typename T>
-	class Vector final {
+	/// <typeparam name="TGrowth">The growth policy the Vector uses to pick its next capacity when it is full (see GrowthPolicy.h). Use RuntimeGrowth to choose a functor at runtime.</typeparam>
+	template <typename T, typename TGrowth = DefaultGrowth>
+	class Vector final : private GrowthPolicyHolder<TGrowth> {
 	public:
 		using size_type = std::size_t;
 		using value_type = T;
+		using growth_policy_type = TGrowth;
 		using reference = value_type&;
 		using const_reference = const value_type&;
 		using rvalue_reference = T&&;
 
 		/// <summary>
 		/// Iterator class allows traversal of Vector objects. Iterators function as Random Access Iterators and have all related functionaliy.
-		/// Dereferencing an Iterator with an index out of bounds of the size of its Vector or trying to increment an Iterator that is not assigned to an Vector will result in a runtime error.
+		/// With USE_CHECKED_ITERATORS defined, an Iterator is a Vector and an index, and dereferencing an Iterator with an index out of bounds of the size of its Vector or trying to increment an Iterator that is not assigned to an Vector will result in a runtime error.
+		/// Otherwise an Iterator is a bare pointer into the Vector's storage with no checks, so std:: algorithms over it inline and vectorize just as they would over an array.
 		/// </summary>
 		class Iterator final{
 			friend Vector;
@@ -143,11 +152,15 @@ namespace FIEAGameEngine {
 			/// <param name="incrementAmount">The offset to the new Iterator.</param>
 			/// <returns>A new Iterator pointing incrementAmount away (additively) from the original Iterator.</returns>
 			friend Iterator operator+(const Iterator& iter, difference_type incrementAmount) {
+#ifdef USE_CHECKED_ITERATORS
 #ifdef USE_EXCEPTIONS
 				if (iter._container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
 #endif // USE_EXCEPTIONS
 
 				return Iterator(*iter._container, iter._index + incrementAmount);
+#else
+				return Iterator(iter._current + incrementAmount);
+#endif // USE_CHECKED_ITERATORS
 			}
 			/// <summary>
 			/// A friend function of Iterator that returns a new Iterator pointing a specified distance away from the original Iterator.
@@ -156,11 +169,15 @@ namespace FIEAGameEngine {
 			/// <param name="incrementAmount">The offset to the new Iterator.</param>
 			/// <returns>A new Iterator pointing decrementAmount away (subtractively) from the original Iterator.</returns>
 			friend Iterator operator-(const Iterator& iter, difference_type decrementAmount) {
+#ifdef USE_CHECKED_ITERATORS
 #ifdef USE_EXCEPTIONS
 				if (iter._container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
 #endif // USE_EXCEPTIONS
 
 				return Iterator(*iter._container, iter._index - decrementAmount);
+#else
+				return Iterator(iter._current - decrementAmount);
+#endif // USE_CHECKED_ITERATORS
 			}
 
 			/// <summary>
@@ -207,6 +224,7 @@ namespace FIEAGameEngine {
 			/// <param name="index">The index this Iterator points at, defaulted to nullptr</param>
 			Iterator(Vector& container, size_type index = 0);
 
+#ifdef USE_CHECKED_ITERATORS
 			/// <summary>
 			/// The index this Iterator points to.
 			/// </summary>
@@ -215,11 +233,23 @@ namespace FIEAGameEngine {
 			/// The Vector this Iterator belongs to.
 			/// </summary>
 			Vector* _container{ nullptr };
+#else
+			/// <summary>
+			/// Private constructor for an Iterator that points directly at an element.
+			/// </summary>
+			/// <param name="current">The element this Iterator points at</param>
+			explicit Iterator(pointer current);
+
+			/// <summary>
+			/// The element this Iterator points at.
+			/// </summary>
+			pointer _current{ nullptr };
+#endif // USE_CHECKED_ITERATORS
 		};
 
 		/// <summary>
 		/// ConstIterator class allows traversal of Vector objects. Functionally almost identical to Iterator class, except that dereferencing a ConstIterator returns a const T reference.
-		/// Dereferencing an Iterator with an index out of bounds of the size of its Vector or trying to increment a ConstIterator that is not assigned to an Vector will result in a runtime error.
+		/// With USE_CHECKED_ITERATORS defined, dereferencing an Iterator with an index out of bounds of the size of its Vector or trying to increment a ConstIterator that is not assigned to an Vector will result in a runtime error. Otherwise a ConstIterator is an unchecked pointer, like Iterator.
 		/// </summary>
 		class ConstIterator final {
 			friend Vector;
@@ -334,11 +364,15 @@ namespace FIEAGameEngine {
 			/// <param name="incrementAmount">The offset to the new ConstIterator.</param>
 			/// <returns>A new ConstIterator pointing incrementAmount away (additively) from the original ConstIterator.</returns>
 			friend ConstIterator operator+(const ConstIterator& iter, difference_type incrementAmount) {
+#ifdef USE_CHECKED_ITERATORS
 #ifdef USE_EXCEPTIONS
 				if (iter._container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
 #endif // USE_EXCEPTIONS
 
 				return ConstIterator(*iter._container, iter._index + incrementAmount);
+#else
+				return ConstIterator(iter._current + incrementAmount);
+#endif // USE_CHECKED_ITERATORS
 			}
 			/// <summary>
 			/// A friend function of ConstIterator that returns a new ConstIterator pointing a specified distance away from the original ConstIterator.
@@ -347,11 +381,15 @@ namespace FIEAGameEngine {
 			/// <param name="incrementAmount">The offset to the new ConstIterator.</param>
 			/// <returns>A new ConstIterator pointing decrementAmount away (subtractively) from the original ConstIterator.</returns>
 			friend ConstIterator operator-(const ConstIterator& iter, difference_type decrementAmount) {
+#ifdef USE_CHECKED_ITERATORS
 #ifdef USE_EXCEPTIONS
 				if (iter._container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
 #endif // USE_EXCEPTIONS
 
 				return ConstIterator(*iter._container, iter._index - decrementAmount);
+#else
+				return ConstIterator(iter._current - decrementAmount);
+#endif // USE_CHECKED_ITERATORS
 			}
 
 			/// <summary>
@@ -398,6 +436,7 @@ namespace FIEAGameEngine {
 			/// <param name="index">The index this ConstIterator points at, defaulted to nullptr</param>
 			ConstIterator(const Vector& container, size_type index = 0);
 
+#ifdef USE_CHECKED_ITERATORS
 			/// <summary>
 			/// The index this ConstIterator points to.
 			/// </summary>
@@ -406,23 +445,46 @@ namespace FIEAGameEngine {
 			/// The Vector this ConstIterator belongs to.
 			/// </summary>
 			const Vector* _container{ nullptr };
+#else
+			/// <summary>
+			/// Private constructor for a ConstIterator that points directly at an element.
+			/// </summary>
+			/// <param name="current">The element this ConstIterator points at</param>
+			explicit ConstIterator(const value_type* current);
+
+			/// <summary>
+			/// The element this ConstIterator points at.
+			/// </summary>
+			const value_type* _current{ nullptr };
+#endif // USE_CHECKED_ITERATORS
 		};
 
 		/// <summary>
 		/// Default constructor for an Vector, using the compiler provided default behavior. Its front and back pointers will both be set to nullptr, and its size to zero.
 		/// </summary>
-		explicit Vector(size_type capacity = size_type(0), std::function<size_type(size_type)> incrementFunctor = DefaultGrowth{});
+		/// <param name="capacity">The capacity to reserve.</param>
+		/// <param name="growthPolicy">The growth policy to use. Only stored if it has state, like RuntimeGrowth.</param>
+		/// <param name="resource">The resource to allocate storage from, or nullptr for the default resource.</param>
+		explicit Vector(size_type capacity = size_type(0), TGrowth growthPolicy = TGrowth{}, MemoryResource* resource = nullptr);
 		/// <summary>
 		/// An Initializer list constructor for Vector. The items will be pushed back to the constructor Vector in the same order as given into this function.
 		/// </summary>
 		/// <param name="list">A set of items to add to an Vector as it's being constructed</param>
-		Vector(std::initializer_list<value_type> list, std::function<size_type(size_type)> incrementFunctor = DefaultGrowth{});
+		/// <param name="growthPolicy">The growth policy to use. Only stored if it has state, like RuntimeGrowth.</param>
+		/// <param name="resource">The resource to allocate storage from, or nullptr for the default resource.</param>
+		Vector(std::initializer_list<value_type> list, TGrowth growthPolicy = TGrowth{}, MemoryResource* resource = nullptr);
 		/// <summary>
-		/// A copy constructor for an Vector that performs a deep copy during construction.
+		/// A copy constructor for an Vector that performs a deep copy during construction. The copy allocates from the default resource.
 		/// </summary>
 		/// <param name="other">The Vector to copy</param>
 		Vector(const Vector& rhs);
 		/// <summary>
+		/// A copy constructor for an Vector that performs a deep copy into storage obtained from the given resource.
+		/// </summary>
+		/// <param name="rhs">The Vector to copy</param>
+		/// <param name="resource">The resource to allocate storage from, or nullptr for the default resource.</param>
+		Vector(const Vector& rhs, MemoryResource* resource);
+		/// <summary>
 		/// The move constructor for Vector is currently not implemented and has been deleted.
 		/// </summary>
 		/// <param name="rhs">The Vector to move data from</param>
@@ -434,10 +496,11 @@ namespace FIEAGameEngine {
 		/// <returns>A reference to the updated Vector</returns>
 		Vector& operator=(const Vector& rhs);
 		/// <summary>
-		/// The move assignment operator for Vector is currently not implemented and has been deleted.
+		/// The move assignment operator for Vector. Takes over the storage of the given Vector if both allocate from equal resources, and moves its elements one by one otherwise.
+		/// Only the first case is guaranteed not to throw: across resources new storage must be allocated, so running out of memory or an element's move constructor throwing calls std::terminate.
 		/// </summary>
 		/// <param name="rhs">The Vector to move data from</param>
-		/// <returns></returns>
+		/// <returns>A reference to the updated Vector</returns>
 		Vector& operator=(Vector&& rhs) noexcept;
 		/// <summary>
 		/// The destructor for Vector deletes each element of the vector to free memory.
@@ -473,6 +536,16 @@ namespace FIEAGameEngine {
 		/// <exception cref = "std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the index is out of bounds of the size of the Vector.</exception>
 		[[nodiscard]] const_reference At(size_type index) const;
 
+		/// <summary>
+		/// Retrieve the growth policy of the Vector.
+		/// </summary>
+		using GrowthPolicyHolder<TGrowth>::GetGrowthPolicy;
+		/// <summary>
+		/// Retrieve the resource the Vector allocates its storage from.
+		/// </summary>
+		/// <returns>A pointer to the Vector's resource.</returns>
+		[[nodiscard]] MemoryResource* GetResource() const;
+
 		/// <summary>
 		/// Retrieve the size of the Vector.
 		/// </summary>
@@ -559,6 +632,26 @@ namespace FIEAGameEngine {
 		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the vector is empty</exception>
 		[[nodiscard]] const_reference Back() const;
 		/// <summary>
+		/// Gets a pointer to the contiguous storage of the Vector. Invalidated by any operation that changes the Vector's capacity.
+		/// </summary>
+		/// <returns>A pointer to the first item in the Vector, or nullptr if nothing has been reserved</returns>
+		[[nodiscard]] T* Data();
+		/// <summary>
+		/// Gets a constant pointer to the contiguous storage of the Vector. Invalidated by any operation that changes the Vector's capacity.
+		/// </summary>
+		/// <returns>A constant pointer to the first item in the Vector, or nullptr if nothing has been reserved</returns>
+		[[nodiscard]] const T* Data() const;
+		/// <summary>
+		/// Gets a span over the items in the Vector, for passing them to code that takes plain contiguous ranges. Invalidated by any operation that changes the Vector's size or capacity.
+		/// </summary>
+		/// <returns>A span of Size() items starting at Data()</returns>
+		[[nodiscard]] gsl::span<T> AsSpan();
+		/// <summary>
+		/// Gets a constant span over the items in the Vector. Invalidated by any operation that changes the Vector's size or capacity.
+		/// </summary>
+		/// <returns>A constant span of Size() items starting at Data()</returns>
+		[[nodiscard]] gsl::span<const T> AsSpan() const;
+		/// <summary>
 		/// Look for an item in the Vector and return a ConstIterator to the first instance of it if it's found, or pointing to end() otherwise.
 		/// </summary>
 		/// <param name="data">The item to look for</param>
@@ -587,6 +680,32 @@ namespace FIEAGameEngine {
 		/// <returns></returns>
 		Iterator PushBack(rvalue_reference data);
 		/// <summary>
+		/// Construct an item in place at the back of the Vector. If the Vector does not have enough capacity to add this item, it will first reserve extra space according to the Vector's growth policy.
+		/// </summary>
+		/// <param name="args">The arguments to construct the item with.</param>
+		/// <returns>An Iterator pointing to the item that was just added.</returns>
+		template <typename... Args>
+		Iterator EmplaceBack(Args&&... args);
+		/// <summary>
+		/// Insert copies of a range of items before the given position, reserving space for all of them at once and shifting the following elements only once.
+		/// The range must not refer to elements of this Vector. Pass std::move_iterators to move the items instead of copying them. Single pass input ranges are read exactly once,
+		/// into a buffer that is then moved into place. If an item fails to construct, the items built so far are destroyed and the existing elements are left where they were.
+		/// </summary>
+		/// <param name="position">An Iterator pointing at the element the items are inserted before, or end() to add them to the back.</param>
+		/// <param name="first">An iterator pointing at the first item to insert.</param>
+		/// <param name="last">An iterator pointing past the last item to insert.</param>
+		/// <returns>An Iterator pointing to the first inserted item, or to position if the range is empty.</returns>
+		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Vector the Iterator belongs to is not valid or not the same as the Vector being modified</exception>
+		template <typename InputIterator>
+		Iterator Insert(const Iterator& position, InputIterator first, InputIterator last);
+		/// <summary>
+		/// Add every item of a range to the back of the Vector with a single reserve. The items are moved out of the range if it is an rvalue, and copied otherwise.
+		/// </summary>
+		/// <param name="range">Any range with begin and end, such as another Vector, an SList, or an initializer list. Must not be this Vector.</param>
+		/// <returns>An Iterator pointing to the first added item, or to end() if the range is empty.</returns>
+		template <typename Range>
+		Iterator Append(Range&& range);
+		/// <summary>
 		/// Look for an item in the Vector and remove the first instance of it if it's found. Does not decrease the Vector's capacity.
 		/// </summary>
 		/// <param name="data">The item to look for</param>
@@ -610,11 +729,24 @@ namespace FIEAGameEngine {
 		/// <exception cref="std::runtime_error">Thrown if USE_EXCEPTIONS is defined and the Vector the Iterator belngs to is not valid or not the same as the Vector being modified</exception>
 		bool Remove(const Iterator& iterFirst, const Iterator& iterLast);
 		/// <summary>
+		/// Remove every element the predicate returns true for, compacting the rest in a single pass that keeps their order. Does not decrease the Vector's capacity.
+		/// If the predicate throws, the elements already removed stay removed and the one it threw on is kept along with every element after it.
+		/// </summary>
+		/// <param name="predicate">A callable taking a reference to an element and returning whether it should be removed. It is called once per element, in order.</param>
+		/// <returns>The number of elements removed.</returns>
+		template <typename Predicate>
+		size_type RemoveIf(Predicate predicate);
+		/// <summary>
 		/// Remove the last item from the Vector. Does not decrease the Vector's capacity.
 		/// </summary>
 		void PopBack();
 
 	private:
+		/// <summary>
+		/// The base class that stores the growth policy.
+		/// </summary>
+		using GrowthHolder = GrowthPolicyHolder<TGrowth>;
+
 		/// <summary>
 		/// The head of the Vector.
 		/// </summary>
@@ -628,15 +760,39 @@ namespace FIEAGameEngine {
 		/// </summary>
 		size_type _size{ 0 };
 		/// <summary>
-		/// A function that will return how much to increment the capacity of the Vector by when called on a certain current capacity.
+		/// The resource the Vector allocates its storage from.
 		/// </summary>
-		std::function<size_type(size_type)> _incrementFunctor;
-
+		MemoryResource* _resource{ GetDefaultResource() };
 		/// <summary>
 		/// A helper function that performs a deep copy of the given Vector into this.
 		/// </summary>
 		/// <param name="rhs">The Vector to copy.</param>
 		void DeepCopy(const Vector& rhs);
+		/// <summary>
+		/// A helper function that moves the elements into a new buffer of exactly the given capacity and releases the old one.
+		/// </summary>
+		/// <param name="capacity">The capacity of the new buffer. Must not be less than the current size or zero.</param>
+		void Reallocate(size_type capacity);
+		/// <summary>
+		/// A helper function to get the index of the item an Iterator points at.
+		/// </summary>
+		/// <param name="iter">An Iterator into this Vector.</param>
+		/// <returns>The index of the item the Iterator points at.</returns>
+		[[nodiscard]] size_type IndexOf(const Iterator& iter) const;
+		/// <summary>
+		/// A helper function that moves every item of another Vector into this one before the given index, shifting the following elements only once, and leaves the other Vector empty.
+		/// </summary>
+		/// <param name="index">The index the first item should end up at.</param>
+		/// <param name="items">The Vector holding the items, already constructed.</param>
+		/// <returns>An Iterator pointing to the first inserted item, or to index if there were no items.</returns>
+		Iterator MoveInsert(size_type index, Vector& items);
+		/// <summary>
+		/// A helper function that moves the bytes of a run of trivially relocatable elements, which may overlap their destination.
+		/// </summary>
+		/// <param name="destination">Where the elements should end up.</param>
+		/// <param name="source">Where the elements are now.</param>
+		/// <param name="count">The number of elements to move.</param>
+		static void RelocateBytes(value_type* destination, value_type* source, size_type count);
 	};
 }
 
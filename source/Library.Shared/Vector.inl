@@ -7,16 +7,16 @@
 
 namespace FIEAGameEngine {
 #pragma region Vector
-	template<typename T>
-	inline Vector<T>::Vector(size_type capacity, std::function<size_type(size_type)> incrementFunctor) :
-		_incrementFunctor{incrementFunctor}
+	template<typename T, typename TGrowth>
+	inline Vector<T, TGrowth>::Vector(size_type capacity, TGrowth growthPolicy, MemoryResource* resource) :
+		GrowthHolder(std::move(growthPolicy)), _resource{ resource != nullptr ? resource : GetDefaultResource() }
 	{
 		Reserve(capacity);
 	}
 
-	template<typename value_type>
-	inline Vector<value_type>::Vector(std::initializer_list<value_type> list, std::function<size_type(size_type)> incrementFunctor) :
-		_incrementFunctor{incrementFunctor}
+	template<typename value_type, typename TGrowth>
+	inline Vector<value_type, TGrowth>::Vector(std::initializer_list<value_type> list, TGrowth growthPolicy, MemoryResource* resource) :
+		GrowthHolder(std::move(growthPolicy)), _resource{ resource != nullptr ? resource : GetDefaultResource() }
 	{
 		Reserve(list.size());
 		for (const_reference value : list) {
@@ -24,22 +24,32 @@ namespace FIEAGameEngine {
 		}
 	}
 
-	template<typename value_type>
-	Vector<value_type>::Vector(const Vector& rhs) {
+	template<typename value_type, typename TGrowth>
+	Vector<value_type, TGrowth>::Vector(const Vector& rhs) :
+		GrowthHolder(rhs)
+	{
+		DeepCopy(rhs);
+	}
+
+	template<typename value_type, typename TGrowth>
+	Vector<value_type, TGrowth>::Vector(const Vector& rhs, MemoryResource* resource) :
+		GrowthHolder(rhs), _resource{ resource != nullptr ? resource : GetDefaultResource() }
+	{
 		DeepCopy(rhs);
 	}
 
-	template<typename value_type>
-	Vector<value_type>::Vector(Vector&& rhs) noexcept :
-		_data{ rhs._data }, _capacity{ rhs._capacity }, _size{ rhs._size }, _incrementFunctor{rhs._incrementFunctor}
+	template<typename value_type, typename TGrowth>
+	Vector<value_type, TGrowth>::Vector(Vector&& rhs) noexcept :
+		GrowthHolder(rhs),
+		_data{ rhs._data }, _capacity{ rhs._capacity }, _size{ rhs._size }, _resource{ rhs._resource }
 	{
 		rhs._data = nullptr;
 		rhs._capacity = 0;
 		rhs._size = 0;
 	}
 
-	template<typename value_type>
-	Vector<value_type>& Vector<value_type>::operator=(const Vector& rhs) {
+	template<typename value_type, typename TGrowth>
+	Vector<value_type, TGrowth>& Vector<value_type, TGrowth>::operator=(const Vector& rhs) {
 		if (this != &rhs) {
 			Clear();
 			ShrinkToFit();
@@ -48,256 +58,483 @@ namespace FIEAGameEngine {
 		return *this;
 	}
 
-	template<typename value_type>
-	Vector<value_type>& Vector<value_type>::operator=(Vector&& rhs) noexcept {
+	template<typename value_type, typename TGrowth>
+	Vector<value_type, TGrowth>& Vector<value_type, TGrowth>::operator=(Vector&& rhs) noexcept {
 		if (this != &rhs) {
 			Clear();
 			ShrinkToFit();
 			
-			_data = rhs._data;
-			_capacity = rhs._capacity;
-			_size = rhs._size;
-			rhs._data = nullptr;
-			rhs._capacity = 0;
-			rhs._size = 0;
+			GrowthHolder::operator=(rhs);
+			if (_resource->IsEqual(*rhs._resource)) {
+				_data = rhs._data;
+				_capacity = rhs._capacity;
+				_size = rhs._size;
+				rhs._data = nullptr;
+				rhs._capacity = 0;
+				rhs._size = 0;
+			}
+			else {
+				Reserve(rhs._size);
+				for (size_type i = 0; i < rhs._size; ++i) {
+					if constexpr (std::is_constructible_v<value_type, value_type&&, MemoryResource*>) {
+						new (_data + i) value_type(std::move(rhs._data[i]), _resource);
+					}
+					else {
+						new (_data + i) value_type(std::move(rhs._data[i]));
+					}
+				}
+				_size = rhs._size;
+				rhs.Clear();
+				rhs.ShrinkToFit();
+			}
 		}
 		return *this;
 	}
 
-	template<typename value_type>
-	Vector<value_type>::~Vector() {
+	template<typename value_type, typename TGrowth>
+	Vector<value_type, TGrowth>::~Vector() {
 		Clear();
 		ShrinkToFit();
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::reference Vector<value_type>::operator[](size_type index) {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::reference Vector<value_type, TGrowth>::operator[](size_type index) {
 #ifdef USE_EXCEPTIONS
 		if (index >= _size) throw std::runtime_error("Index is out of bounds.");
 #endif // USE_EXCEPTIONS
 		return _data[index];
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::const_reference Vector<value_type>::operator[](size_type index) const {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::const_reference Vector<value_type, TGrowth>::operator[](size_type index) const {
 #ifdef USE_EXCEPTIONS
 		if (index >= _size) throw std::runtime_error("Index is out of bounds.");
 #endif // USE_EXCEPTIONS
 		return _data[index];
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::reference Vector<value_type>::At(size_type index) {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::reference Vector<value_type, TGrowth>::At(size_type index) {
 #ifdef USE_EXCEPTIONS
 		if (index >= _size) throw std::runtime_error("Index is out of bounds.");
 #endif // USE_EXCEPTIONS
 		return _data[index];
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::const_reference Vector<value_type>::At(size_type index) const {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::const_reference Vector<value_type, TGrowth>::At(size_type index) const {
 #ifdef USE_EXCEPTIONS
 		if (index >= _size) throw std::runtime_error("Index is out of bounds.");
 #endif // USE_EXCEPTIONS
 		return _data[index];
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::size_type Vector<value_type>::Size() const {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::size_type Vector<value_type, TGrowth>::Size() const {
 		return _size;
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::size_type Vector<value_type>::Capacity() const {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::size_type Vector<value_type, TGrowth>::Capacity() const {
 		return _capacity;
 	}
 
-	template<typename value_type>
-	inline bool Vector<value_type>::IsEmpty() const {
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::IsEmpty() const {
 		return (_size == size_type(0));
 	}
 
-	template<typename value_type>
-	void Vector<value_type>::Reserve(size_type capacity) {
+	template<typename value_type, typename TGrowth>
+	void Vector<value_type, TGrowth>::Reserve(size_type capacity) {
 		if(capacity > _capacity) {
-			value_type* data = reinterpret_cast<value_type*>(realloc(_data, capacity * sizeof(value_type)));
-			assert(data != nullptr);
-			_data = data;
-			_capacity = capacity;
+			Reallocate(capacity);
 		}
 	}
 
-	template<typename value_type>
-	void Vector<value_type>::ShrinkToFit() {
+	template<typename value_type, typename TGrowth>
+	void Vector<value_type, TGrowth>::ShrinkToFit() {
 		if (_capacity > _size) {
 			if (_size == 0) {
-				free(_data);
+				_resource->Deallocate(_data, _capacity * sizeof(value_type), alignof(value_type));
 				_data = nullptr;
 			}
 			else {
-				value_type* data = reinterpret_cast<value_type*>(realloc(_data, _size * sizeof(value_type)));
-				assert(data != nullptr);
-				_data = data;
+				Reallocate(_size);
 			}
 			_capacity = _size;
 		}
 	}
 
-	template<typename value_type>
-	inline void Vector<value_type>::Clear() {
+	template<typename value_type, typename TGrowth>
+	void Vector<value_type, TGrowth>::Reallocate(size_type capacity) {
+		assert(capacity >= _size && capacity > 0);
+		if constexpr (IsTriviallyRelocatableV<value_type>) {
+			value_type* data = reinterpret_cast<value_type*>(_resource->Reallocate(_data, _capacity * sizeof(value_type), capacity * sizeof(value_type), alignof(value_type)));
+			assert(data != nullptr);
+			_data = data;
+		}
+		else {
+			value_type* data = reinterpret_cast<value_type*>(_resource->Allocate(capacity * sizeof(value_type), alignof(value_type)));
+			assert(data != nullptr);
+			for (size_type i = 0; i < _size; ++i) {
+				new (data + i) value_type(std::move(_data[i]));
+				_data[i].~value_type();
+			}
+			_resource->Deallocate(_data, _capacity * sizeof(value_type), alignof(value_type));
+			_data = data;
+		}
+		_capacity = capacity;
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline void Vector<value_type, TGrowth>::Clear() {
 		for (size_type i = 0; i < _size; ++i) {
 			_data[i].~value_type();
 		}
 		_size = 0;
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::Iterator Vector<value_type>::begin() {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::Iterator Vector<value_type, TGrowth>::begin() {
 		return Iterator(*this);
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::Iterator Vector<value_type>::end() {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::Iterator Vector<value_type, TGrowth>::end() {
 		return Iterator(*this, _size);
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::ConstIterator Vector<value_type>::begin() const {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::ConstIterator Vector<value_type, TGrowth>::begin() const {
 		return ConstIterator(*this);
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::ConstIterator Vector<value_type>::end() const {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::ConstIterator Vector<value_type, TGrowth>::end() const {
 		return ConstIterator(*this, _size);
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::ConstIterator Vector<value_type>::cbegin() const {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::ConstIterator Vector<value_type, TGrowth>::cbegin() const {
 		return ConstIterator(*this);
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::ConstIterator Vector<value_type>::cend() const {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::ConstIterator Vector<value_type, TGrowth>::cend() const {
 		return ConstIterator(*this, _size);
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::reference Vector<value_type>::Front() {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::reference Vector<value_type, TGrowth>::Front() {
 #ifdef USE_EXCEPTIONS
 		if (_size == 0) throw std::runtime_error("Vector is empty.");
 #endif // USE_EXCEPTIONS
 		return _data[0];
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::const_reference Vector<value_type>::Front() const {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::const_reference Vector<value_type, TGrowth>::Front() const {
 #ifdef USE_EXCEPTIONS
 		if (_size == 0) throw std::runtime_error("Vector is empty.");
 #endif // USE_EXCEPTIONS
 		return _data[0];
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::reference Vector<value_type>::Back() {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::reference Vector<value_type, TGrowth>::Back() {
 #ifdef USE_EXCEPTIONS
 		if (_size == 0) throw std::runtime_error("Vector is empty.");
 #endif // USE_EXCEPTIONS
 		return _data[_size - 1];
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::const_reference Vector<value_type>::Back() const {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::const_reference Vector<value_type, TGrowth>::Back() const {
 #ifdef USE_EXCEPTIONS
 		if (_size == 0) throw std::runtime_error("Vector is empty.");
 #endif // USE_EXCEPTIONS
 		return _data[_size - 1];
 	}
 
-	template<typename value_type>
-	void Vector<value_type>::DeepCopy(const Vector& rhs) {
+	template<typename value_type, typename TGrowth>
+	inline value_type* Vector<value_type, TGrowth>::Data() {
+		return _data;
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline const value_type* Vector<value_type, TGrowth>::Data() const {
+		return _data;
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline gsl::span<value_type> Vector<value_type, TGrowth>::AsSpan() {
+		return gsl::span<value_type>(_data, _size);
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline gsl::span<const value_type> Vector<value_type, TGrowth>::AsSpan() const {
+		return gsl::span<const value_type>(_data, _size);
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::size_type Vector<value_type, TGrowth>::IndexOf(const Iterator& iter) const {
+#ifdef USE_CHECKED_ITERATORS
+		return iter._index;
+#else
+		return static_cast<size_type>(iter._current - _data);
+#endif // USE_CHECKED_ITERATORS
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline void Vector<value_type, TGrowth>::RelocateBytes(value_type* destination, value_type* source, size_type count) {
+#ifdef _WINDOWS
+		memmove_s(destination, count * sizeof(value_type), source, count * sizeof(value_type));
+#else
+		memmove(static_cast<void*>(destination), source, count * sizeof(value_type));
+#endif
+	}
+
+	template<typename value_type, typename TGrowth>
+	void Vector<value_type, TGrowth>::DeepCopy(const Vector& rhs) {
 		Reserve(rhs._size);
-		_incrementFunctor = rhs._incrementFunctor;
+		GrowthHolder::operator=(rhs);
 		for (size_type i = 0; i < rhs._size; ++i) {
-			PushBack(rhs[i]);
+			if constexpr (std::is_constructible_v<value_type, const value_type&, MemoryResource*>) {
+				new (_data + _size) value_type(rhs._data[i], _resource);
+				++_size;
+			}
+			else {
+				PushBack(rhs[i]);
+			}
 		}
 	}
 
-	template<typename value_type>
+	template<typename value_type, typename TGrowth>
+	inline MemoryResource* Vector<value_type, TGrowth>::GetResource() const {
+		return _resource;
+	}
+
+	template<typename value_type, typename TGrowth>
 	template<typename EqualityFunctor>
-	inline typename Vector<value_type>::ConstIterator Vector<value_type>::Find(const_reference data, EqualityFunctor equalityFunctor) const {
+	inline typename Vector<value_type, TGrowth>::ConstIterator Vector<value_type, TGrowth>::Find(const_reference data, EqualityFunctor equalityFunctor) const {
 		for (size_type i = 0; i < _size; ++i) {
 			if (equalityFunctor(At(i), data)) return ConstIterator(*this, i);
 		}
 		return end();
 	}
 
-	template<typename value_type>
+	template<typename value_type, typename TGrowth>
 	template<typename EqualityFunctor>
-	inline typename Vector<value_type>::Iterator Vector<value_type>::Find(const_reference data, EqualityFunctor equalityFunctor) {
+	inline typename Vector<value_type, TGrowth>::Iterator Vector<value_type, TGrowth>::Find(const_reference data, EqualityFunctor equalityFunctor) {
 		for (size_type i = 0; i < _size; ++i) {
 			if (equalityFunctor(At(i), data)) return Iterator(*this, i);
 		}
 		return end();
 	}
 
-	template<typename value_type>
-	typename Vector<value_type>::Iterator Vector<value_type>::PushBack(const_reference data) {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::Iterator Vector<value_type, TGrowth>::PushBack(const_reference data) {
+		return EmplaceBack(data);
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::Iterator Vector<value_type, TGrowth>::PushBack(rvalue_reference data) {
+		return EmplaceBack(std::forward<value_type>(data));
+	}
+
+	template<typename value_type, typename TGrowth>
+	template<typename... Args>
+	typename Vector<value_type, TGrowth>::Iterator Vector<value_type, TGrowth>::EmplaceBack(Args&&... args) {
 		if (_size == _capacity) {
-			size_type increment = std::max(_incrementFunctor(_capacity), size_type(1));
-			Reserve(_capacity + increment);
+			Reserve(GrowthHolder::GrowCapacity(_capacity, sizeof(value_type)));
 		}
-		new (_data + _size) value_type(data);
+		new (_data + _size) value_type(std::forward<Args>(args)...);
 		++_size;
 		return Iterator(*this, _size - 1);
 	}
 
-	template<typename value_type>
-	typename Vector<value_type>::Iterator Vector<value_type>::PushBack(rvalue_reference data) {
-		if (_size == _capacity) {
-			size_type increment = std::max(_incrementFunctor(_capacity), size_type(1));
-			Reserve(_capacity + increment);
+	template<typename value_type, typename TGrowth>
+	template<typename InputIterator>
+	typename Vector<value_type, TGrowth>::Iterator Vector<value_type, TGrowth>::Insert(const Iterator& position, InputIterator first, InputIterator last) {
+#if defined(USE_CHECKED_ITERATORS) && defined(USE_EXCEPTIONS)
+		if (position._container == nullptr || position._container != this) throw std::runtime_error("Given iterator is not associated with this container.");
+#endif // USE_CHECKED_ITERATORS && USE_EXCEPTIONS
+
+		size_type index = IndexOf(position);
+		assert(index <= _size);
+
+		//a single pass range can't be measured or read twice, so buffer it first
+		if constexpr (!std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>) {
+			Vector items(size_type(0), TGrowth{}, _resource);
+			for (; first != last; ++first) {
+				items.EmplaceBack(*first);
+			}
+			return MoveInsert(index, items);
+		}
+		else if constexpr (IsTriviallyRelocatableV<value_type>) {
+			size_type count = gsl::narrow_cast<size_type>(std::distance(first, last));
+			if (count == 0) return Iterator(*this, index);
+
+			if (_size + count > _capacity) {
+				Reserve(std::max(_size + count, GrowthHolder::GrowCapacity(_capacity, sizeof(value_type))));
+			}
+
+			//open the gap bitwise, and close it again if an item fails to construct
+			const size_type tailSize = _size - index;
+			RelocateBytes(_data + index + count, _data + index, tailSize);
+			size_type constructed = 0;
+			try {
+				for (; first != last; ++first, ++constructed) {
+					new (_data + index + constructed) value_type(*first);
+				}
+			}
+			catch (...) {
+				for (size_type i = 0; i < constructed; ++i) {
+					_data[index + i].~value_type();
+				}
+				RelocateBytes(_data + index, _data + index + count, tailSize);
+				throw;
+			}
+			_size += count;
+			return Iterator(*this, index);
+		}
+		else {
+			//build the items in separate storage first, so a throwing constructor never leaves the elements shifted
+			Vector items(gsl::narrow_cast<size_type>(std::distance(first, last)), TGrowth{}, _resource);
+			for (; first != last; ++first) {
+				items.EmplaceBack(*first);
+			}
+			return MoveInsert(index, items);
 		}
-		new (_data + _size) value_type(std::forward<value_type>(data));
-		++_size;
-		return Iterator(*this, _size - 1);
 	}
 
-	template<typename value_type>
+	template<typename value_type, typename TGrowth>
+	typename Vector<value_type, TGrowth>::Iterator Vector<value_type, TGrowth>::MoveInsert(size_type index, Vector& items) {
+		assert(index <= _size && &items != this);
+		size_type count = items._size;
+		if (count == 0) return Iterator(*this, index);
+
+		if (_size + count > _capacity) {
+			Reserve(std::max(_size + count, GrowthHolder::GrowCapacity(_capacity, sizeof(value_type))));
+		}
+
+		if constexpr (IsTriviallyRelocatableV<value_type>) {
+			RelocateBytes(_data + index + count, _data + index, _size - index);
+			RelocateBytes(_data + index, items._data, count);
+			items._size = 0;
+		}
+		else {
+			for (size_type i = _size; i > index; --i) {
+				new (_data + i - 1 + count) value_type(std::move(_data[i - 1]));
+				_data[i - 1].~value_type();
+			}
+			for (size_type i = 0; i < count; ++i) {
+				new (_data + index + i) value_type(std::move(items._data[i]));
+			}
+			items.Clear();
+		}
+		_size += count;
+		return Iterator(*this, index);
+	}
+
+	template<typename value_type, typename TGrowth>
+	template<typename Range>
+	inline typename Vector<value_type, TGrowth>::Iterator Vector<value_type, TGrowth>::Append(Range&& range) {
+		if constexpr (std::is_lvalue_reference_v<Range>) {
+			return Insert(end(), std::begin(range), std::end(range));
+		}
+		else {
+			return Insert(end(), std::make_move_iterator(std::begin(range)), std::make_move_iterator(std::end(range)));
+		}
+	}
+
+	template<typename value_type, typename TGrowth>
 	template<typename EqualityFunctor>
-	inline bool Vector<value_type>::Remove(const_reference data, EqualityFunctor equalityFunctor) {
+	inline bool Vector<value_type, TGrowth>::Remove(const_reference data, EqualityFunctor equalityFunctor) {
 		return Remove(Find(data, equalityFunctor));
 	}
 
-	template<typename value_type>
-	inline bool Vector<value_type>::Remove(const Iterator& iter) {
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::Remove(const Iterator& iter) {
 		return Remove(iter, iter + 1);
 	}
 
-	template<typename value_type>
-	inline bool Vector<value_type>::Remove(const Iterator& iterFirst, const Iterator& iterLast) {
-#ifdef USE_EXCEPTIONS
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::Remove(const Iterator& iterFirst, const Iterator& iterLast) {
+#if defined(USE_CHECKED_ITERATORS) && defined(USE_EXCEPTIONS)
 		if (iterFirst._container == nullptr || iterFirst._container != this) throw std::runtime_error("Given iterator(s) are not associated with this container.");
 		if (iterFirst._container != iterLast._container) throw std::runtime_error("Given iterators do not refer to the same container.");
-#endif // USE_EXCEPTIONS
+#endif // USE_CHECKED_ITERATORS && USE_EXCEPTIONS
 
-		if (_size == 0 || iterFirst._index < 0 || iterLast._index <= iterFirst._index || iterLast._index > _size) return false;
+		size_type first = IndexOf(iterFirst);
+		size_type last = IndexOf(iterLast);
+		if (_size == 0 || last <= first || last > _size) return false;
 
-		size_type shiftAmount = (end() - iterLast);
-		for (size_type i = iterFirst._index; i < iterLast._index; ++i) {
+		size_type shiftAmount = (_size - last);
+		for (size_type i = first; i < last; ++i) {
 			_data[i].~value_type();
 			--_size;
 		}
+
+		if constexpr (IsTriviallyRelocatableV<value_type>) {
 #ifdef _WINDOWS
-		memmove_s(&_data[iterFirst._index], (shiftAmount) * sizeof(value_type), &_data[iterLast._index], (shiftAmount) * sizeof(value_type));
+			memmove_s(&_data[first], (shiftAmount) * sizeof(value_type), &_data[last], (shiftAmount) * sizeof(value_type));
 #else
-		memmove(&_data[iterFirst._index], &_data[iterLast._index], (shiftAmount) * sizeof(value_type));
+			memmove(&_data[first], &_data[last], (shiftAmount) * sizeof(value_type));
 #endif
+		}
+		else {
+			for (size_type i = 0; i < shiftAmount; ++i) {
+				new (_data + first + i) value_type(std::move(_data[last + i]));
+				_data[last + i].~value_type();
+			}
+		}
 
 		return true;
 	}
 
-	template<typename value_type>
-	inline void Vector<value_type>::PopBack() {
+	template<typename value_type, typename TGrowth>
+	template<typename Predicate>
+	typename Vector<value_type, TGrowth>::size_type Vector<value_type, TGrowth>::RemoveIf(Predicate predicate) {
+		auto keep = [this](size_type from, size_type to) {
+			if (from == to) return;
+			if constexpr (IsTriviallyRelocatableV<value_type>) {
+				memcpy(static_cast<void*>(_data + to), _data + from, sizeof(value_type));
+			}
+			else {
+				new (_data + to) value_type(std::move(_data[from]));
+				_data[from].~value_type();
+			}
+		};
+
+		size_type kept = 0;
+		size_type i = 0;
+		try {
+			for (; i < _size; ++i) {
+				if (predicate(_data[i])) {
+					_data[i].~value_type();
+				}
+				else {
+					keep(i, kept++);
+				}
+			}
+		}
+		catch (...) {
+			//keep the element the predicate threw on and every one after it, so the size only covers live elements
+			for (; i < _size; ++i) {
+				keep(i, kept++);
+			}
+			_size = kept;
+			throw;
+		}
+
+		size_type removed = _size - kept;
+		_size = kept;
+		return removed;
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline void Vector<value_type, TGrowth>::PopBack() {
 #ifdef USE_EXCEPTIONS
 		if (_size == 0) throw std::runtime_error("Vector is empty.");
 #endif // USE_EXCEPTIONS
@@ -306,15 +543,16 @@ namespace FIEAGameEngine {
 	}
 #pragma endregion Vector
 
+#ifdef USE_CHECKED_ITERATORS
 #pragma region Iterator
-	template<typename value_type>
-	Vector<value_type>::Iterator::Iterator(Vector& container, size_type index) :
+	template<typename value_type, typename TGrowth>
+	Vector<value_type, TGrowth>::Iterator::Iterator(Vector& container, size_type index) :
 		_container{ &container }, _index{ index }
 	{
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::reference Vector<value_type>::Iterator::operator*() const {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::reference Vector<value_type, TGrowth>::Iterator::operator*() const {
 #ifdef USE_EXCEPTIONS
 		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
 		if (_index >= _container->Size()) throw std::runtime_error("Iterator's data is equal to end, cannot be dereferenced.");
@@ -322,8 +560,8 @@ namespace FIEAGameEngine {
 		return _container->_data[_index];
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::Iterator& Vector<value_type>::Iterator::operator++() {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::Iterator& Vector<value_type, TGrowth>::Iterator::operator++() {
 #ifdef USE_EXCEPTIONS
 		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
 #endif // USE_EXCEPTIONS
@@ -337,15 +575,15 @@ namespace FIEAGameEngine {
 		return *this;
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::Iterator Vector<value_type>::Iterator::operator++(int) {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::Iterator Vector<value_type, TGrowth>::Iterator::operator++(int) {
 		Iterator it = *this;
 		operator++();
 		return it;
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::Iterator& Vector<value_type>::Iterator::operator--() {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::Iterator& Vector<value_type, TGrowth>::Iterator::operator--() {
 #ifdef USE_EXCEPTIONS
 		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
 #endif // USE_EXCEPTIONS
@@ -359,23 +597,23 @@ namespace FIEAGameEngine {
 		return *this;
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::Iterator Vector<value_type>::Iterator::operator--(int) {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::Iterator Vector<value_type, TGrowth>::Iterator::operator--(int) {
 		Iterator it = *this;
 		operator--();
 		return it;
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::Iterator::difference_type Vector<value_type>::Iterator::operator-(const Vector<value_type>::Iterator& rhs) const {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::Iterator::difference_type Vector<value_type, TGrowth>::Iterator::operator-(const Vector<value_type, TGrowth>::Iterator& rhs) const {
 #ifdef USE_EXCEPTIONS
 		if (_container != rhs._container) throw std::runtime_error("Iterators are not associated with the same container.");
 #endif // USE_EXCEPTIONS
 		return (_index - rhs._index);
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::Iterator& Vector<value_type>::Iterator::operator+=(difference_type incrementAmount) {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::Iterator& Vector<value_type, TGrowth>::Iterator::operator+=(difference_type incrementAmount) {
 #ifdef USE_EXCEPTIONS
 		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
 #endif // USE_EXCEPTIONS
@@ -390,13 +628,13 @@ namespace FIEAGameEngine {
 		return *this;
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::Iterator& Vector<value_type>::Iterator::operator-=(difference_type decrementAmount) {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::Iterator& Vector<value_type, TGrowth>::Iterator::operator-=(difference_type decrementAmount) {
 		return *this += (-decrementAmount);
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::reference Vector<value_type>::Iterator::operator[](difference_type index) {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::reference Vector<value_type, TGrowth>::Iterator::operator[](difference_type index) {
 #ifdef USE_EXCEPTIONS
 		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
 #endif // USE_EXCEPTIONS
@@ -405,52 +643,52 @@ namespace FIEAGameEngine {
 		return _container->operator[](_index);
 	}
 
-	template<typename value_type>
-	inline bool Vector<value_type>::Iterator::operator!=(const Iterator& rhs) const {
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::Iterator::operator!=(const Iterator& rhs) const {
 		return (_container != rhs._container || _index != rhs._index);
 	}
 
-	template<typename value_type>
-	inline bool Vector<value_type>::Iterator::operator==(const Iterator& rhs) const {
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::Iterator::operator==(const Iterator& rhs) const {
 		return !(operator!=(rhs));
 	}
 
-	template<typename value_type>
-	inline bool Vector<value_type>::Iterator::operator<=(const Iterator& rhs) const {
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::Iterator::operator<=(const Iterator& rhs) const {
 		return (_index <= rhs._index && _container == rhs._container);
 	}
 
-	template<typename value_type>
-	inline bool Vector<value_type>::Iterator::operator>=(const Iterator& rhs) const {
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::Iterator::operator>=(const Iterator& rhs) const {
 		return (_index >= rhs._index && _container == rhs._container);
 	}
 
-	template<typename value_type>
-	inline bool Vector<value_type>::Iterator::operator<(const Iterator& rhs) const {
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::Iterator::operator<(const Iterator& rhs) const {
 		return (_index < rhs._index && _container == rhs._container);
 	}
 
-	template<typename value_type>
-	inline bool Vector<value_type>::Iterator::operator>(const Iterator& rhs) const {
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::Iterator::operator>(const Iterator& rhs) const {
 		return (_index > rhs._index && _container == rhs._container);
 	}
 #pragma endregion Iterator
 
 #pragma region ConstIterator
-	template<typename value_type>
-	Vector<value_type>::ConstIterator::ConstIterator(const Vector& container, size_type index) :
+	template<typename value_type, typename TGrowth>
+	Vector<value_type, TGrowth>::ConstIterator::ConstIterator(const Vector& container, size_type index) :
 		_container{ &container }, _index{ index }
 	{
 	}
 
-	template<typename value_type>
-	Vector<value_type>::ConstIterator::ConstIterator(const Iterator& other) :
+	template<typename value_type, typename TGrowth>
+	Vector<value_type, TGrowth>::ConstIterator::ConstIterator(const Iterator& other) :
 		_container(other._container), _index(other._index)
 	{
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::const_reference Vector<value_type>::ConstIterator::operator*() const {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::const_reference Vector<value_type, TGrowth>::ConstIterator::operator*() const {
 #ifdef USE_EXCEPTIONS
 		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
 		if (_index >= _container->Size()) throw std::runtime_error("Iterator's data is equal to end, cannot be dereferenced.");
@@ -458,8 +696,8 @@ namespace FIEAGameEngine {
 		return _container->_data[_index];
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::ConstIterator& Vector<value_type>::ConstIterator::operator++() {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::ConstIterator& Vector<value_type, TGrowth>::ConstIterator::operator++() {
 #ifdef USE_EXCEPTIONS
 		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
 #endif // USE_EXCEPTIONS
@@ -473,15 +711,15 @@ namespace FIEAGameEngine {
 		return *this;
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::ConstIterator Vector<value_type>::ConstIterator::operator++(int) {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::ConstIterator Vector<value_type, TGrowth>::ConstIterator::operator++(int) {
 		ConstIterator it = *this;
 		operator++();
 		return it;
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::ConstIterator& Vector<value_type>::ConstIterator::operator--() {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::ConstIterator& Vector<value_type, TGrowth>::ConstIterator::operator--() {
 #ifdef USE_EXCEPTIONS
 		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
 #endif // USE_EXCEPTIONS
@@ -495,23 +733,23 @@ namespace FIEAGameEngine {
 		return *this;
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::ConstIterator Vector<value_type>::ConstIterator::operator--(int) {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::ConstIterator Vector<value_type, TGrowth>::ConstIterator::operator--(int) {
 		ConstIterator it = *this;
 		operator--();
 		return it;
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::ConstIterator::difference_type Vector<value_type>::ConstIterator::operator-(const Vector<value_type>::ConstIterator& rhs) const {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::ConstIterator::difference_type Vector<value_type, TGrowth>::ConstIterator::operator-(const Vector<value_type, TGrowth>::ConstIterator& rhs) const {
 #ifdef USE_EXCEPTIONS
 		if (_container != rhs._container) throw std::runtime_error("Iterators are not associated with the same container.");
 #endif // USE_EXCEPTIONS
 		return (_index - rhs._index);
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::ConstIterator& Vector<value_type>::ConstIterator::operator+=(difference_type incrementAmount) {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::ConstIterator& Vector<value_type, TGrowth>::ConstIterator::operator+=(difference_type incrementAmount) {
 #ifdef USE_EXCEPTIONS
 		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
 #endif // USE_EXCEPTIONS
@@ -526,13 +764,13 @@ namespace FIEAGameEngine {
 		return *this;
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::ConstIterator& Vector<value_type>::ConstIterator::operator-=(difference_type decrementAmount) {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::ConstIterator& Vector<value_type, TGrowth>::ConstIterator::operator-=(difference_type decrementAmount) {
 		return *this += (-decrementAmount);
 	}
 
-	template<typename value_type>
-	inline typename Vector<value_type>::const_reference Vector<value_type>::ConstIterator::operator[](difference_type index) {
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::const_reference Vector<value_type, TGrowth>::ConstIterator::operator[](difference_type index) {
 #ifdef USE_EXCEPTIONS
 		if (_container == nullptr) throw std::runtime_error("Iterator is not associated with a container.");
 #endif // USE_EXCEPTIONS
@@ -541,36 +779,237 @@ namespace FIEAGameEngine {
 		return _container->operator[](_index);
 	}
 
-	template<typename value_type>
-	inline bool Vector<value_type>::ConstIterator::operator!=(const ConstIterator& rhs) const {
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::ConstIterator::operator!=(const ConstIterator& rhs) const {
 		return (_container != rhs._container || _index != rhs._index);
 	}
 
-	template<typename value_type>
-	inline bool Vector<value_type>::ConstIterator::operator==(const ConstIterator& rhs) const {
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::ConstIterator::operator==(const ConstIterator& rhs) const {
 		return !(operator!=(rhs));
 	}
 
-	template<typename value_type>
-	inline bool Vector<value_type>::ConstIterator::operator<=(const ConstIterator& rhs) const {
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::ConstIterator::operator<=(const ConstIterator& rhs) const {
 		return (_index <= rhs._index && _container == rhs._container);
 	}
 
-	template<typename value_type>
-	inline bool Vector<value_type>::ConstIterator::operator>=(const ConstIterator& rhs) const {
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::ConstIterator::operator>=(const ConstIterator& rhs) const {
 		return (_index >= rhs._index && _container == rhs._container);
 	}
 
-	template<typename value_type>
-	inline bool Vector<value_type>::ConstIterator::operator<(const ConstIterator& rhs) const {
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::ConstIterator::operator<(const ConstIterator& rhs) const {
 		return (_index < rhs._index && _container == rhs._container);
 	}
 
-	template<typename value_type>
-	inline bool Vector<value_type>::ConstIterator::operator>(const ConstIterator& rhs) const {
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::ConstIterator::operator>(const ConstIterator& rhs) const {
 		return (_index > rhs._index && _container == rhs._container);
 	}
 #pragma endregion ConstIterator
+#else
+#pragma region Iterator
+	template<typename value_type, typename TGrowth>
+	inline Vector<value_type, TGrowth>::Iterator::Iterator(Vector& container, size_type index) :
+		_current{ container._data + index }
+	{
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline Vector<value_type, TGrowth>::Iterator::Iterator(pointer current) :
+		_current{ current }
+	{
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::reference Vector<value_type, TGrowth>::Iterator::operator*() const {
+		return *_current;
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::Iterator& Vector<value_type, TGrowth>::Iterator::operator++() {
+		++_current;
+		return *this;
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::Iterator Vector<value_type, TGrowth>::Iterator::operator++(int) {
+		Iterator it = *this;
+		++_current;
+		return it;
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::Iterator& Vector<value_type, TGrowth>::Iterator::operator--() {
+		--_current;
+		return *this;
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::Iterator Vector<value_type, TGrowth>::Iterator::operator--(int) {
+		Iterator it = *this;
+		--_current;
+		return it;
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::Iterator::difference_type Vector<value_type, TGrowth>::Iterator::operator-(const Vector<value_type, TGrowth>::Iterator& rhs) const {
+		return (_current - rhs._current);
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::Iterator& Vector<value_type, TGrowth>::Iterator::operator+=(difference_type incrementAmount) {
+		_current += incrementAmount;
+		return *this;
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::Iterator& Vector<value_type, TGrowth>::Iterator::operator-=(difference_type decrementAmount) {
+		_current -= decrementAmount;
+		return *this;
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::reference Vector<value_type, TGrowth>::Iterator::operator[](difference_type index) {
+		return _current[index];
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::Iterator::operator!=(const Iterator& rhs) const {
+		return (_current != rhs._current);
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::Iterator::operator==(const Iterator& rhs) const {
+		return (_current == rhs._current);
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::Iterator::operator<=(const Iterator& rhs) const {
+		return (_current <= rhs._current);
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::Iterator::operator>=(const Iterator& rhs) const {
+		return (_current >= rhs._current);
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::Iterator::operator<(const Iterator& rhs) const {
+		return (_current < rhs._current);
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::Iterator::operator>(const Iterator& rhs) const {
+		return (_current > rhs._current);
+	}
+#pragma endregion Iterator
+
+#pragma region ConstIterator
+	template<typename value_type, typename TGrowth>
+	inline Vector<value_type, TGrowth>::ConstIterator::ConstIterator(const Vector& container, size_type index) :
+		_current{ container._data + index }
+	{
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline Vector<value_type, TGrowth>::ConstIterator::ConstIterator(const value_type* current) :
+		_current{ current }
+	{
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline Vector<value_type, TGrowth>::ConstIterator::ConstIterator(const Iterator& other) :
+		_current{ other._current }
+	{
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::const_reference Vector<value_type, TGrowth>::ConstIterator::operator*() const {
+		return *_current;
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::ConstIterator& Vector<value_type, TGrowth>::ConstIterator::operator++() {
+		++_current;
+		return *this;
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::ConstIterator Vector<value_type, TGrowth>::ConstIterator::operator++(int) {
+		ConstIterator it = *this;
+		++_current;
+		return it;
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::ConstIterator& Vector<value_type, TGrowth>::ConstIterator::operator--() {
+		--_current;
+		return *this;
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::ConstIterator Vector<value_type, TGrowth>::ConstIterator::operator--(int) {
+		ConstIterator it = *this;
+		--_current;
+		return it;
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::ConstIterator::difference_type Vector<value_type, TGrowth>::ConstIterator::operator-(const Vector<value_type, TGrowth>::ConstIterator& rhs) const {
+		return (_current - rhs._current);
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::ConstIterator& Vector<value_type, TGrowth>::ConstIterator::operator+=(difference_type incrementAmount) {
+		_current += incrementAmount;
+		return *this;
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::ConstIterator& Vector<value_type, TGrowth>::ConstIterator::operator-=(difference_type decrementAmount) {
+		_current -= decrementAmount;
+		return *this;
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline typename Vector<value_type, TGrowth>::const_reference Vector<value_type, TGrowth>::ConstIterator::operator[](difference_type index) {
+		return _current[index];
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::ConstIterator::operator!=(const ConstIterator& rhs) const {
+		return (_current != rhs._current);
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::ConstIterator::operator==(const ConstIterator& rhs) const {
+		return (_current == rhs._current);
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::ConstIterator::operator<=(const ConstIterator& rhs) const {
+		return (_current <= rhs._current);
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::ConstIterator::operator>=(const ConstIterator& rhs) const {
+		return (_current >= rhs._current);
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::ConstIterator::operator<(const ConstIterator& rhs) const {
+		return (_current < rhs._current);
+	}
+
+	template<typename value_type, typename TGrowth>
+	inline bool Vector<value_type, TGrowth>::ConstIterator::operator>(const ConstIterator& rhs) const {
+		return (_current > rhs._current);
+	}
+#pragma endregion ConstIterator
+#endif // USE_CHECKED_ITERATORS
 
 }
 